@@ -4,6 +4,7 @@
 #include "Utility/FileSystemUtil.h"
 #include <filesystem>
 #include <cstdlib>
+#include <stdexcept>
 #include <iostream> // Only for --help output (before logging init)
 
 namespace fs = std::filesystem;
@@ -26,6 +27,12 @@ struct CommandLineArgs
     bool showVersion = false;
     bool vsyncOverride = false;
     bool vsyncEnabled = true;
+    std::string recordInputPath;
+    std::string replayInputPath;
+    bool headless = false;
+    bool offscreen = false;
+    std::string device;
+    uint64_t maxFrames = 0;
 };
 
 // NOTE: PrintUsage and PrintVersion use std::cout because they're called
@@ -39,6 +46,12 @@ void PrintUsage(const char* exeName)
         << "  --version, -v       Show version information\n"
         << "  --config PATH       Specify config file (default: ./Data/config.toml)\n"
         << "  --vsync on|off      Override VSync setting (default: on)\n"
+        << "  --record-input PATH Record all window input to a replay file\n"
+        << "  --replay-input PATH Drive window input from a recorded replay file\n"
+        << "  --headless          Run without a display (simulated windows, no renderer)\n"
+        << "  --offscreen         Render to offscreen images (also with --headless)\n"
+        << "  --device NAME       Prefer the GPU whose name contains NAME (e.g. llvmpipe)\n"
+        << "  --max-frames N      Exit after N running frames (0 = until closed)\n"
         << "\n"
         << "Arguments:\n"
         << "  PROJECT_FILE        Path to .solarcproj file to open on startup\n\n"
@@ -46,6 +59,8 @@ void PrintUsage(const char* exeName)
         << "  " << exeName << "                         # Start without project\n"
         << "  " << exeName << " --config custom.toml    # Use custom config\n"
         << "  " << exeName << " --vsync off             # Disable VSync\n"
+        << "  " << exeName << " --headless --max-frames 600 # CI / benchmark run\n"
+        << "  " << exeName << " --headless --offscreen --device llvmpipe # CPU-rendered CI run\n"
         << "  " << exeName << " myproject.solarcproj    # Open specific project\n";
 }
 
@@ -118,6 +133,62 @@ bool ParseCommandLine(int argc, char** argv, CommandLineArgs& args, std::string&
                 return false;
             }
         }
+        else if (arg == "--record-input")
+        {
+            if (++i >= argc)
+            {
+                errorMsg = "Error: --record-input requires a path argument";
+                return false;
+            }
+            args.recordInputPath = argv[i];
+        }
+        else if (arg == "--replay-input")
+        {
+            if (++i >= argc)
+            {
+                errorMsg = "Error: --replay-input requires a path argument";
+                return false;
+            }
+            args.replayInputPath = argv[i];
+        }
+        else if (arg == "--headless")
+        {
+            args.headless = true;
+        }
+        else if (arg == "--offscreen")
+        {
+            args.offscreen = true;
+        }
+        else if (arg == "--device")
+        {
+            if (++i >= argc)
+            {
+                errorMsg = "Error: --device requires a device name";
+                return false;
+            }
+            args.device = argv[i];
+        }
+        else if (arg == "--max-frames")
+        {
+            if (++i >= argc)
+            {
+                errorMsg = "Error: --max-frames requires a frame count";
+                return false;
+            }
+
+            try
+            {
+                size_t parsed = 0;
+                args.maxFrames = std::stoull(argv[i], &parsed);
+                if (parsed != std::string(argv[i]).size())
+                    throw std::invalid_argument(argv[i]);
+            }
+            catch (const std::exception&)
+            {
+                errorMsg = "Error: --max-frames must be a non-negative integer";
+                return false;
+            }
+        }
         else if (arg.starts_with("--"))
         {
             errorMsg = "Error: Unknown option '" + arg + "'";
@@ -272,6 +343,34 @@ int main(int argc, char** argv)
             app.SetVSyncPreference(args.vsyncEnabled);
         }
 
+        // Headless only overrides the config when requested on the command line
+        if (args.headless)
+        {
+            app.SetHeadlessPreference(true);
+        }
+
+        if (args.offscreen)
+        {
+            app.SetOffscreenPreference(true);
+        }
+
+        if (!args.device.empty())
+        {
+            app.SetDevicePreference(args.device);
+        }
+
+        app.SetFrameLimit(args.maxFrames);
+
+        // Recording and replay start once the window context exists (INITIALIZE state)
+        if (!args.recordInputPath.empty())
+        {
+            app.SetInputRecordingPath(args.recordInputPath);
+        }
+        if (!args.replayInputPath.empty())
+        {
+            app.SetInputReplayPath(args.replayInputPath);
+        }
+
         // Run the application
         SOLARC_INFO("Starting main application loop...");
         app.Run();
@@ -7,6 +7,7 @@ ${${PROJECT_NAME}_SRC_DIR}/SolarcApp.cpp
 
 ${${PROJECT_NAME}_SRC_DIR}/Window/Window.cpp
 ${${PROJECT_NAME}_SRC_DIR}/Window/WindowContext.cpp
+${${PROJECT_NAME}_SRC_DIR}/Window/ReplayWindowPlatform.cpp
 
 ${${PROJECT_NAME}_SRC_DIR}/Window/Platform/Windows/WindowsWindowPlatform.cpp
 ${${PROJECT_NAME}_SRC_DIR}/Window/Platform/Windows/WindowsWindowContextPlatform.cpp
@@ -14,15 +15,24 @@ ${${PROJECT_NAME}_SRC_DIR}/Window/Platform/Windows/WindowsWindowContextPlatform.
 ${${PROJECT_NAME}_SRC_DIR}/Window/Platform/Linux/WaylandWindowPlatform.cpp
 ${${PROJECT_NAME}_SRC_DIR}/Window/Platform/Linux/WaylandWindowContextPlatform.cpp
 
+${${PROJECT_NAME}_SRC_DIR}/Window/Platform/Headless/HeadlessWindowPlatform.cpp
+
 
 ${${PROJECT_NAME}_SRC_DIR}/Event/Event.cpp
 ${${PROJECT_NAME}_SRC_DIR}/Event/WindowEvent.cpp
 
 ${${PROJECT_NAME}_SRC_DIR}/Input/KeyCode.cpp
 ${${PROJECT_NAME}_SRC_DIR}/Input/KeyMapping.cpp
+${${PROJECT_NAME}_SRC_DIR}/Input/InputActionMap.cpp
+${${PROJECT_NAME}_SRC_DIR}/Input/InputRecording.cpp
+${${PROJECT_NAME}_SRC_DIR}/Input/Platform/Linux/XkbKeymap.cpp
 
 ${${PROJECT_NAME}_SRC_DIR}/Utility/CompileTimeUtil.cpp
 ${${PROJECT_NAME}_SRC_DIR}/Utility/FileSystemUtil.cpp
+${${PROJECT_NAME}_SRC_DIR}/Utility/FramePacer.cpp
+${${PROJECT_NAME}_SRC_DIR}/Utility/FrameTimer.cpp
+${${PROJECT_NAME}_SRC_DIR}/Utility/PresentTimingModel.cpp
+${${PROJECT_NAME}_SRC_DIR}/Utility/TLSFAllocator.cpp
 
 ${${PROJECT_NAME}_SRC_DIR}/MT/JobHandle.cpp
 ${${PROJECT_NAME}_SRC_DIR}/MT/JobSystem.cpp
@@ -30,6 +40,11 @@ ${${PROJECT_NAME}_SRC_DIR}/MT/JobSystem.cpp
 ${${PROJECT_NAME}_SRC_DIR}/Logging/Log.cpp
 
 ${${PROJECT_NAME}_SRC_DIR}/Rendering/RHI/RHI.cpp
+${${PROJECT_NAME}_SRC_DIR}/Rendering/RHI/GPUAllocator.cpp
+${${PROJECT_NAME}_SRC_DIR}/Rendering/RHI/UploadRing.cpp
+${${PROJECT_NAME}_SRC_DIR}/Rendering/RHI/PipelineCache.cpp
+${${PROJECT_NAME}_SRC_DIR}/Rendering/RHI/PipelineCompileQueue.cpp
+${${PROJECT_NAME}_SRC_DIR}/Rendering/RHI/DescriptorHeap.cpp
 
 ${${PROJECT_NAME}_SRC_DIR}/Rendering/RHI/Platform/DX12/DX12Device.h
 ${${PROJECT_NAME}_SRC_DIR}/Rendering/RHI/Platform/DX12/DX12Device.cpp
@@ -41,9 +56,19 @@ ${${PROJECT_NAME}_SRC_DIR}/Rendering/RHI/Platform/DX12/DX12CommandContext.cpp
 ${${PROJECT_NAME}_SRC_DIR}/Rendering/RHI/Platform/Vulkan/VulkanDevice.cpp
 ${${PROJECT_NAME}_SRC_DIR}/Rendering/RHI/Platform/Vulkan/VulkanDevice.h
 ${${PROJECT_NAME}_SRC_DIR}/Rendering/RHI/Platform/Vulkan/VulkanSwapchain.cpp
+${${PROJECT_NAME}_SRC_DIR}/Rendering/RHI/Platform/Vulkan/VulkanSwapchainOffscreen.cpp
 ${${PROJECT_NAME}_SRC_DIR}/Rendering/RHI/Platform/Vulkan/VulkanSwapchain.h
 ${${PROJECT_NAME}_SRC_DIR}/Rendering/RHI/Platform/Vulkan/VulkanCommandContext.cpp
 ${${PROJECT_NAME}_SRC_DIR}/Rendering/RHI/Platform/Vulkan/VulkanCommandContext.h
+${${PROJECT_NAME}_SRC_DIR}/Rendering/RHI/Platform/Vulkan/VulkanMemoryBackend.cpp
+${${PROJECT_NAME}_SRC_DIR}/Rendering/RHI/Platform/Vulkan/VulkanMemoryBackend.h
+${${PROJECT_NAME}_SRC_DIR}/Rendering/RHI/Platform/Vulkan/VulkanPipelineCache.cpp
+${${PROJECT_NAME}_SRC_DIR}/Rendering/RHI/Platform/Vulkan/VulkanPipelineCache.h
+${${PROJECT_NAME}_SRC_DIR}/Rendering/RHI/Platform/Vulkan/VulkanDescriptorHeap.cpp
+${${PROJECT_NAME}_SRC_DIR}/Rendering/RHI/Platform/Vulkan/VulkanDescriptorHeap.h
+
+${${PROJECT_NAME}_SRC_DIR}/Rendering/RenderGraph/RenderGraph.cpp
+${${PROJECT_NAME}_SRC_DIR}/Rendering/RenderGraph/RenderGraphExecute.cpp
 
 )
 
@@ -54,7 +79,10 @@ ${${PROJECT_NAME}_INC_DIR}/SolarcApp.h
 ${${PROJECT_NAME}_INC_DIR}/Window/Window.h
 ${${PROJECT_NAME}_INC_DIR}/Window/WindowContext.h
 ${${PROJECT_NAME}_INC_DIR}/Window/WindowPlatform.h
+${${PROJECT_NAME}_INC_DIR}/Window/WindowState.h
+${${PROJECT_NAME}_INC_DIR}/Window/SurfaceScale.h
 ${${PROJECT_NAME}_INC_DIR}/Window/WindowContextPlatform.h
+${${PROJECT_NAME}_INC_DIR}/Window/ReplayWindowPlatform.h
 
 
 ${${PROJECT_NAME}_INC_DIR}/Event/Event.h
@@ -71,21 +99,39 @@ ${${PROJECT_NAME}_INC_DIR}/Event/EventProducer.h
 ${${PROJECT_NAME}_INC_DIR}/Input/KeyCode.h
 ${${PROJECT_NAME}_INC_DIR}/Input/MouseButton.h
 ${${PROJECT_NAME}_INC_DIR}/Input/InputState.h
+${${PROJECT_NAME}_INC_DIR}/Input/KeyBitset.h
+${${PROJECT_NAME}_INC_DIR}/Input/InputTimestamp.h
+${${PROJECT_NAME}_INC_DIR}/Input/CursorMode.h
 ${${PROJECT_NAME}_INC_DIR}/Input/InputFrame.h
 ${${PROJECT_NAME}_INC_DIR}/Input/KeyMapping.h
+${${PROJECT_NAME}_INC_DIR}/Input/InputAction.h
+${${PROJECT_NAME}_INC_DIR}/Input/InputActionMap.h
+${${PROJECT_NAME}_INC_DIR}/Input/InputRecording.h
+${${PROJECT_NAME}_INC_DIR}/Input/InputEventQueue.h
+${${PROJECT_NAME}_INC_DIR}/Input/KeyModifiers.h
+${${PROJECT_NAME}_INC_DIR}/Input/TextInput.h
+${${PROJECT_NAME}_INC_DIR}/Input/KeyRepeat.h
 ${${PROJECT_NAME}_INC_DIR}/Input/Platform/Windows/WindowsKeyMapping.h
 ${${PROJECT_NAME}_INC_DIR}/Input/Platform/Linux/WaylandKeyMapping.h
+${${PROJECT_NAME}_INC_DIR}/Input/Platform/Linux/XkbKeymap.h
 
 ${${PROJECT_NAME}_INC_DIR}/Preprocessor/API.h
 
 ${${PROJECT_NAME}_INC_DIR}/Utility/UUID.h
 ${${PROJECT_NAME}_INC_DIR}/Utility/CompileTimeUtil.h
 ${${PROJECT_NAME}_INC_DIR}/Utility/FileSystemUtil.h
+${${PROJECT_NAME}_INC_DIR}/Utility/FixedRingBuffer.h
+${${PROJECT_NAME}_INC_DIR}/Utility/FramePacer.h
+${${PROJECT_NAME}_INC_DIR}/Utility/FrameTimer.h
+${${PROJECT_NAME}_INC_DIR}/Utility/PresentTimingModel.h
+${${PROJECT_NAME}_INC_DIR}/Utility/SlotMap.h
+${${PROJECT_NAME}_INC_DIR}/Utility/TLSFAllocator.h
 
 ${${PROJECT_NAME}_INC_DIR}/MT/JobHandle.h
 ${${PROJECT_NAME}_INC_DIR}/MT/Job.h
 ${${PROJECT_NAME}_INC_DIR}/MT/JobSystem.h
 ${${PROJECT_NAME}_INC_DIR}/MT/ThreadSafeQueue.h
+${${PROJECT_NAME}_INC_DIR}/MT/SPSCQueue.h
 ${${PROJECT_NAME}_INC_DIR}/MT/ThreadChecker.h
 
 ${${PROJECT_NAME}_INC_DIR}/Logging/Log.h
@@ -93,6 +139,14 @@ ${${PROJECT_NAME}_INC_DIR}/Logging/LogMacros.h
 ${${PROJECT_NAME}_INC_DIR}/Logging/Log.h
 
 ${${PROJECT_NAME}_INC_DIR}/Rendering/RHI/RHI.h
+${${PROJECT_NAME}_INC_DIR}/Rendering/RHI/RHIDesc.h
 ${${PROJECT_NAME}_INC_DIR}/Rendering/RHI/RHIResult.h
+${${PROJECT_NAME}_INC_DIR}/Rendering/RHI/GPUAllocator.h
+${${PROJECT_NAME}_INC_DIR}/Rendering/RHI/UploadRing.h
+${${PROJECT_NAME}_INC_DIR}/Rendering/RHI/PipelineCache.h
+${${PROJECT_NAME}_INC_DIR}/Rendering/RHI/PipelineCompileQueue.h
+${${PROJECT_NAME}_INC_DIR}/Rendering/RHI/DescriptorHeap.h
+
+${${PROJECT_NAME}_INC_DIR}/Rendering/RenderGraph/RenderGraph.h
 
 )
\ No newline at end of file
@@ -2,7 +2,9 @@
 #include "Event/WindowEvent.h"
 #include "Input/KeyCode.h"
 #include "Input/MouseButton.h"
+#include "Input/TextInput.h"
 #include <cstdint>
+#include <string_view>
 
 /**
  * ============================================================================
@@ -143,7 +145,8 @@ public:
         KEY_RELEASED,
         MOUSE_BUTTON_DOWN,
         MOUSE_BUTTON_UP,
-        MOUSE_WHEEL
+        MOUSE_WHEEL,
+        TEXT_INPUT
     };
 
     WindowInputEvent(TYPE t)
@@ -267,6 +270,43 @@ private:
     bool m_Alt;
 };
 
+/**
+ * Fired once per character typed into a focused window.
+ *
+ * Carries the text the keyboard layout produced (Shift, Caps Lock, AltGr
+ * and the active layout applied), so it is what text fields should use
+ * instead of mapping KeyPressedEvent key codes to characters. Key repeats
+ * produce repeated characters.
+ *
+ * Not fired for keys without text (arrows, Enter, Backspace, Escape) or
+ * for Ctrl/Alt shortcuts - handle those through KeyPressedEvent.
+ */
+class TextInputEvent : public WindowInputEvent
+{
+public:
+    explicit TextInputEvent(uint32_t codepoint)
+        : WindowInputEvent(WindowInputEvent::TYPE::TEXT_INPUT)
+        , m_Codepoint(codepoint)
+    {
+        m_UTF8Length = static_cast<uint8_t>(TextInput::EncodeUTF8(codepoint, m_UTF8));
+    }
+
+    /**
+     * Unicode code point of the typed character.
+     */
+    uint32_t GetCodepoint() const { return m_Codepoint; }
+
+    /**
+     * The character encoded as UTF-8 (1-4 bytes).
+     */
+    std::string_view GetUTF8() const { return std::string_view(m_UTF8, m_UTF8Length); }
+
+private:
+    uint32_t m_Codepoint;
+    char m_UTF8[4] = {};
+    uint8_t m_UTF8Length = 0;
+};
+
 // ============================================================================
 // Mouse Button Events
 // ============================================================================
@@ -0,0 +1,37 @@
+#pragma once
+#include <cstdint>
+#include <string_view>
+
+/**
+ * Cursor constraint mode for a window.
+ *
+ * - Normal:   Cursor moves freely and may leave the window.
+ * - Confined: Cursor is visible but cannot leave the window's client area.
+ * - Locked:   Cursor is hidden and pinned in place; only relative motion
+ *             (GetMouseDeltaX/Y) is reported. Intended for FPS-style camera
+ *             control.
+ *
+ * Platform mapping:
+ * - Wayland: zwp_pointer_constraints_v1 (confine_pointer / lock_pointer)
+ * - Win32:   ClipCursor + ShowCursor, raw input (WM_INPUT) while locked
+ *
+ * Constraints are only active while the window has pointer focus; they
+ * are re-applied automatically when focus returns.
+ */
+enum class CursorMode : uint8_t
+{
+    Normal = 0,
+    Confined,
+    Locked
+};
+
+inline std::string_view CursorModeToString(CursorMode mode)
+{
+    switch (mode)
+    {
+    case CursorMode::Normal:   return "Normal";
+    case CursorMode::Confined: return "Confined";
+    case CursorMode::Locked:   return "Locked";
+    }
+    return "Unknown";
+}
@@ -0,0 +1,105 @@
+#pragma once
+#include "Input/KeyCode.h"
+#include "Input/MouseButton.h"
+#include <array>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Identifiers and per-frame state for the input action layer.
+ *
+ * Actions are named, rebindable inputs ("Jump", "Fire") bound to one or
+ * more key / mouse button chords. Axes are continuous values built from a
+ * pair of actions or from mouse motion. Both are identified by a small
+ * dense index so that per-frame state fits in a few machine words and
+ * queries are a single bit test or array load.
+ *
+ * See InputActionMap for binding and evaluation.
+ */
+
+using InputActionId = uint8_t;
+using InputAxisId = uint8_t;
+
+/**
+ * Action state for all actions is one bit per action in a 64-bit mask.
+ */
+inline constexpr size_t MAX_INPUT_ACTIONS = 64;
+inline constexpr size_t MAX_INPUT_AXES = 16;
+
+inline constexpr InputActionId INVALID_INPUT_ACTION = 0xFF;
+inline constexpr InputAxisId INVALID_INPUT_AXIS = 0xFF;
+
+/**
+ * A key / mouse button chord. The binding is active while every listed
+ * key and button is held.
+ *
+ * Keys are stored as scancodes (the same index space as InputState) so
+ * evaluation never goes through KeyMapping.
+ *
+ * note: A chord does not exclude supersets - "S" is also active while
+ *       "LeftCtrl+S" is held.
+ */
+struct InputBinding
+{
+    static constexpr size_t MAX_CHORD_KEYS = 4;
+
+    std::array<uint16_t, MAX_CHORD_KEYS> scancodes{};
+    uint8_t keyCount = 0;
+    uint8_t mouseButtons = 0;  // Bitmask, see MouseButtonToBit()
+
+    bool IsEmpty() const { return keyCount == 0 && mouseButtons == 0; }
+};
+
+/**
+ * Source of an axis value.
+ *
+ * - Actions: +scale while the positive action is down, -scale while the
+ *            negative action is down (cancelling out when both are).
+ * - MouseX / MouseY: this frame's mouse delta times scale.
+ * - Wheel / WheelH:  this frame's wheel delta times scale.
+ */
+enum class InputAxisSource : uint8_t
+{
+    Actions = 0,
+    MouseX,
+    MouseY,
+    Wheel,
+    WheelH
+};
+
+/**
+ * Per-frame result of evaluating an InputActionMap.
+ *
+ * Bit N of each mask corresponds to InputActionId N.
+ */
+struct ActionState
+{
+    uint64_t down = 0;
+    uint64_t pressed = 0;   // Went down this frame
+    uint64_t released = 0;  // Went up this frame
+    std::array<float, MAX_INPUT_AXES> axes{};
+
+    bool IsDown(InputActionId id) const { return TestBit(down, id); }
+    bool WasPressed(InputActionId id) const { return TestBit(pressed, id); }
+    bool WasReleased(InputActionId id) const { return TestBit(released, id); }
+
+    float GetAxis(InputAxisId id) const
+    {
+        return id < MAX_INPUT_AXES ? axes[id] : 0.0f;
+    }
+
+    void Reset()
+    {
+        down = 0;
+        pressed = 0;
+        released = 0;
+        axes.fill(0.0f);
+    }
+
+private:
+    static bool TestBit(uint64_t mask, InputActionId id)
+    {
+        return id < MAX_INPUT_ACTIONS && ((mask >> id) & 1ull);
+    }
+};
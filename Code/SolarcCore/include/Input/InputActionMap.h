@@ -0,0 +1,152 @@
+#pragma once
+#include "Preprocessor/API.h"
+#include "Input/InputAction.h"
+#include "Input/InputState.h"
+#include "Input/KeyBitset.h"
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Named actions and axes bound to key / mouse chords, compiled into dense
+ * lookup tables for per-frame evaluation.
+ *
+ * Compiled tables:
+ * - m_KeyActionMask[scancode]:  actions that have a binding using that key
+ * - m_ButtonActionMask[button]: actions that have a binding using that button
+ *
+ * Evaluation makes one pass over the keys and buttons that changed this
+ * frame, ORs their masks into a "dirty" set and only re-tests the bindings
+ * of those actions. Actions whose inputs did not change keep their previous
+ * down state. Cost therefore scales with the number of transitions, not with
+ * the number of bindings.
+ *
+ * Binding strings (used by the config file):
+ * - Key names as printed by KeyCodeToString: "W", "Space", "LeftShift", "F5"
+ * - Mouse buttons: "MouseLeft", "MouseRight", "MouseMiddle", "MouseX1", "MouseX2"
+ * - Chords joined with '+': "LeftCtrl+S", "LeftAlt+MouseLeft"
+ * Names are case-insensitive.
+ *
+ * Thread Safety: Building is not thread-safe. Once built, a map is
+ * immutable and may be shared (read-only) by several windows.
+ */
+class SOLARC_CORE_API InputActionMap
+{
+public:
+    // ========================================================================
+    // Building
+    // ========================================================================
+
+    /**
+     * Register an action.
+     * return Id of the new or existing action with this name, or
+     *        INVALID_INPUT_ACTION if MAX_INPUT_ACTIONS is exceeded
+     */
+    InputActionId AddAction(std::string_view name);
+
+    /**
+     * Bind a chord to an action.
+     * return false if the id is invalid or the binding is empty
+     */
+    bool AddBinding(InputActionId action, const InputBinding& binding);
+
+    /**
+     * Parse and bind a chord string to an action.
+     * return false if the id is invalid or the string does not parse
+     */
+    bool AddBinding(InputActionId action, std::string_view chord);
+
+    /**
+     * Register an axis driven by a pair of actions.
+     * Either action may be INVALID_INPUT_ACTION for a one-sided axis.
+     * return Axis id, or INVALID_INPUT_AXIS if MAX_INPUT_AXES is exceeded
+     */
+    InputAxisId AddAxis(std::string_view name, InputActionId positive, InputActionId negative, float scale = 1.0f);
+
+    /**
+     * Register an axis driven by mouse motion or the wheel.
+     * return Axis id, or INVALID_INPUT_AXIS if MAX_INPUT_AXES is exceeded
+     */
+    InputAxisId AddAxis(std::string_view name, InputAxisSource source, float scale = 1.0f);
+
+    /**
+     * Remove all actions, axes and bindings.
+     */
+    void Clear();
+
+    /**
+     * Parse a chord string ("LeftCtrl+S", "MouseRight").
+     * return Binding, or std::nullopt on unknown names / too many keys
+     */
+    static std::optional<InputBinding> ParseBinding(std::string_view chord);
+
+    /**
+     * Parse an axis source name ("MouseX", "MouseY", "Wheel", "WheelH").
+     */
+    static std::optional<InputAxisSource> ParseAxisSource(std::string_view name);
+
+    // ========================================================================
+    // Lookup
+    // ========================================================================
+
+    /**
+     * Resolve names once at startup and keep the ids; queries by id are O(1).
+     */
+    InputActionId FindAction(std::string_view name) const;
+    InputAxisId FindAxis(std::string_view name) const;
+
+    const std::string& GetActionName(InputActionId id) const;
+    const std::string& GetAxisName(InputAxisId id) const;
+
+    size_t GetActionCount() const { return m_Actions.size(); }
+    size_t GetAxisCount() const { return m_Axes.size(); }
+
+    // ========================================================================
+    // Evaluation
+    // ========================================================================
+
+    /**
+     * Update state from this frame's input.
+     *
+     * param current:         Input state after this frame's transitions
+     * param previousKeys:    Key state at the end of the previous frame
+     * param previousButtons: Mouse button state at the end of the previous frame
+     * param state:           In: last frame's result. Out: this frame's result
+     */
+    void Evaluate(const InputState& current,
+                  const KeyBitset& previousKeys,
+                  uint8_t previousButtons,
+                  ActionState& state) const;
+
+    /**
+     * Re-test every action regardless of what changed. Used when the map is
+     * first attached (keys may already be held) or replaced.
+     */
+    void EvaluateAll(const InputState& current, ActionState& state) const;
+
+private:
+    struct Action
+    {
+        std::string name;
+        std::vector<InputBinding> bindings;
+    };
+
+    struct Axis
+    {
+        std::string name;
+        InputAxisSource source = InputAxisSource::Actions;
+        InputActionId positive = INVALID_INPUT_ACTION;
+        InputActionId negative = INVALID_INPUT_ACTION;
+        float scale = 1.0f;
+    };
+
+    void Evaluate(const InputState& current, uint64_t dirty, ActionState& state) const;
+    bool IsActionActive(const Action& action, const InputState& current) const;
+
+    std::vector<Action> m_Actions;
+    std::vector<Axis> m_Axes;
+
+    std::array<uint64_t, KeyBitset::BIT_COUNT> m_KeyActionMask{};
+    std::array<uint64_t, static_cast<size_t>(MouseButton::Count)> m_ButtonActionMask{};
+};
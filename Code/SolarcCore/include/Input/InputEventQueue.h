@@ -0,0 +1,47 @@
+#pragma once
+#include <cstdint>
+#include "Input/InputTimestamp.h"
+#include "MT/SPSCQueue.h"
+
+/**
+ * One raw input event as reported by the OS, before it is folded into a
+ * window's InputFrame.
+ *
+ * Used when input is read on a dedicated thread: the input thread pushes
+ * these into the window's InputEventQueue and the main thread applies them
+ * (WindowPlatform::DrainInputQueue) right before Window::UpdateInput reads
+ * the frame. All window input state is therefore only touched by the main
+ * thread and the input thread never takes a window lock.
+ */
+struct PlatformInputEvent
+{
+    enum class TYPE : uint8_t
+    {
+        KEY,             // code = scancode, pressed
+        MOUSE_BUTTON,    // code = MouseButton, pressed
+        MOUSE_POSITION,  // x, y (absolute, surface-local)
+        RELATIVE_MOTION, // dx, dy (unaccelerated)
+        WHEEL,           // dx = horizontal, dy = vertical
+        FOCUS_GAINED,
+        FOCUS_LOST,
+        POINTER_ENTER,   // x, y; pressed = relative motion available
+        TEXT,            // x = Unicode code point (printable)
+        MODIFIERS        // code = KeyModifier bitmask
+    };
+
+    TYPE type = TYPE::KEY;
+    bool pressed = false;
+    uint16_t code = 0;
+    int32_t x = 0;
+    int32_t y = 0;
+    double dx = 0.0;
+    double dy = 0.0;
+    InputTimestamp timestamp = 0;
+};
+
+/**
+ * Per-window event buffer between the input thread (producer) and the
+ * main thread (consumer). 1024 events covers several frames of 8 kHz
+ * mouse motion; on overflow the newest events are dropped and counted.
+ */
+using InputEventQueue = SPSCQueue<PlatformInputEvent, 1024>;
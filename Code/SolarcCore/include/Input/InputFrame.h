@@ -3,6 +3,9 @@
 #include <cstdint>
 #include "Input/KeyCode.h"
 #include "Input/MouseButton.h"
+#include "Input/InputTimestamp.h"
+#include "Input/KeyModifiers.h"
+#include "Utility/FixedRingBuffer.h"
 
 struct InputFrame
 {
@@ -14,12 +17,13 @@ struct InputFrame
    */
    struct KeyTransition
    {
-       uint16_t scancode;  // Platform scancode (0-511)
-       bool pressed;       // true = key pressed, false = key released
-       bool isRepeat;      // true = this is a key repeat event
+       uint16_t scancode;        // Platform scancode (0-511)
+       bool pressed;             // true = key pressed, false = key released
+       bool isRepeat;            // true = this is a key repeat event
+       InputTimestamp timestamp; // When the OS reported the transition (0 = unknown)
  
-       KeyTransition(uint16_t sc, bool p, bool repeat = false)
-           : scancode(sc), pressed(p), isRepeat(repeat)
+       KeyTransition(uint16_t sc, bool p, bool repeat = false, InputTimestamp ts = 0)
+           : scancode(sc), pressed(p), isRepeat(repeat), timestamp(ts)
        {
        }
    };
@@ -29,15 +33,43 @@ struct InputFrame
    */
    struct MouseButtonTransition
    {
-       MouseButton button;  // Which button changed state
-       bool pressed;        // true = button pressed, false = button released
+       MouseButton button;       // Which button changed state
+       bool pressed;             // true = button pressed, false = button released
+       InputTimestamp timestamp; // When the OS reported the transition (0 = unknown)
  
-       MouseButtonTransition(MouseButton btn, bool p)
-           : button(btn), pressed(p)
+       MouseButtonTransition(MouseButton btn, bool p, InputTimestamp ts = 0)
+           : button(btn), pressed(p), timestamp(ts)
        {
        }
    };
 
+   /**
+   * A single mouse motion event captured this frame.
+   *
+   * One sample is stored per OS motion event (WM_MOUSEMOVE / wl_pointer::motion)
+   * so game code can integrate motion at sub-frame precision instead of
+   * only seeing the per-frame accumulated delta.
+   */
+   struct MouseSample
+   {
+       InputTimestamp timestamp = 0; // When the OS reported the motion
+       int32_t x = 0;                // Absolute position after this event
+       int32_t y = 0;
+       int32_t deltaX = 0;           // Motion contributed by this event
+       int32_t deltaY = 0;
+   };
+
+   /**
+   * Per-frame motion sample capacity.
+   *
+   * Sized for a 1000 Hz mouse at ~4 fps, or an 8000 Hz mouse at ~30 fps.
+   * On overflow the oldest samples are overwritten; mouseDeltaX/Y still
+   * carries the full accumulated motion.
+   */
+   static constexpr size_t MAX_MOUSE_SAMPLES = 256;
+
+   using MouseSampleRing = FixedRingBuffer<MouseSample, MAX_MOUSE_SAMPLES>;
+
    /**
    * Per-frame input accumulator.
    *
@@ -67,6 +99,42 @@ struct InputFrame
     std::vector<KeyTransition> keyTransitions;
     // Mouse button transitions
     std::vector<MouseButtonTransition> mouseButtonTransitions;
+    // Timestamped mouse motion samples (fixed ring, oldest first)
+    MouseSampleRing mouseSamples;
+    // Text typed this frame (Unicode code points, printable only, in order)
+    std::vector<uint32_t> textInput;
+
+    /**
+     * Modifier state from the platform keymap (KeyModifier bitmask).
+     *
+     * Only meaningful when hasModifiers is true (Wayland with a keymap);
+     * otherwise modifiers are derived from held modifier scancodes.
+     * Persists frame-to-frame like mouseX/mouseY.
+     */
+    uint8_t modifiers = 0;
+    bool hasModifiers = false;
+
+    /**
+     * Timestamp of the oldest timestamped input captured this frame.
+     *
+     * Used as the start point for input-to-present latency.
+     * return 0 if no timestamped input was captured
+     */
+    InputTimestamp GetOldestTimestamp() const
+    {
+        InputTimestamp oldest = 0;
+        auto consider = [&oldest](InputTimestamp ts)
+        {
+            if (ts != 0 && (oldest == 0 || ts < oldest))
+                oldest = ts;
+        };
+
+        for (const auto& kt : keyTransitions) consider(kt.timestamp);
+        for (const auto& bt : mouseButtonTransitions) consider(bt.timestamp);
+        if (!mouseSamples.Empty()) consider(mouseSamples.Front().timestamp);
+
+        return oldest;
+    }
     /**
      * Reset all fields to zero/empty.
      * Called at the start of each frame by WindowContext::PollEvents().
@@ -80,5 +148,7 @@ struct InputFrame
         hWheelDelta = 0.0f;
         keyTransitions.clear();
         mouseButtonTransitions.clear();
+        mouseSamples.Clear();
+        textInput.clear();
     }
 };
\ No newline at end of file
@@ -0,0 +1,207 @@
+#pragma once
+#include "Preprocessor/API.h"
+#include "Input/InputFrame.h"
+#include "Input/InputTimestamp.h"
+#include <cstdint>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+/**
+ * Deterministic input capture and playback.
+ *
+ * InputRecorder serializes every window's InputFrame once per engine frame
+ * (transitions, deltas, position, wheel, motion samples and focus) into a
+ * compact binary file. InputRecording loads such a file so that
+ * ReplayWindowPlatform can feed the frames back through the regular
+ * WindowPlatformConcept interface, e.g. to benchmark frame time with
+ * identical input on every run.
+ *
+ * Each recorded window is a "stream" (a small integer chosen by the
+ * recorder's owner, typically window creation order).
+ *
+ * File layout (all integers little-endian / LEB128 varints):
+ *   Header:  "SOLINPUT" | u32 version | u64 epoch timestamp
+ *   Frame:   varint record count, then per record:
+ *            varint stream | u8 flags | zigzag mouseX, mouseY, deltaX, deltaY
+ *            [f32 wheel, f32 hWheel] (if FLAG_WHEEL)
+ *            varint key count    | per key:    varint scancode, u8 flags, timestamp
+ *            varint button count | per button: u8 button, u8 pressed, timestamp
+ *            varint sample count | per sample: timestamp, zigzag x, y, dx, dy
+ *            [varint text count, per code point: varint] (if FLAG_TEXT)
+ *            [u8 modifiers] (if FLAG_MODIFIERS)
+ *
+ * Timestamps are delta-coded against the previous timestamp in the file:
+ * 0 means "no timestamp", otherwise zigzag(ts - previous) + 1. Motion
+ * samples arrive in order, so most timestamps take 1-2 bytes.
+ */
+namespace InputRecordingFormat
+{
+    inline constexpr char MAGIC[8] = { 'S', 'O', 'L', 'I', 'N', 'P', 'U', 'T' };
+    inline constexpr uint32_t VERSION = 2;
+    inline constexpr uint32_t MIN_VERSION = 1; // v1: no text or modifiers
+
+    inline constexpr uint8_t FLAG_FOCUS = 0x01;
+    inline constexpr uint8_t FLAG_WHEEL = 0x02;
+    inline constexpr uint8_t FLAG_TEXT = 0x04;
+    inline constexpr uint8_t FLAG_MODIFIERS = 0x08;
+
+    inline constexpr uint8_t KEY_PRESSED = 0x01;
+    inline constexpr uint8_t KEY_REPEAT = 0x02;
+}
+
+/**
+ * One window's input for one engine frame.
+ */
+struct RecordedInputFrame
+{
+    uint64_t frameIndex = 0;
+    uint32_t stream = 0;
+    bool hasFocus = true;
+    InputFrame input;
+};
+
+/**
+ * Writes InputFrames to a recording file.
+ *
+ * Usage (once per engine frame, after OS events were pumped):
+ *   recorder.BeginFrame();
+ *   recorder.Record(stream, platform->GetThisFrameInput(), platform->HasKeyboardFocus());
+ *   recorder.EndFrame();
+ *
+ * Thread Safety: Not thread-safe. Main thread only.
+ */
+class SOLARC_CORE_API InputRecorder
+{
+public:
+    InputRecorder() = default;
+    ~InputRecorder();
+
+    InputRecorder(const InputRecorder&) = delete;
+    InputRecorder& operator=(const InputRecorder&) = delete;
+
+    /**
+     * Create (truncate) the file and write the header.
+     * return false if the file cannot be opened
+     */
+    bool Open(const std::string& path);
+
+    /**
+     * Flush and close. Safe to call when not open.
+     */
+    void Close();
+
+    bool IsOpen() const { return m_File.is_open(); }
+
+    void BeginFrame();
+    void Record(uint32_t stream, const InputFrame& input, bool hasFocus);
+    void EndFrame();
+
+    uint64_t GetFrameCount() const { return m_FrameCount; }
+    uint64_t GetBytesWritten() const { return m_BytesWritten; }
+
+private:
+    std::ofstream m_File;
+    std::vector<uint8_t> m_FrameBuffer;
+    uint32_t m_FrameRecordCount = 0;
+    uint64_t m_FrameCount = 0;
+    uint64_t m_BytesWritten = 0;
+    InputTimestamp m_LastTimestamp = 0;
+};
+
+/**
+ * A recording loaded into memory, grouped by stream.
+ *
+ * Thread Safety: Immutable after Load/Parse; safe to share read-only.
+ */
+class SOLARC_CORE_API InputRecording
+{
+public:
+    /**
+     * Read and parse a recording file.
+     * return false on I/O error, bad header or truncated data
+     */
+    bool Load(const std::string& path);
+
+    /**
+     * Parse a recording from memory (same layout as the file).
+     */
+    bool Parse(const uint8_t* data, size_t size);
+
+    /**
+     * Records of one stream in frame order (empty if the stream is unknown).
+     */
+    const std::vector<RecordedInputFrame>& GetStream(uint32_t stream) const;
+
+    std::vector<uint32_t> GetStreamIds() const;
+
+    /**
+     * Number of engine frames in the recording.
+     */
+    uint64_t GetFrameCount() const { return m_FrameCount; }
+
+    /**
+     * Input clock time at which the recording started. Recorded timestamps
+     * are relative to this; replay rebases them onto the replay start.
+     */
+    InputTimestamp GetEpoch() const { return m_Epoch; }
+
+private:
+    std::map<uint32_t, std::vector<RecordedInputFrame>> m_Streams;
+    uint64_t m_FrameCount = 0;
+    InputTimestamp m_Epoch = 0;
+};
+
+/**
+ * Plays back one stream of a recording, frame by frame.
+ *
+ * Records carry the engine frame they were captured in. A frame the stream
+ * has no record for (e.g. the window did not exist yet) plays back as
+ * empty input instead of pulling the next record forward, so playback
+ * stays in step with the recorded frames.
+ *
+ * Recorded timestamps are rebased onto the time playback started, so
+ * latency measurements remain meaningful.
+ *
+ * Thread Safety: Not thread-safe. Main thread only.
+ */
+class SOLARC_CORE_API InputReplayStream
+{
+public:
+    InputReplayStream(std::shared_ptr<const InputRecording> recording, uint32_t stream,
+                      InputTimestamp playbackEpoch = InputClock::Now());
+
+    /**
+     * Produce the input of one engine frame.
+     * param frame: Recording frame index; must not decrease between calls
+     * param out: Reset, then filled with the recorded input (if any)
+     * param hasFocus: Set to the recorded focus; unchanged for gaps
+     * return false if the stream has no record for 'frame'
+     */
+    bool Play(uint64_t frame, InputFrame& out, bool& hasFocus);
+
+    /**
+     * Frame index of the stream's first record (0 if the stream is empty).
+     */
+    uint64_t GetFirstFrame() const;
+
+    /**
+     * Number of records played so far.
+     */
+    size_t GetPlayedRecordCount() const { return m_NextRecord; }
+
+    /**
+     * True once every record of the stream has been played (or skipped).
+     */
+    bool IsFinished() const;
+
+private:
+    InputTimestamp Rebase(InputTimestamp recorded) const;
+
+    std::shared_ptr<const InputRecording> m_Recording;
+    uint32_t m_Stream;
+    size_t m_NextRecord = 0;
+    InputTimestamp m_PlaybackEpoch;
+};
@@ -1,6 +1,8 @@
 #pragma once
 #include "Input/KeyCode.h"
 #include "Input/MouseButton.h"
+#include "Input/KeyBitset.h"
+#include "Input/KeyModifiers.h"
 #include <array>
 #include <cstring>  // For memset
 
@@ -33,12 +35,13 @@ struct InputState
      * - They match platform APIs (Win32 scancode, Wayland XKB code)
      * - They support full keyboard range (USB HID allows 0-511)
      * 
-     * true = key is currently held down
-     * false = key is released
+     * Packed as a 512-bit set (bit set = key held down) so that the
+     * previous-frame snapshot is a single 64-byte copy and transition
+     * queries run word-at-a-time (see KeyBitset).
      * 
      * Note: Public APIs use KeyCode enum, not scancodes directly.
      */
-    std::array<bool, 512> keys;
+    KeyBitset keys;
     
     /**
      * Per-key repeat count indexed by scancode (0-511).
@@ -146,6 +149,19 @@ struct InputState
      */
     float mouseWheelHDelta;
 
+    // ========================================================================
+    // Modifier State
+    // ========================================================================
+
+    /**
+     * Modifier bitmask reported by the platform keymap (see KeyModifier).
+     *
+     * Valid only when platformModifiers is true. Window::IsShiftDown() etc.
+     * fall back to the held modifier keys otherwise.
+     */
+    uint8_t modifiers;
+    bool platformModifiers;
+
     // ========================================================================
     // Constructors
     // ========================================================================
@@ -164,7 +180,7 @@ struct InputState
      */
     void Reset()
     {
-        keys.fill(false);
+        keys.Reset();
         keyRepeatCount.fill(0);
         mouseX = 0;
         mouseY = 0;
@@ -173,6 +189,8 @@ struct InputState
         mouseButtons = 0;
         mouseWheelDelta = 0.0f;
         mouseWheelHDelta = 0.0f;
+        modifiers = 0;
+        platformModifiers = false;
     }
     
     // ========================================================================
@@ -185,7 +203,7 @@ struct InputState
      */
     bool IsKeyScanCodeDown(uint16_t scancode) const
     {
-        return scancode < 512 && keys[scancode];
+        return keys.Test(scancode);
     }
     
     /**
@@ -0,0 +1,77 @@
+#pragma once
+#include <chrono>
+#include <cstdint>
+
+/**
+ * Input event timestamp in microseconds on std::chrono::steady_clock.
+ *
+ * All input timestamps (key/button transitions, mouse motion samples) are
+ * normalized to this clock so they can be compared against frame and
+ * present times measured by the engine. A value of 0 means "no timestamp".
+ */
+using InputTimestamp = uint64_t;
+
+namespace InputClock
+{
+    /**
+     * Current time on the input clock.
+     */
+    inline InputTimestamp Now()
+    {
+        return static_cast<InputTimestamp>(
+            std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now().time_since_epoch()).count());
+    }
+
+    /**
+     * Maximum accepted age of a platform event time (milliseconds).
+     * Anything older is treated as a bogus/unrelated clock and stamped 'now'.
+     */
+    inline constexpr uint32_t MAX_EVENT_AGE_MS = 10000;
+
+    /**
+     * Convert a 32-bit millisecond platform event time to an InputTimestamp.
+     *
+     * Platforms report event times in their own millisecond clock with
+     * wrap-around (Wayland: compositor 'time' argument, Win32: GetMessageTime).
+     * The age of the event is measured in that clock and then subtracted
+     * from the current steady_clock time, so the platform clock epoch never
+     * needs to match steady_clock.
+     *
+     * param eventTimeMs:   Event time reported by the platform
+     * param platformNowMs: Current time in the same platform clock
+     * param now:           Current input clock time
+     * return Timestamp on the input clock
+     */
+    inline InputTimestamp FromEventTimeMs(uint32_t eventTimeMs, uint32_t platformNowMs, InputTimestamp now)
+    {
+        uint32_t ageMs = platformNowMs - eventTimeMs; // Wrap-safe unsigned difference
+        if (ageMs > MAX_EVENT_AGE_MS)
+            return now;
+
+        return now - static_cast<InputTimestamp>(ageMs) * 1000;
+    }
+
+    inline InputTimestamp FromEventTimeMs(uint32_t eventTimeMs, uint32_t platformNowMs)
+    {
+        return FromEventTimeMs(eventTimeMs, platformNowMs, Now());
+    }
+
+    /**
+     * Convert a 64-bit microsecond platform event time to an InputTimestamp.
+     *
+     * Same age-based conversion as FromEventTimeMs, for high-resolution
+     * sources (e.g. Wayland relative pointer utime_hi/utime_lo).
+     */
+    inline InputTimestamp FromEventTimeUs(uint64_t eventTimeUs, uint64_t platformNowUs, InputTimestamp now)
+    {
+        if (eventTimeUs > platformNowUs)
+            return now;
+
+        uint64_t ageUs = platformNowUs - eventTimeUs;
+        if (ageUs > static_cast<uint64_t>(MAX_EVENT_AGE_MS) * 1000 || ageUs > now)
+            return now;
+
+        return now - ageUs;
+    }
+}
@@ -0,0 +1,172 @@
+#pragma once
+#include <array>
+#include <bit>
+#include <cstdint>
+
+/**
+ * Fixed 512-bit set indexed by scancode (0-511).
+ *
+ * Keyboard state is stored as 8 x 64-bit words so that whole-keyboard
+ * operations (copy, compare, transition masks, "any key" queries) are
+ * done a word at a time instead of a key at a time:
+ * - Copying a full keyboard snapshot moves 64 bytes (one cache line)
+ * - Pressed mask  = current & ~previous
+ * - Released mask = ~current & previous
+ *
+ * The word loops have a fixed trip count of 8 and no dependencies between
+ * iterations, so optimizing compilers lower them to SSE2/AVX2/NEON vector
+ * ops without intrinsics in this header.
+ *
+ * Thread Safety: Not thread-safe. Same rules as InputState.
+ */
+struct alignas(64) KeyBitset
+{
+    static constexpr uint32_t BIT_COUNT = 512;
+    static constexpr uint32_t WORD_BITS = 64;
+    static constexpr uint32_t WORD_COUNT = BIT_COUNT / WORD_BITS;
+
+    std::array<uint64_t, WORD_COUNT> words{};
+
+    // ========================================================================
+    // Per-bit Access
+    // ========================================================================
+
+    bool Test(uint16_t scancode) const
+    {
+        if (scancode >= BIT_COUNT) return false;
+        return (words[scancode / WORD_BITS] >> (scancode % WORD_BITS)) & 1ull;
+    }
+
+    void Set(uint16_t scancode)
+    {
+        if (scancode >= BIT_COUNT) return;
+        words[scancode / WORD_BITS] |= (1ull << (scancode % WORD_BITS));
+    }
+
+    void Clear(uint16_t scancode)
+    {
+        if (scancode >= BIT_COUNT) return;
+        words[scancode / WORD_BITS] &= ~(1ull << (scancode % WORD_BITS));
+    }
+
+    void Assign(uint16_t scancode, bool value)
+    {
+        if (value) Set(scancode);
+        else Clear(scancode);
+    }
+
+    // ========================================================================
+    // Whole-set Operations
+    // ========================================================================
+
+    void Reset()
+    {
+        words.fill(0);
+    }
+
+    /**
+     * True if any bit is set.
+     */
+    bool Any() const
+    {
+        uint64_t acc = 0;
+        for (uint32_t i = 0; i < WORD_COUNT; ++i)
+            acc |= words[i];
+        return acc != 0;
+    }
+
+    bool None() const { return !Any(); }
+
+    /**
+     * Number of set bits.
+     */
+    uint32_t Count() const
+    {
+        uint32_t count = 0;
+        for (uint32_t i = 0; i < WORD_COUNT; ++i)
+            count += static_cast<uint32_t>(std::popcount(words[i]));
+        return count;
+    }
+
+    /**
+     * Invoke fn(scancode) for every set bit, in ascending scancode order.
+     * Skips empty words, so cost scales with the number of set bits.
+     */
+    template<typename Fn>
+    void ForEachSetBit(Fn&& fn) const
+    {
+        for (uint32_t i = 0; i < WORD_COUNT; ++i)
+        {
+            uint64_t word = words[i];
+            while (word != 0)
+            {
+                uint32_t bit = static_cast<uint32_t>(std::countr_zero(word));
+                fn(static_cast<uint16_t>(i * WORD_BITS + bit));
+                word &= word - 1; // Clear lowest set bit
+            }
+        }
+    }
+
+    // ========================================================================
+    // Transition Masks
+    // ========================================================================
+
+    /**
+     * Keys down in 'current' but not in 'previous' (up -> down).
+     */
+    static KeyBitset PressedMask(const KeyBitset& current, const KeyBitset& previous)
+    {
+        KeyBitset out;
+        for (uint32_t i = 0; i < WORD_COUNT; ++i)
+            out.words[i] = current.words[i] & ~previous.words[i];
+        return out;
+    }
+
+    /**
+     * Keys down in 'previous' but not in 'current' (down -> up).
+     */
+    static KeyBitset ReleasedMask(const KeyBitset& current, const KeyBitset& previous)
+    {
+        KeyBitset out;
+        for (uint32_t i = 0; i < WORD_COUNT; ++i)
+            out.words[i] = ~current.words[i] & previous.words[i];
+        return out;
+    }
+
+    /**
+     * Keys whose state differs between 'current' and 'previous'.
+     */
+    static KeyBitset ChangedMask(const KeyBitset& current, const KeyBitset& previous)
+    {
+        KeyBitset out;
+        for (uint32_t i = 0; i < WORD_COUNT; ++i)
+            out.words[i] = current.words[i] ^ previous.words[i];
+        return out;
+    }
+
+    /**
+     * True if any key went up -> down, without materializing the mask.
+     */
+    static bool AnyPressed(const KeyBitset& current, const KeyBitset& previous)
+    {
+        uint64_t acc = 0;
+        for (uint32_t i = 0; i < WORD_COUNT; ++i)
+            acc |= current.words[i] & ~previous.words[i];
+        return acc != 0;
+    }
+
+    /**
+     * True if any key went down -> up, without materializing the mask.
+     */
+    static bool AnyReleased(const KeyBitset& current, const KeyBitset& previous)
+    {
+        uint64_t acc = 0;
+        for (uint32_t i = 0; i < WORD_COUNT; ++i)
+            acc |= ~current.words[i] & previous.words[i];
+        return acc != 0;
+    }
+
+    bool operator==(const KeyBitset& other) const = default;
+};
+
+static_assert(sizeof(KeyBitset) == 64, "KeyBitset must occupy exactly one cache line");
@@ -1,5 +1,6 @@
 #pragma once
 #include <cstdint>
+#include <string_view>
 
 /**
  * Platform-agnostic keyboard key codes based on USB HID Usage IDs.
@@ -182,4 +183,10 @@ inline constexpr bool IsNumPadKey(KeyCode key)
  * Get string representation of KeyCode (for debugging)
  * Returns "Unknown" for unrecognized codes
  */
-const char* KeyCodeToString(KeyCode key);
\ No newline at end of file
+const char* KeyCodeToString(KeyCode key);
+
+/**
+ * Parse a key name as produced by KeyCodeToString (case-insensitive).
+ * Returns KeyCode::Unknown for unrecognized names.
+ */
+KeyCode KeyCodeFromString(std::string_view name);
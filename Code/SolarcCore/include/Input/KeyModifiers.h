@@ -0,0 +1,39 @@
+#pragma once
+#include <cstdint>
+
+/**
+ * Keyboard modifier state as reported by the platform's keymap.
+ *
+ * Stored as a bitmask in InputFrame / InputState. Unlike the per-key
+ * scancode state this reflects what the compositor/OS considers active,
+ * including latched and locked modifiers (sticky keys, Caps Lock) and
+ * remapped modifiers (e.g. Caps Lock bound to Ctrl).
+ */
+enum class KeyModifier : uint8_t
+{
+    Shift    = 0,
+    Ctrl     = 1,
+    Alt      = 2,
+    Super    = 3,
+    CapsLock = 4,
+    NumLock  = 5,
+
+    Count    = 6
+};
+
+/**
+ * Convert KeyModifier to bitmask value
+ * Example: KeyModifierToBit(KeyModifier::Ctrl) = 0x02
+ */
+inline constexpr uint8_t KeyModifierToBit(KeyModifier modifier)
+{
+    return static_cast<uint8_t>(1 << static_cast<uint8_t>(modifier));
+}
+
+/**
+ * Check if a modifier is set in a bitmask
+ */
+inline constexpr bool IsModifierSet(uint8_t mask, KeyModifier modifier)
+{
+    return (mask & KeyModifierToBit(modifier)) != 0;
+}
@@ -0,0 +1,121 @@
+#pragma once
+#include "Input/InputTimestamp.h"
+#include <cstdint>
+
+/**
+ * Client-side key repeat schedule.
+ *
+ * Wayland compositors do not resend key presses while a key is held; they
+ * only report the user's repeat rate and delay (wl_keyboard::repeat_info)
+ * and leave repeating to the client. This class tracks the key that should
+ * repeat and produces the repeat timestamps that fall due.
+ *
+ * Repeats are generated lazily in batches: Generate(now) emits every repeat
+ * scheduled up to 'now', each with its own timestamp, so a long frame gets
+ * the correct number of repeats and nothing has to run per repeat. The
+ * caller only needs a timer for GetNextRepeatTime() when it would otherwise
+ * sleep past it.
+ *
+ * Like other platforms, only the most recently pressed key repeats.
+ *
+ * Thread Safety: Not thread-safe. Owned by whichever thread dispatches the
+ * keyboard.
+ */
+class KeyRepeatGenerator
+{
+public:
+    /**
+     * Upper bound of repeats emitted by one Generate() call. Beyond this
+     * (e.g. after a multi-second stall) the schedule skips ahead instead of
+     * flooding the frame.
+     */
+    static constexpr uint32_t MAX_BATCH = 256;
+
+    /**
+     * Apply the compositor's repeat settings.
+     *
+     * param ratePerSecond: Repeats per second (0 disables repeat)
+     * param delayMs: Time from the press to the first repeat
+     */
+    void SetRepeatInfo(int32_t ratePerSecond, int32_t delayMs)
+    {
+        m_IntervalUs = ratePerSecond > 0 ? 1000000u / static_cast<uint32_t>(ratePerSecond) : 0;
+        m_DelayUs = delayMs > 0 ? static_cast<uint32_t>(delayMs) * 1000u : 0;
+        if (m_IntervalUs == 0)
+            Stop();
+    }
+
+    bool IsEnabled() const { return m_IntervalUs > 0; }
+
+    /**
+     * A repeatable key was pressed: it becomes the repeating key.
+     *
+     * param timestamp: Press time; the first repeat is due at timestamp + delay
+     */
+    void Press(uint16_t scancode, InputTimestamp timestamp)
+    {
+        if (!IsEnabled()) return;
+
+        m_Scancode = scancode;
+        m_NextRepeat = timestamp + m_DelayUs;
+        m_Active = true;
+    }
+
+    /**
+     * A key was released. Stops repeating if it was the repeating key.
+     */
+    void Release(uint16_t scancode)
+    {
+        if (m_Active && m_Scancode == scancode)
+            Stop();
+    }
+
+    /**
+     * Stop repeating (focus loss, keymap change).
+     */
+    void Stop()
+    {
+        m_Active = false;
+        m_NextRepeat = 0;
+    }
+
+    bool IsRepeating() const { return m_Active; }
+    uint16_t GetRepeatingKey() const { return m_Scancode; }
+
+    /**
+     * Time the next repeat falls due (0 = nothing repeating).
+     */
+    InputTimestamp GetNextRepeatTime() const { return m_Active ? m_NextRepeat : 0; }
+
+    /**
+     * Emit every repeat due at or before 'now', oldest first.
+     *
+     * param emit: Called as emit(scancode, repeatTimestamp)
+     * return Number of repeats emitted
+     */
+    template<typename EmitFn>
+    uint32_t Generate(InputTimestamp now, EmitFn&& emit)
+    {
+        uint32_t count = 0;
+        while (m_Active && m_NextRepeat <= now && count < MAX_BATCH)
+        {
+            emit(m_Scancode, m_NextRepeat);
+            m_NextRepeat += m_IntervalUs;
+            ++count;
+        }
+
+        // Dropped repeats past the cap keep the original phase
+        if (m_Active && m_NextRepeat <= now)
+            m_NextRepeat += ((now - m_NextRepeat) / m_IntervalUs + 1) * m_IntervalUs;
+
+        return count;
+    }
+
+private:
+    uint32_t m_IntervalUs = 0;
+    uint32_t m_DelayUs = 0;
+
+    bool m_Active = false;
+    uint16_t m_Scancode = 0;
+    InputTimestamp m_NextRepeat = 0;
+};
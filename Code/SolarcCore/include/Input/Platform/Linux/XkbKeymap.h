@@ -0,0 +1,135 @@
+#pragma once
+
+#ifdef __linux__
+
+#include "Input/KeyBitset.h"
+#include <array>
+#include <cstdint>
+#include <vector>
+
+struct xkb_context;
+struct xkb_keymap;
+
+/**
+ * Compiled Wayland keymap with precomputed lookup tables.
+ *
+ * The compositor sends its keymap once (wl_keyboard::keymap) as a file
+ * descriptor. Load() maps it, compiles it with xkbcommon and resolves
+ * every key of every layout under every modifier combination that can
+ * change the produced symbol (Shift, Caps Lock, Num Lock, AltGr). The
+ * result is a flat table, so translating a key press is one array read
+ * and wl_keyboard::key never calls into xkb state.
+ *
+ * Modifier updates (wl_keyboard::modifiers) select the active table row
+ * and produce the KeyModifier bitmask from masks resolved at load time.
+ *
+ * Limitations of the table approach: compose/dead-key sequences are not
+ * handled, and keys producing more than one keysym yield only the first.
+ *
+ * Thread Safety: Not thread-safe. Used by whichever thread dispatches
+ * the seat (main thread or the input thread), one at a time.
+ */
+class XkbKeymap
+{
+public:
+    /**
+     * What a key produces under the current modifiers.
+     */
+    struct KeySymbol
+    {
+        uint32_t keysym = 0;    // XKB keysym (0 = NoSymbol)
+        uint32_t codepoint = 0; // Unicode code point (0 = produces no text)
+    };
+
+    // Layouts beyond this are resolved as layout 0
+    static constexpr uint32_t MAX_LAYOUTS = 4;
+
+    XkbKeymap() = default;
+    ~XkbKeymap();
+
+    XkbKeymap(const XkbKeymap&) = delete;
+    XkbKeymap& operator=(const XkbKeymap&) = delete;
+
+    /**
+     * Compile the keymap sent by the compositor and rebuild the tables.
+     *
+     * param fd: Keymap file descriptor (always closed by this call)
+     * param size: Size of the keymap in bytes
+     * return false if the keymap could not be mapped or compiled; the
+     *        previous tables are kept in that case
+     */
+    bool Load(int32_t fd, uint32_t size);
+
+    /**
+     * Apply wl_keyboard::modifiers. No xkb calls.
+     */
+    void UpdateModifiers(uint32_t depressed, uint32_t latched, uint32_t locked, uint32_t group);
+
+    /**
+     * Look up what a key produces with the current modifiers.
+     *
+     * param key: evdev key code, as sent in wl_keyboard::key (0-511); the
+     *            xkb keycode is key + 8
+     */
+    KeySymbol Translate(uint32_t key) const
+    {
+        if (key >= KEY_COUNT || m_Symbols.empty())
+            return {};
+        return m_Symbols[(m_ActiveRow * KEY_COUNT) + key];
+    }
+
+    /**
+     * Should holding this key repeat? (false for modifiers and other keys
+     * the keymap marks as non-repeating; true for every key without a keymap)
+     */
+    bool KeyRepeats(uint32_t key) const
+    {
+        if (m_Symbols.empty())
+            return true;
+        return key < KEY_COUNT && m_RepeatingKeys.Test(static_cast<uint16_t>(key));
+    }
+
+    /**
+     * Current modifiers as a KeyModifier bitmask.
+     */
+    uint8_t GetModifiers() const { return m_Modifiers; }
+
+    bool IsLoaded() const { return !m_Symbols.empty(); }
+
+private:
+    static constexpr uint32_t KEY_COUNT = 512;
+
+    // Modifiers that select a table row (one bit each in the row index)
+    enum LevelModifier : uint32_t
+    {
+        LEVEL_SHIFT = 0,
+        LEVEL_CAPS,
+        LEVEL_NUM,
+        LEVEL_THREE,
+        LEVEL_MODIFIER_COUNT
+    };
+    static constexpr uint32_t LEVEL_COMBINATIONS = 1u << LEVEL_MODIFIER_COUNT;
+
+    void BuildTables(xkb_keymap* keymap);
+
+    xkb_context* m_Context = nullptr;
+
+    // [layout][level combination][evdev key]
+    std::vector<KeySymbol> m_Symbols;
+    uint32_t m_LayoutCount = 0;
+    KeyBitset m_RepeatingKeys;              // By evdev key
+    uint32_t m_ActiveRow = 0;
+
+    // xkb modifier masks resolved at load time
+    std::array<uint32_t, LEVEL_MODIFIER_COUNT> m_LevelMasks{};
+    uint32_t m_ShiftMask = 0;
+    uint32_t m_CtrlMask = 0;
+    uint32_t m_AltMask = 0;
+    uint32_t m_SuperMask = 0;
+    uint32_t m_CapsMask = 0;
+    uint32_t m_NumMask = 0;
+
+    uint8_t m_Modifiers = 0;
+};
+
+#endif // __linux__
@@ -0,0 +1,90 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+/**
+ * Helpers for the text input stream (InputFrame::textInput).
+ *
+ * Text is carried as Unicode code points; UTF-8 is produced on demand
+ * for UI code and TextInputEvent.
+ */
+namespace TextInput
+{
+    /**
+     * Should this code point be delivered as text?
+     *
+     * Filters C0/C1 control characters (Enter, Tab, Backspace, Escape,
+     * Ctrl+letter combinations on Win32) - those are handled as key
+     * presses - plus surrogates and out-of-range values.
+     */
+    inline constexpr bool IsPrintable(uint32_t codepoint)
+    {
+        if (codepoint < 0x20 || (codepoint >= 0x7F && codepoint < 0xA0))
+            return false;
+        if (codepoint >= 0xD800 && codepoint <= 0xDFFF)
+            return false;
+        return codepoint <= 0x10FFFF;
+    }
+
+    /**
+     * Encode one code point as UTF-8.
+     *
+     * param codepoint: Unicode scalar value
+     * param out: Receives 1-4 bytes (not null-terminated)
+     * return Number of bytes written (0 for an invalid code point)
+     */
+    inline size_t EncodeUTF8(uint32_t codepoint, char out[4])
+    {
+        if (codepoint < 0x80)
+        {
+            out[0] = static_cast<char>(codepoint);
+            return 1;
+        }
+        if (codepoint < 0x800)
+        {
+            out[0] = static_cast<char>(0xC0 | (codepoint >> 6));
+            out[1] = static_cast<char>(0x80 | (codepoint & 0x3F));
+            return 2;
+        }
+        if (codepoint >= 0xD800 && codepoint <= 0xDFFF)
+            return 0;
+        if (codepoint < 0x10000)
+        {
+            out[0] = static_cast<char>(0xE0 | (codepoint >> 12));
+            out[1] = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+            out[2] = static_cast<char>(0x80 | (codepoint & 0x3F));
+            return 3;
+        }
+        if (codepoint <= 0x10FFFF)
+        {
+            out[0] = static_cast<char>(0xF0 | (codepoint >> 18));
+            out[1] = static_cast<char>(0x80 | ((codepoint >> 12) & 0x3F));
+            out[2] = static_cast<char>(0x80 | ((codepoint >> 6) & 0x3F));
+            out[3] = static_cast<char>(0x80 | (codepoint & 0x3F));
+            return 4;
+        }
+        return 0;
+    }
+
+    /**
+     * Append one code point to a UTF-8 string (invalid code points are skipped).
+     */
+    inline void AppendUTF8(std::string& text, uint32_t codepoint)
+    {
+        char bytes[4];
+        size_t count = EncodeUTF8(codepoint, bytes);
+        text.append(bytes, count);
+    }
+
+    /**
+     * Combine a UTF-16 surrogate pair (Win32 WM_CHAR) into a code point.
+     */
+    inline constexpr uint32_t CombineSurrogates(uint16_t high, uint16_t low)
+    {
+        return 0x10000 + ((static_cast<uint32_t>(high) - 0xD800) << 10) + (static_cast<uint32_t>(low) - 0xDC00);
+    }
+
+    inline constexpr bool IsHighSurrogate(uint32_t unit) { return unit >= 0xD800 && unit <= 0xDBFF; }
+    inline constexpr bool IsLowSurrogate(uint32_t unit) { return unit >= 0xDC00 && unit <= 0xDFFF; }
+}
@@ -81,6 +81,10 @@ public:
     // Check if logging is initialized
     static bool IsInitialized() { return s_Initialized; }
 
+    // Directory of the log file ("" = working directory); other
+    // run-to-run files (e.g. the pipeline cache) are written next to it
+    static const std::string& GetLogDirectory() { return s_LogDirectory; }
+
 private:
     static std::shared_ptr<spdlog::logger> CreateCategoryLogger(
         const std::string& name,
@@ -91,6 +95,7 @@ private:
     static const char* CategoryToString(LogCategory category);
 
     inline static bool s_Initialized = false;
+    inline static std::string s_LogDirectory;
     inline static std::string s_LogPattern = "[%Y-%m-%d %H:%M:%S.%e] [%n] [%^%l%$] %v";
 
     // Sinks (shared across loggers)
@@ -9,10 +9,13 @@
 #include <condition_variable>
 #include <atomic>
 #include <functional>
+#include <limits>
 
 class SOLARC_CORE_API JobSystem 
 {
 public:
+    static constexpr size_t INVALID_WORKER_INDEX = std::numeric_limits<size_t>::max();
+
     // Create job system with specified number of worker threads
     // If numThreads == 0, uses hardware_concurrency - 1 (leaving one core for main thread)
     explicit JobSystem(size_t numThreads = 0);
@@ -50,6 +53,10 @@ public:
     // Get number of worker threads
     size_t GetWorkerCount() const { return m_Workers.size(); }
 
+    // Index [0, GetWorkerCount()) of the calling worker thread, INVALID_WORKER_INDEX on other threads
+    // Stable for the thread's lifetime; use it to pick per-thread resources inside a job
+    static size_t GetCurrentWorkerIndex();
+
     // Check if there are any pending jobs
     bool HasPendingJobs() const;
 
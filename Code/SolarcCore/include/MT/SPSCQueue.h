@@ -0,0 +1,95 @@
+#pragma once
+#include <array>
+#include <atomic>
+#include <cstddef>
+#include <new>
+#include <type_traits>
+
+/**
+ * Bounded lock-free single-producer / single-consumer ring buffer.
+ *
+ * Exactly one thread may call TryPush() and exactly one (other) thread may
+ * call TryPop(); neither side ever blocks or takes a lock. Each index is
+ * written by one side only and published with release/acquire ordering.
+ *
+ * Capacity must be a power of two. The queue holds at most Capacity items;
+ * TryPush() fails (and the caller decides what to drop) when it is full.
+ *
+ * Head and tail live on separate cache lines so producer and consumer do
+ * not false-share.
+ */
+template<typename T, size_t Capacity>
+class SPSCQueue
+{
+    static_assert(Capacity >= 2 && (Capacity & (Capacity - 1)) == 0, "Capacity must be a power of two");
+    static_assert(std::is_trivially_copyable_v<T>, "SPSCQueue stores trivially copyable items");
+
+public:
+    SPSCQueue() = default;
+
+    SPSCQueue(const SPSCQueue&) = delete;
+    SPSCQueue& operator=(const SPSCQueue&) = delete;
+
+    /**
+     * Producer side. Returns false if the queue is full.
+     */
+    bool TryPush(const T& value)
+    {
+        const size_t tail = m_Tail.load(std::memory_order_relaxed);
+        if (tail - m_CachedHead == Capacity)
+        {
+            m_CachedHead = m_Head.load(std::memory_order_acquire);
+            if (tail - m_CachedHead == Capacity)
+                return false;
+        }
+
+        m_Items[tail & MASK] = value;
+        m_Tail.store(tail + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Consumer side. Returns false if the queue is empty.
+     */
+    bool TryPop(T& out)
+    {
+        const size_t head = m_Head.load(std::memory_order_relaxed);
+        if (head == m_CachedTail)
+        {
+            m_CachedTail = m_Tail.load(std::memory_order_acquire);
+            if (head == m_CachedTail)
+                return false;
+        }
+
+        out = m_Items[head & MASK];
+        m_Head.store(head + 1, std::memory_order_release);
+        return true;
+    }
+
+    /**
+     * Approximate number of queued items (exact when called by either side
+     * while the other is idle).
+     */
+    size_t SizeApprox() const
+    {
+        return m_Tail.load(std::memory_order_acquire) - m_Head.load(std::memory_order_acquire);
+    }
+
+    bool IsEmpty() const { return SizeApprox() == 0; }
+
+    static constexpr size_t GetCapacity() { return Capacity; }
+
+private:
+    static constexpr size_t MASK = Capacity - 1;
+    static constexpr size_t CACHE_LINE = 64;
+
+    // Consumer-owned
+    alignas(CACHE_LINE) std::atomic<size_t> m_Head{ 0 };
+    size_t m_CachedTail = 0;
+
+    // Producer-owned
+    alignas(CACHE_LINE) std::atomic<size_t> m_Tail{ 0 };
+    size_t m_CachedHead = 0;
+
+    alignas(CACHE_LINE) std::array<T, Capacity> m_Items{};
+};
@@ -0,0 +1,127 @@
+#pragma once
+#include "Preprocessor/API.h"
+#include <cstdint>
+#include <deque>
+#include <mutex>
+#include <string_view>
+#include <vector>
+
+/**
+ * Descriptor arrays of the bindless heap, in binding order
+ * (set 0, binding = value).
+ */
+enum class RHIDescriptorType : uint8_t
+{
+    SampledImage = 0,
+    StorageBuffer,
+    Sampler,
+
+    Count
+};
+
+inline std::string_view RHIDescriptorTypeToString(RHIDescriptorType type)
+{
+    switch (type)
+    {
+    case RHIDescriptorType::SampledImage:  return "sampled image";
+    case RHIDescriptorType::StorageBuffer: return "storage buffer";
+    case RHIDescriptorType::Sampler:       return "sampler";
+    default:                               break;
+    }
+    return "unknown";
+}
+
+/**
+ * A descriptor in the bindless heap. Shaders index the type's array with
+ * 'index' (passed in push constants), so no descriptor set is bound per draw.
+ */
+struct RHIDescriptorHandle
+{
+    static constexpr uint32_t INVALID_INDEX = UINT32_MAX;
+
+    uint32_t index = INVALID_INDEX;
+    RHIDescriptorType type = RHIDescriptorType::SampledImage;
+
+    bool IsValid() const { return index != INVALID_INDEX; }
+};
+
+/**
+ * Filtering of the samplers the heap owns (RHI::CreateSamplerDescriptor).
+ * Addressing is clamp-to-edge.
+ */
+enum class RHISamplerFilter : uint8_t
+{
+    Nearest = 0,
+    Linear,
+
+    Count
+};
+
+// Push constant bytes every pipeline of the heap's layout gets (guaranteed minimum)
+inline constexpr uint32_t RHI_PUSH_CONSTANT_SIZE = 128;
+
+/**
+ * Hands out indices of one descriptor array.
+ *
+ * Freed indices are not reused until the GPU finished every frame that
+ * could reference them: Free() tags the index with the GPU frame value
+ * (see RHI::GetLastSubmittedFrame) of the last frame that may use it, and
+ * Collect() returns indices whose frame completed to the free list. A
+ * descriptor is therefore never rewritten while a command buffer in flight
+ * can read it.
+ *
+ * Reuse is LIFO so live indices stay dense at the start of the array.
+ *
+ * Thread Safety: Thread-safe (one mutex); resources may be created and
+ * released from loader threads.
+ */
+class SOLARC_CORE_API DescriptorIndexAllocator
+{
+public:
+    explicit DescriptorIndexAllocator(uint32_t capacity);
+
+    DescriptorIndexAllocator(const DescriptorIndexAllocator&) = delete;
+    DescriptorIndexAllocator& operator=(const DescriptorIndexAllocator&) = delete;
+
+    /**
+     * Allocate an index
+     * return RHIDescriptorHandle::INVALID_INDEX if every index is live or pending
+     */
+    uint32_t Allocate();
+
+    /**
+     * Release an index once the GPU reached 'frame'
+     * param frame: Frame value of the last submission that may use the
+     *              descriptor (0 = never used by the GPU, reusable at once)
+     * note: A free older than the newest pending one waits for that one's frame
+     */
+    void Free(uint32_t index, uint64_t frame);
+
+    /**
+     * Recycle indices whose frame the GPU has completed
+     * param completedFrame: Highest frame value the GPU reached
+     * return Number of indices recycled
+     */
+    uint32_t Collect(uint64_t completedFrame);
+
+    uint32_t GetCapacity() const { return m_Capacity; }
+    uint32_t GetAllocatedCount() const;     // Live, excluding pending frees
+    uint32_t GetPendingFreeCount() const;
+    uint32_t GetPeakAllocatedCount() const; // Highest live count so far (sizing aid)
+
+private:
+    struct PendingFree
+    {
+        uint64_t frame;
+        uint32_t index;
+    };
+
+    const uint32_t m_Capacity;
+
+    mutable std::mutex m_Mutex;
+    std::vector<uint32_t> m_FreeIndices;    // Recycled, reused last-in first-out
+    uint32_t m_NextUnused = 0;              // Indices at and above were never handed out
+    std::deque<PendingFree> m_PendingFrees; // Frame order
+    uint32_t m_Allocated = 0;
+    uint32_t m_PeakAllocated = 0;
+};
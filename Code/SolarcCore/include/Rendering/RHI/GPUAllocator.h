@@ -0,0 +1,270 @@
+#pragma once
+#include "Preprocessor/API.h"
+#include "Utility/SlotMap.h"
+#include "Utility/TLSFAllocator.h"
+#include <cstdint>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <unordered_map>
+#include <vector>
+
+// ============================================================================
+// Memory Types
+// ============================================================================
+
+/**
+ * Memory type properties (GPUMemoryType::propertyFlags bitmask).
+ * Same bit values as VkMemoryPropertyFlagBits.
+ */
+enum GPUMemoryPropertyFlag : uint32_t
+{
+    GPU_MEMORY_DEVICE_LOCAL  = 1 << 0,
+    GPU_MEMORY_HOST_VISIBLE  = 1 << 1,
+    GPU_MEMORY_HOST_COHERENT = 1 << 2,
+    GPU_MEMORY_HOST_CACHED   = 1 << 3
+};
+
+struct GPUMemoryType
+{
+    uint32_t propertyFlags = 0;
+    uint32_t heapIndex = 0;
+};
+
+struct GPUMemoryHeap
+{
+    uint64_t size = 0;
+};
+
+/**
+ * A device's memory types and heaps (VkPhysicalDeviceMemoryProperties),
+ * plus the allocation count limit (maxMemoryAllocationCount).
+ */
+struct GPUMemoryProperties
+{
+    std::vector<GPUMemoryType> types;
+    std::vector<GPUMemoryHeap> heaps;
+    uint32_t maxAllocationCount = 4096;
+};
+
+// Backend memory object (VkDeviceMemory as an integer)
+using GPUDeviceMemory = uint64_t;
+
+/**
+ * Allocates and frees device memory objects for a GPUAllocator.
+ * Implemented per graphics API; tests use a mock.
+ */
+class GPUMemoryBackend
+{
+public:
+    virtual ~GPUMemoryBackend() = default;
+
+    /**
+     * Allocate a device memory object
+     * param mapped: Receives a persistent mapping for host-visible types, nullptr otherwise
+     * return false if the device is out of memory
+     */
+    virtual bool AllocateMemory(uint32_t memoryType, uint64_t size, GPUDeviceMemory& memory, void*& mapped) = 0;
+
+    /**
+     * Free a device memory object (unmapping it first if mapped)
+     */
+    virtual void FreeMemory(uint32_t memoryType, GPUDeviceMemory memory) = 0;
+};
+
+// ============================================================================
+// Allocations
+// ============================================================================
+
+/**
+ * Linear resources (buffers, linear images) and optimal-tiling images never
+ * share a block, so bufferImageGranularity never applies between neighbours.
+ */
+enum class GPUResourceTiling : uint8_t
+{
+    Linear = 0,
+    Optimal
+};
+
+struct GPUAllocationDesc
+{
+    uint64_t size = 0;
+    uint64_t alignment = 1;                 // Power of two (VkMemoryRequirements::alignment)
+    uint32_t memoryTypeBits = ~0u;          // Acceptable types (VkMemoryRequirements::memoryTypeBits)
+    uint32_t requiredFlags = 0;             // GPUMemoryPropertyFlag bits the type must have
+    uint32_t preferredFlags = 0;            // Bits to prefer when several types qualify
+    GPUResourceTiling tiling = GPUResourceTiling::Linear;
+    bool dedicated = false;                 // Own memory object (driver-preferred, or large render targets)
+};
+
+struct GPUAllocation
+{
+    GPUDeviceMemory memory = 0;
+    uint64_t offset = 0;                    // Bind offset within 'memory'
+    uint64_t size = 0;
+    void* mapped = nullptr;                 // Host pointer to 'offset', host-visible types only
+    uint32_t memoryType = UINT32_MAX;
+    bool dedicated = false;
+
+    SlotHandle block;                       // Owning block (allocator internal)
+
+    bool IsValid() const { return memoryType != UINT32_MAX; }
+};
+
+// ============================================================================
+// Statistics
+// ============================================================================
+
+struct GPUMemoryTypeStats
+{
+    uint32_t blockCount = 0;                // Pooled memory objects
+    uint64_t blockBytes = 0;
+    uint32_t allocationCount = 0;           // Sub-allocations in the blocks
+    uint64_t usedBytes = 0;
+    uint64_t largestFreeRange = 0;          // Largest sub-allocation that fits without a new block
+
+    uint32_t dedicatedCount = 0;            // Memory objects with one resource each
+    uint64_t dedicatedBytes = 0;
+};
+
+struct GPUAllocatorStats
+{
+    std::vector<GPUMemoryTypeStats> types;  // Indexed by memory type
+    GPUMemoryTypeStats total;
+    uint32_t deviceAllocationCount = 0;     // Against GPUMemoryProperties::maxAllocationCount
+};
+
+struct GPUDefragmentStats
+{
+    uint32_t moves = 0;
+    uint64_t bytesMoved = 0;
+    uint32_t blocksFreed = 0;
+};
+
+/**
+ * Relocates a resource during GPUAllocator::Defragment()
+ * param from: Current allocation
+ * param to: New allocation in the same memory type
+ * return true once the resource's contents are copied and it is bound to
+ *        'to'; false leaves the resource where it is
+ */
+using GPUDefragmentMove = std::function<bool(const GPUAllocation& from, const GPUAllocation& to)>;
+
+// ============================================================================
+// Allocator
+// ============================================================================
+
+/**
+ * Device memory sub-allocator.
+ *
+ * Keeps device memory objects ("blocks") per memory type and tiling and
+ * sub-allocates resources from them with a TLSFAllocator, so the number of
+ * memory objects stays far below maxMemoryAllocationCount. Resources larger
+ * than half a block, or asking for it, get a dedicated memory object.
+ *
+ * Block size is min(blockSize, heap size / 8) so small heaps (e.g. a 256 MiB
+ * host-visible device-local heap) are not exhausted by a few blocks. If a
+ * block cannot be created, smaller blocks are tried, then the next memory
+ * type with the required flags. One empty block is kept per pool so
+ * per-frame allocate/free patterns do not churn device allocations.
+ *
+ * Host-visible blocks are persistently mapped: GPUAllocation::mapped is
+ * valid for the allocation's lifetime.
+ *
+ * Thread Safety: Thread-safe (one mutex).
+ */
+class SOLARC_CORE_API GPUAllocator
+{
+public:
+    static constexpr uint64_t DEFAULT_BLOCK_SIZE = 64ull * 1024 * 1024;
+
+    /**
+     * param backend: Must outlive the allocator
+     */
+    GPUAllocator(GPUMemoryProperties properties, GPUMemoryBackend& backend,
+        uint64_t blockSize = DEFAULT_BLOCK_SIZE);
+
+    /**
+     * Frees every block. Allocations still alive are reported as leaks.
+     */
+    ~GPUAllocator();
+
+    GPUAllocator(const GPUAllocator&) = delete;
+    GPUAllocator& operator=(const GPUAllocator&) = delete;
+
+    /**
+     * Allocate memory for a resource
+     * return Invalid allocation (IsValid() == false) if no acceptable memory
+     *        type has room
+     */
+    GPUAllocation Allocate(const GPUAllocationDesc& desc);
+
+    /**
+     * Free an allocation (no-op for invalid allocations)
+     * note: The GPU must be done with the resource (see RHI::IsFrameComplete)
+     */
+    void Free(const GPUAllocation& allocation);
+
+    /**
+     * Compact sparse blocks into fuller ones and free the blocks that empty
+     * param move: Copies and rebinds one resource; called with the allocator
+     *             locked, so it must not call back into the allocator
+     * param maxBytesToMove: Stop after moving this many bytes
+     * note: Call between frames with the GPU idle on the affected
+     *       resources: 'from' is reusable as soon as 'move' returns true
+     * note: Each allocation moves at most once per call
+     */
+    GPUDefragmentStats Defragment(const GPUDefragmentMove& move, uint64_t maxBytesToMove = UINT64_MAX);
+
+    /**
+     * Snapshot of block and allocation usage per memory type
+     */
+    GPUAllocatorStats GetStats() const;
+
+    /**
+     * Memory type for the given requirements (preferred flags first)
+     * return UINT32_MAX if no type has the required flags
+     */
+    uint32_t FindMemoryType(uint32_t memoryTypeBits, uint32_t requiredFlags, uint32_t preferredFlags = 0) const;
+
+    // Size of new blocks for a memory type
+    uint64_t GetBlockSize(uint32_t memoryType) const;
+
+    const GPUMemoryProperties& GetMemoryProperties() const { return m_Properties; }
+
+private:
+    struct Block
+    {
+        GPUDeviceMemory memory = 0;
+        void* mapped = nullptr;
+        uint64_t size = 0;
+        uint32_t memoryType = 0;
+        GPUResourceTiling tiling = GPUResourceTiling::Linear;
+
+        // Pooled blocks only (nullptr for dedicated allocations)
+        std::unique_ptr<TLSFAllocator> ranges;
+        std::unordered_map<uint64_t, GPUAllocationDesc> allocations; // Offset -> request, for defragmentation
+    };
+
+    GPUAllocation AllocateFromType(uint32_t memoryType, const GPUAllocationDesc& desc);
+    GPUAllocation AllocateDedicated(uint32_t memoryType, const GPUAllocationDesc& desc);
+    GPUAllocation SubAllocate(SlotHandle blockHandle, const GPUAllocationDesc& desc);
+
+    // Create a memory object, respecting the heap size and allocation count
+    bool CreateMemory(uint32_t memoryType, uint64_t size, GPUDeviceMemory& memory, void*& mapped);
+    void DestroyBlock(SlotHandle blockHandle);
+
+    std::vector<SlotHandle>& GetPool(uint32_t memoryType, GPUResourceTiling tiling);
+
+    // Free empty blocks beyond 'keep' per pool
+    uint32_t ReleaseEmptyBlocks(size_t keep);
+
+    GPUMemoryProperties m_Properties;
+    GPUMemoryBackend& m_Backend;
+    uint64_t m_BlockSize;
+
+    mutable std::mutex m_Mutex;
+    SlotMap<Block> m_Blocks;                        // Pooled blocks and dedicated allocations
+    std::vector<std::vector<SlotHandle>> m_Pools;   // [memoryType * 2 + tiling] -> pooled blocks
+    std::vector<uint64_t> m_HeapUsage;              // Bytes allocated from each heap
+};
@@ -0,0 +1,88 @@
+#pragma once
+#include "Preprocessor/API.h"
+#include <array>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+/**
+ * Identifies the device and driver a pipeline cache was built by
+ * (VkPhysicalDeviceProperties vendorID / deviceID / driverVersion /
+ * pipelineCacheUUID). Cache data is only valid for an identical one.
+ */
+struct PipelineCacheDeviceInfo
+{
+    uint32_t vendorID = 0;
+    uint32_t deviceID = 0;
+    uint32_t driverVersion = 0;
+    std::array<uint8_t, 16> uuid{};
+
+    bool operator==(const PipelineCacheDeviceInfo&) const = default;
+};
+
+enum class PipelineCacheLoadResult : uint8_t
+{
+    Loaded = 0,
+    Missing,            // No file (first run, or the cache was deleted)
+    Corrupt,            // Truncated, unknown format or checksum mismatch
+    DeviceMismatch,     // Written by another GPU or pipelineCacheUUID
+    DriverMismatch      // Same GPU, other driver version
+};
+
+inline std::string_view PipelineCacheLoadResultToString(PipelineCacheLoadResult result)
+{
+    switch (result)
+    {
+    case PipelineCacheLoadResult::Loaded:         return "loaded";
+    case PipelineCacheLoadResult::Missing:        return "missing";
+    case PipelineCacheLoadResult::Corrupt:        return "corrupt";
+    case PipelineCacheLoadResult::DeviceMismatch: return "device mismatch";
+    case PipelineCacheLoadResult::DriverMismatch: return "driver mismatch";
+    }
+    return "unknown";
+}
+
+/**
+ * On-disk pipeline cache: a small header followed by the driver's cache
+ * blob (vkGetPipelineCacheData).
+ *
+ * The header records the device and driver the blob came from plus a
+ * checksum, so a cache copied to another machine, left behind by a driver
+ * update or cut short by a crash is discarded before the driver sees it.
+ * Some drivers do not validate cache data robustly; a rejected cache only
+ * costs one cold start.
+ */
+class SOLARC_CORE_API PipelineCacheFile
+{
+public:
+    static constexpr uint32_t MAGIC = 0x46435053;  // "SPCF"
+    static constexpr uint32_t VERSION = 1;
+
+    /**
+     * Header plus data, ready to write
+     */
+    static std::vector<uint8_t> Serialize(const PipelineCacheDeviceInfo& device, const void* data, size_t size);
+
+    /**
+     * Validate a file's contents against the current device
+     * param data: Receives the driver blob when Loaded, cleared otherwise
+     */
+    static PipelineCacheLoadResult Deserialize(const std::vector<uint8_t>& file,
+        const PipelineCacheDeviceInfo& device, std::vector<uint8_t>& data);
+
+    /**
+     * Read and validate a cache file
+     * param data: Receives the driver blob when Loaded, cleared otherwise
+     */
+    static PipelineCacheLoadResult Load(const std::string& path,
+        const PipelineCacheDeviceInfo& device, std::vector<uint8_t>& data);
+
+    /**
+     * Write a cache file, creating its directory
+     * return false if the file could not be written
+     * note: Writes a temporary file and renames it over 'path', so a crash
+     *       mid-write leaves the previous cache intact
+     */
+    static bool Save(const std::string& path, const PipelineCacheDeviceInfo& device, const void* data, size_t size);
+};
@@ -0,0 +1,142 @@
+#pragma once
+#include "Preprocessor/API.h"
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <unordered_map>
+
+class JobSystem;
+
+// Hash of everything a pipeline is built from (shaders, state, formats)
+using PipelineKey = uint64_t;
+
+// Backend pipeline object (VkPipeline as an integer); 0 = none
+using RHIPipelineHandle = uint64_t;
+
+struct PipelineCompileResult
+{
+    RHIPipelineHandle pipeline = 0;     // 0 = compilation failed
+    bool cacheHit = false;              // Driver took it from the pipeline cache (creation feedback)
+};
+
+/**
+ * Builds one pipeline. Runs on a JobSystem worker, or on the calling thread
+ * for PipelineCompileQueue::CompileNow(). May throw; that counts as a failure.
+ */
+using PipelineCompileFunction = std::function<PipelineCompileResult()>;
+
+struct PipelineCompileStats
+{
+    uint64_t requests = 0;              // Request() / CompileNow() calls
+    uint64_t fallbackRequests = 0;      // Requests answered with the fallback (not ready yet, or failed)
+
+    uint32_t compiles = 0;              // Finished compilations
+    uint32_t cacheHits = 0;             // ... served from the driver's pipeline cache
+    uint32_t failures = 0;
+    uint32_t pending = 0;               // Compiling right now or queued
+
+    double totalCompileMs = 0.0;
+    double maxCompileMs = 0.0;
+
+    double GetCacheHitRate() const { return compiles > 0 ? static_cast<double>(cacheHits) / compiles : 0.0; }
+    double GetAverageCompileMs() const { return compiles > 0 ? totalCompileMs / compiles : 0.0; }
+};
+
+/**
+ * Compiles pipelines on JobSystem workers so draws never wait on the driver.
+ *
+ * The first Request() for a key schedules its compilation and returns the
+ * caller's fallback (e.g. a simpler pipeline of the same layout, or 0 to
+ * skip the draw) until the pipeline is ready; later requests cost one hash
+ * lookup. Pipelines that must exist this frame use CompileNow(), which
+ * waits instead of falling back.
+ *
+ * A failed compilation is not retried: its key keeps returning the
+ * fallback, and the failure is logged once.
+ *
+ * Thread Safety: Thread-safe. Compile functions run concurrently with each
+ * other; vkCreate*Pipelines is safe to call from several threads with one
+ * VkPipelineCache.
+ */
+class SOLARC_CORE_API PipelineCompileQueue
+{
+public:
+    /**
+     * param jobSystem: Runs the compilations; must outlive the queue
+     */
+    explicit PipelineCompileQueue(JobSystem& jobSystem);
+
+    /**
+     * Waits for compilations still running
+     */
+    ~PipelineCompileQueue();
+
+    PipelineCompileQueue(const PipelineCompileQueue&) = delete;
+    PipelineCompileQueue& operator=(const PipelineCompileQueue&) = delete;
+
+    /**
+     * Get a pipeline, compiling it in the background on first use
+     * param compile: Called once per key, on a worker
+     * param fallback: Returned while the pipeline is compiling or if it failed
+     */
+    RHIPipelineHandle Request(PipelineKey key, const PipelineCompileFunction& compile, RHIPipelineHandle fallback = 0);
+
+    /**
+     * Get a pipeline, compiling it on the calling thread if needed
+     * return 0 if compilation failed
+     * note: Waits for a compilation of the same key already running (in
+     *       the background or in another CompileNow) instead of starting a
+     *       second one. A background compile still queued is taken over and
+     *       run here, so calling this from a job cannot wait on a job that
+     *       needs this worker to start
+     */
+    RHIPipelineHandle CompileNow(PipelineKey key, const PipelineCompileFunction& compile);
+
+    /**
+     * Has the pipeline compiled successfully?
+     */
+    bool IsReady(PipelineKey key) const;
+
+    /**
+     * Block until every compilation finished, background and CompileNow
+     */
+    void WaitIdle();
+
+    /**
+     * Wait for pending compilations, then hand every pipeline to 'destroy'
+     * and forget all keys
+     * note: Call before the device goes; the GPU must be done with the pipelines
+     */
+    void Clear(const std::function<void(RHIPipelineHandle)>& destroy);
+
+    PipelineCompileStats GetStats() const;
+
+private:
+    enum class State : uint8_t
+    {
+        Compiling = 0,
+        Ready,
+        Failed
+    };
+
+    struct Entry
+    {
+        State state = State::Compiling;
+        RHIPipelineHandle pipeline = 0;
+        bool started = false; // A thread runs its compile function (a queued job has not)
+    };
+
+    // Run 'compile', time it and publish the result to the key's entry
+    void Compile(PipelineKey key, const PipelineCompileFunction& compile);
+
+    // Body of a background job: compile unless CompileNow took the key over
+    void RunJob(PipelineKey key, const PipelineCompileFunction& compile);
+
+    JobSystem& m_JobSystem;
+
+    mutable std::mutex m_Mutex;
+    std::condition_variable m_Compiled; // Notified whenever a compilation finishes
+    std::unordered_map<PipelineKey, Entry> m_Entries;
+    PipelineCompileStats m_Stats;
+};
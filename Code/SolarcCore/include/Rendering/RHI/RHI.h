@@ -1,33 +1,115 @@
 #pragma once
 #include "Preprocessor/API.h"
 #include "RHIResult.h"
+#include "RHIDesc.h"
+#include "DescriptorHeap.h"
 #include "Window/Window.h"
 #include "Event/EventListener.h"
 #include "Event/WindowEvent.h"
+#include "Utility/PresentTimingModel.h"
+#include <chrono>
+#include <functional>
 #include <memory>
 #include <mutex>
+#include <vector>
+
+class JobSystem;
 
 // Forward declarations for backend types
 #ifdef SOLARC_RENDERER_DX12
     class DX12Device;
     class DX12Swapchain;
     class DX12CommandContext;
+    struct ID3D12GraphicsCommandList;
     
     using RHIDevice = DX12Device;
     using RHISwapchain = DX12Swapchain;
     using RHICommandContext = DX12CommandContext;
+    using RHICommandList = ID3D12GraphicsCommandList*;
 #elif SOLARC_RENDERER_VULKAN
     class VulkanDevice;
     class VulkanSwapchain;
     class VulkanCommandContext;
+    struct VkCommandBuffer_T;
     
     using RHIDevice = VulkanDevice;
     using RHISwapchain = VulkanSwapchain;
     using RHICommandContext = VulkanCommandContext;
+    using RHICommandList = VkCommandBuffer_T*;
 #else
     #error "No Renderer Backend Selected!"
 #endif
 
+/**
+ * Records one task of RHI::RecordParallel.
+ *
+ * Handed to the task on a JobSystem worker (or the calling thread when the
+ * task runs alone) and valid only during that call.
+ * Its commands render into the frame's target after everything recorded
+ * before RecordParallel, and in task order relative to the other tasks,
+ * whichever worker finishes first.
+ */
+class SOLARC_CORE_API RHICommandRecorder
+{
+public:
+    /**
+     * Clear the whole render target
+     * param r, g, b, a: Clear color components (0.0 - 1.0 range)
+     */
+    void Clear(float r, float g, float b, float a);
+
+    /**
+     * Clear a rectangle of the render target (clipped to the target)
+     * param x, y: Top-left corner in buffer pixels
+     * param width, height: Size in buffer pixels
+     * param r, g, b, a: Clear color components (0.0 - 1.0 range)
+     */
+    void ClearRect(int32_t x, int32_t y, uint32_t width, uint32_t height, float r, float g, float b, float a);
+
+    /**
+     * Set push constants of the bindless pipeline layout (descriptor
+     * indices and per-draw data)
+     * param offset, size: Byte range within RHI_PUSH_CONSTANT_SIZE
+     * note: No-op without a descriptor heap (see RHI::HasDescriptorHeap)
+     */
+    void PushConstants(const void* data, uint32_t size, uint32_t offset = 0);
+
+    // Render target size in buffer pixels
+    uint32_t GetWidth() const { return m_Width; }
+    uint32_t GetHeight() const { return m_Height; }
+
+    // Position of this task in the RecordParallel call
+    size_t GetTaskIndex() const { return m_TaskIndex; }
+
+private:
+    friend class RHI;
+    RHICommandRecorder() = default;
+
+    RHIDevice* m_Device = nullptr;          // Non-owning
+    RHISwapchain* m_Swapchain = nullptr;    // Non-owning
+    RHICommandList m_CommandList = nullptr; // Vulkan: this task's secondary; DX12: the frame's list
+    uint32_t m_Width = 0;
+    uint32_t m_Height = 0;
+    size_t m_TaskIndex = 0;
+};
+
+using RHIRecordTask = std::function<void(RHICommandRecorder&)>;
+
+// Backend object as an integer (VkImageView, VkBuffer); 0 = none
+using RHINativeHandle = uint64_t;
+
+/**
+ * CPU-side timings of the last frame cycle, in microseconds.
+ * Zero when the step did not run (dummy frame, nothing presented).
+ */
+struct RHIFrameTimings
+{
+    uint64_t waitForFrameUs = 0;    // Blocked until the frame-in-flight slot was free
+    uint64_t acquireUs = 0;         // Blocked acquiring the next swapchain image
+    uint64_t presentIntervalUs = 0; // Since the previous successful Present()
+    bool presented = false;         // Frame reached the swapchain
+};
+
 /**
  * Rendering Hardware Interface (RHI)
  * 
@@ -41,8 +123,9 @@
  * 
  * Thread Safety:
  * - Initialize/Shutdown: Main thread only
- * - Frame cycle (Begin/Clear/End/Present): Main thread only
- * - WaitForGPU: Any thread (synchronization primitive)
+ * - Frame cycle (Begin/Clear/RecordParallel/End/Present): Main thread only
+ * - RHICommandRecorder: The JobSystem worker running its task
+ * - WaitForGPU / GetLastSubmittedFrame / IsFrameComplete: Any thread
  */
 class SOLARC_CORE_API RHI : public EventListener<WindowEvent>
 {
@@ -56,11 +139,14 @@ public:
     /**
      * Initialize the RHI with a target window
      * param window: Window to render to (must remain alive until Shutdown)
+     * param desc: Render target and adapter preference (see RHIDesc)
      * throws std::runtime_error if initialization fails
      * note: Must be called from main thread
+     * note: Headless windows have no surface and always render offscreen
+     * note: Offscreen is Vulkan only; DX12 throws
      */
 
-    static void Initialize(std::shared_ptr<Window> window);
+    static void Initialize(std::shared_ptr<Window> window, const RHIDesc& desc = {});
 
     /**
      * Shutdown the RHI and release all GPU resources
@@ -82,9 +168,25 @@ public:
      * Clear the current render target
      * param r, g, b, a: Clear color components (0.0 - 1.0 range)
      * note: Must be called between BeginFrame() and EndFrame()
+     * note: May be called several times per frame; the last clear wins
      */
     void Clear(float r, float g, float b, float a);
 
+    /**
+     * Record part of the frame in parallel on JobSystem workers
+     * param jobSystem: Workers to record on
+     * param tasks: Each gets its own recorder; results execute in vector order
+     * note: Must be called between BeginFrame() and EndFrame()
+     * note: Blocks until every task finished, then merges them into the frame
+     * note: Tasks must only use their recorder; calling RHI methods from a task deadlocks
+     * note: Rethrows the first exception a task threw (that task's commands are dropped)
+     * note: Vulkan records secondary command buffers from per-worker, per-frame
+     *       command pools; DX12 runs the tasks in order on the calling thread
+     * note: A single task is recorded on the calling thread (Vulkan: into a
+     *       secondary from the caller's own pool), with no job dispatch
+     */
+    void RecordParallel(JobSystem& jobSystem, std::vector<RHIRecordTask> tasks);
+
     /**
      * End the current frame
      * note: Submits command buffer to GPU
@@ -112,6 +214,32 @@ public:
      */
     bool GetVSync() const { return m_VSync; }
 
+    /**
+     * Is the RHI rendering to an offscreen image ring instead of the window?
+     * note: Offscreen frames render while the window is hidden and ignore VSync
+     */
+    bool IsOffscreen() const { return m_Target == RHITarget::Offscreen; }
+
+    /**
+     * Get the latency mode the RHI was created with
+     */
+    RHILatencyMode GetLatencyMode() const { return m_LatencyMode; }
+
+    /**
+     * Get the number of frames the CPU may record ahead of the GPU
+     * note: Fixed at Initialize() (RHIDesc); DX12 always runs 2
+     */
+    uint32_t GetFramesInFlight() const { return m_FramesInFlight; }
+
+    /**
+     * Copy the last presented offscreen frame to the CPU
+     * param pixels: Receives width * height BGRA8 pixels, rows top to bottom, tightly packed
+     * param width, height: Receive the frame's size in pixels
+     * return false if not offscreen or nothing was presented since the last resize
+     * note: Waits for the GPU; for tests and captures, not per-frame use
+     */
+    bool ReadbackFrame(std::vector<uint8_t>& pixels, uint32_t& width, uint32_t& height);
+
     /**
      * Block until all GPU work is complete
      * note: Thread-safe, can be called from any thread
@@ -119,12 +247,62 @@ public:
      */
     void WaitForGPU();
 
+    /**
+     * Get the GPU frame number of the most recent submission
+     * return Monotonic value signaled on the queue's timeline when that
+     *        frame's GPU work completes; 0 = nothing submitted yet
+     * note: Thread-safe. Frames skipped while minimized are not submitted,
+     *       so this is not GetCurrentFrameIndex()
+     * note: Tag a resource with it when it is released, then delete the
+     *       resource once IsFrameComplete() returns true
+     */
+    uint64_t GetLastSubmittedFrame() const;
+
+    /**
+     * Has the GPU finished the frame with this number (and all before it)?
+     * note: Thread-safe and cheap (no lock; at most one counter query)
+     */
+    bool IsFrameComplete(uint64_t frame) const;
+
+    /**
+     * Is there a bindless descriptor heap?
+     * return false on DX12 and on Vulkan devices without descriptor indexing;
+     *        descriptor calls then return invalid handles / do nothing
+     */
+    bool HasDescriptorHeap() const;
+
+    /**
+     * Write a descriptor into the bindless heap (see DescriptorHeap.h)
+     * param imageView: VkImageView in SHADER_READ_ONLY_OPTIMAL layout when sampled
+     * param buffer, offset, range: Storage buffer range (range in bytes)
+     * return Invalid handle if the type's array is full or there is no heap
+     * note: Thread-safe. The object must stay alive until the descriptor is
+     *       freed and the frames that used it completed
+     */
+    RHIDescriptorHandle CreateSampledImageDescriptor(RHINativeHandle imageView);
+    RHIDescriptorHandle CreateStorageBufferDescriptor(RHINativeHandle buffer, uint64_t offset, uint64_t range);
+
+    /**
+     * Write a descriptor for one of the heap's own samplers
+     * return Invalid handle if the sampler array is full or there is no heap
+     * note: Thread-safe
+     */
+    RHIDescriptorHandle CreateSamplerDescriptor(RHISamplerFilter filter);
+
+    /**
+     * Release a descriptor; its index is reused once every frame submitted
+     * so far, and the one being recorded, completed
+     * note: Thread-safe. No-op for invalid handles and without a heap
+     */
+    void FreeDescriptor(const RHIDescriptorHandle& handle);
+
     /**
      * Handle window resize event
-     * param width: New window width
-     * param height: New window height
+     * param width: New window width (logical)
+     * param height: New window height (logical)
      * note: Called automatically via event system
-     * note: Recreates swapchain with new dimensions
+     * note: Recreates swapchain at the window's buffer size (Window::GetBufferExtent),
+     *       which also covers display / render scale changes
      */
     void OnWindowResize(int32_t width, int32_t height);
     /**
@@ -133,6 +311,30 @@ public:
      */
     uint32_t GetCurrentFrameIndex() const { return m_FrameIndex; }
 
+    /**
+     * Get input-to-present latency of the last presented frame
+     * return Microseconds from the oldest input event consumed by the window
+     *        that frame until the frame was handed to the swapchain,
+     *        or 0 if that frame consumed no input
+     * note: Measures CPU-side latency up to Present(); scan-out time is not included
+     */
+    uint64_t GetInputToPresentLatencyUs() const { return m_InputToPresentLatencyUs; }
+
+    /**
+     * Get blocking times measured during the last BeginFrame() / Present()
+     * return Timings of the most recent frame cycle (see RHIFrameTimings)
+     * note: Feed into FrameTimer for percentiles
+     */
+    const RHIFrameTimings& GetLastFrameTimings() const { return m_FrameTimings; }
+
+    /**
+     * Get the display timing model of the presenting surface
+     * return nullptr if the backend / compositor reports no presentation
+     *        feedback (currently: Vulkan on Wayland with wp_presentation)
+     * note: Attach to FramePacer for just-in-time frame starts; valid until Shutdown()
+     */
+    PresentTimingModel* GetPresentTiming();
+
 protected:
     // EventListener override - handles window resize events
     void OnEvent(const std::shared_ptr<const WindowEvent>& e) override;
@@ -145,12 +347,24 @@ private:
     friend struct std::default_delete<RHI>;
 
     // Internal initialization logic
-    void InitializeInternal(std::shared_ptr<Window> window);
+    void InitializeInternal(std::shared_ptr<Window> window, const RHIDesc& desc);
     void ShutdownInternal();
 
-    // Resize handling
+    // Resize handling (buffer pixels)
     void ResizeSwapchain(int32_t width, int32_t height);
 
+    // Can a frame be rendered for this window state? (offscreen ignores visibility)
+    bool IsTargetReady(const WindowState& state) const;
+
+#ifdef SOLARC_RENDERER_VULKAN
+    // Transition the acquired image for rendering
+    void BeginImageAccess();
+
+    // Acquire the frame's image if not done yet (just-in-time acquire)
+    // return false if the swapchain is out of date and the frame is dropped
+    bool EnsureImageAcquired();
+#endif
+
     // Singleton instance
     static std::unique_ptr<RHI> s_Instance;
     static std::mutex s_InstanceMutex;
@@ -168,11 +382,22 @@ private:
     bool m_InFrame = false;      // True between BeginFrame/EndFrame
     bool m_InDummyFrame = false;  // True when window is hidden but frame cycle is logically active
     bool m_VSync = true;         // VSync enabled by default
+    RHITarget m_Target = RHITarget::Window;
+    RHILatencyMode m_LatencyMode = RHILatencyMode::Balanced;
+    uint32_t m_FramesInFlight = 2;
     uint32_t m_FrameIndex = 0;   // Current frame number
+    uint64_t m_InputToPresentLatencyUs = 0; // Last frame's input-to-present latency
+    RHIFrameTimings m_FrameTimings;          // Last frame's blocking times
+    std::chrono::steady_clock::time_point m_LastPresentTime{}; // For present-to-present interval
+    std::chrono::steady_clock::time_point m_FrameStartTime{};  // Last BeginFrame(), for presentation feedback
+    PresentTimingModel m_PresentTiming;                        // Fed by the swapchain's presentation feedback
 
 #ifdef SOLARC_RENDERER_VULKAN
-        float m_PendingClearColor[4] = { 0.0f, 0.0f, 0.0f, 1.0f }; // Default black
-        bool m_RenderPassActive = false;
+        bool m_RenderingActive = false; // Between vkCmdBeginRendering / vkCmdEndRendering
+        bool m_ImageWritten = false;      // Current image rendered to this frame (later passes load it)
+        bool m_JustInTimeAcquire = false; // Low latency: acquire at first use of the image
+        bool m_ImageAcquired = false;     // Current frame's image acquired and transitioned
+        bool m_AcquireFailed = false;     // Just-in-time acquire hit an out-of-date swapchain
 #endif
     
     // Thread safety
@@ -0,0 +1,118 @@
+#pragma once
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+
+/**
+ * What the RHI renders into.
+ */
+enum class RHITarget : uint8_t
+{
+    Window,     // Swapchain on the window's surface
+    Offscreen   // Ring of device images with CPU readback; no surface, no present
+};
+
+/**
+ * Trade-off between input latency and CPU/GPU overlap ([rendering] latency_mode).
+ *
+ * - LowLatency: 1 frame in flight. The CPU waits for the previous frame's
+ *               GPU work before recording, and the swapchain image is
+ *               acquired just before its first use instead of in BeginFrame.
+ * - Balanced:   2 frames in flight (default).
+ * - Throughput: 3 frames in flight. The CPU rarely waits on the GPU, at the
+ *               cost of up to one more frame of latency.
+ */
+enum class RHILatencyMode : uint8_t
+{
+    LowLatency = 0,
+    Balanced,
+    Throughput
+};
+
+inline std::string_view RHILatencyModeToString(RHILatencyMode mode)
+{
+    switch (mode)
+    {
+    case RHILatencyMode::LowLatency: return "low_latency";
+    case RHILatencyMode::Balanced:   return "balanced";
+    case RHILatencyMode::Throughput: return "throughput";
+    }
+    return "unknown";
+}
+
+/**
+ * Parse a latency mode as printed by RHILatencyModeToString (case-insensitive).
+ * return std::nullopt for unknown names
+ */
+inline std::optional<RHILatencyMode> RHILatencyModeFromString(std::string_view name)
+{
+    for (RHILatencyMode mode : { RHILatencyMode::LowLatency, RHILatencyMode::Balanced, RHILatencyMode::Throughput })
+    {
+        const std::string_view candidate = RHILatencyModeToString(mode);
+        if (std::equal(name.begin(), name.end(), candidate.begin(), candidate.end(),
+            [](char a, char b) { return std::tolower(static_cast<unsigned char>(a)) == b; }))
+            return mode;
+    }
+    return std::nullopt;
+}
+
+/**
+ * RHI creation options ([rendering] offscreen / device / latency_mode /
+ * frames_in_flight / pipeline_cache, --offscreen / --device).
+ */
+struct RHIDesc
+{
+    static constexpr uint32_t MIN_FRAMES_IN_FLIGHT = 1;
+    static constexpr uint32_t MAX_FRAMES_IN_FLIGHT = 4;
+
+    /**
+     * Offscreen renders at the window's buffer extent without touching the
+     * window's surface, so it runs without a display server (headless
+     * windows) and on devices that cannot present (CPU rasterizers such as
+     * lavapipe). Frames are paced by the queue's timeline only.
+     */
+    RHITarget target = RHITarget::Window;
+
+    /**
+     * Case-insensitive substring of the adapter name to prefer
+     * (e.g. "llvmpipe"). Empty = highest rated adapter.
+     */
+    std::string preferredDevice;
+
+    RHILatencyMode latencyMode = RHILatencyMode::Balanced;
+
+    /**
+     * Frames the CPU may record ahead of the GPU. 0 = the latency mode's
+     * default; otherwise clamped to [MIN_FRAMES_IN_FLIGHT, MAX_FRAMES_IN_FLIGHT].
+     */
+    uint32_t framesInFlight = 0;
+
+    /**
+     * Pipeline cache file, loaded at startup and written at shutdown so
+     * pipelines compiled in one run are driver cache hits in the next
+     * ([rendering] pipeline_cache). Empty = in-memory cache only.
+     * note: Vulkan only; DX12 has no pipeline cache yet
+     */
+    std::string pipelineCachePath;
+
+    uint32_t GetFramesInFlight() const
+    {
+        if (framesInFlight != 0)
+            return std::clamp(framesInFlight, MIN_FRAMES_IN_FLIGHT, MAX_FRAMES_IN_FLIGHT);
+
+        switch (latencyMode)
+        {
+        case RHILatencyMode::LowLatency: return 1;
+        case RHILatencyMode::Throughput: return 3;
+        default:                         return 2;
+        }
+    }
+
+    /**
+     * Acquire the swapchain image at its first use rather than in BeginFrame?
+     */
+    bool IsJustInTimeAcquire() const { return latencyMode == RHILatencyMode::LowLatency; }
+};
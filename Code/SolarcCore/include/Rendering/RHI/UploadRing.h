@@ -0,0 +1,90 @@
+#pragma once
+#include "Preprocessor/API.h"
+#include <atomic>
+#include <cstdint>
+
+/**
+ * CPU-written range of an upload ring
+ */
+struct UploadAllocation
+{
+    void* mapped = nullptr;     // Write the data here
+    uint64_t offset = 0;        // Offset in the ring's GPU buffer (bind / copy source offset)
+    uint64_t size = 0;
+
+    bool IsValid() const { return mapped != nullptr; }
+};
+
+/**
+ * Per-frame linear allocator over one persistently mapped buffer.
+ *
+ * The buffer is split into one partition per frame in flight. Allocations
+ * bump a pointer in the current frame's partition and are never freed
+ * individually: BeginFrame() rewinds a partition once the GPU finished the
+ * frame that last used it, so reclamation is keyed on the frame's fence
+ * and costs nothing per allocation.
+ *
+ * Allocate() is lock-free (one compare-exchange) and may be called from
+ * any number of threads, e.g. JobSystem workers recording a frame. When a
+ * partition is full, Allocate() fails instead of overwriting memory the GPU
+ * may still read; GetPeakUsedBytes() tells how large partitions need to be.
+ *
+ * Thread Safety: Allocate() and the queries are thread-safe. BeginFrame()
+ * must not run concurrently with Allocate().
+ */
+class SOLARC_CORE_API UploadRing
+{
+public:
+    static constexpr uint64_t DEFAULT_ALIGNMENT = 16;
+
+    /**
+     * param mapped: Host pointer to the buffer start (frameSize * frameCount bytes)
+     * param frameSize: Bytes per frame partition
+     * param frameCount: Frames in flight
+     */
+    UploadRing(void* mapped, uint64_t frameSize, uint32_t frameCount);
+
+    /**
+     * Start allocating from a frame's partition, discarding its previous contents
+     * note: The GPU must be done with the partition (its frame's fence waited on)
+     */
+    void BeginFrame(uint32_t frameIndex);
+
+    /**
+     * Allocate from the current frame's partition
+     * param alignment: Power of two; applies to the offset in the buffer
+     * return Invalid allocation if the partition is full
+     */
+    UploadAllocation Allocate(uint64_t size, uint64_t alignment = DEFAULT_ALIGNMENT);
+
+    /**
+     * Allocate and copy 'size' bytes of 'data'
+     */
+    UploadAllocation Upload(const void* data, uint64_t size, uint64_t alignment = DEFAULT_ALIGNMENT);
+
+    uint64_t GetFrameSize() const { return m_FrameSize; }
+    uint32_t GetFrameCount() const { return m_FrameCount; }
+    uint32_t GetCurrentFrame() const { return m_FrameIndex; }
+
+    // Bytes allocated this frame (including alignment padding)
+    uint64_t GetUsedBytes() const { return m_Head.load(std::memory_order_relaxed); }
+
+    // Most bytes any frame used since creation
+    uint64_t GetPeakUsedBytes() const;
+
+    // Allocations that did not fit this frame
+    uint32_t GetFailedAllocations() const { return m_Failed.load(std::memory_order_relaxed); }
+
+private:
+    uint8_t* m_Mapped;
+    uint64_t m_FrameSize;
+    uint32_t m_FrameCount;
+
+    // Written by BeginFrame only
+    uint32_t m_FrameIndex = 0;
+    uint64_t m_FrameBase = 0;
+
+    std::atomic<uint64_t> m_Head{ 0 };  // Offset in the current partition
+    std::atomic<uint32_t> m_Failed{ 0 };
+    uint64_t m_PeakUsedBytes = 0;       // Of finished frames
+};
@@ -0,0 +1,329 @@
+#pragma once
+#include "Preprocessor/API.h"
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <string>
+#include <string_view>
+#include <vector>
+
+class RHI;
+class RHICommandRecorder;
+class JobSystem;
+
+// ============================================================================
+// Resources
+// ============================================================================
+
+enum class RGFormat : uint8_t
+{
+    BGRA8_UNORM = 0,
+    RGBA8_UNORM,
+    RGBA16_FLOAT,
+    D32_FLOAT
+};
+
+inline uint32_t RGFormatBytesPerPixel(RGFormat format)
+{
+    switch (format)
+    {
+    case RGFormat::RGBA16_FLOAT: return 8;
+    default:                     return 4;
+    }
+}
+
+struct RGTextureDesc
+{
+    uint32_t width = 0;
+    uint32_t height = 0;
+    RGFormat format = RGFormat::RGBA8_UNORM;
+};
+
+/**
+ * How a pass uses a resource. Maps to an image layout plus stage / access
+ * masks (Vulkan) or a resource state (DX12) when barriers are recorded.
+ */
+enum class RGAccess : uint8_t
+{
+    None = 0,               // Not accessed yet: contents undefined (may be discarded)
+    ColorAttachmentWrite,
+    DepthAttachmentWrite,
+    ShaderRead,
+    TransferRead,
+    TransferWrite,
+    Present
+};
+
+inline bool RGIsWriteAccess(RGAccess access)
+{
+    return access == RGAccess::ColorAttachmentWrite
+        || access == RGAccess::DepthAttachmentWrite
+        || access == RGAccess::TransferWrite;
+}
+
+inline std::string_view RGAccessToString(RGAccess access)
+{
+    switch (access)
+    {
+    case RGAccess::None:                 return "None";
+    case RGAccess::ColorAttachmentWrite: return "ColorAttachmentWrite";
+    case RGAccess::DepthAttachmentWrite: return "DepthAttachmentWrite";
+    case RGAccess::ShaderRead:           return "ShaderRead";
+    case RGAccess::TransferRead:         return "TransferRead";
+    case RGAccess::TransferWrite:        return "TransferWrite";
+    case RGAccess::Present:              return "Present";
+    }
+    return "Unknown";
+}
+
+struct RGResourceHandle
+{
+    static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+    uint32_t index = INVALID_INDEX;
+
+    bool IsValid() const { return index != INVALID_INDEX; }
+    bool operator==(const RGResourceHandle&) const = default;
+};
+
+struct RGPassHandle
+{
+    static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+    uint32_t index = INVALID_INDEX;
+
+    bool IsValid() const { return index != INVALID_INDEX; }
+    bool operator==(const RGPassHandle&) const = default;
+};
+
+/**
+ * State change of one resource, recorded before a pass (or at the end of
+ * the graph for imported resources).
+ */
+struct RGBarrier
+{
+    RGResourceHandle resource;
+    RGAccess before = RGAccess::None; // None = discard the old contents
+    RGAccess after = RGAccess::None;
+
+    bool operator==(const RGBarrier&) const = default;
+};
+
+/**
+ * Placement of a transient texture in the graph's shared transient heap.
+ * Textures whose lifetimes do not overlap may share bytes (aliasing).
+ */
+struct RGTransientAllocation
+{
+    uint64_t offset = 0;
+    uint64_t size = 0;
+};
+
+// ============================================================================
+// Passes
+// ============================================================================
+
+using RGExecuteFunc = std::function<void(RHICommandRecorder&)>;
+
+class RenderGraph;
+
+/**
+ * Declares what a pass reads and writes (RenderGraph::AddPass setup).
+ */
+class SOLARC_CORE_API RGPassBuilder
+{
+public:
+    /**
+     * Create a transient texture owned by the graph
+     * note: Lives from its first to its last use; memory may be shared with
+     *       other transients whose lifetimes do not overlap
+     */
+    RGResourceHandle CreateTexture(std::string name, const RGTextureDesc& desc);
+
+    /**
+     * Declare a read
+     * param access: ShaderRead, TransferRead or Present
+     */
+    RGResourceHandle Read(RGResourceHandle resource, RGAccess access = RGAccess::ShaderRead);
+
+    /**
+     * Declare a write
+     * param access: ColorAttachmentWrite, DepthAttachmentWrite or TransferWrite
+     * note: Writes keep the previous contents (partial writes such as ClearRect)
+     */
+    RGResourceHandle Write(RGResourceHandle resource, RGAccess access = RGAccess::ColorAttachmentWrite);
+
+    /**
+     * Never cull this pass, even if nothing reads its results
+     */
+    void SetSideEffects();
+
+private:
+    friend class RenderGraph;
+    RGPassBuilder(RenderGraph& graph, uint32_t passIndex) : m_Graph(graph), m_PassIndex(passIndex) {}
+
+    RenderGraph& m_Graph;
+    uint32_t m_PassIndex;
+};
+
+// ============================================================================
+// Render Graph
+// ============================================================================
+
+/**
+ * Frame graph: passes declare resource accesses, Compile() derives the rest.
+ *
+ * Compile():
+ * - Culls passes whose results never reach an imported resource or a pass
+ *   with side effects (reverse walk from the graph's outputs)
+ * - Computes the barriers each surviving pass needs, and the final
+ *   barriers that leave imported resources in their declared final access
+ * - Splits the passes into batches at barriers. Passes in a batch need no
+ *   barrier between them and are recorded in parallel
+ * - Places transient textures in one heap, aliasing textures whose
+ *   lifetimes (first to last surviving use) do not overlap
+ *
+ * Compile() touches no GPU object, so graphs are unit-testable; Execute()
+ * records the compiled graph through the RHI.
+ *
+ * Passes run in the order they were added; a pass may only depend on
+ * passes added before it.
+ *
+ * Thread Safety: Not thread-safe. Build, compile and execute on one thread.
+ */
+class SOLARC_CORE_API RenderGraph
+{
+public:
+    // Transient placements are aligned to this (covers Vulkan / DX12 image alignment)
+    static constexpr uint64_t TRANSIENT_ALIGNMENT = 64 * 1024;
+
+    RenderGraph() = default;
+
+    /**
+     * Remove all passes and resources (keeps allocated capacity)
+     */
+    void Reset();
+
+    /**
+     * Import a resource the graph does not own (e.g. the swapchain back buffer)
+     * param initialAccess: Access when the graph starts (None = contents undefined)
+     * param finalAccess: Access the graph must leave it in; imported resources are outputs
+     */
+    RGResourceHandle ImportTexture(std::string name, const RGTextureDesc& desc,
+        RGAccess initialAccess, RGAccess finalAccess);
+
+    /**
+     * Add a pass
+     * param setup: Declares the pass's resources (runs immediately)
+     * param execute: Records the pass; nullptr for passes that only declare accesses
+     */
+    RGPassHandle AddPass(std::string name, const std::function<void(RGPassBuilder&)>& setup,
+        RGExecuteFunc execute = nullptr);
+
+    /**
+     * Cull, compute barriers and batches, and place transients
+     */
+    void Compile();
+
+    /**
+     * Record the compiled graph as one frame
+     * note: BeginFrame, one RHI::RecordParallel per batch, EndFrame, and
+     *       Present when a surviving pass presents an imported resource.
+     *       A batch with a single task is recorded on the calling thread;
+     *       only larger batches fan out to workers
+     * note: The pass and final barriers from Compile() are not recorded:
+     *       the only supported resource is the imported back buffer, whose
+     *       transitions the RHI records itself (acquire, EndFrame). Transient
+     *       textures are placed but not yet backed by GPU memory
+     */
+    void Execute(RHI& rhi, JobSystem& jobSystem);
+
+    // ------------------------------------------------------------------------
+    // Compiled results (valid after Compile())
+    // ------------------------------------------------------------------------
+
+    bool IsCompiled() const { return m_Compiled; }
+
+    bool IsPassCulled(RGPassHandle pass) const;
+
+    // Barriers recorded before the pass (empty for culled passes)
+    const std::vector<RGBarrier>& GetPassBarriers(RGPassHandle pass) const;
+
+    // Barriers recorded after the last pass (imported resources to their final access)
+    const std::vector<RGBarrier>& GetFinalBarriers() const { return m_FinalBarriers; }
+
+    // Surviving passes in execution order
+    const std::vector<RGPassHandle>& GetExecutionOrder() const { return m_ExecutionOrder; }
+
+    // Parallel recording batches, each a run of GetExecutionOrder()
+    const std::vector<std::vector<RGPassHandle>>& GetBatches() const { return m_Batches; }
+
+    // Heap placement of a transient texture (size 0 if unused after culling)
+    RGTransientAllocation GetTransientAllocation(RGResourceHandle resource) const;
+
+    // Bytes the transient heap needs with aliasing
+    uint64_t GetTransientHeapSize() const { return m_TransientHeapSize; }
+
+    // Bytes the transient textures would need without aliasing
+    uint64_t GetTransientBytesWithoutAliasing() const;
+
+    size_t GetPassCount() const { return m_Passes.size(); }
+    size_t GetResourceCount() const { return m_Resources.size(); }
+    std::string_view GetPassName(RGPassHandle pass) const;
+    std::string_view GetResourceName(RGResourceHandle resource) const;
+
+private:
+    friend class RGPassBuilder;
+
+    struct ResourceAccess
+    {
+        RGResourceHandle resource;
+        RGAccess access = RGAccess::None;
+    };
+
+    struct Resource
+    {
+        std::string name;
+        RGTextureDesc desc;
+        bool imported = false;
+        RGAccess initialAccess = RGAccess::None;
+        RGAccess finalAccess = RGAccess::None;
+
+        // Compiled
+        uint32_t firstUse = UINT32_MAX; // Position in m_ExecutionOrder
+        uint32_t lastUse = 0;
+        RGTransientAllocation allocation;
+    };
+
+    struct Pass
+    {
+        std::string name;
+        std::vector<ResourceAccess> accesses;
+        RGExecuteFunc execute;
+        bool sideEffects = false;
+
+        // Compiled
+        bool culled = false;
+        std::vector<RGBarrier> barriers;
+    };
+
+    RGResourceHandle AddResource(std::string name, const RGTextureDesc& desc, bool imported,
+        RGAccess initialAccess, RGAccess finalAccess);
+    void AddAccess(uint32_t passIndex, RGResourceHandle resource, RGAccess access);
+
+    void CullPasses();
+    void ComputeBarriers();
+    void PlaceTransients();
+
+    // Does going from 'before' to 'after' need a barrier?
+    static bool NeedsBarrier(RGAccess before, RGAccess after);
+
+    std::vector<Resource> m_Resources;
+    std::vector<Pass> m_Passes;
+
+    bool m_Compiled = false;
+    std::vector<RGPassHandle> m_ExecutionOrder;
+    std::vector<std::vector<RGPassHandle>> m_Batches;
+    std::vector<RGBarrier> m_FinalBarriers;
+    uint64_t m_TransientHeapSize = 0;
+};
@@ -3,6 +3,11 @@
 #include "Window/Window.h"
 #include "Window/WindowContext.h"
 #include "MT/JobSystem.h"
+#include "Input/InputActionMap.h"
+#include "Rendering/RHI/RHIDesc.h"
+#include "Rendering/RenderGraph/RenderGraph.h"
+#include "Utility/FramePacer.h"
+#include "Utility/FrameTimer.h"
 #include "toml.hpp"
 #include <memory>
 #include <string>
@@ -30,8 +35,68 @@ public:
         m_VSyncEnabled = enabled;
     }
 
+    /**
+     * Run without a display server (overrides [window] headless).
+     * Windows are simulated; the renderer is only created when offscreen.
+     */
+    void SetHeadlessPreference(bool headless)
+    {
+        m_HeadlessOverride = true;
+        m_Headless = headless;
+    }
+
+    /**
+     * Render to an offscreen image ring instead of the window
+     * (overrides [rendering] offscreen). Also renders in headless mode.
+     */
+    void SetOffscreenPreference(bool offscreen)
+    {
+        m_OffscreenOverride = true;
+        m_RHIDesc.target = offscreen ? RHITarget::Offscreen : RHITarget::Window;
+    }
+
+    /**
+     * Prefer the graphics adapter whose name contains 'name'
+     * (overrides [rendering] device), e.g. "llvmpipe".
+     */
+    void SetDevicePreference(const std::string& name)
+    {
+        m_DeviceOverride = true;
+        m_RHIDesc.preferredDevice = name;
+    }
+
+    /**
+     * Record all window input to 'path' once the window context exists.
+     */
+    void SetInputRecordingPath(const std::string& path) { m_InputRecordingPath = path; }
+
+    /**
+     * Replay the recorded input in 'path' instead of live input once the
+     * window context exists.
+     */
+    void SetInputReplayPath(const std::string& path) { m_InputReplayPath = path; }
+
+    /**
+     * Leave the running state after 'frames' frames (0 = run until closed).
+     * Lets headless runs and benchmarks terminate on their own.
+     * note: Counts frames from entering the running state; initialization
+     *       and loading frames do not count
+     */
+    void SetFrameLimit(uint64_t frames) { m_FrameLimit = frames; }
+
     uint8_t GetThreadCountFor(const std::string& systemComponent);
 
+    /**
+     * Action map built from the [input] config section.
+     * Attached to the main window when it is created.
+     */
+    std::shared_ptr<const InputActionMap> GetInputActionMap() const { return m_InputActionMap; }
+
+    /**
+     * Frame time statistics of the main loop (delta time, FPS, percentiles).
+     */
+    const FrameTimer& GetFrameTimer() const { return m_FrameTimer; }
+
     void Run();
     void RequestQuit() { m_IsRunning = false; }
 
@@ -42,7 +107,7 @@ private:
 
     struct SolarcContext
     {
-        WindowContext* windowCtx;
+        WindowContext* windowCtx = nullptr; // Created in INITIALIZE (after [window] is parsed)
         JobSystem* jobSystem = nullptr; // Non-owning pointer
     };
 
@@ -84,6 +149,7 @@ private:
     void ParseMTData(const toml::value& configData);
     void ParseStartupData(const toml::value& configData);
     void ParseRenderingData(const toml::value& configData);
+    void ParseInputData(const toml::value& configData);
 
     inline static std::unique_ptr<SolarcApp> m_Instance = nullptr;
 
@@ -100,9 +166,32 @@ private:
     bool m_WindowFullscreen = false;
     std::string m_WindowName = "Solarc Window";
 
+    bool m_HeadlessOverride = false;
+    bool m_Headless = false;
+
+    std::string m_InputRecordingPath;
+    std::string m_InputReplayPath;
+    uint64_t m_FrameLimit = 0;
+
     bool m_VSyncOverride = false;
     bool m_VSyncEnabled = true;
 
+    // Internal resolution ([rendering] render_scale, see SurfaceScale)
+    float m_RenderScale = 1.0f;
+
+    // RHI creation options ([rendering] offscreen / device / latency_mode / frames_in_flight)
+    bool m_OffscreenOverride = false;
+    bool m_DeviceOverride = false;
+    RHIDesc m_RHIDesc;
+
+    // Frame pacing ([rendering] target_fps, 0 = unlimited)
+    FramePacer m_FramePacer;
+
+    // Frame statistics ([rendering] frame_stats_interval, seconds between log lines)
+    FrameTimer m_FrameTimer;
+
+    std::shared_ptr<InputActionMap> m_InputActionMap;
+
     // Initial project path (set before state machine starts)
     std::string m_InitialProjectPath;
 };
@@ -117,10 +206,18 @@ public:
     SolarcStateMachine(SolarcContext& solarcCtx, const std::string& initialProjectPath);
     void Update();
 
+    /**
+     * True if the main loop should keep producing frames without waiting
+     * for OS events. False right after a transition so the new state runs
+     * its first Update without delay.
+     */
+    bool WantsContinuousFrames() const;
+
 private:
     void TransitionTo(StateTransition transition, const std::string& data);
 
     SolarcContext& m_SolarctCtxRef;
+    bool m_TransitionedThisFrame = false;
     std::unique_ptr<SolarcState> m_CurrentState;
     std::string m_InitialProjectPath;
 };
@@ -144,6 +241,10 @@ public:
     // Called once when leaving this state
     virtual void OnExit() {}
 
+    // True if the state renders every frame; otherwise the main loop
+    // blocks until an OS event, a wake-up or the idle timeout
+    virtual bool WantsContinuousFrames() const { return false; }
+
     SOLARC_STATE_TYPE GetType() const { return m_Type; }
 
 protected:
@@ -193,10 +294,17 @@ public:
     void OnEnter() override;
     StateTransitionData Update() override;
     void OnExit() override;
+    bool WantsContinuousFrames() const override;
 
 private:
+    void BuildFrameGraph();
+
     std::shared_ptr<Window> m_MainWindow;
     ObserverBus<WindowEvent> m_Bus;
+    bool m_Headless = false; // Simulated window, no RHI unless offscreen
+    uint64_t m_LastPresentFeedback = 0; // Presentation feedback already recorded
+    uint64_t m_RunningFrames = 0; // Frames updated in this state (frame limit)
+    RenderGraph m_FrameGraph; // Compiled once; executed every rendered frame
 };
 
 class SolarcApp::SolarcStateCleanup : public SolarcState
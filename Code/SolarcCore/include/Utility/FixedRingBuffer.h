@@ -0,0 +1,74 @@
+#pragma once
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+/**
+ * Fixed-capacity ring buffer with overwrite-oldest semantics.
+ *
+ * Storage is inline (no heap allocation), so the buffer can live inside
+ * per-frame structures that are reset every frame without reallocating.
+ * When full, Push() overwrites the oldest element and increments the
+ * dropped counter.
+ *
+ * Indexing is oldest-first: [0] is the oldest element, [Size() - 1] the newest.
+ *
+ * Thread Safety: Not thread-safe. Guard externally if shared.
+ */
+template<typename T, size_t Capacity>
+class FixedRingBuffer
+{
+    static_assert(Capacity > 0, "FixedRingBuffer capacity must be non-zero");
+
+public:
+    /**
+     * Append an element, overwriting the oldest one if full.
+     */
+    void Push(const T& value)
+    {
+        m_Data[(m_Head + m_Size) % Capacity] = value;
+
+        if (m_Size < Capacity)
+        {
+            ++m_Size;
+        }
+        else
+        {
+            m_Head = (m_Head + 1) % Capacity;
+            ++m_Dropped;
+        }
+    }
+
+    /**
+     * Remove all elements and reset the dropped counter.
+     */
+    void Clear()
+    {
+        m_Head = 0;
+        m_Size = 0;
+        m_Dropped = 0;
+    }
+
+    const T& operator[](size_t index) const { return m_Data[(m_Head + index) % Capacity]; }
+    T& operator[](size_t index) { return m_Data[(m_Head + index) % Capacity]; }
+
+    const T& Back() const { return (*this)[m_Size - 1]; }
+    const T& Front() const { return (*this)[0]; }
+
+    size_t Size() const { return m_Size; }
+    bool Empty() const { return m_Size == 0; }
+    bool Full() const { return m_Size == Capacity; }
+
+    /**
+     * Number of elements overwritten since the last Clear().
+     */
+    uint32_t Dropped() const { return m_Dropped; }
+
+    static constexpr size_t GetCapacity() { return Capacity; }
+
+private:
+    std::array<T, Capacity> m_Data{};
+    size_t m_Head = 0;
+    size_t m_Size = 0;
+    uint32_t m_Dropped = 0;
+};
@@ -0,0 +1,91 @@
+#pragma once
+#include "Preprocessor/API.h"
+#include <chrono>
+#include <cstdint>
+
+class PresentTimingModel;
+
+/**
+ * Computes frame deadlines for the main loop.
+ *
+ * With a target frame rate, frame starts are scheduled on a fixed grid
+ * (deadline += period) so per-frame jitter does not accumulate into drift.
+ * If the loop falls more than one period behind (hitch, breakpoint,
+ * minimize), the grid is re-anchored at the current time instead of
+ * running a burst of catch-up frames.
+ *
+ * A target of 0 means "unlimited": frames are paced by vsync / present
+ * blocking only and NextFrameDeadline() returns 'now'.
+ *
+ * With a PresentTimingModel attached (and a display prediction available)
+ * each deadline is moved to just before the display refresh it can reach,
+ * for unlimited and capped rates alike (see PresentTimingModel). The grid
+ * itself stays unsnapped, so a cap keeps its average rate.
+ *
+ * The pacer only computes times; the main loop blocks on
+ * WindowContext::WaitForEvents() until the returned deadline.
+ *
+ * Thread Safety: Not thread-safe. Main thread only.
+ */
+class SOLARC_CORE_API FramePacer
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    /**
+     * Upper bound for blocking while idle (no continuous rendering).
+     * OS events and WakeMainThread() end the wait earlier.
+     */
+    static constexpr Clock::duration IDLE_TIMEOUT = std::chrono::milliseconds(250);
+
+    explicit FramePacer(uint32_t targetFrameRate = 0);
+
+    /**
+     * Set the target frame rate (frames per second, 0 = unlimited).
+     * Re-anchors the frame grid.
+     */
+    void SetTargetFrameRate(uint32_t framesPerSecond);
+    uint32_t GetTargetFrameRate() const { return m_TargetFrameRate; }
+
+    bool IsUnlimited() const { return m_TargetFrameRate == 0; }
+
+    /**
+     * Duration of one frame at the target rate (zero when unlimited).
+     */
+    Clock::duration GetFramePeriod() const { return m_Period; }
+
+    /**
+     * Advance to the next frame and return when it should start.
+     *
+     * param now: Current time (end of the frame just completed)
+     * return Start time of the next frame (<= now if it should start immediately)
+     */
+    Clock::time_point NextFrameDeadline(Clock::time_point now);
+
+    /**
+     * Forget the frame grid; the next deadline is anchored at 'now'.
+     * Call after idle periods so the first active frame is not late.
+     */
+    void Reset() { m_HasDeadline = false; }
+
+    /**
+     * Align frame starts to predicted display refreshes (just in time).
+     * param model: Display timing of the presenting swapchain, nullptr to stop
+     * note: Non-owning; detach before the model is destroyed
+     */
+    void SetPresentTiming(PresentTimingModel* model) { m_PresentTiming = model; }
+
+    /**
+     * Are deadlines currently aligned to the display?
+     * (The main loop must then wait even when the rate is unlimited.)
+     */
+    bool IsDisplaySynced() const;
+
+private:
+    uint32_t m_TargetFrameRate = 0;
+    Clock::duration m_Period{};
+    Clock::time_point m_Deadline{};
+    bool m_HasDeadline = false;
+
+    PresentTimingModel* m_PresentTiming = nullptr;
+};
@@ -0,0 +1,119 @@
+#pragma once
+#include "Preprocessor/API.h"
+#include "Utility/FixedRingBuffer.h"
+#include <array>
+#include <chrono>
+#include <cstdint>
+
+/**
+ * Per-frame measurements tracked by FrameTimer.
+ */
+enum class FrameMetric : uint8_t
+{
+    CpuFrame,        // Frame start to frame end, excluding the pacing wait
+    PresentInterval, // Present-to-present interval (what the user sees)
+    GpuWait,         // CPU blocked waiting for a frame-in-flight slot
+    Acquire,         // CPU blocked acquiring the next swapchain image
+    DisplayLatency,  // Present to on screen (compositor feedback, where available)
+    Count
+};
+
+const char* FrameMetricToString(FrameMetric metric);
+
+/**
+ * Rolling statistics of one metric over the last FrameTimer::WINDOW_SIZE samples.
+ * All times in milliseconds.
+ */
+struct FrameTimeStats
+{
+    float p50 = 0.0f;
+    float p95 = 0.0f;
+    float p99 = 0.0f;
+    float mean = 0.0f;
+    float max = 0.0f;
+    uint32_t sampleCount = 0;
+};
+
+/**
+ * Frame time measurement: delta time, FPS and rolling percentiles.
+ *
+ * The main loop brackets each frame with BeginFrame() / EndFrame(); the
+ * renderer reports blocking times with RecordSample(). Percentiles are
+ * computed on demand from a fixed window of recent samples (no
+ * allocation per frame), so they reflect the last few seconds rather
+ * than the whole session.
+ *
+ * With a log interval set, EndFrame() writes one summary line per
+ * interval - the signal to watch for frame time regressions.
+ *
+ * Thread Safety: Not thread-safe. Main thread only.
+ */
+class SOLARC_CORE_API FrameTimer
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr size_t WINDOW_SIZE = 512;
+
+    /**
+     * Mark the start of a frame (after any pacing wait).
+     * Updates delta time from the previous frame start.
+     */
+    void BeginFrame(Clock::time_point now = Clock::now());
+
+    /**
+     * Mark the end of a frame. Records CpuFrame and emits the periodic
+     * log line when due.
+     */
+    void EndFrame(Clock::time_point now = Clock::now());
+
+    /**
+     * Add one sample for a metric.
+     */
+    void RecordSample(FrameMetric metric, Clock::duration duration);
+
+    /**
+     * Percentiles over the recent sample window.
+     */
+    FrameTimeStats GetStats(FrameMetric metric) const;
+
+    /**
+     * Seconds between the last two frame starts (0 on the first frame).
+     */
+    float GetDeltaTime() const { return m_DeltaTime; }
+
+    /**
+     * Frames per second from the mean frame start-to-start time of the window.
+     */
+    float GetFps() const;
+
+    uint64_t GetFrameCount() const { return m_FrameCount; }
+
+    /**
+     * Log a summary line every 'interval' (zero disables periodic logging).
+     */
+    void SetLogInterval(Clock::duration interval) { m_LogInterval = interval; }
+    Clock::duration GetLogInterval() const { return m_LogInterval; }
+
+    /**
+     * Drop all samples (e.g. after a loading screen or a long stall).
+     */
+    void Reset();
+
+private:
+    using SampleWindow = FixedRingBuffer<float, WINDOW_SIZE>;
+
+    static FrameTimeStats ComputeStats(const SampleWindow& samples);
+    void LogStats() const;
+
+    std::array<SampleWindow, static_cast<size_t>(FrameMetric::Count)> m_Samples{};
+    SampleWindow m_FrameIntervals; // Start-to-start, for FPS
+
+    Clock::time_point m_FrameStart{};
+    bool m_HasFrameStart = false;
+    float m_DeltaTime = 0.0f;
+    uint64_t m_FrameCount = 0;
+
+    Clock::duration m_LogInterval{};
+    Clock::time_point m_LastLog{};
+};
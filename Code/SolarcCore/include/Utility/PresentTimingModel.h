@@ -0,0 +1,144 @@
+#pragma once
+#include "Preprocessor/API.h"
+#include "Utility/FixedRingBuffer.h"
+#include <chrono>
+#include <cstdint>
+
+/**
+ * When one presented frame was started, submitted and actually shown.
+ * Produced from compositor feedback (Wayland wp_presentation).
+ */
+struct PresentFeedback
+{
+    using Clock = std::chrono::steady_clock;
+
+    Clock::time_point frameStart;       // RHI::BeginFrame() of the frame
+    Clock::time_point presentTime;      // Handed to the swapchain
+    Clock::time_point displayTime;      // Turned into light (start of scan-out)
+    Clock::duration refreshInterval{};  // Display refresh period (0 = unknown / variable rate)
+    bool zeroCopy = false;              // Scanned out directly, not composited
+};
+
+/**
+ * Display timing model built from presentation feedback.
+ *
+ * Tracks the display's refresh period and vblank phase (the latest
+ * display timestamp) and estimates how long before a vblank a frame has
+ * to start to make it:
+ *
+ *   lead time = max(start-to-present time of recent frames) + safety margin
+ *
+ * ScheduleFrame() returns the latest start that still reaches the first
+ * reachable vblank. Starting there instead of immediately samples input
+ * as late as possible (lower input-to-photon latency) without missing the
+ * refresh, which would add a whole refresh of latency with FIFO.
+ *
+ * The safety margin covers the GPU and compositor time not visible in
+ * the start-to-present measurement. It adapts: a scheduled frame shown
+ * after the vblank it was scheduled for widens it by MARGIN_STEP; a run
+ * of HIT_STREAK frames on time narrows it again. Frames that were not
+ * started by ScheduleFrame() (unpaced, or started late by a main-thread
+ * stall) only update the work estimate, so a full FIFO queue before
+ * pacing engages does not inflate the margin.
+ *
+ * Without a known refresh period (variable refresh, compositor without
+ * feedback) there is no prediction and callers should pace as before.
+ *
+ * Thread Safety: Not thread-safe. Main thread only (feedback events are
+ * dispatched by WindowContext::PollEvents()).
+ */
+class SOLARC_CORE_API PresentTimingModel
+{
+public:
+    using Clock = std::chrono::steady_clock;
+
+    static constexpr Clock::duration MIN_SAFETY_MARGIN = std::chrono::microseconds(500);
+    static constexpr Clock::duration DEFAULT_SAFETY_MARGIN = std::chrono::milliseconds(1);
+    static constexpr Clock::duration MARGIN_STEP = std::chrono::microseconds(250);
+    static constexpr uint32_t HIT_STREAK = 120;
+    static constexpr size_t WORK_WINDOW = 32;
+
+    /**
+     * Fold in one presented frame.
+     */
+    void OnPresented(const PresentFeedback& feedback);
+
+    /**
+     * A frame was never shown (replaced before its vblank, e.g. MAILBOX).
+     */
+    void OnDiscarded() { ++m_DiscardedCount; }
+
+    /**
+     * Forget everything (swapchain recreated, display changed).
+     */
+    void Reset();
+
+    /**
+     * Is the refresh period and phase known?
+     */
+    bool HasPrediction() const { return m_HasVBlank && m_RefreshInterval > Clock::duration::zero(); }
+
+    Clock::duration GetRefreshInterval() const { return m_RefreshInterval; }
+
+    /**
+     * First predicted vblank at or after 'notBefore'.
+     * note: Only meaningful when HasPrediction()
+     */
+    Clock::time_point PredictVBlank(Clock::time_point notBefore) const;
+
+    /**
+     * Start-to-vblank time a frame needs (work estimate + safety margin).
+     */
+    Clock::duration GetLeadTime() const { return m_WorkEstimate + m_SafetyMargin; }
+    Clock::duration GetSafetyMargin() const { return m_SafetyMargin; }
+
+    /**
+     * Schedule the next frame just in time for a vblank.
+     *
+     * param notBefore: Earliest acceptable start (now, or a frame rate cap deadline)
+     * return Latest start that still reaches the first vblank at or after
+     *        notBefore + lead time; 'notBefore' when there is no prediction
+     */
+    Clock::time_point ScheduleFrame(Clock::time_point notBefore);
+
+    // -- Statistics --
+
+    /**
+     * Present-to-display time of the most recent presented frame.
+     */
+    Clock::duration GetLastDisplayLatency() const { return m_LastDisplayLatency; }
+
+    uint64_t GetPresentedCount() const { return m_PresentedCount; }
+    uint64_t GetMissedCount() const { return m_MissedCount; }
+    uint64_t GetDiscardedCount() const { return m_DiscardedCount; }
+    uint64_t GetZeroCopyCount() const { return m_ZeroCopyCount; }
+
+private:
+    struct ScheduledFrame
+    {
+        Clock::time_point start;
+        Clock::time_point vblank;
+    };
+
+    // Frames in flight between ScheduleFrame() and their feedback
+    static constexpr size_t SCHEDULE_HISTORY = 8;
+
+    const ScheduledFrame* FindScheduledFrame(Clock::time_point frameStart) const;
+
+    Clock::duration m_RefreshInterval{};
+    Clock::time_point m_LastVBlank{};
+    bool m_HasVBlank = false;
+
+    FixedRingBuffer<ScheduledFrame, SCHEDULE_HISTORY> m_Schedule;
+
+    FixedRingBuffer<Clock::duration, WORK_WINDOW> m_WorkSamples;
+    Clock::duration m_WorkEstimate{};
+    Clock::duration m_SafetyMargin = DEFAULT_SAFETY_MARGIN;
+    uint32_t m_HitStreak = 0;
+
+    Clock::duration m_LastDisplayLatency{};
+    uint64_t m_PresentedCount = 0;
+    uint64_t m_MissedCount = 0;
+    uint64_t m_DiscardedCount = 0;
+    uint64_t m_ZeroCopyCount = 0;
+};
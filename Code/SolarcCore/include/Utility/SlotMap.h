@@ -0,0 +1,183 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <vector>
+
+/**
+ * Stable reference to an element of a SlotMap.
+ *
+ * A handle stays valid until its element is erased. Afterwards it is stale:
+ * the slot may be reused, but with a new generation, so lookups with the
+ * old handle fail instead of returning the new occupant.
+ */
+struct SlotHandle
+{
+    static constexpr uint32_t INVALID_INDEX = std::numeric_limits<uint32_t>::max();
+
+    uint32_t index = INVALID_INDEX;
+    uint32_t generation = 0;
+
+    bool IsValid() const { return index != INVALID_INDEX; }
+
+    bool operator==(const SlotHandle&) const = default;
+};
+
+/**
+ * Dense container addressed by generational handles.
+ *
+ * Values are stored contiguously (iteration touches only live elements and
+ * can be split by index across threads). A sparse slot array maps handles
+ * to dense positions, so Insert(), Erase() and Get() are O(1). Erase()
+ * moves the last element into the hole: dense order is not stable, handles
+ * are.
+ *
+ * Freed slots are reused (free list through the slot array), so a
+ * container that stays at a steady size stops allocating.
+ *
+ * Thread Safety: Not thread-safe. Guard externally if shared.
+ */
+template<typename T>
+class SlotMap
+{
+public:
+    /**
+     * Add a value.
+     * return Handle to the new element
+     */
+    SlotHandle Insert(T value)
+    {
+        uint32_t slotIndex;
+        if (m_FreeHead != SlotHandle::INVALID_INDEX)
+        {
+            slotIndex = m_FreeHead;
+            m_FreeHead = m_Slots[slotIndex].denseIndex;
+        }
+        else
+        {
+            slotIndex = static_cast<uint32_t>(m_Slots.size());
+            m_Slots.push_back(Slot{});
+        }
+
+        Slot& slot = m_Slots[slotIndex];
+        slot.denseIndex = static_cast<uint32_t>(m_Values.size());
+
+        m_Values.push_back(std::move(value));
+        m_DenseToSlot.push_back(slotIndex);
+
+        return SlotHandle{ slotIndex, slot.generation };
+    }
+
+    /**
+     * Remove the element referenced by 'handle'.
+     * return false if the handle is stale or invalid
+     */
+    bool Erase(SlotHandle handle)
+    {
+        if (!Contains(handle))
+            return false;
+
+        Slot& slot = m_Slots[handle.index];
+        const uint32_t denseIndex = slot.denseIndex;
+        const uint32_t lastIndex = static_cast<uint32_t>(m_Values.size() - 1);
+
+        // Swap-and-pop; the moved element's slot is redirected
+        if (denseIndex != lastIndex)
+        {
+            m_Values[denseIndex] = std::move(m_Values[lastIndex]);
+            m_DenseToSlot[denseIndex] = m_DenseToSlot[lastIndex];
+            m_Slots[m_DenseToSlot[denseIndex]].denseIndex = denseIndex;
+        }
+        m_Values.pop_back();
+        m_DenseToSlot.pop_back();
+
+        Release(handle.index);
+        return true;
+    }
+
+    /**
+     * Look up an element.
+     * return nullptr if the handle is stale or invalid
+     */
+    T* Get(SlotHandle handle)
+    {
+        return Contains(handle) ? &m_Values[m_Slots[handle.index].denseIndex] : nullptr;
+    }
+
+    const T* Get(SlotHandle handle) const
+    {
+        return Contains(handle) ? &m_Values[m_Slots[handle.index].denseIndex] : nullptr;
+    }
+
+    bool Contains(SlotHandle handle) const
+    {
+        return handle.index < m_Slots.size() &&
+            m_Slots[handle.index].generation == handle.generation &&
+            m_Slots[handle.index].denseIndex < m_Values.size() &&
+            m_DenseToSlot[m_Slots[handle.index].denseIndex] == handle.index;
+    }
+
+    /**
+     * Handle of the element at a dense position (0 .. Size() - 1).
+     */
+    SlotHandle HandleAt(size_t denseIndex) const
+    {
+        const uint32_t slotIndex = m_DenseToSlot[denseIndex];
+        return SlotHandle{ slotIndex, m_Slots[slotIndex].generation };
+    }
+
+    /**
+     * Remove every element. All outstanding handles become stale; slot
+     * storage is kept for reuse.
+     */
+    void Clear()
+    {
+        for (uint32_t slotIndex : m_DenseToSlot)
+            Release(slotIndex);
+
+        m_Values.clear();
+        m_DenseToSlot.clear();
+    }
+
+    void Reserve(size_t capacity)
+    {
+        m_Values.reserve(capacity);
+        m_DenseToSlot.reserve(capacity);
+        m_Slots.reserve(capacity);
+    }
+
+    size_t Size() const { return m_Values.size(); }
+    bool Empty() const { return m_Values.empty(); }
+
+    // Dense access (order changes on Erase)
+    T& operator[](size_t denseIndex) { return m_Values[denseIndex]; }
+    const T& operator[](size_t denseIndex) const { return m_Values[denseIndex]; }
+
+    auto begin() { return m_Values.begin(); }
+    auto end() { return m_Values.end(); }
+    auto begin() const { return m_Values.begin(); }
+    auto end() const { return m_Values.end(); }
+
+private:
+    struct Slot
+    {
+        uint32_t denseIndex = 0; // Next free slot while on the free list
+        uint32_t generation = 1; // Bumped on release; never 0 so {i, 0} is never live
+    };
+
+    void Release(uint32_t slotIndex)
+    {
+        Slot& slot = m_Slots[slotIndex];
+        if (++slot.generation == 0)
+            slot.generation = 1;
+
+        slot.denseIndex = m_FreeHead;
+        m_FreeHead = slotIndex;
+    }
+
+    std::vector<T> m_Values;
+    std::vector<uint32_t> m_DenseToSlot;
+    std::vector<Slot> m_Slots;
+    uint32_t m_FreeHead = SlotHandle::INVALID_INDEX;
+};
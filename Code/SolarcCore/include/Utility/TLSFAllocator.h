@@ -0,0 +1,94 @@
+#pragma once
+#include "Preprocessor/API.h"
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+/**
+ * Two-Level Segregated Fit range allocator.
+ *
+ * Hands out [offset, offset + size) ranges of a fixed-size address space;
+ * it never touches the memory itself, so it can manage GPU memory blocks.
+ *
+ * Free ranges are binned by size: the first level is the power of two, the
+ * second splits each power of two into SECOND_LEVEL_COUNT linear steps. Two
+ * bitmaps find a non-empty bin that fits in O(1), and freed ranges merge
+ * with free physical neighbours immediately, so fragmentation stays low
+ * without a background pass.
+ *
+ * A bin is only searched if every range in it fits, so a request may fail
+ * while a slightly larger range of the right bin exists (good fit, not
+ * best fit).
+ *
+ * Thread Safety: Not thread-safe. Guard externally if shared.
+ */
+class SOLARC_CORE_API TLSFAllocator
+{
+public:
+    static constexpr uint32_t SECOND_LEVEL_LOG2 = 4;
+    static constexpr uint32_t SECOND_LEVEL_COUNT = 1u << SECOND_LEVEL_LOG2;
+    static constexpr uint32_t FIRST_LEVEL_COUNT = 64;
+
+    // Ranges below this size share first-level bin 0 (linear bins of SMALL_SIZE / SECOND_LEVEL_COUNT)
+    static constexpr uint64_t SMALL_SIZE = 256;
+
+    explicit TLSFAllocator(uint64_t size);
+
+    /**
+     * Allocate a range
+     * param alignment: Power of two
+     * param offset: Receives the range's offset
+     * return false if no free range fits
+     */
+    bool Allocate(uint64_t size, uint64_t alignment, uint64_t& offset);
+
+    /**
+     * Free a range returned by Allocate()
+     * note: Asserts on offsets that are not allocated
+     */
+    void Free(uint64_t offset);
+
+    uint64_t GetSize() const { return m_Size; }
+    uint64_t GetUsedBytes() const { return m_UsedBytes; }
+    uint64_t GetFreeBytes() const { return m_Size - m_UsedBytes; }
+    size_t GetAllocationCount() const { return m_Allocated.size(); }
+    bool IsEmpty() const { return m_Allocated.empty(); }
+
+    // Size of the largest free range (what fragmentation leaves usable)
+    uint64_t GetLargestFreeRange() const;
+
+private:
+    static constexpr uint32_t NIL = UINT32_MAX;
+
+    struct Range
+    {
+        uint64_t offset = 0;
+        uint64_t size = 0;
+        uint32_t prevPhysical = NIL;
+        uint32_t nextPhysical = NIL;
+        uint32_t prevFree = NIL;
+        uint32_t nextFree = NIL;
+        bool free = false;
+    };
+
+    static void MapSize(uint64_t size, uint32_t& firstLevel, uint32_t& secondLevel);
+
+    uint32_t NewRange();
+    void ReleaseRange(uint32_t index);
+
+    void InsertFree(uint32_t index);
+    void RemoveFree(uint32_t index);
+    uint32_t FindFree(uint64_t size) const;
+
+    uint64_t m_Size;
+    uint64_t m_UsedBytes = 0;
+
+    std::vector<Range> m_Ranges;
+    std::vector<uint32_t> m_UnusedRanges;        // Recycled m_Ranges slots
+
+    uint64_t m_FirstLevelBitmap = 0;
+    uint32_t m_SecondLevelBitmaps[FIRST_LEVEL_COUNT] = {};
+    uint32_t m_FreeHeads[FIRST_LEVEL_COUNT][SECOND_LEVEL_COUNT];
+
+    std::unordered_map<uint64_t, uint32_t> m_Allocated; // Offset -> range
+};
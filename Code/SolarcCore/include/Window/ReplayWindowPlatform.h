@@ -0,0 +1,116 @@
+#pragma once
+#include "Window/Window.h"
+#include "Window/WindowState.h"
+#include "Window/SurfaceScale.h"
+#include "Input/InputRecording.h"
+#include "Preprocessor/API.h"
+#include <memory>
+#include <string>
+
+/**
+ * Window platform that plays back a recorded input stream.
+ *
+ * Satisfies WindowPlatformConcept without any OS backend, so a recorded
+ * session can be replayed headless (no compositor / no HWND). Window
+ * commands (Show, Resize, ...) complete immediately and dispatch the
+ * same events a real platform would report.
+ *
+ * Playback is driven by the usual frame protocol: every
+ * ResetThisFrameInput() (called by the replay driver at frame start)
+ * advances one engine frame, starting at the stream's first recorded
+ * frame, and loads that frame's record (see InputReplayStream). Frames
+ * without a record are empty. Once the stream is exhausted, frames are
+ * empty and IsFinished() returns true.
+ *
+ * Thread Safety: Main thread only, like the real platforms.
+ */
+class SOLARC_CORE_API ReplayWindowPlatform : public EventProducer<WindowEvent>
+{
+public:
+    ReplayWindowPlatform(const std::string& title, const int32_t& width, const int32_t& height,
+                         std::shared_ptr<const InputRecording> recording, uint32_t stream);
+
+    // -- Commands (complete immediately) --
+    void Show();
+    void Hide();
+    void Resize(int32_t width, int32_t height);
+    void Minimize();
+    void Maximize();
+    void Restore();
+
+    // -- Properties --
+    const std::string& GetTitle() const { return m_Title; }
+    const int32_t& GetWidth() const { return m_Width; }
+    const int32_t& GetHeight() const { return m_Height; }
+    bool IsVisible() const { return m_Visible; }
+    bool IsMinimized() const { return m_Minimized; }
+
+    // -- Surface scale (sizes are device pixels; only the render scale applies) --
+    SurfaceScale GetSurfaceScale() const { return m_SurfaceScale; }
+    SurfaceExtent GetBufferExtent() const { return m_SurfaceScale.ToBuffer(m_Width, m_Height); }
+    void SetRenderScale(float scale);
+
+    /**
+     * Publish size / visibility changes into 'snapshot' (see WindowPlatform).
+     */
+    void BindStateSnapshot(WindowStateSnapshot* snapshot)
+    {
+        m_StateSnapshot = snapshot;
+        PublishState();
+    }
+
+    // -- Input --
+
+    /**
+     * Advance playback by one frame: replace this frame's input with the
+     * record of that frame (empty if the stream has none).
+     */
+    void ResetThisFrameInput();
+
+    const InputFrame& GetThisFrameInput() const { return m_ThisFrameInput; }
+    bool HasKeyboardFocus() const { return m_HasKeyboardFocus; }
+
+    /**
+     * Focus changes come from the recording; a focus loss reported by the
+     * engine only clears the focus flag (the recording already contains
+     * the synthesized releases).
+     */
+    void OnFocusLost() { m_HasKeyboardFocus = false; }
+
+    void SetCursorMode(CursorMode mode) { m_CursorMode = mode; }
+    CursorMode GetCursorMode() const { return m_CursorMode; }
+
+    // -- Playback --
+
+    /**
+     * Number of recorded frames played so far (gaps not included).
+     */
+    size_t GetPlayedFrameCount() const { return m_Playback.GetPlayedRecordCount(); }
+
+    /**
+     * True once every recorded frame of the stream has been played.
+     */
+    bool IsFinished() const { return m_Playback.IsFinished(); }
+
+private:
+    void PublishState();
+
+    std::string m_Title;
+    int32_t m_Width;
+    int32_t m_Height;
+    bool m_Visible = false;
+    bool m_Minimized = false;
+    bool m_HasKeyboardFocus = true;
+    WindowStateSnapshot* m_StateSnapshot = nullptr;
+    CursorMode m_CursorMode = CursorMode::Normal;
+    SurfaceScale m_SurfaceScale;
+
+    InputReplayStream m_Playback;
+    uint64_t m_Frame; // Recording frame loaded by the next ResetThisFrameInput()
+
+    InputFrame m_ThisFrameInput;
+};
+
+extern template class WindowT<ReplayWindowPlatform>;
+
+using ReplayWindow = WindowT<ReplayWindowPlatform>;
@@ -0,0 +1,73 @@
+#pragma once
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+/**
+ * Size in buffer (device) pixels.
+ */
+struct SurfaceExtent
+{
+    int32_t width = 0;
+    int32_t height = 0;
+
+    bool operator==(const SurfaceExtent&) const = default;
+};
+
+/**
+ * Maps a window's logical size to the size of the buffers rendered for it.
+ *
+ *   buffer = round(logical * displayScale * renderScale)
+ *
+ * displayScale is the output's preferred scale in 1/120 steps (the
+ * wp_fractional_scale_v1 convention: 120 = 1.0, 180 = 1.5). Rendering at
+ * it gives one buffer pixel per device pixel instead of letting the
+ * compositor upscale a logical-size buffer (blurry on HiDPI outputs).
+ *
+ * renderScale is the internal resolution as a fraction of that native
+ * size (dynamic resolution). Below 1.0 the compositor upscales the
+ * smaller buffer to the window, which saves fill rate on expensive frames.
+ *
+ * Platforms whose window size is already in device pixels (Win32 with
+ * per-monitor DPI awareness, headless) keep displayScale at 1.0.
+ */
+struct SurfaceScale
+{
+    static constexpr uint32_t SCALE_DENOMINATOR = 120;
+    static constexpr float MIN_RENDER_SCALE = 0.25f;
+    static constexpr float MAX_RENDER_SCALE = 2.0f;
+
+    uint32_t displayScale = SCALE_DENOMINATOR;
+    float renderScale = 1.0f;
+
+    float GetDisplayScale() const { return static_cast<float>(displayScale) / SCALE_DENOMINATOR; }
+
+    /**
+     * Clamp a requested render scale to [MIN_RENDER_SCALE, MAX_RENDER_SCALE].
+     * NaN / non-positive requests fall back to 1.0.
+     */
+    static float ClampRenderScale(float scale)
+    {
+        if (!(scale > 0.0f)) return 1.0f;
+        return std::clamp(scale, MIN_RENDER_SCALE, MAX_RENDER_SCALE);
+    }
+
+    /**
+     * Buffer size for a logical size.
+     * return {0, 0} for an empty logical size; otherwise at least 1x1
+     */
+    SurfaceExtent ToBuffer(int32_t logicalWidth, int32_t logicalHeight) const
+    {
+        if (logicalWidth <= 0 || logicalHeight <= 0)
+            return {};
+
+        // Rounded half away from zero, as the fractional-scale protocol specifies
+        const double factor = static_cast<double>(displayScale) / SCALE_DENOMINATOR * renderScale;
+        return {
+            std::max<int32_t>(1, static_cast<int32_t>(std::lround(logicalWidth * factor))),
+            std::max<int32_t>(1, static_cast<int32_t>(std::lround(logicalHeight * factor)))
+        };
+    }
+
+    bool operator==(const SurfaceScale&) const = default;
+};
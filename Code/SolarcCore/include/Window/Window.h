@@ -11,12 +11,31 @@
 #include <functional>
 #include <type_traits>
 #include <stdexcept>
+#include <string>
+#include <vector>
 #include "Input/InputState.h"
+#include "Input/KeyBitset.h"
+#include "Input/InputTimestamp.h"
+#include "Input/CursorMode.h"
+#include "Input/InputActionMap.h"
 #include "Input/KeyCode.h"
 #include "Input/MouseButton.h"
+#include "Input/KeyModifiers.h"
+#include "Input/TextInput.h"
 #include "Event/InputEvent.h"
 #include "MT/ThreadChecker.h"
 #include "Input/KeyMapping.h"
+#include "Utility/SlotMap.h"
+#include "Window/WindowState.h"
+#include "Window/SurfaceScale.h"
+
+class WindowContext;
+
+/**
+ * Stable identifier of a window tracked by WindowContext.
+ * Stale once the window is destroyed (see SlotHandle).
+ */
+using WindowHandle = SlotHandle;
 
 template<typename T>
 concept WindowPlatformConcept = requires(T & t) {
@@ -44,6 +63,12 @@ concept WindowPlatformConcept = requires(T & t) {
     { t.HasKeyboardFocus() } -> std::same_as<bool>;
     { t.GetThisFrameInput() } -> std::same_as<const InputFrame&>;
     { t.ResetThisFrameInput() } -> std::same_as<void>;
+    { t.SetCursorMode(CursorMode::Normal) } -> std::same_as<void>;
+    { t.GetCursorMode() } -> std::same_as<CursorMode>;
+
+    // Surface scale
+    { t.GetSurfaceScale() } -> std::same_as<SurfaceScale>;
+    { t.SetRenderScale(1.0f) } -> std::same_as<void>;
 
     // Events (optional but expected for integration)
     // We assume it derives from EventProducer<WindowEvent> externally
@@ -59,7 +84,13 @@ concept WindowPlatformConcept = requires(T & t) {
  *
  * Thread Safety:
  * - All methods must be called from main thread only
+ * - Exception: WindowContext runs UpdateInput() of different windows in
+ *   parallel on the JobSystem (see WindowContext::PollEvents)
  * - Destroy: Idempotent - safe to call multiple times
+ * - State queries (GetState, IsVisible, IsMinimized, IsClosed, GetWidth,
+ *   GetHeight) are wait-free and callable from any thread when the
+ *   platform publishes a WindowStateSnapshot (BindStateSnapshot); they
+ *   fall back to locking the platform otherwise
  */
 
 template<WindowPlatformConcept PlatformT>
@@ -120,26 +151,30 @@ public:
      */
     void Restore();
 
+    /**
+     * Get size, visibility flags and change generation in one read.
+     * Use this over several IsX()/GetX() calls when the values must agree.
+     * note: Wait-free; callable from any thread (e.g. the render thread)
+     */
+    WindowState GetState() const;
+
     /**
      * Check if window is visible
      * return true if visible, false otherwise
-     * note: Must be called from main thread
      */
-    bool IsVisible() const;
+    bool IsVisible() const { return GetState().IsVisible(); }
 
     /**
     * Check if window is minimized
     * return true if minimized, false otherwise
-    * note: Must be called from main thread
     */
-    bool IsMinimized() const;
+    bool IsMinimized() const { return GetState().IsMinimized(); }
 
     /**
      * Check if window is closed
      * return true if closed, false otherwise
-     * note: Must be called from main thread
      */
-    bool IsClosed() const;
+    bool IsClosed() const { return m_State.Load().IsClosed(); }
 
     // ========================================================================
     // Input State Queries (Fast Path - Polling)
@@ -190,6 +225,54 @@ public:
      */
     uint16_t GetKeyRepeatCount(KeyCode key) const;
 
+    /**
+     * Check if any key is currently held down.
+     */
+    bool IsAnyKeyDown() const;
+
+    /**
+     * Check if any key transitioned up -> down this frame.
+     *
+     * Word-level test over the packed key set; does not walk all 512 keys.
+     *
+     * Example:
+     *   if (window->WasAnyKeyJustPressed()) {
+     *       splashScreen.Dismiss();
+     *   }
+     */
+    bool WasAnyKeyJustPressed() const;
+
+    /**
+     * Check if any key transitioned down -> up this frame.
+     */
+    bool WasAnyKeyJustReleased() const;
+
+    /**
+     * Get the set of scancodes that transitioned up -> down this frame.
+     * Computed as current & ~previous over the packed key set.
+     */
+    KeyBitset GetJustPressedKeys() const;
+
+    /**
+     * Get the set of scancodes that transitioned down -> up this frame.
+     * Computed as ~current & previous over the packed key set.
+     */
+    KeyBitset GetJustReleasedKeys() const;
+
+    /**
+     * Invoke fn(KeyCode) for every key that was just pressed this frame.
+     *
+     * Cost scales with the number of pressed keys, not the key range.
+     * Scancodes without a KeyCode mapping are skipped.
+     *
+     * Example:
+     *   window->ForEachKeyJustPressed([&](KeyCode key) {
+     *       rebindMenu.Capture(key);
+     *   });
+     */
+    template<typename Fn>
+    void ForEachKeyJustPressed(Fn&& fn) const;
+
     /**
      * Get current mouse position in client-area coordinates (logical pixels).
      *
@@ -251,6 +334,129 @@ public:
      */
     float GetMouseWheelHDelta() const;
 
+    // ========================================================================
+    // Timestamped Input (Sub-frame Precision)
+    // ========================================================================
+
+    /**
+     * Copy this frame's mouse motion samples with timestamp >= since.
+     *
+     * One sample exists per OS motion event, oldest first, each carrying
+     * its own delta. Summing deltaX/deltaY over all samples gives
+     * GetMouseDeltaX/Y() unless samples were dropped (see
+     * GetDroppedMouseSampleCount).
+     *
+     * param since: Input clock timestamp (see InputClock::Now)
+     * param out:   Cleared, then filled with matching samples. Reuse the
+     *              same vector across frames to avoid allocation.
+     * return Number of samples written to out
+     *
+     * Example:
+     *   window->GetMouseSamplesSince(lastSimTick, samples);
+     *   for (const auto& s : samples)
+     *       aim.Integrate(s.deltaX, s.deltaY, s.timestamp);
+     */
+    size_t GetMouseSamplesSince(InputTimestamp since, std::vector<InputFrame::MouseSample>& out) const;
+
+    /**
+     * Number of motion samples overwritten this frame because the
+     * per-frame ring (InputFrame::MAX_MOUSE_SAMPLES) was full.
+     */
+    uint32_t GetDroppedMouseSampleCount() const;
+
+    /**
+     * Timestamp of the oldest input event consumed by the last Update().
+     *
+     * This is the start point for input-to-present latency: the RHI
+     * compares it against the time the frame was handed to the swapchain.
+     *
+     * return 0 if no timestamped input arrived this frame
+     */
+    InputTimestamp GetOldestInputTimestamp() const;
+
+    /**
+     * Text typed during the last Update(), UTF-8 encoded, in order.
+     *
+     * The polling counterpart of TextInputEvent (same characters, same
+     * filtering). Empty while the window is unfocused.
+     *
+     * Example:
+     *   m_SearchBox.Append(window->GetTextInput());
+     */
+    const std::string& GetTextInput() const;
+
+    // ========================================================================
+    // Input Actions
+    // ========================================================================
+
+    /**
+     * Attach an action map (named actions / axes bound in config).
+     *
+     * The map is evaluated once per Update() after raw input is applied.
+     * Passing nullptr detaches it and clears the action state. The map must
+     * not be modified while attached; build a new one to rebind.
+     *
+     * note: Must be called from main thread
+     */
+    void SetInputActionMap(std::shared_ptr<const InputActionMap> map);
+
+    /**
+     * Get the attached action map (nullptr if none).
+     * Use it to resolve action/axis names to ids once, at startup.
+     */
+    const std::shared_ptr<const InputActionMap>& GetInputActionMap() const { return m_ActionMap; }
+
+    /**
+     * Query an action by id (see InputActionMap::FindAction).
+     * Invalid ids report "not down".
+     */
+    bool IsActionDown(InputActionId action) const;
+    bool WasActionJustPressed(InputActionId action) const;
+    bool WasActionJustReleased(InputActionId action) const;
+
+    /**
+     * Query an axis by id (see InputActionMap::FindAxis).
+     * return Axis value this frame, 0.0f for invalid ids
+     */
+    float GetActionAxis(InputAxisId axis) const;
+
+    /**
+     * Get this frame's state for all actions at once.
+     *
+     * Hot paths can take the reference once per frame and test bits
+     * directly, avoiding per-query thread checks.
+     *
+     * Example:
+     *   const ActionState& actions = window->GetActionState();
+     *   if (actions.WasPressed(jumpId)) player.Jump();
+     *   player.Move(actions.GetAxis(moveXId), actions.GetAxis(moveYId));
+     */
+    const ActionState& GetActionState() const;
+
+    // ========================================================================
+    // Cursor Control
+    // ========================================================================
+
+    /**
+     * Lock or confine the cursor to this window.
+     *
+     * Locked mode hides the cursor and reports unaccelerated relative
+     * motion through GetMouseDeltaX/Y (FPS camera control).
+     * Confined mode keeps the cursor visible inside the client area.
+     *
+     * note: Must be called from main thread
+     * note: Falls back to Normal (with a warning) if the platform lacks support
+     *
+     * Example:
+     *   window->SetCursorMode(CursorMode::Locked);
+     */
+    void SetCursorMode(CursorMode mode);
+
+    /**
+     * Get the cursor mode currently applied by the platform.
+     */
+    CursorMode GetCursorMode() const;
+
     // ========================================================================
     // Modifier Key Helpers
     // ========================================================================
@@ -275,6 +481,20 @@ public:
      */
     bool IsSuperDown() const;
 
+    /**
+     * Get the modifier state as a KeyModifier bitmask.
+     *
+     * Uses the platform keymap when it reports modifiers (Wayland), which
+     * includes latched/locked modifiers and Caps Lock / Num Lock. Otherwise
+     * built from the held modifier keys (no lock state).
+     */
+    uint8_t GetModifiers() const;
+
+    /**
+     * Check if Caps Lock is active (platform keymap only; false otherwise).
+     */
+    bool IsCapsLockOn() const;
+
     /**
      * Check specific left/right modifier keys.
      */
@@ -293,14 +513,36 @@ public:
     const std::string& GetTitle() const { return m_Platform->GetTitle(); }
 
     /**
-     * Get window width
+     * Get window width (0 once destroyed)
      */
-    const int32_t& GetWidth() const { return m_Platform->GetWidth(); }
+    int32_t GetWidth() const { return GetState().width; }
 
     /**
-     * Get window height
+     * Get window height (0 once destroyed)
      */
-    const int32_t& GetHeight() const { return m_Platform->GetHeight(); }
+    int32_t GetHeight() const { return GetState().height; }
+
+    /**
+     * Get the logical-to-buffer scaling (display scale and render scale)
+     */
+    SurfaceScale GetSurfaceScale() const;
+
+    /**
+     * Get the size the swapchain should have, in device pixels
+     * return {0, 0} while the window has no size (or once destroyed)
+     * note: GetWidth()/GetHeight() are logical; they differ on fractionally
+     *       scaled outputs and at render scales other than 1.0
+     */
+    SurfaceExtent GetBufferExtent() const;
+
+    /**
+     * Render at a fraction of the native resolution (dynamic resolution).
+     * The compositor scales the smaller buffer up to the window.
+     * param scale: Clamped to [SurfaceScale::MIN_RENDER_SCALE, MAX_RENDER_SCALE]
+     * note: Must be called from main thread
+     * note: Dispatches a resize event (same logical size) when the buffer size changes
+     */
+    void SetRenderScale(float scale);
 
     /**
      * Get platform handle (for internal use by WindowContext)
@@ -308,6 +550,12 @@ public:
      */
     PlatformT* GetPlatform() const { return m_Platform.get(); }
 
+    /**
+     * Get the handle WindowContext tracks this window under
+     * return Invalid handle for windows not created by WindowContext
+     */
+    WindowHandle GetHandle() const { return m_Handle; }
+
     /**
      * Process queued window events
      * note: Must be called from main thread
@@ -329,6 +577,7 @@ protected:
     * Called by Update() before event communication.
     *
     * Responsibilities:
+    * 0. Drain the platform's input-thread queue (if it has one)
     * 1. Check keyboard focus (skip keyboard input if unfocused)
     * 2. Read WindowPlatform::GetThisFrameInput()
     * 3. Apply transitions to m_CurrentInput
@@ -338,6 +587,14 @@ protected:
     */
     void UpdateInput();
 
+    /**
+     * Deliver queued window events (bus communication + OnEvent).
+     *
+     * Called by Update() after UpdateInput(). Listeners run here, so this
+     * always runs on the main thread.
+     */
+    void CommunicateEvents();
+
     /**
      * Map scancode to KeyCode.
      *
@@ -356,9 +613,39 @@ protected:
     InputState m_CurrentInput;
 
     /**
-     * Previous frame's input state (for transition detection).
+     * Previous frame's key and mouse button state (for transition detection).
+     *
+     * Only the parts used by WasKeyJust* / WasMouseButtonJust* are kept, so
+     * the per-frame snapshot is one 64-byte key set plus one byte instead of
+     * a full InputState copy.
      */
-    InputState m_PreviousInput;
+    KeyBitset m_PreviousKeys;
+    uint8_t m_PreviousMouseButtons = 0;
+
+    /**
+     * Timestamped motion samples consumed this frame (copied from the
+     * platform's InputFrame so queries stay valid until the next Update).
+     */
+    InputFrame::MouseSampleRing m_MouseSamples;
+
+    /**
+     * Oldest input timestamp consumed this frame (0 = no input).
+     */
+    InputTimestamp m_OldestInputTimestamp = 0;
+
+    /**
+     * Text consumed this frame (UTF-8). Capacity is kept across frames.
+     */
+    std::string m_TextInput;
+
+    /**
+     * Attached action map and this frame's evaluated action state.
+     * m_ActionMapChanged forces a full re-evaluation on the next Update()
+     * (keys may already be held when a map is attached).
+     */
+    std::shared_ptr<const InputActionMap> m_ActionMap;
+    ActionState m_ActionState;
+    bool m_ActionMapChanged = false;
 
     /**
      * Thread checker for input queries.
@@ -367,6 +654,26 @@ protected:
     ThreadChecker m_InputThreadChecker;
 
 private:
+    friend class WindowContext;
+
+    /**
+     * GetModifiers() without the owner-thread check, for UpdateInput()
+     * (which may run on a job worker).
+     */
+    uint8_t ComputeModifiers() const;
+    bool HasModifier(KeyModifier modifier) const { return IsModifierSet(ComputeModifiers(), modifier); }
+
+    WindowHandle m_Handle;
+
+    // Platform writes m_State directly (wait-free reads); otherwise queries lock
+    static constexpr bool PublishesState = requires(PlatformT& p, WindowStateSnapshot* s) { p.BindStateSnapshot(s); };
+
+    /**
+     * Published window state. Only WINDOW_STATE_CLOSED is written by the
+     * window itself; everything else comes from the platform.
+     */
+    WindowStateSnapshot m_State;
+
     std::unique_ptr<PlatformT> m_Platform;
     std::function<void(WindowT<PlatformT>*)> m_OnDestroy;
     bool m_Destroyed = false;
@@ -396,6 +703,9 @@ inline WindowT<PlatformT>::WindowT(
     m_Bus.RegisterProducer(m_Platform.get());
     m_Bus.RegisterListener(this);
 
+    if constexpr (PublishesState)
+        m_Platform->BindStateSnapshot(&m_State);
+
     SOLARC_WINDOW_TRACE("Window created: '{}'", m_Platform->GetTitle());
 }
 
@@ -415,6 +725,15 @@ inline void WindowT<PlatformT>::Destroy()
 
     m_Destroyed = true;
 
+    // Readers see the window closed from here on; the platform must not
+    // publish into m_State once it is being torn down
+    if constexpr (PublishesState)
+    {
+        if (m_Platform)
+            m_Platform->BindStateSnapshot(nullptr);
+    }
+    m_State.Publish(0, 0, WINDOW_STATE_CLOSED);
+
     SOLARC_WINDOW_INFO("Destroying window: '{}'",
         m_Platform ? m_Platform->GetTitle() : "null");
 
@@ -494,24 +813,68 @@ inline void WindowT<PlatformT>::Restore()
 }
 
 template<WindowPlatformConcept PlatformT>
-inline bool WindowT<PlatformT>::IsVisible() const
+inline void WindowT<PlatformT>::SetCursorMode(CursorMode mode)
+{
+    std::lock_guard lock(m_DestroyMutex);
+    if (m_Platform && !m_Destroyed)
+    {
+        m_Platform->SetCursorMode(mode);
+        SOLARC_WINDOW_DEBUG("Cursor mode requested: '{}' -> {}",
+            m_Platform->GetTitle(), CursorModeToString(mode));
+    }
+}
+
+template<WindowPlatformConcept PlatformT>
+inline CursorMode WindowT<PlatformT>::GetCursorMode() const
 {
     std::lock_guard lock(m_DestroyMutex);
-    return m_Platform && !m_Destroyed ? m_Platform->IsVisible() : false;
+    return m_Platform && !m_Destroyed ? m_Platform->GetCursorMode() : CursorMode::Normal;
 }
 
 template<WindowPlatformConcept PlatformT>
-inline bool WindowT<PlatformT>::IsMinimized() const
+inline SurfaceScale WindowT<PlatformT>::GetSurfaceScale() const
 {
     std::lock_guard lock(m_DestroyMutex);
-    return m_Platform && !m_Destroyed ? m_Platform->IsMinimized() : false;
+    return m_Platform && !m_Destroyed ? m_Platform->GetSurfaceScale() : SurfaceScale{};
+}
+
+template<WindowPlatformConcept PlatformT>
+inline SurfaceExtent WindowT<PlatformT>::GetBufferExtent() const
+{
+    const WindowState state = GetState();
+    return GetSurfaceScale().ToBuffer(state.width, state.height);
 }
 
 template<WindowPlatformConcept PlatformT>
-inline bool WindowT<PlatformT>::IsClosed() const
+inline void WindowT<PlatformT>::SetRenderScale(float scale)
 {
     std::lock_guard lock(m_DestroyMutex);
-    return m_Destroyed;
+    if (m_Platform && !m_Destroyed)
+    {
+        m_Platform->SetRenderScale(scale);
+    }
+}
+
+template<WindowPlatformConcept PlatformT>
+inline WindowState WindowT<PlatformT>::GetState() const
+{
+    if constexpr (PublishesState)
+    {
+        return m_State.Load();
+    }
+    else
+    {
+        std::lock_guard lock(m_DestroyMutex);
+        WindowState state = m_State.Load();
+        if (!m_Platform || m_Destroyed)
+            return state;
+
+        state.width = m_Platform->GetWidth();
+        state.height = m_Platform->GetHeight();
+        if (m_Platform->IsVisible()) state.flags |= WINDOW_STATE_VISIBLE;
+        if (m_Platform->IsMinimized()) state.flags |= WINDOW_STATE_MINIMIZED;
+        return state;
+    }
 }
 
 template<WindowPlatformConcept PlatformT>
@@ -525,6 +888,12 @@ inline void WindowT<PlatformT>::Update()
     // ========================================================================
     // Step 2: Communicate events through the bus
     // ========================================================================
+    CommunicateEvents();
+}
+
+template<WindowPlatformConcept PlatformT>
+inline void WindowT<PlatformT>::CommunicateEvents()
+{
     // Process all queued events
 
     m_Bus.Communicate();
@@ -606,9 +975,18 @@ inline void WindowT<PlatformT>::UpdateInput()
     if (!m_Platform || m_Destroyed) return;
 
     // ========================================================================
-    // Swap previous ? current (for transition detection)
+    // Pull events from the input thread (platforms that support one)
     // ========================================================================
-    m_PreviousInput = m_CurrentInput;
+    // Done as late as possible so input read while the frame was running
+    // still lands in this frame.
+    if constexpr (requires(PlatformT& p) { p.DrainInputQueue(); })
+        m_Platform->DrainInputQueue();
+
+    // ========================================================================
+    // Snapshot previous frame (for transition detection)
+    // ========================================================================
+    m_PreviousKeys = m_CurrentInput.keys;
+    m_PreviousMouseButtons = m_CurrentInput.mouseButtons;
 
     // ========================================================================
     // Check keyboard focus
@@ -636,6 +1014,10 @@ inline void WindowT<PlatformT>::UpdateInput()
     m_CurrentInput.mouseWheelDelta = thisFrame.wheelDelta;
     m_CurrentInput.mouseWheelHDelta = thisFrame.hWheelDelta;
 
+    // Keep this frame's motion samples and latency start point
+    m_MouseSamples = thisFrame.mouseSamples;
+    m_OldestInputTimestamp = thisFrame.GetOldestTimestamp();
+
     // ========================================================================
     // Apply mouse button transitions
     // ========================================================================
@@ -653,9 +1035,9 @@ inline void WindowT<PlatformT>::UpdateInput()
                 transition.button,
                 m_CurrentInput.mouseX,
                 m_CurrentInput.mouseY,
-                IsShiftDown(),
-                IsCtrlDown(),
-                IsAltDown()
+                HasModifier(KeyModifier::Shift),
+                HasModifier(KeyModifier::Ctrl),
+                HasModifier(KeyModifier::Alt)
             );
             DispatchEvent(evt);
         }
@@ -669,9 +1051,9 @@ inline void WindowT<PlatformT>::UpdateInput()
                 transition.button,
                 m_CurrentInput.mouseX,
                 m_CurrentInput.mouseY,
-                IsShiftDown(),
-                IsCtrlDown(),
-                IsAltDown()
+                HasModifier(KeyModifier::Shift),
+                HasModifier(KeyModifier::Ctrl),
+                HasModifier(KeyModifier::Alt)
             );
             DispatchEvent(evt);
         }
@@ -680,8 +1062,15 @@ inline void WindowT<PlatformT>::UpdateInput()
     // ========================================================================
     // Apply keyboard transitions (only if focused)
     // ========================================================================
+    m_TextInput.clear();
+
     if (hasKeyboardFocus)
     {
+        // Keymap modifiers are end-of-frame state; applied first so key
+        // events below see e.g. a Ctrl pressed earlier in the same frame
+        m_CurrentInput.modifiers = thisFrame.modifiers;
+        m_CurrentInput.platformModifiers = thisFrame.hasModifiers;
+
         for (const auto& transition : thisFrame.keyTransitions)
         {
             uint16_t scancode = transition.scancode;
@@ -689,8 +1078,8 @@ inline void WindowT<PlatformT>::UpdateInput()
             if (transition.pressed)
             {
                 // Key pressed
-                bool wasAlreadyDown = m_CurrentInput.keys[scancode];
-                m_CurrentInput.keys[scancode] = true;
+                bool wasAlreadyDown = m_CurrentInput.keys.Test(scancode);
+                m_CurrentInput.keys.Set(scancode);
 
                 if (transition.isRepeat)
                 {
@@ -711,16 +1100,16 @@ inline void WindowT<PlatformT>::UpdateInput()
                     keyCode,
                     scancode,
                     transition.isRepeat,
-                    IsShiftDown(),
-                    IsCtrlDown(),
-                    IsAltDown()
+                    HasModifier(KeyModifier::Shift),
+                    HasModifier(KeyModifier::Ctrl),
+                    HasModifier(KeyModifier::Alt)
                 );
                 DispatchEvent(evt);
             }
             else
             {
                 // Key released
-                m_CurrentInput.keys[scancode] = false;
+                m_CurrentInput.keys.Clear(scancode);
                 m_CurrentInput.keyRepeatCount[scancode] = 0;
 
                 // Map scancode to KeyCode
@@ -730,13 +1119,20 @@ inline void WindowT<PlatformT>::UpdateInput()
                 auto evt = std::make_shared<KeyReleasedEvent>(
                     keyCode,
                     scancode,
-                    IsShiftDown(),
-                    IsCtrlDown(),
-                    IsAltDown()
+                    HasModifier(KeyModifier::Shift),
+                    HasModifier(KeyModifier::Ctrl),
+                    HasModifier(KeyModifier::Alt)
                 );
                 DispatchEvent(evt);
             }
         }
+
+        // Text after the key events that produced it
+        for (uint32_t codepoint : thisFrame.textInput)
+        {
+            TextInput::AppendUTF8(m_TextInput, codepoint);
+            DispatchEvent(std::make_shared<TextInputEvent>(codepoint));
+        }
     }
     else
         // No focus: keyboard state was already cleared by OnFocusLost()
@@ -754,13 +1150,29 @@ inline void WindowT<PlatformT>::UpdateInput()
             thisFrame.hWheelDelta,
             m_CurrentInput.mouseX,
             m_CurrentInput.mouseY,
-            IsShiftDown(),
-            IsCtrlDown(),
-            IsAltDown()
+            HasModifier(KeyModifier::Shift),
+            HasModifier(KeyModifier::Ctrl),
+            HasModifier(KeyModifier::Alt)
         );
         DispatchEvent(evt);
     }
 
+    // ========================================================================
+    // Evaluate input actions
+    // ========================================================================
+    if (m_ActionMap)
+    {
+        if (m_ActionMapChanged)
+        {
+            m_ActionMap->EvaluateAll(m_CurrentInput, m_ActionState);
+            m_ActionMapChanged = false;
+        }
+        else
+        {
+            m_ActionMap->Evaluate(m_CurrentInput, m_PreviousKeys, m_PreviousMouseButtons, m_ActionState);
+        }
+    }
+
     // ========================================================================
     // Done: State updated, events emitted
     // ========================================================================
@@ -784,7 +1196,7 @@ inline bool WindowT<PlatformT>::IsKeyDown(KeyCode key) const
     uint16_t scancode = KeyMapping::KeyCodeToScancode(key);
     if (scancode == 0) return false; // No mapping
 
-    return m_CurrentInput.keys[scancode];
+    return m_CurrentInput.keys.Test(scancode);
 }
 
 template<WindowPlatformConcept PlatformT>
@@ -795,8 +1207,8 @@ inline bool WindowT<PlatformT>::WasKeyJustPressed(KeyCode key) const
     uint16_t scancode = KeyMapping::KeyCodeToScancode(key);
     if (scancode == 0) return false;
 
-    bool isDown = m_CurrentInput.keys[scancode];
-    bool wasDown = m_PreviousInput.keys[scancode];
+    bool isDown = m_CurrentInput.keys.Test(scancode);
+    bool wasDown = m_PreviousKeys.Test(scancode);
 
     return isDown && !wasDown;
 }
@@ -809,8 +1221,8 @@ inline bool WindowT<PlatformT>::WasKeyJustReleased(KeyCode key) const
     uint16_t scancode = KeyMapping::KeyCodeToScancode(key);
     if (scancode == 0) return false;
 
-    bool isDown = m_CurrentInput.keys[scancode];
-    bool wasDown = m_PreviousInput.keys[scancode];
+    bool isDown = m_CurrentInput.keys.Test(scancode);
+    bool wasDown = m_PreviousKeys.Test(scancode);
 
     return !isDown && wasDown;
 }
@@ -826,6 +1238,56 @@ inline uint16_t WindowT<PlatformT>::GetKeyRepeatCount(KeyCode key) const
     return m_CurrentInput.keyRepeatCount[scancode];
 }
 
+template<WindowPlatformConcept PlatformT>
+inline bool WindowT<PlatformT>::IsAnyKeyDown() const
+{
+    m_InputThreadChecker.AssertOnOwnerThread("Window::IsAnyKeyDown");
+    return m_CurrentInput.keys.Any();
+}
+
+template<WindowPlatformConcept PlatformT>
+inline bool WindowT<PlatformT>::WasAnyKeyJustPressed() const
+{
+    m_InputThreadChecker.AssertOnOwnerThread("Window::WasAnyKeyJustPressed");
+    return KeyBitset::AnyPressed(m_CurrentInput.keys, m_PreviousKeys);
+}
+
+template<WindowPlatformConcept PlatformT>
+inline bool WindowT<PlatformT>::WasAnyKeyJustReleased() const
+{
+    m_InputThreadChecker.AssertOnOwnerThread("Window::WasAnyKeyJustReleased");
+    return KeyBitset::AnyReleased(m_CurrentInput.keys, m_PreviousKeys);
+}
+
+template<WindowPlatformConcept PlatformT>
+inline KeyBitset WindowT<PlatformT>::GetJustPressedKeys() const
+{
+    m_InputThreadChecker.AssertOnOwnerThread("Window::GetJustPressedKeys");
+    return KeyBitset::PressedMask(m_CurrentInput.keys, m_PreviousKeys);
+}
+
+template<WindowPlatformConcept PlatformT>
+inline KeyBitset WindowT<PlatformT>::GetJustReleasedKeys() const
+{
+    m_InputThreadChecker.AssertOnOwnerThread("Window::GetJustReleasedKeys");
+    return KeyBitset::ReleasedMask(m_CurrentInput.keys, m_PreviousKeys);
+}
+
+template<WindowPlatformConcept PlatformT>
+template<typename Fn>
+inline void WindowT<PlatformT>::ForEachKeyJustPressed(Fn&& fn) const
+{
+    m_InputThreadChecker.AssertOnOwnerThread("Window::ForEachKeyJustPressed");
+
+    KeyBitset::PressedMask(m_CurrentInput.keys, m_PreviousKeys).ForEachSetBit(
+        [&](uint16_t scancode)
+        {
+            KeyCode keyCode = ScancodeToKeyCode(scancode);
+            if (keyCode != KeyCode::Unknown)
+                fn(keyCode);
+        });
+}
+
 // ============================================================================
 // Mouse Query Methods
 // ============================================================================
@@ -871,7 +1333,7 @@ inline bool WindowT<PlatformT>::WasMouseButtonJustPressed(MouseButton button) co
     m_InputThreadChecker.AssertOnOwnerThread("Window::WasMouseButtonJustPressed");
 
     bool isDown = IsButtonSet(m_CurrentInput.mouseButtons, button);
-    bool wasDown = IsButtonSet(m_PreviousInput.mouseButtons, button);
+    bool wasDown = IsButtonSet(m_PreviousMouseButtons, button);
 
     return isDown && !wasDown;
 }
@@ -882,7 +1344,7 @@ inline bool WindowT<PlatformT>::WasMouseButtonJustReleased(MouseButton button) c
     m_InputThreadChecker.AssertOnOwnerThread("Window::WasMouseButtonJustReleased");
 
     bool isDown = IsButtonSet(m_CurrentInput.mouseButtons, button);
-    bool wasDown = IsButtonSet(m_PreviousInput.mouseButtons, button);
+    bool wasDown = IsButtonSet(m_PreviousMouseButtons, button);
 
     return !isDown && wasDown;
 }
@@ -902,32 +1364,152 @@ inline float WindowT<PlatformT>::GetMouseWheelHDelta() const
 }
 
 
+template<WindowPlatformConcept PlatformT>
+inline size_t WindowT<PlatformT>::GetMouseSamplesSince(
+    InputTimestamp since, std::vector<InputFrame::MouseSample>& out) const
+{
+    m_InputThreadChecker.AssertOnOwnerThread("Window::GetMouseSamplesSince");
+
+    out.clear();
+    for (size_t i = 0; i < m_MouseSamples.Size(); ++i)
+    {
+        const auto& sample = m_MouseSamples[i];
+        if (sample.timestamp >= since)
+            out.push_back(sample);
+    }
+    return out.size();
+}
+
+template<WindowPlatformConcept PlatformT>
+inline uint32_t WindowT<PlatformT>::GetDroppedMouseSampleCount() const
+{
+    m_InputThreadChecker.AssertOnOwnerThread("Window::GetDroppedMouseSampleCount");
+    return m_MouseSamples.Dropped();
+}
+
+template<WindowPlatformConcept PlatformT>
+inline InputTimestamp WindowT<PlatformT>::GetOldestInputTimestamp() const
+{
+    m_InputThreadChecker.AssertOnOwnerThread("Window::GetOldestInputTimestamp");
+    return m_OldestInputTimestamp;
+}
+
+template<WindowPlatformConcept PlatformT>
+inline const std::string& WindowT<PlatformT>::GetTextInput() const
+{
+    m_InputThreadChecker.AssertOnOwnerThread("Window::GetTextInput");
+    return m_TextInput;
+}
+
+// ============================================================================
+// Input Actions
+// ============================================================================
+
+template<WindowPlatformConcept PlatformT>
+inline void WindowT<PlatformT>::SetInputActionMap(std::shared_ptr<const InputActionMap> map)
+{
+    m_InputThreadChecker.AssertOnOwnerThread("Window::SetInputActionMap");
+
+    std::lock_guard lock(m_DestroyMutex);
+    m_ActionMap = std::move(map);
+    m_ActionState.Reset();
+    m_ActionMapChanged = (m_ActionMap != nullptr);
+}
+
+template<WindowPlatformConcept PlatformT>
+inline bool WindowT<PlatformT>::IsActionDown(InputActionId action) const
+{
+    m_InputThreadChecker.AssertOnOwnerThread("Window::IsActionDown");
+    return m_ActionState.IsDown(action);
+}
+
+template<WindowPlatformConcept PlatformT>
+inline bool WindowT<PlatformT>::WasActionJustPressed(InputActionId action) const
+{
+    m_InputThreadChecker.AssertOnOwnerThread("Window::WasActionJustPressed");
+    return m_ActionState.WasPressed(action);
+}
+
+template<WindowPlatformConcept PlatformT>
+inline bool WindowT<PlatformT>::WasActionJustReleased(InputActionId action) const
+{
+    m_InputThreadChecker.AssertOnOwnerThread("Window::WasActionJustReleased");
+    return m_ActionState.WasReleased(action);
+}
+
+template<WindowPlatformConcept PlatformT>
+inline float WindowT<PlatformT>::GetActionAxis(InputAxisId axis) const
+{
+    m_InputThreadChecker.AssertOnOwnerThread("Window::GetActionAxis");
+    return m_ActionState.GetAxis(axis);
+}
+
+template<WindowPlatformConcept PlatformT>
+inline const ActionState& WindowT<PlatformT>::GetActionState() const
+{
+    m_InputThreadChecker.AssertOnOwnerThread("Window::GetActionState");
+    return m_ActionState;
+}
+
 // ============================================================================
 // Modifier Key Helpers
 // ============================================================================
 
+template<WindowPlatformConcept PlatformT>
+inline uint8_t WindowT<PlatformT>::GetModifiers() const
+{
+    m_InputThreadChecker.AssertOnOwnerThread("Window::GetModifiers");
+    return ComputeModifiers();
+}
+
+template<WindowPlatformConcept PlatformT>
+inline uint8_t WindowT<PlatformT>::ComputeModifiers() const
+{
+    if (m_CurrentInput.platformModifiers)
+        return m_CurrentInput.modifiers;
+
+    auto isDown = [this](KeyCode key)
+    {
+        uint16_t scancode = KeyMapping::KeyCodeToScancode(key);
+        return scancode != 0 && m_CurrentInput.keys.Test(scancode);
+    };
+
+    uint8_t modifiers = 0;
+    if (isDown(KeyCode::LeftShift) || isDown(KeyCode::RightShift)) modifiers |= KeyModifierToBit(KeyModifier::Shift);
+    if (isDown(KeyCode::LeftCtrl) || isDown(KeyCode::RightCtrl)) modifiers |= KeyModifierToBit(KeyModifier::Ctrl);
+    if (isDown(KeyCode::LeftAlt) || isDown(KeyCode::RightAlt)) modifiers |= KeyModifierToBit(KeyModifier::Alt);
+    if (isDown(KeyCode::LeftSuper) || isDown(KeyCode::RightSuper)) modifiers |= KeyModifierToBit(KeyModifier::Super);
+    return modifiers;
+}
+
+template<WindowPlatformConcept PlatformT>
+inline bool WindowT<PlatformT>::IsCapsLockOn() const
+{
+    return IsModifierSet(GetModifiers(), KeyModifier::CapsLock);
+}
+
 template<WindowPlatformConcept PlatformT>
 inline bool WindowT<PlatformT>::IsShiftDown() const
 {
-    return IsLeftShiftDown() || IsRightShiftDown();
+    return IsModifierSet(GetModifiers(), KeyModifier::Shift);
 }
 
 template<WindowPlatformConcept PlatformT>
 inline bool WindowT<PlatformT>::IsCtrlDown() const
 {
-    return IsLeftCtrlDown() || IsRightCtrlDown();
+    return IsModifierSet(GetModifiers(), KeyModifier::Ctrl);
 }
 
 template<WindowPlatformConcept PlatformT>
 inline bool WindowT<PlatformT>::IsAltDown() const
 {
-    return IsLeftAltDown() || IsRightAltDown();
+    return IsModifierSet(GetModifiers(), KeyModifier::Alt);
 }
 
 template<WindowPlatformConcept PlatformT>
 inline bool WindowT<PlatformT>::IsSuperDown() const
 {
-    return IsLeftSuperDown() || IsRightSuperDown();
+    return IsModifierSet(GetModifiers(), KeyModifier::Super);
 }
 
 template<WindowPlatformConcept PlatformT>
@@ -5,12 +5,17 @@
 #include "Event/EventProducer.h"
 #include "MT/ThreadChecker.h"
 #include "Preprocessor/API.h"
-#include <unordered_set>
+#include "Input/InputRecording.h"
+#include "Utility/SlotMap.h"
+#include <map>
 #include <memory>
 #include <mutex>
+#include <chrono>
 
 #undef CreateWindow
 
+class JobSystem;
+
 /**
  * Manages window lifecycle and event distribution
  *
@@ -19,6 +24,9 @@
  * - Poll platform events and dispatch to windows
  * - Manage window cleanup
  *
+ * Windows are tracked in a SlotMap: creation and destruction are O(1) and
+ * each window keeps a stable WindowHandle for its lifetime.
+ *
  * Thread Safety:
  * - All methods must be called from main thread only
  */
@@ -28,6 +36,16 @@ public:
     // Singleton access
     static WindowContext& Get();
 
+    /**
+     * Select headless mode (no display server, simulated windows).
+     *
+     * return false if the context already exists in the other mode
+     * note: Must be called before the first Get()
+     */
+    static bool SetHeadless(bool headless) { return WindowContextPlatform::SetHeadless(headless); }
+
+    bool IsHeadless() const { return m_Platform.IsHeadless(); }
+
     WindowContext(const WindowContext&) = delete;
     WindowContext& operator=(const WindowContext&) = delete;
 
@@ -75,7 +93,10 @@ public:
         // Track ownership
         {
             std::lock_guard lock(m_WindowsMutex);
-            m_Windows.insert(std::static_pointer_cast<Window>(window));
+            window->m_Handle = m_Windows.Insert(WindowEntry{
+                std::static_pointer_cast<Window>(window),
+                m_NextRecordStreamId++
+            });
         }
 
         SOLARC_WINDOW_INFO("Window created successfully: '{}'", title);
@@ -88,12 +109,122 @@ public:
      * This is the main input capture entry point. Call order:
      * 1. Reset all windows' ThisFrameInput accumulators
      * 2. Poll OS events (triggers WndProc / Wayland callbacks)
-     * 3. Update all windows (processes input, emits events)
+     * 3. Update all windows' input (emits input events)
+     * 4. Deliver queued window events (listeners, close handling)
+     *
+     * Step 3 runs on the JobSystem, one batch of windows per worker plus one
+     * updated by the main thread itself, when one is set and there are at
+     * least PARALLEL_UPDATE_MIN_WINDOWS windows. Each
+     * window's events keep their order; the order between windows does not.
+     * Step 4 always runs on the main thread.
      *
      * note: Must be called from main thread only
     */
     void PollEvents();
 
+    /**
+     * Window count from which PollEvents() updates input in parallel.
+     * Below it the job round trip costs more than the work.
+     */
+    static constexpr size_t PARALLEL_UPDATE_MIN_WINDOWS = 4;
+
+    /**
+     * Set the JobSystem used to update windows in parallel.
+     * param jobSystem: Non-owning; nullptr = update serially. Must outlive
+     *                  its use here (clear it before destroying the JobSystem)
+     * note: Must be called from main thread
+     */
+    void SetJobSystem(JobSystem* jobSystem);
+
+    /**
+     * Block the main thread until OS input arrives, the deadline passes, or
+     * WakeMainThread() is called. Replaces busy-polling in the main loop.
+     *
+     * param deadline:    Absolute time to return at (time_point::max() = none)
+     * param wakeOnInput: false = only wait for the deadline / wake-up (used
+     *                    for frame pacing; input is picked up next frame)
+     * note: Must be called from main thread
+     */
+    void WaitForEvents(std::chrono::steady_clock::time_point deadline, bool wakeOnInput = true);
+
+    /**
+     * Wake the main thread from WaitForEvents().
+     * note: Thread-safe; intended for jobs that finish work the main loop is waiting on
+     */
+    void WakeMainThread();
+
+    /**
+     * Read input on a dedicated thread instead of in PollEvents().
+     *
+     * Input is then read and timestamped as soon as the OS delivers it and
+     * each window drains it in Window::UpdateInput(), so a long frame no
+     * longer delays when input is picked up.
+     *
+     * return false if the platform does not support it (Win32)
+     * note: Must be called from main thread
+     */
+    bool StartInputThread();
+
+    /**
+     * Return to reading input on the main thread. Safe to call when not running.
+     */
+    void StopInputThread();
+
+    bool IsInputThreadRunning() const { return m_Platform.IsInputThreadRunning(); }
+
+    /**
+     * Record every window's per-frame input to a file.
+     *
+     * Each frame containing the InputFrame of every live window is written
+     * when the frame ends (start of the next PollEvents(), or
+     * StopInputRecording()), so input drained late in the frame from the
+     * input thread is included. Windows are
+     * identified by creation order (stream 0 = first window created), which
+     * matches the stream ids expected by ReplayWindowPlatform.
+     *
+     * param path: Output file (truncated)
+     * return false if the file cannot be created
+     * note: Must be called from main thread
+     */
+    bool StartInputRecording(const std::string& path);
+
+    /**
+     * Stop recording and close the file. Safe to call when not recording.
+     */
+    void StopInputRecording();
+
+    bool IsRecordingInput() const { return m_InputRecorder != nullptr; }
+
+    /**
+     * Drive every window's input from a recording instead of the OS.
+     *
+     * Frame N after the call plays frame N of the recording: each window
+     * gets the record of its stream (creation order, as written by
+     * StartInputRecording()) for that frame, or empty input if the stream
+     * has none. Live input is discarded while replaying; once the
+     * recording is exhausted, frames stay empty.
+     *
+     * param path: Recording file (see InputRecording)
+     * return false if the file cannot be loaded
+     * note: Must be called from main thread
+     */
+    bool StartInputReplay(const std::string& path);
+
+    /**
+     * Return to live input. Safe to call when not replaying.
+     */
+    void StopInputReplay();
+
+    bool IsReplayingInput() const { return m_InputReplay != nullptr; }
+
+    /**
+     * True once every recorded frame has been played.
+     */
+    bool IsInputReplayFinished() const
+    {
+        return m_InputReplay && m_ReplayFrame >= m_InputReplay->GetFrameCount();
+    }
+
     /**
      * Shutdown window context and destroy all windows
      * note: Must be called from main thread, idempotent
@@ -107,7 +238,18 @@ public:
     size_t GetWindowCount() const
     {
         std::lock_guard lock(m_WindowsMutex);
-        return m_Windows.size();
+        return m_Windows.Size();
+    }
+
+    /**
+     * Look up a window by handle
+     * return nullptr if the window was destroyed
+     */
+    std::shared_ptr<Window> GetWindow(WindowHandle handle) const
+    {
+        std::lock_guard lock(m_WindowsMutex);
+        const WindowEntry* entry = m_Windows.Get(handle);
+        return entry ? entry->window : nullptr;
     }
 
 private:
@@ -116,9 +258,36 @@ private:
 
     void OnDestroyWindow(Window* window);
 
+    struct WindowEntry
+    {
+        std::shared_ptr<Window> window;
+        uint32_t recordStreamId = 0; // Input recording stream (creation order)
+    };
+
+    void UpdateWindows();
+
     WindowContextPlatform& m_Platform = WindowContextPlatform::Get(); // Reference to singleton
-    std::unordered_set<std::shared_ptr<Window>> m_Windows;
+    SlotMap<WindowEntry> m_Windows;
     mutable std::mutex m_WindowsMutex;
     ThreadChecker m_ThreadChecker;
     bool m_Shutdown = false;
+
+    // Parallel window update
+    JobSystem* m_JobSystem = nullptr;
+    std::vector<std::shared_ptr<Window>> m_UpdateWindows; // Per-frame snapshot, capacity reused
+
+    // Input recording (stream id = window creation order)
+    std::unique_ptr<InputRecorder> m_InputRecorder;
+    uint32_t m_NextRecordStreamId = 0;
+    bool m_RecordFramePending = false; // A polled frame has not been written yet
+
+    void RecordInputFrame();
+
+    // Input replay (streams by window creation order, like recording)
+    std::shared_ptr<const InputRecording> m_InputReplay;
+    std::map<uint32_t, InputReplayStream> m_ReplayStreams;
+    uint64_t m_ReplayFrame = 0; // Recording frame played by the next PollEvents()
+    InputTimestamp m_ReplayEpoch = 0;
+
+    void ReplayInputFrame();
 };
\ No newline at end of file
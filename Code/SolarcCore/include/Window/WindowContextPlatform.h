@@ -1,10 +1,13 @@
 ﻿#pragma once
 #include "Event/WindowEvent.h"
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include "Preprocessor/API.h"
+#include <atomic>
 #include <string>
+#include <thread>
 #include <unordered_map>
 
 #ifdef _WIN32
@@ -20,10 +23,23 @@
     #include <wayland-client.h>
     #include "xdg-shell-client-protocol.h"
     #include "xdg-decoration-unstable-v1-client-protocol.h"
+    #include "relative-pointer-unstable-v1-client-protocol.h"
+    #include "pointer-constraints-unstable-v1-client-protocol.h"
+    #include "presentation-time-client-protocol.h"
+    #include "viewporter-client-protocol.h"
+    #include "fractional-scale-v1-client-protocol.h"
+    #include <time.h>
+    #include "Input/Platform/Linux/XkbKeymap.h"
+    #include "Input/InputTimestamp.h"
+    #include "Input/KeyRepeat.h"
+
+    struct wl_cursor_theme;
+    struct wl_cursor;
 
 #endif
 
 class WindowPlatform; // Forward declare
+struct PlatformInputEvent;
 
 /**
  * Abstract backend for WindowContext (per-platform)
@@ -44,6 +60,69 @@ public:
     void PollEvents();
     void Shutdown();
 
+    /**
+     * Run without a display server (CI, servers, benchmarks).
+     *
+     * No connection to the compositor / window system is made; windows are
+     * simulated (see WindowPlatform::IsHeadless) and WaitForEvents() only
+     * waits for deadlines and Wake().
+     *
+     * return false if the context already exists in the other mode
+     * note: Must be called before the first Get(); fixed for the process
+     */
+    static bool SetHeadless(bool headless)
+    {
+        if (s_Created.load(std::memory_order_acquire))
+            return Get().IsHeadless() == headless;
+
+        s_HeadlessRequested.store(headless, std::memory_order_release);
+        return true;
+    }
+
+    bool IsHeadless() const { return m_Headless; }
+
+    /**
+     * Block until OS events arrive, the deadline passes, or Wake() is called.
+     *
+     * Events that arrive are only queued; they are dispatched by the next
+     * PollEvents() so input still lands in the right frame.
+     *
+     * param deadline:    Absolute time to return at (time_point::max() = none)
+     * param wakeOnInput: false = ignore OS events (including client-side
+     *                    key repeats) and only wait for the deadline or
+     *                    Wake() (frame pacing)
+     * note: Main thread only
+     */
+    void WaitForEvents(std::chrono::steady_clock::time_point deadline, bool wakeOnInput = true);
+
+    /**
+     * Interrupt WaitForEvents() from any thread.
+     */
+    void Wake();
+
+    /**
+     * Read and dispatch input on a dedicated thread.
+     *
+     * Seat objects (keyboard, pointer, relative pointer) are moved to their
+     * own event queue, which the input thread reads with the
+     * prepare_read / read_events protocol as soon as data arrives,
+     * independent of the frame rate. Events are timestamped there and
+     * pushed into each window's lock-free input queue; Window::UpdateInput
+     * drains it on the main thread.
+     *
+     * return false if unsupported (Win32: window messages are bound to the
+     *        thread that created the window) or the thread cannot start
+     * note: Main thread only. Idempotent.
+     */
+    bool StartInputThread();
+
+    /**
+     * Stop the input thread and dispatch seat events on the main thread again.
+     */
+    void StopInputThread();
+
+    bool IsInputThreadRunning() const;
+
 #ifdef _WIN32
     static LRESULT CALLBACK WndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam);
     static const std::string& GetWindowClassName() { return m_WindowClassName; }
@@ -57,34 +136,100 @@ public:
         return m_DecorationManager;
     }
 
+    /**
+     * Pointer constraints global (nullptr if the compositor lacks it).
+     */
+    zwp_pointer_constraints_v1* GetPointerConstraints() const { return m_PointerConstraints; }
+
+    /**
+     * Presentation-time global (nullptr if the compositor lacks it).
+     */
+    wp_presentation* GetPresentation() const { return m_Presentation; }
+
+    /**
+     * Viewporter global (nullptr if the compositor lacks it).
+     * Lets a surface's buffer size differ from its logical size.
+     */
+    wp_viewporter* GetViewporter() const { return m_Viewporter; }
+
+    /**
+     * Fractional scale global (nullptr if the compositor lacks it).
+     */
+    wp_fractional_scale_manager_v1* GetFractionalScaleManager() const { return m_FractionalScaleManager; }
+
+    /**
+     * Convert a wp_presentation timestamp (in the compositor's presentation
+     * clock) to steady_clock.
+     */
+    std::chrono::steady_clock::time_point PresentationTimeToSteady(uint64_t seconds, uint32_t nanoseconds) const;
+
+    /**
+     * Seat pointer (nullptr until the seat reports pointer capability).
+     */
+    wl_pointer* GetPointer() const
+    {
+        std::lock_guard lock(m_SeatMtx);
+        return m_Pointer;
+    }
+
+    /**
+     * Re-apply the cursor image for a window that currently has pointer focus
+     * (hidden while its cursor mode is Locked, default arrow otherwise).
+     */
+    void RefreshCursor(WindowPlatform* window);
+
+    /**
+     * Drop any focus references to a window that is being destroyed.
+     */
+    void ForgetWindow(WindowPlatform* window);
+
 #endif
 
 private:
     WindowContextPlatform();  // Private constructor
     ~WindowContextPlatform(); // Private destructor
 
+    static inline std::atomic<bool> s_HeadlessRequested{ false };
+    static inline std::atomic<bool> s_Created{ false };
+    bool m_Headless = false;
+
 #ifdef _WIN32
     static inline std::mutex m_WindowClassMtx;
     static inline std::string m_WindowClassName = "SolarcEngineWindowClass";
     static inline HINSTANCE m_hInstance = nullptr;
     static inline bool m_ClassRegistered = false;
 
+    HANDLE m_WakeEvent = nullptr;   // Auto-reset event signalled by Wake()
+    HANDLE m_FrameTimer = nullptr;  // Waitable timer for WaitForEvents deadlines
+
 #elif defined(__linux__)
 
     static void registry_global(void* data, wl_registry* registry, uint32_t name, const char* interface, uint32_t version);
     static void registry_global_remove(void* data, wl_registry* registry, uint32_t name);
     static void xdg_wm_base_ping(void* data, xdg_wm_base* xdg_wm_base, uint32_t serial);
+    static void presentation_clock_id(void* data, wp_presentation* presentation, uint32_t clockId);
 
     wl_display* m_Display = nullptr;
     wl_registry* m_Registry = nullptr;
     wl_compositor* m_Compositor = nullptr;
     xdg_wm_base* m_XdgWmBase = nullptr;
     zxdg_decoration_manager_v1* m_DecorationManager = nullptr;
+    zwp_relative_pointer_manager_v1* m_RelativePointerManager = nullptr;
+    zwp_pointer_constraints_v1* m_PointerConstraints = nullptr;
+    wp_presentation* m_Presentation = nullptr;
+    clockid_t m_PresentationClock = CLOCK_MONOTONIC; // Announced by wp_presentation::clock_id
+    wp_viewporter* m_Viewporter = nullptr;
+    wp_fractional_scale_manager_v1* m_FractionalScaleManager = nullptr;
+    wl_shm* m_Shm = nullptr;
 
     bool m_ShuttingDown = false;
 
+    int m_WakeFd = -1;   // eventfd written by Wake()
+    int m_TimerFd = -1;  // timerfd (CLOCK_MONOTONIC) for WaitForEvents deadlines
+
     static const wl_registry_listener s_RegistryListener;
     static const xdg_wm_base_listener s_XdgWmBaseListener;
+    static const wp_presentation_listener s_PresentationListener;
 
 
     // ========================================================================
@@ -93,11 +238,75 @@ private:
     wl_seat* m_Seat = nullptr;
     wl_keyboard* m_Keyboard = nullptr;
     wl_pointer* m_Pointer = nullptr;
+    zwp_relative_pointer_v1* m_RelativePointer = nullptr;
+
+    // Compositor keymap, compiled to lookup tables (seat dispatch thread only)
+    XkbKeymap m_Keymap;
+
+    // ========================================================================
+    // Key Repeat (client-side; the compositor only sends rate and delay)
+    // ========================================================================
+
+    /**
+     * Deliver every repeat of the held key due at or before 'now' to the
+     * focused window, with per-repeat timestamps. Called before each key
+     * event, from PollEvents() (main-thread dispatch) and by the input
+     * thread when m_RepeatTimerFd fires.
+     */
+    void GenerateKeyRepeats(InputTimestamp now);
+
+    /**
+     * Arm m_RepeatTimerFd for the next repeat, or disarm it.
+     */
+    void ArmKeyRepeatTimer();
+
+    KeyRepeatGenerator m_KeyRepeat;
+    int m_RepeatTimerFd = -1; // Wakes idle waits and the input thread for the next repeat
+
+    // Cursor image (wayland-cursor). Optional: without wl_shm or a theme the
+    // compositor's cursor is left untouched except for hiding while locked.
+    wl_cursor_theme* m_CursorTheme = nullptr;
+    wl_cursor* m_DefaultCursor = nullptr;
+    wl_surface* m_CursorSurface = nullptr;
+    uint32_t m_PointerEnterSerial = 0;
+
+    void LoadCursorTheme();
+    void CreateRelativePointer();
+
+    // ========================================================================
+    // Input Thread
+    // ========================================================================
+
+    /**
+     * Hand an input event to a window: queued for the main thread while the
+     * input thread runs (or older queued events are pending), applied
+     * directly otherwise.
+     */
+    void DeliverInput(WindowPlatform* window, const PlatformInputEvent& event);
+
+    /**
+     * Deliver the text a key press produces (table lookup, no xkb calls).
+     * Nothing is sent for keys without printable text or while Ctrl/Alt
+     * are held.
+     * param key: evdev key code (wl_keyboard::key), not the internal scancode
+     */
+    void DeliverText(WindowPlatform* window, uint32_t key, InputTimestamp timestamp);
+    void InputThreadMain();
+
+    wl_event_queue* m_SeatQueue = nullptr; // Non-null while the input thread owns the seat
+    std::thread m_InputThread;
+    int m_InputStopFd = -1;                // eventfd that ends the input thread's poll
+
+    // Guards seat objects, focus pointers and the enter serial. Held by the
+    // input thread while it dispatches, so a window unregistered through
+    // ForgetWindow() is never touched afterwards.
+    mutable std::mutex m_SeatMtx;
 
     // Listener structures
     static const wl_seat_listener s_SeatListener;
     static const wl_keyboard_listener s_KeyboardListener;
     static const wl_pointer_listener s_PointerListener;
+    static const zwp_relative_pointer_v1_listener s_RelativePointerListener;
 
     // Seat capabilities tracking
     static void seat_capabilities(void* data, wl_seat* seat, uint32_t capabilities);
@@ -134,6 +343,12 @@ private:
     static void pointer_axis_stop(void* data, wl_pointer* pointer, uint32_t time, uint32_t axis);
     static void pointer_axis_discrete(void* data, wl_pointer* pointer, uint32_t axis, int32_t discrete);
 
+    // Relative pointer (unaccelerated motion) handler
+    static void relative_pointer_motion(void* data, zwp_relative_pointer_v1* relativePointer,
+        uint32_t utime_hi, uint32_t utime_lo,
+        wl_fixed_t dx, wl_fixed_t dy,
+        wl_fixed_t dx_unaccel, wl_fixed_t dy_unaccel);
+
     WindowPlatform* m_PointerFocusedWindow = nullptr;
     WindowPlatform* m_KeyboardFocusedWindow = nullptr;
 
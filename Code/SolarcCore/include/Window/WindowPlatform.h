@@ -8,6 +8,13 @@
 #include "Input/KeyCode.h"
 #include "Input/MouseButton.h"
 #include "Input/InputFrame.h"
+#include "Input/InputTimestamp.h"
+#include "Input/CursorMode.h"
+#include "Input/InputEventQueue.h"
+#include "Input/InputRecording.h"
+#include "Window/WindowState.h"
+#include "Window/SurfaceScale.h"
+#include <atomic>
 
 #ifdef _WIN32
 #include <windows.h>
@@ -41,6 +48,22 @@ public:
     {
         std::lock_guard lk(mtx);
         m_ThisFrameInput.Reset();
+        m_InputReplaced = false;
+    }
+
+    /**
+     * Replace this frame's input with a recorded frame.
+     * Called by WindowContext::PollEvents() after OS events were processed,
+     * while input replay is active (WindowContext::StartInputReplay).
+     *
+     * Live input still queued by the input thread is discarded until the
+     * next ResetThisFrameInput().
+     */
+    void ReplaceThisFrameInput(InputReplayStream& replay, uint64_t frame)
+    {
+        std::lock_guard lk(mtx);
+        replay.Play(frame, m_ThisFrameInput, m_HasKeyboardFocus);
+        m_InputReplaced = true;
     }
 
     /**
@@ -70,6 +93,28 @@ public:
      */
     void OnFocusLost();
 
+    /**
+     * Constrain the cursor to this window (see CursorMode).
+     *
+     * Normal:   release any constraint
+     * Confined: keep the cursor inside the client area
+     * Locked:   hide and pin the cursor; deltas come from unaccelerated
+     *           relative motion
+     *
+     * note: If the platform cannot honor the request the mode stays Normal
+     *       and a warning is logged
+     */
+    void SetCursorMode(CursorMode mode);
+
+    /**
+     * Get the currently applied cursor mode.
+     */
+    CursorMode GetCursorMode() const
+    {
+        std::lock_guard lk(mtx);
+        return m_CursorMode;
+    }
+
 
     // -- Getters --
     const std::string& GetTitle() const { return m_Title; }
@@ -79,6 +124,61 @@ public:
     bool IsMinimized() const;
     bool IsMaximized() const;
 
+    /**
+     * Is this a simulated window (WindowContextPlatform::IsHeadless)?
+     *
+     * Headless windows have no OS surface. Commands take effect immediately
+     * and dispatch the same events the OS would, so pacing, resize and
+     * minimize paths run unchanged.
+     * note: Resize() to an empty size is ignored with a warning; simulate a
+     *       minimized window with Minimize(), which dispatches
+     *       WindowMinimizedEvent
+     */
+    bool IsHeadless() const { return m_Headless; }
+
+    /**
+     * Logical-to-buffer scaling of this window (see SurfaceScale).
+     */
+    SurfaceScale GetSurfaceScale() const
+    {
+        std::lock_guard lk(mtx);
+        return m_SurfaceScale;
+    }
+
+    /**
+     * Size the swapchain of this window should have, in device pixels.
+     * Differs from GetWidth()/GetHeight() (logical) on fractionally scaled
+     * outputs and at render scales other than 1.0.
+     */
+    SurfaceExtent GetBufferExtent() const
+    {
+        std::lock_guard lk(mtx);
+        return m_SurfaceScale.ToBuffer(m_Width, m_Height);
+    }
+
+    /**
+     * Render at a fraction of the native resolution; the compositor (or
+     * DXGI stretch scaling) scales the buffer to the window.
+     *
+     * param scale: Clamped to [SurfaceScale::MIN_RENDER_SCALE, MAX_RENDER_SCALE]
+     * note: Dispatches WindowResizeEvent (same logical size) when the buffer
+     *       size changes, so the swapchain is recreated through the usual path
+     * note: Wayland needs wp_viewporter; without it the scale stays 1.0 and
+     *       a warning is logged
+     */
+    void SetRenderScale(float scale);
+
+    /**
+     * Publish size / visibility changes into 'snapshot' (owned by Window).
+     * The current state is published immediately; nullptr stops publishing.
+     */
+    void BindStateSnapshot(WindowStateSnapshot* snapshot)
+    {
+        std::lock_guard lk(mtx);
+        m_StateSnapshot = snapshot;
+        PublishState();
+    }
+
     // Helper for internal dispatch
     void DispatchWindowEvent(const std::shared_ptr<const WindowEvent>& e)
     {
@@ -89,6 +189,15 @@ public:
     HWND GetWin32Handle() const { return m_hWnd; }
 #elif defined(__linux__)
     wl_surface* GetWaylandSurface() const { return m_Surface; }
+
+    /**
+     * Apply input events queued by the input thread to this frame's input.
+     *
+     * Called by Window::UpdateInput() on the main thread right before the
+     * frame is read. Cheap no-op when input is dispatched on the main
+     * thread (WindowContextPlatform::StartInputThread not used).
+     */
+    void DrainInputQueue();
 #endif
 
 private:
@@ -99,7 +208,7 @@ private:
         m_HasKeyboardFocus = focused;
     }
 
-    void RecordKeyTransition(uint16_t scancode, bool pressed, bool isRepeat)
+    void RecordKeyTransition(uint16_t scancode, bool pressed, bool isRepeat, InputTimestamp timestamp)
     {
         std::lock_guard lock(mtx);
         if (scancode < m_CurrentKeyState.size())
@@ -112,20 +221,32 @@ private:
             {
                 m_CurrentKeyState[scancode] = false;
             }
-            m_ThisFrameInput.keyTransitions.emplace_back(scancode, pressed, isRepeat);
+            m_ThisFrameInput.keyTransitions.emplace_back(scancode, pressed, isRepeat, timestamp);
         }
     }
 
-    void RecordMousePosition(int32_t x, int32_t y)
+    void RecordMousePosition(int32_t x, int32_t y, InputTimestamp timestamp)
     {
         std::lock_guard lock(mtx);
 
+        if (m_RelativeMotionActive)
+        {
+            // Deltas come from RecordRelativeMotion(); only track position
+            m_ThisFrameInput.mouseX = x;
+            m_ThisFrameInput.mouseY = y;
+            m_PrevMouseX = x;
+            m_PrevMouseY = y;
+            m_MousePositionInitialized = true;
+            return;
+        }
+
 
         if (!m_MousePositionInitialized)
         {
             // First mouse event: initialize without delta
             m_ThisFrameInput.mouseX = x;
             m_ThisFrameInput.mouseY = y;
+            m_ThisFrameInput.mouseSamples.Push({ timestamp, x, y, 0, 0 });
             m_PrevMouseX = x;
             m_PrevMouseY = y;
             m_MousePositionInitialized = true;
@@ -138,14 +259,51 @@ private:
         m_ThisFrameInput.mouseDeltaY += deltaY;
         m_ThisFrameInput.mouseX = x;
         m_ThisFrameInput.mouseY = y;
+        m_ThisFrameInput.mouseSamples.Push({ timestamp, x, y, deltaX, deltaY });
         m_PrevMouseX = x;
         m_PrevMouseY = y;
     }
 
-    void RecordMouseButton(MouseButton button, bool pressed)
+    /**
+     * Record unaccelerated relative motion (Wayland relative pointer / Win32 raw input).
+     *
+     * Sub-pixel motion is carried over between events so slow movements are
+     * not lost to integer truncation of mouseDeltaX/Y.
+     */
+    void RecordRelativeMotion(double dx, double dy, InputTimestamp timestamp)
+    {
+        std::lock_guard lock(mtx);
+
+        m_RelativeRemainderX += dx;
+        m_RelativeRemainderY += dy;
+
+        int32_t deltaX = static_cast<int32_t>(m_RelativeRemainderX);
+        int32_t deltaY = static_cast<int32_t>(m_RelativeRemainderY);
+        m_RelativeRemainderX -= deltaX;
+        m_RelativeRemainderY -= deltaY;
+
+        m_ThisFrameInput.mouseDeltaX += deltaX;
+        m_ThisFrameInput.mouseDeltaY += deltaY;
+        m_ThisFrameInput.mouseSamples.Push({
+            timestamp, m_ThisFrameInput.mouseX, m_ThisFrameInput.mouseY, deltaX, deltaY });
+    }
+
+    /**
+     * Select the delta source: relative motion events (true) or differences
+     * of absolute positions (false).
+     */
+    void SetRelativeMotionActive(bool active)
+    {
+        std::lock_guard lock(mtx);
+        m_RelativeMotionActive = active;
+        m_RelativeRemainderX = 0.0;
+        m_RelativeRemainderY = 0.0;
+    }
+
+    void RecordMouseButton(MouseButton button, bool pressed, InputTimestamp timestamp)
     {
         std::lock_guard lock(mtx);
-        m_ThisFrameInput.mouseButtonTransitions.emplace_back(button, pressed);
+        m_ThisFrameInput.mouseButtonTransitions.emplace_back(button, pressed, timestamp);
     }
 
     void RecordMouseWheel(float verticalDelta, float horizontalDelta)
@@ -155,14 +313,71 @@ private:
         m_ThisFrameInput.hWheelDelta += horizontalDelta;
     }
 
+    /**
+     * Record one typed character (already filtered with TextInput::IsPrintable).
+     */
+    void RecordText(uint32_t codepoint)
+    {
+        std::lock_guard lock(mtx);
+        m_ThisFrameInput.textInput.push_back(codepoint);
+    }
+
+    /**
+     * Record the keymap's modifier state (KeyModifier bitmask).
+     */
+    void RecordModifiers(uint8_t modifiers)
+    {
+        std::lock_guard lock(mtx);
+        m_ThisFrameInput.modifiers = modifiers;
+        m_ThisFrameInput.hasModifiers = true;
+    }
+
     std::string m_Title;
     int32_t m_Width;
     int32_t m_Height;
     bool m_Visible = false;
+    bool m_Minimized = false;
     bool m_Maximized = false;
 
     mutable std::recursive_mutex mtx;
 
+    // -- Headless (shared by all platforms, see HeadlessWindowPlatform.cpp) --
+    void InitializeHeadless();
+    void HeadlessShow();
+    void HeadlessHide();
+    void HeadlessResize(int32_t width, int32_t height);
+    void HeadlessMinimize();
+    void HeadlessMaximize();
+    void HeadlessRestore();
+    void HeadlessSetCursorMode(CursorMode mode);
+    void HeadlessSetRenderScale(float scale);
+    bool m_Headless = false;
+
+    /**
+     * Replace the surface scale. Called with mtx held; republishes the state
+     * and dispatches a resize if the buffer size changed.
+     */
+    void UpdateSurfaceScale(const SurfaceScale& scale)
+    {
+        const SurfaceExtent previous = m_SurfaceScale.ToBuffer(m_Width, m_Height);
+        m_SurfaceScale = scale;
+
+        if (m_SurfaceScale.ToBuffer(m_Width, m_Height) != previous)
+        {
+            PublishState();
+            DispatchWindowEvent(std::make_shared<WindowResizeEvent>(m_Width, m_Height));
+        }
+    }
+
+    SurfaceScale m_SurfaceScale;
+
+    /**
+     * Publish the current size and flags to m_StateSnapshot (if bound).
+     * Called with mtx held after every change to them.
+     */
+    void PublishState();
+    WindowStateSnapshot* m_StateSnapshot = nullptr;
+
     /**
      * Per-frame input accumulator (populated during OS event processing).
      */
@@ -175,6 +390,9 @@ private:
      */
     bool m_HasKeyboardFocus = false;
 
+    // This frame's input came from a replay (live input is discarded)
+    bool m_InputReplaced = false;
+
     /**
      * Current keyboard state (which keys are held down).
      * Indexed by scancode (0-511).
@@ -184,6 +402,26 @@ private:
      */
     std::array<bool, 512> m_CurrentKeyState;
 
+    /**
+    * Previous mouse position (for delta computation).
+    * Both Win32 (WM_MOUSEMOVE) and Wayland (wl_pointer::motion) report
+    * absolute positions, so the per-event delta is computed here.
+    */
+    bool m_MousePositionInitialized = false;
+    int32_t m_PrevMouseX = 0;
+    int32_t m_PrevMouseY = 0;
+
+    /**
+    * Relative motion state.
+    * When active, mouseDeltaX/Y are fed by RecordRelativeMotion() and
+    * absolute positions only update mouseX/Y.
+    */
+    bool m_RelativeMotionActive = false;
+    double m_RelativeRemainderX = 0.0;
+    double m_RelativeRemainderY = 0.0;
+
+    CursorMode m_CursorMode = CursorMode::Normal;
+
 #ifdef _WIN32
 
     void SyncDimensions(int32_t width, int32_t height)
@@ -191,18 +429,21 @@ private:
         std::lock_guard lk(mtx);
         m_Width = width;
         m_Height = height;
+        PublishState();
     }
 
     void SyncVisibility(bool visible)
     {
         std::lock_guard lk(mtx);
         m_Visible = visible;
+        PublishState();
     }
 
     void SyncMaximized(bool maximized)
     {
         std::lock_guard lk(mtx);
         m_Maximized = maximized;
+        PublishState();
     }
 
     friend LRESULT CALLBACK WindowContextPlatform::WndProc(HWND, UINT, WPARAM, LPARAM);
@@ -210,23 +451,60 @@ private:
     {
         std::lock_guard lk(mtx);
         m_Minimized = minimized;
+        PublishState();
     }
 
-    HWND m_hWnd = nullptr;
-    bool m_Minimized = false;
-    bool m_MousePositionInitialized = false;
-
     /**
-    * Previous mouse position (for delta computation).
-    * Win32 gives us absolute position in WM_MOUSEMOVE, we compute delta.
+    * Re-apply ClipCursor for the current cursor mode.
+    * Windows drops the clip rect on focus change, move and resize.
     */
-    int32_t m_PrevMouseX = 0;
-    int32_t m_PrevMouseY = 0;
+    void ApplyCursorClip();
+
+    HWND m_hWnd = nullptr;
+    bool m_CursorHidden = false;
+    uint16_t m_PendingHighSurrogate = 0; // First half of a WM_CHAR surrogate pair
   
 #elif defined(__linux__)
     void HandleConfigure(int32_t width, int32_t height);
     void HandleClose();
 
+    /**
+     * Fold one OS input event into this frame's input (main thread).
+     * Wayland listeners call this directly, or through the input queue
+     * when a dedicated input thread dispatches the seat.
+     */
+    void ApplyInputEvent(const PlatformInputEvent& event);
+
+    /**
+     * Input thread side of the queue. Never blocks; drops on overflow.
+     */
+    void QueueInputEvent(const PlatformInputEvent& event)
+    {
+        if (!m_InputQueue.TryPush(event))
+            m_DroppedInputEvents.fetch_add(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * Create the pointer constraint object for m_CursorMode if none exists.
+     * Called from SetCursorMode() and on pointer enter (the wl_pointer may
+     * not exist yet when the mode is first requested).
+     */
+    void ApplyPointerConstraint();
+    void DestroyPointerConstraint();
+
+    /**
+     * Map the buffer onto the logical size (wp_viewport destination).
+     * Applied with the next surface commit.
+     */
+    void UpdateViewportDestination();
+
+    static void fractional_scale_preferred_scale(void* data, wp_fractional_scale_v1* fractionalScale, uint32_t scale);
+
+    static void locked_pointer_locked(void* data, zwp_locked_pointer_v1* locked);
+    static void locked_pointer_unlocked(void* data, zwp_locked_pointer_v1* locked);
+    static void confined_pointer_confined(void* data, zwp_confined_pointer_v1* confined);
+    static void confined_pointer_unconfined(void* data, zwp_confined_pointer_v1* confined);
+
     static void xdg_surface_configure(void* data, xdg_surface* xdg_surface, uint32_t serial);
     static void xdg_toplevel_configure(void* data, xdg_toplevel* toplevel,
         int32_t width, int32_t height, wl_array* states);
@@ -236,10 +514,31 @@ private:
     xdg_surface* m_XdgSurface = nullptr;
     xdg_toplevel* m_XdgToplevel = nullptr;
     zxdg_toplevel_decoration_v1* m_Decoration = nullptr;
+    zwp_locked_pointer_v1* m_LockedPointer = nullptr;
+    zwp_confined_pointer_v1* m_ConfinedPointer = nullptr;
+    wp_viewport* m_Viewport = nullptr;                 // Buffer size != logical size
+    wp_fractional_scale_v1* m_FractionalScale = nullptr; // Preferred scale of the surface's output
     bool m_Configured = false;
 
+    // The one source of IsVisible() / IsMinimized() and the published flags
+    // (caller holds mtx). Unmapped until the first configure; a zero size
+    // from the compositor means minimized.
+    bool IsMappedUnlocked() const { return m_Visible && m_Configured; }
+    bool IsMinimizedUnlocked() const
+    {
+        return IsMappedUnlocked() && (m_Minimized || (m_Width == 0 && m_Height == 0));
+    }
+
+    // Events from the input thread (single producer: input thread,
+    // single consumer: main thread in DrainInputQueue)
+    InputEventQueue m_InputQueue;
+    std::atomic<uint32_t> m_DroppedInputEvents{ 0 };
+
     static const xdg_surface_listener s_XdgSurfaceListener;
     static const xdg_toplevel_listener s_XdgToplevelListener;
+    static const zwp_locked_pointer_v1_listener s_LockedPointerListener;
+    static const zwp_confined_pointer_v1_listener s_ConfinedPointerListener;
+    static const wp_fractional_scale_v1_listener s_FractionalScaleListener;
 
     friend class WindowContextPlatform;
 
@@ -0,0 +1,108 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <cstdint>
+
+/**
+ * Window state flags (WindowState::flags bitmask).
+ */
+enum WindowStateFlag : uint8_t
+{
+    WINDOW_STATE_VISIBLE   = 1 << 0,
+    WINDOW_STATE_MINIMIZED = 1 << 1,
+    WINDOW_STATE_MAXIMIZED = 1 << 2,
+    WINDOW_STATE_CLOSED    = 1 << 3
+};
+
+/**
+ * Window state at one point in time, as read from a WindowStateSnapshot.
+ *
+ * 'generation' changes every time the state is published, so a reader can
+ * detect "anything changed since last frame" with one compare.
+ */
+struct WindowState
+{
+    int32_t width = 0;
+    int32_t height = 0;
+    uint32_t generation = 0;
+    uint8_t flags = 0;
+
+    bool IsVisible() const { return (flags & WINDOW_STATE_VISIBLE) != 0; }
+    bool IsMinimized() const { return (flags & WINDOW_STATE_MINIMIZED) != 0; }
+    bool IsMaximized() const { return (flags & WINDOW_STATE_MAXIMIZED) != 0; }
+    bool IsClosed() const { return (flags & WINDOW_STATE_CLOSED) != 0; }
+
+    /**
+     * Can a frame be rendered and presented to this window?
+     */
+    bool IsRenderable() const
+    {
+        return IsVisible() && !IsMinimized() && !IsClosed() && width > 0 && height > 0;
+    }
+};
+
+/**
+ * Wait-free published window state.
+ *
+ * The platform publishes size and flags whenever they change (under its
+ * own lock, so writers are serialized); any thread reads the latest state
+ * with a single atomic load, without touching the window or platform
+ * mutexes. Size, flags and generation are packed into one 64-bit word so
+ * a reader never sees a size from one update and flags from another:
+ *
+ *   [63..40] generation (24 bits, wraps)
+ *   [39..32] flags
+ *   [31..16] height (clamped to 0..65535)
+ *   [15..0]  width  (clamped to 0..65535)
+ *
+ * Aligned to its own cache line so the reads on the render thread do not
+ * contend with writes to neighbouring window fields.
+ */
+class alignas(64) WindowStateSnapshot
+{
+public:
+    static constexpr int32_t MAX_EXTENT = 0xFFFF;
+
+    /**
+     * Publish new state (bumps the generation).
+     * note: Writers must be serialized externally
+     */
+    void Publish(int32_t width, int32_t height, uint8_t flags)
+    {
+        const uint64_t previous = m_Packed.load(std::memory_order_relaxed);
+        const uint32_t generation = (static_cast<uint32_t>(previous >> 40) + 1) & 0xFFFFFF;
+
+        m_Packed.store(Pack(width, height, flags, generation), std::memory_order_release);
+    }
+
+    /**
+     * Read the latest published state. Wait-free, any thread.
+     */
+    WindowState Load() const
+    {
+        return Unpack(m_Packed.load(std::memory_order_acquire));
+    }
+
+    static uint64_t Pack(int32_t width, int32_t height, uint8_t flags, uint32_t generation)
+    {
+        const uint64_t w = static_cast<uint64_t>(std::clamp(width, 0, MAX_EXTENT));
+        const uint64_t h = static_cast<uint64_t>(std::clamp(height, 0, MAX_EXTENT));
+        return w | (h << 16) | (static_cast<uint64_t>(flags) << 32) |
+            (static_cast<uint64_t>(generation & 0xFFFFFF) << 40);
+    }
+
+    static WindowState Unpack(uint64_t packed)
+    {
+        WindowState state;
+        state.width = static_cast<int32_t>(packed & 0xFFFF);
+        state.height = static_cast<int32_t>((packed >> 16) & 0xFFFF);
+        state.flags = static_cast<uint8_t>((packed >> 32) & 0xFF);
+        state.generation = static_cast<uint32_t>(packed >> 40);
+        return state;
+    }
+
+private:
+    std::atomic<uint64_t> m_Packed{ 0 };
+
+    static_assert(std::atomic<uint64_t>::is_always_lock_free, "WindowStateSnapshot requires lock-free 64-bit atomics");
+};
@@ -0,0 +1,307 @@
+#include "Input/InputActionMap.h"
+#include "Input/KeyMapping.h"
+#include <cctype>
+
+namespace
+{
+    bool EqualsIgnoreCase(std::string_view a, std::string_view b)
+    {
+        if (a.size() != b.size())
+            return false;
+
+        for (size_t i = 0; i < a.size(); ++i)
+        {
+            if (std::tolower(static_cast<unsigned char>(a[i])) !=
+                std::tolower(static_cast<unsigned char>(b[i])))
+                return false;
+        }
+        return true;
+    }
+
+    std::string_view Trim(std::string_view s)
+    {
+        while (!s.empty() && std::isspace(static_cast<unsigned char>(s.front())))
+            s.remove_prefix(1);
+        while (!s.empty() && std::isspace(static_cast<unsigned char>(s.back())))
+            s.remove_suffix(1);
+        return s;
+    }
+
+    std::optional<MouseButton> ParseMouseButton(std::string_view name)
+    {
+        constexpr std::string_view PREFIX = "Mouse";
+        if (name.size() <= PREFIX.size() || !EqualsIgnoreCase(name.substr(0, PREFIX.size()), PREFIX))
+            return std::nullopt;
+
+        std::string_view button = name.substr(PREFIX.size());
+        for (uint8_t i = 0; i < static_cast<uint8_t>(MouseButton::Count); ++i)
+        {
+            MouseButton candidate = static_cast<MouseButton>(i);
+            if (EqualsIgnoreCase(button, MouseButtonToString(candidate)))
+                return candidate;
+        }
+        return std::nullopt;
+    }
+
+    template<typename Fn>
+    void ForEachBit(uint64_t mask, Fn&& fn)
+    {
+        while (mask != 0)
+        {
+            fn(static_cast<uint32_t>(std::countr_zero(mask)));
+            mask &= mask - 1;
+        }
+    }
+
+    const std::string g_EmptyName;
+}
+
+// ============================================================================
+// Building
+// ============================================================================
+
+InputActionId InputActionMap::AddAction(std::string_view name)
+{
+    InputActionId existing = FindAction(name);
+    if (existing != INVALID_INPUT_ACTION)
+        return existing;
+
+    if (name.empty() || m_Actions.size() >= MAX_INPUT_ACTIONS)
+        return INVALID_INPUT_ACTION;
+
+    m_Actions.push_back({ std::string(name), {} });
+    return static_cast<InputActionId>(m_Actions.size() - 1);
+}
+
+bool InputActionMap::AddBinding(InputActionId action, const InputBinding& binding)
+{
+    if (action >= m_Actions.size() || binding.IsEmpty())
+        return false;
+
+    m_Actions[action].bindings.push_back(binding);
+
+    // Compile: every key / button in the chord marks the action dirty when
+    // it changes state
+    const uint64_t actionBit = 1ull << action;
+    for (uint8_t i = 0; i < binding.keyCount; ++i)
+        m_KeyActionMask[binding.scancodes[i]] |= actionBit;
+
+    for (uint8_t i = 0; i < static_cast<uint8_t>(MouseButton::Count); ++i)
+    {
+        if (IsButtonSet(binding.mouseButtons, static_cast<MouseButton>(i)))
+            m_ButtonActionMask[i] |= actionBit;
+    }
+
+    return true;
+}
+
+bool InputActionMap::AddBinding(InputActionId action, std::string_view chord)
+{
+    auto binding = ParseBinding(chord);
+    if (!binding)
+        return false;
+
+    return AddBinding(action, *binding);
+}
+
+InputAxisId InputActionMap::AddAxis(std::string_view name, InputActionId positive, InputActionId negative, float scale)
+{
+    if (name.empty() || FindAxis(name) != INVALID_INPUT_AXIS || m_Axes.size() >= MAX_INPUT_AXES)
+        return INVALID_INPUT_AXIS;
+
+    Axis axis;
+    axis.name = std::string(name);
+    axis.source = InputAxisSource::Actions;
+    axis.positive = positive < m_Actions.size() ? positive : INVALID_INPUT_ACTION;
+    axis.negative = negative < m_Actions.size() ? negative : INVALID_INPUT_ACTION;
+    axis.scale = scale;
+
+    m_Axes.push_back(std::move(axis));
+    return static_cast<InputAxisId>(m_Axes.size() - 1);
+}
+
+InputAxisId InputActionMap::AddAxis(std::string_view name, InputAxisSource source, float scale)
+{
+    if (name.empty() || FindAxis(name) != INVALID_INPUT_AXIS || m_Axes.size() >= MAX_INPUT_AXES)
+        return INVALID_INPUT_AXIS;
+
+    Axis axis;
+    axis.name = std::string(name);
+    axis.source = source;
+    axis.scale = scale;
+
+    m_Axes.push_back(std::move(axis));
+    return static_cast<InputAxisId>(m_Axes.size() - 1);
+}
+
+void InputActionMap::Clear()
+{
+    m_Actions.clear();
+    m_Axes.clear();
+    m_KeyActionMask.fill(0);
+    m_ButtonActionMask.fill(0);
+}
+
+std::optional<InputBinding> InputActionMap::ParseBinding(std::string_view chord)
+{
+    InputBinding binding;
+    bool morePartsExpected = !chord.empty();
+
+    while (morePartsExpected)
+    {
+        size_t plus = chord.find('+');
+        std::string_view part = Trim(chord.substr(0, plus));
+        morePartsExpected = (plus != std::string_view::npos);
+        chord = morePartsExpected ? chord.substr(plus + 1) : std::string_view{};
+
+        if (part.empty())
+            return std::nullopt;
+
+        if (auto button = ParseMouseButton(part))
+        {
+            binding.mouseButtons = SetButton(binding.mouseButtons, *button);
+            continue;
+        }
+
+        KeyCode key = KeyCodeFromString(part);
+        if (key == KeyCode::Unknown || !KeyMapping::HasScancodeMapping(key))
+            return std::nullopt;
+
+        if (binding.keyCount >= InputBinding::MAX_CHORD_KEYS)
+            return std::nullopt;
+
+        binding.scancodes[binding.keyCount++] = KeyMapping::KeyCodeToScancode(key);
+    }
+
+    if (binding.IsEmpty())
+        return std::nullopt;
+
+    return binding;
+}
+
+std::optional<InputAxisSource> InputActionMap::ParseAxisSource(std::string_view name)
+{
+    if (EqualsIgnoreCase(name, "MouseX")) return InputAxisSource::MouseX;
+    if (EqualsIgnoreCase(name, "MouseY")) return InputAxisSource::MouseY;
+    if (EqualsIgnoreCase(name, "Wheel"))  return InputAxisSource::Wheel;
+    if (EqualsIgnoreCase(name, "WheelH")) return InputAxisSource::WheelH;
+    return std::nullopt;
+}
+
+// ============================================================================
+// Lookup
+// ============================================================================
+
+InputActionId InputActionMap::FindAction(std::string_view name) const
+{
+    for (size_t i = 0; i < m_Actions.size(); ++i)
+    {
+        if (m_Actions[i].name == name)
+            return static_cast<InputActionId>(i);
+    }
+    return INVALID_INPUT_ACTION;
+}
+
+InputAxisId InputActionMap::FindAxis(std::string_view name) const
+{
+    for (size_t i = 0; i < m_Axes.size(); ++i)
+    {
+        if (m_Axes[i].name == name)
+            return static_cast<InputAxisId>(i);
+    }
+    return INVALID_INPUT_AXIS;
+}
+
+const std::string& InputActionMap::GetActionName(InputActionId id) const
+{
+    return id < m_Actions.size() ? m_Actions[id].name : g_EmptyName;
+}
+
+const std::string& InputActionMap::GetAxisName(InputAxisId id) const
+{
+    return id < m_Axes.size() ? m_Axes[id].name : g_EmptyName;
+}
+
+// ============================================================================
+// Evaluation
+// ============================================================================
+
+void InputActionMap::Evaluate(const InputState& current,
+                              const KeyBitset& previousKeys,
+                              uint8_t previousButtons,
+                              ActionState& state) const
+{
+    // Single pass over this frame's transitions to collect affected actions
+    uint64_t dirty = 0;
+
+    KeyBitset::ChangedMask(current.keys, previousKeys).ForEachSetBit(
+        [&](uint16_t scancode) { dirty |= m_KeyActionMask[scancode]; });
+
+    ForEachBit(static_cast<uint8_t>(current.mouseButtons ^ previousButtons),
+        [&](uint32_t button)
+        {
+            if (button < m_ButtonActionMask.size())
+                dirty |= m_ButtonActionMask[button];
+        });
+
+    Evaluate(current, dirty, state);
+}
+
+void InputActionMap::EvaluateAll(const InputState& current, ActionState& state) const
+{
+    uint64_t all = m_Actions.size() >= 64 ? ~0ull : ((1ull << m_Actions.size()) - 1);
+    Evaluate(current, all, state);
+}
+
+void InputActionMap::Evaluate(const InputState& current, uint64_t dirty, ActionState& state) const
+{
+    const uint64_t previousDown = state.down;
+    uint64_t down = previousDown & ~dirty;
+
+    ForEachBit(dirty, [&](uint32_t action)
+    {
+        if (action < m_Actions.size() && IsActionActive(m_Actions[action], current))
+            down |= (1ull << action);
+    });
+
+    state.down = down;
+    state.pressed = down & ~previousDown;
+    state.released = ~down & previousDown;
+
+    for (size_t i = 0; i < m_Axes.size(); ++i)
+    {
+        const Axis& axis = m_Axes[i];
+        float value = 0.0f;
+
+        switch (axis.source)
+        {
+        case InputAxisSource::Actions:
+            if (state.IsDown(axis.positive)) value += 1.0f;
+            if (state.IsDown(axis.negative)) value -= 1.0f;
+            break;
+        case InputAxisSource::MouseX: value = static_cast<float>(current.mouseDeltaX); break;
+        case InputAxisSource::MouseY: value = static_cast<float>(current.mouseDeltaY); break;
+        case InputAxisSource::Wheel:  value = current.mouseWheelDelta; break;
+        case InputAxisSource::WheelH: value = current.mouseWheelHDelta; break;
+        }
+
+        state.axes[i] = value * axis.scale;
+    }
+}
+
+bool InputActionMap::IsActionActive(const Action& action, const InputState& current) const
+{
+    for (const InputBinding& binding : action.bindings)
+    {
+        if ((current.mouseButtons & binding.mouseButtons) != binding.mouseButtons)
+            continue;
+
+        bool allKeysDown = true;
+        for (uint8_t i = 0; i < binding.keyCount && allKeysDown; ++i)
+            allKeysDown = current.keys.Test(binding.scancodes[i]);
+
+        if (allKeysDown)
+            return true;
+    }
+    return false;
+}
@@ -0,0 +1,486 @@
+#include "Input/InputRecording.h"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+#include <iterator>
+
+namespace
+{
+    // ========================================================================
+    // Encoding helpers
+    // ========================================================================
+
+    void WriteVarint(std::vector<uint8_t>& out, uint64_t value)
+    {
+        while (value >= 0x80)
+        {
+            out.push_back(static_cast<uint8_t>(value | 0x80));
+            value >>= 7;
+        }
+        out.push_back(static_cast<uint8_t>(value));
+    }
+
+    uint64_t ZigZag(int64_t value)
+    {
+        return (static_cast<uint64_t>(value) << 1) ^ static_cast<uint64_t>(value >> 63);
+    }
+
+    int64_t UnZigZag(uint64_t value)
+    {
+        return static_cast<int64_t>(value >> 1) ^ -static_cast<int64_t>(value & 1);
+    }
+
+    void WriteSigned(std::vector<uint8_t>& out, int64_t value)
+    {
+        WriteVarint(out, ZigZag(value));
+    }
+
+    void WriteFixed(std::vector<uint8_t>& out, uint64_t value, size_t bytes)
+    {
+        for (size_t i = 0; i < bytes; ++i)
+            out.push_back(static_cast<uint8_t>(value >> (8 * i)));
+    }
+
+    void WriteFloat(std::vector<uint8_t>& out, float value)
+    {
+        WriteFixed(out, std::bit_cast<uint32_t>(value), 4);
+    }
+
+    void WriteTimestamp(std::vector<uint8_t>& out, InputTimestamp ts, InputTimestamp& last)
+    {
+        if (ts == 0)
+        {
+            WriteVarint(out, 0);
+            return;
+        }
+
+        WriteVarint(out, ZigZag(static_cast<int64_t>(ts - last)) + 1);
+        last = ts;
+    }
+
+    // ========================================================================
+    // Decoding helpers
+    // ========================================================================
+
+    class Reader
+    {
+    public:
+        Reader(const uint8_t* data, size_t size) : m_Data(data), m_Size(size) {}
+
+        bool Ok() const { return m_Ok; }
+        bool AtEnd() const { return m_Pos >= m_Size; }
+
+        uint8_t Byte()
+        {
+            if (m_Pos >= m_Size) { m_Ok = false; return 0; }
+            return m_Data[m_Pos++];
+        }
+
+        uint64_t Varint()
+        {
+            uint64_t value = 0;
+            for (uint32_t shift = 0; shift < 64; shift += 7)
+            {
+                uint8_t b = Byte();
+                value |= static_cast<uint64_t>(b & 0x7F) << shift;
+                if ((b & 0x80) == 0 || !m_Ok)
+                    return value;
+            }
+            m_Ok = false;
+            return 0;
+        }
+
+        int64_t Signed() { return UnZigZag(Varint()); }
+
+        uint64_t Fixed(size_t bytes)
+        {
+            uint64_t value = 0;
+            for (size_t i = 0; i < bytes; ++i)
+                value |= static_cast<uint64_t>(Byte()) << (8 * i);
+            return value;
+        }
+
+        float Float() { return std::bit_cast<float>(static_cast<uint32_t>(Fixed(4))); }
+
+        InputTimestamp Timestamp(InputTimestamp& last)
+        {
+            uint64_t encoded = Varint();
+            if (encoded == 0)
+                return 0;
+
+            last = static_cast<InputTimestamp>(static_cast<int64_t>(last) + UnZigZag(encoded - 1));
+            return last;
+        }
+
+        /**
+         * Bound a count read from the file by the bytes left, so corrupt
+         * data cannot trigger huge allocations.
+         */
+        uint64_t Count()
+        {
+            uint64_t count = Varint();
+            if (count > m_Size - std::min(m_Pos, m_Size))
+                m_Ok = false;
+            return m_Ok ? count : 0;
+        }
+
+    private:
+        const uint8_t* m_Data;
+        size_t m_Size;
+        size_t m_Pos = 0;
+        bool m_Ok = true;
+    };
+
+    const std::vector<RecordedInputFrame> g_EmptyStream;
+}
+
+// ============================================================================
+// InputRecorder
+// ============================================================================
+
+InputRecorder::~InputRecorder()
+{
+    Close();
+}
+
+bool InputRecorder::Open(const std::string& path)
+{
+    Close();
+
+    m_File.open(path, std::ios::binary | std::ios::trunc);
+    if (!m_File.is_open())
+        return false;
+
+    m_FrameCount = 0;
+    m_BytesWritten = 0;
+    m_LastTimestamp = InputClock::Now();
+
+    std::vector<uint8_t> header(std::begin(InputRecordingFormat::MAGIC), std::end(InputRecordingFormat::MAGIC));
+    WriteFixed(header, InputRecordingFormat::VERSION, 4);
+    WriteFixed(header, m_LastTimestamp, 8);
+
+    m_File.write(reinterpret_cast<const char*>(header.data()), static_cast<std::streamsize>(header.size()));
+    m_BytesWritten += header.size();
+    return m_File.good();
+}
+
+void InputRecorder::Close()
+{
+    if (m_File.is_open())
+    {
+        m_File.flush();
+        m_File.close();
+    }
+}
+
+void InputRecorder::BeginFrame()
+{
+    m_FrameBuffer.clear();
+    m_FrameRecordCount = 0;
+}
+
+void InputRecorder::Record(uint32_t stream, const InputFrame& input, bool hasFocus)
+{
+    if (!IsOpen()) return;
+
+    auto& out = m_FrameBuffer;
+    const bool hasWheel = input.wheelDelta != 0.0f || input.hWheelDelta != 0.0f;
+
+    uint8_t flags = 0;
+    if (hasFocus) flags |= InputRecordingFormat::FLAG_FOCUS;
+    if (hasWheel) flags |= InputRecordingFormat::FLAG_WHEEL;
+    if (!input.textInput.empty()) flags |= InputRecordingFormat::FLAG_TEXT;
+    if (input.hasModifiers) flags |= InputRecordingFormat::FLAG_MODIFIERS;
+
+    WriteVarint(out, stream);
+    out.push_back(flags);
+    WriteSigned(out, input.mouseX);
+    WriteSigned(out, input.mouseY);
+    WriteSigned(out, input.mouseDeltaX);
+    WriteSigned(out, input.mouseDeltaY);
+
+    if (hasWheel)
+    {
+        WriteFloat(out, input.wheelDelta);
+        WriteFloat(out, input.hWheelDelta);
+    }
+
+    WriteVarint(out, input.keyTransitions.size());
+    for (const auto& kt : input.keyTransitions)
+    {
+        uint8_t keyFlags = 0;
+        if (kt.pressed) keyFlags |= InputRecordingFormat::KEY_PRESSED;
+        if (kt.isRepeat) keyFlags |= InputRecordingFormat::KEY_REPEAT;
+
+        WriteVarint(out, kt.scancode);
+        out.push_back(keyFlags);
+        WriteTimestamp(out, kt.timestamp, m_LastTimestamp);
+    }
+
+    WriteVarint(out, input.mouseButtonTransitions.size());
+    for (const auto& bt : input.mouseButtonTransitions)
+    {
+        out.push_back(static_cast<uint8_t>(bt.button));
+        out.push_back(bt.pressed ? 1 : 0);
+        WriteTimestamp(out, bt.timestamp, m_LastTimestamp);
+    }
+
+    WriteVarint(out, input.mouseSamples.Size());
+    for (size_t i = 0; i < input.mouseSamples.Size(); ++i)
+    {
+        const auto& sample = input.mouseSamples[i];
+        WriteTimestamp(out, sample.timestamp, m_LastTimestamp);
+        WriteSigned(out, sample.x);
+        WriteSigned(out, sample.y);
+        WriteSigned(out, sample.deltaX);
+        WriteSigned(out, sample.deltaY);
+    }
+
+    if (!input.textInput.empty())
+    {
+        WriteVarint(out, input.textInput.size());
+        for (uint32_t codepoint : input.textInput)
+            WriteVarint(out, codepoint);
+    }
+
+    if (input.hasModifiers)
+        out.push_back(input.modifiers);
+
+    ++m_FrameRecordCount;
+}
+
+void InputRecorder::EndFrame()
+{
+    if (!IsOpen()) return;
+
+    std::vector<uint8_t> count;
+    WriteVarint(count, m_FrameRecordCount);
+
+    m_File.write(reinterpret_cast<const char*>(count.data()), static_cast<std::streamsize>(count.size()));
+    m_File.write(reinterpret_cast<const char*>(m_FrameBuffer.data()), static_cast<std::streamsize>(m_FrameBuffer.size()));
+
+    m_BytesWritten += count.size() + m_FrameBuffer.size();
+    ++m_FrameCount;
+
+    m_FrameBuffer.clear();
+    m_FrameRecordCount = 0;
+}
+
+// ============================================================================
+// InputRecording
+// ============================================================================
+
+bool InputRecording::Load(const std::string& path)
+{
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open())
+        return false;
+
+    std::vector<uint8_t> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    return Parse(data.data(), data.size());
+}
+
+bool InputRecording::Parse(const uint8_t* data, size_t size)
+{
+    m_Streams.clear();
+    m_FrameCount = 0;
+    m_Epoch = 0;
+
+    constexpr size_t MAGIC_SIZE = sizeof(InputRecordingFormat::MAGIC);
+    if (!data || size < MAGIC_SIZE || std::memcmp(data, InputRecordingFormat::MAGIC, MAGIC_SIZE) != 0)
+        return false;
+
+    Reader reader(data + MAGIC_SIZE, size - MAGIC_SIZE);
+    uint64_t version = reader.Fixed(4);
+    if (version < InputRecordingFormat::MIN_VERSION || version > InputRecordingFormat::VERSION)
+        return false;
+
+    m_Epoch = reader.Fixed(8);
+    InputTimestamp last = m_Epoch;
+
+    while (reader.Ok() && !reader.AtEnd())
+    {
+        uint64_t recordCount = reader.Count();
+        for (uint64_t r = 0; r < recordCount && reader.Ok(); ++r)
+        {
+            RecordedInputFrame record;
+            record.frameIndex = m_FrameCount;
+            record.stream = static_cast<uint32_t>(reader.Varint());
+
+            uint8_t flags = reader.Byte();
+            record.hasFocus = (flags & InputRecordingFormat::FLAG_FOCUS) != 0;
+
+            InputFrame& input = record.input;
+            input.mouseX = static_cast<int32_t>(reader.Signed());
+            input.mouseY = static_cast<int32_t>(reader.Signed());
+            input.mouseDeltaX = static_cast<int32_t>(reader.Signed());
+            input.mouseDeltaY = static_cast<int32_t>(reader.Signed());
+
+            if (flags & InputRecordingFormat::FLAG_WHEEL)
+            {
+                input.wheelDelta = reader.Float();
+                input.hWheelDelta = reader.Float();
+            }
+
+            uint64_t keyCount = reader.Count();
+            input.keyTransitions.reserve(keyCount);
+            for (uint64_t i = 0; i < keyCount && reader.Ok(); ++i)
+            {
+                uint16_t scancode = static_cast<uint16_t>(reader.Varint());
+                uint8_t keyFlags = reader.Byte();
+                InputTimestamp ts = reader.Timestamp(last);
+                input.keyTransitions.emplace_back(scancode,
+                    (keyFlags & InputRecordingFormat::KEY_PRESSED) != 0,
+                    (keyFlags & InputRecordingFormat::KEY_REPEAT) != 0,
+                    ts);
+            }
+
+            uint64_t buttonCount = reader.Count();
+            input.mouseButtonTransitions.reserve(buttonCount);
+            for (uint64_t i = 0; i < buttonCount && reader.Ok(); ++i)
+            {
+                uint8_t button = reader.Byte();
+                bool pressed = reader.Byte() != 0;
+                InputTimestamp ts = reader.Timestamp(last);
+                if (button >= static_cast<uint8_t>(MouseButton::Count))
+                    return false;
+
+                input.mouseButtonTransitions.emplace_back(static_cast<MouseButton>(button), pressed, ts);
+            }
+
+            uint64_t sampleCount = reader.Count();
+            for (uint64_t i = 0; i < sampleCount && reader.Ok(); ++i)
+            {
+                InputFrame::MouseSample sample;
+                sample.timestamp = reader.Timestamp(last);
+                sample.x = static_cast<int32_t>(reader.Signed());
+                sample.y = static_cast<int32_t>(reader.Signed());
+                sample.deltaX = static_cast<int32_t>(reader.Signed());
+                sample.deltaY = static_cast<int32_t>(reader.Signed());
+                input.mouseSamples.Push(sample);
+            }
+
+            if (flags & InputRecordingFormat::FLAG_TEXT)
+            {
+                uint64_t textCount = reader.Count();
+                input.textInput.reserve(textCount);
+                for (uint64_t i = 0; i < textCount && reader.Ok(); ++i)
+                    input.textInput.push_back(static_cast<uint32_t>(reader.Varint()));
+            }
+
+            if (flags & InputRecordingFormat::FLAG_MODIFIERS)
+            {
+                input.modifiers = reader.Byte();
+                input.hasModifiers = true;
+            }
+
+            if (reader.Ok())
+                m_Streams[record.stream].push_back(std::move(record));
+        }
+
+        if (reader.Ok())
+            ++m_FrameCount;
+    }
+
+    if (!reader.Ok())
+    {
+        m_Streams.clear();
+        m_FrameCount = 0;
+        return false;
+    }
+
+    return true;
+}
+
+const std::vector<RecordedInputFrame>& InputRecording::GetStream(uint32_t stream) const
+{
+    auto it = m_Streams.find(stream);
+    return it != m_Streams.end() ? it->second : g_EmptyStream;
+}
+
+std::vector<uint32_t> InputRecording::GetStreamIds() const
+{
+    std::vector<uint32_t> ids;
+    ids.reserve(m_Streams.size());
+    for (const auto& [id, records] : m_Streams)
+        ids.push_back(id);
+    return ids;
+}
+
+// ============================================================================
+// InputReplayStream
+// ============================================================================
+
+InputReplayStream::InputReplayStream(std::shared_ptr<const InputRecording> recording, uint32_t stream,
+                                     InputTimestamp playbackEpoch)
+    : m_Recording(std::move(recording))
+    , m_Stream(stream)
+    , m_PlaybackEpoch(playbackEpoch)
+{
+}
+
+bool InputReplayStream::Play(uint64_t frame, InputFrame& out, bool& hasFocus)
+{
+    out.Reset();
+    if (!m_Recording) return false;
+
+    const std::vector<RecordedInputFrame>& records = m_Recording->GetStream(m_Stream);
+
+    // Records of frames already passed are never played late
+    while (m_NextRecord < records.size() && records[m_NextRecord].frameIndex < frame)
+        ++m_NextRecord;
+
+    if (m_NextRecord >= records.size() || records[m_NextRecord].frameIndex != frame)
+        return false;
+
+    const RecordedInputFrame& record = records[m_NextRecord++];
+    const InputFrame& recorded = record.input;
+
+    hasFocus = record.hasFocus;
+
+    out.mouseX = recorded.mouseX;
+    out.mouseY = recorded.mouseY;
+    out.mouseDeltaX = recorded.mouseDeltaX;
+    out.mouseDeltaY = recorded.mouseDeltaY;
+    out.wheelDelta = recorded.wheelDelta;
+    out.hWheelDelta = recorded.hWheelDelta;
+    out.textInput = recorded.textInput;
+    out.modifiers = recorded.modifiers;
+    out.hasModifiers = recorded.hasModifiers;
+
+    for (const auto& kt : recorded.keyTransitions)
+        out.keyTransitions.emplace_back(kt.scancode, kt.pressed, kt.isRepeat, Rebase(kt.timestamp));
+
+    for (const auto& bt : recorded.mouseButtonTransitions)
+        out.mouseButtonTransitions.emplace_back(bt.button, bt.pressed, Rebase(bt.timestamp));
+
+    for (size_t i = 0; i < recorded.mouseSamples.Size(); ++i)
+    {
+        InputFrame::MouseSample sample = recorded.mouseSamples[i];
+        sample.timestamp = Rebase(sample.timestamp);
+        out.mouseSamples.Push(sample);
+    }
+
+    return true;
+}
+
+uint64_t InputReplayStream::GetFirstFrame() const
+{
+    if (!m_Recording) return 0;
+
+    const std::vector<RecordedInputFrame>& records = m_Recording->GetStream(m_Stream);
+    return records.empty() ? 0 : records.front().frameIndex;
+}
+
+bool InputReplayStream::IsFinished() const
+{
+    return !m_Recording || m_NextRecord >= m_Recording->GetStream(m_Stream).size();
+}
+
+InputTimestamp InputReplayStream::Rebase(InputTimestamp recorded) const
+{
+    if (recorded == 0 || recorded < m_Recording->GetEpoch())
+        return recorded;
+
+    return m_PlaybackEpoch + (recorded - m_Recording->GetEpoch());
+}
@@ -1,4 +1,5 @@
 #include "Input/KeyCode.h"
+#include <cctype>
 
 const char* KeyCodeToString(KeyCode key)
 {
@@ -85,4 +86,31 @@ const char* KeyCodeToString(KeyCode key)
         
         default: return "Unknown";
     }
-}
\ No newline at end of file
+}
+
+KeyCode KeyCodeFromString(std::string_view name)
+{
+    if (name.empty())
+        return KeyCode::Unknown;
+
+    // Reverse lookup over the same table as KeyCodeToString; only used when
+    // loading bindings, so a linear scan is fine.
+    for (uint16_t code = 1; code <= static_cast<uint16_t>(KeyCode::MaxValue); ++code)
+    {
+        std::string_view candidate = KeyCodeToString(static_cast<KeyCode>(code));
+        if (candidate.size() != name.size() || candidate == "Unknown")
+            continue;
+
+        bool match = true;
+        for (size_t i = 0; i < name.size() && match; ++i)
+        {
+            match = std::tolower(static_cast<unsigned char>(name[i])) ==
+                    std::tolower(static_cast<unsigned char>(candidate[i]));
+        }
+
+        if (match)
+            return static_cast<KeyCode>(code);
+    }
+
+    return KeyCode::Unknown;
+}
@@ -0,0 +1,175 @@
+#ifdef __linux__
+#include "Input/Platform/Linux/XkbKeymap.h"
+#include "Input/KeyModifiers.h"
+#include "Logging/LogMacros.h"
+#include <xkbcommon/xkbcommon.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#include <cerrno>
+#include <cstring>
+
+namespace
+{
+    // Real modifier carrying AltGr (ISO_Level3_Shift) in the standard keymaps
+    constexpr const char* MOD_NAME_LEVEL_THREE = "Mod5";
+
+    uint32_t ModMask(xkb_keymap* keymap, const char* name)
+    {
+        xkb_mod_index_t index = xkb_keymap_mod_get_index(keymap, name);
+        return index == XKB_MOD_INVALID ? 0u : (1u << index);
+    }
+
+    /**
+     * Releases a mapped keymap and its descriptor on every exit path of Load().
+     */
+    struct KeymapMapping
+    {
+        int32_t fd = -1;
+        void* data = MAP_FAILED;
+        size_t size = 0;
+
+        ~KeymapMapping()
+        {
+            if (data != MAP_FAILED) munmap(data, size);
+            if (fd >= 0) close(fd);
+        }
+    };
+}
+
+XkbKeymap::~XkbKeymap()
+{
+    if (m_Context)
+        xkb_context_unref(m_Context);
+}
+
+bool XkbKeymap::Load(int32_t fd, uint32_t size)
+{
+    KeymapMapping mapping{ .fd = fd, .size = size };
+    if (fd < 0 || size == 0)
+        return false;
+
+    // MAP_PRIVATE: since wl_seat v7 the compositor may share one read-only
+    // mapping with every client
+    mapping.data = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (mapping.data == MAP_FAILED)
+    {
+        SOLARC_WINDOW_ERROR("Failed to map keymap ({} bytes): {}", size, strerror(errno));
+        return false;
+    }
+
+    if (!m_Context)
+    {
+        m_Context = xkb_context_new(XKB_CONTEXT_NO_FLAGS);
+        if (!m_Context)
+        {
+            SOLARC_WINDOW_ERROR("Failed to create xkb context");
+            return false;
+        }
+    }
+
+    // The keymap string is null-terminated within 'size', but do not rely on it
+    const char* text = static_cast<const char*>(mapping.data);
+    xkb_keymap* keymap = xkb_keymap_new_from_buffer(m_Context, text, strnlen(text, size),
+        XKB_KEYMAP_FORMAT_TEXT_V1, XKB_KEYMAP_COMPILE_NO_FLAGS);
+    if (!keymap)
+    {
+        SOLARC_WINDOW_ERROR("Failed to compile keymap");
+        return false;
+    }
+
+    BuildTables(keymap);
+    xkb_keymap_unref(keymap);
+
+    SOLARC_WINDOW_INFO("Keymap loaded: {} layout(s), {} KB lookup table",
+        m_LayoutCount, (m_Symbols.size() * sizeof(KeySymbol)) / 1024);
+    return true;
+}
+
+void XkbKeymap::BuildTables(xkb_keymap* keymap)
+{
+    m_ShiftMask = ModMask(keymap, XKB_MOD_NAME_SHIFT);
+    m_CtrlMask = ModMask(keymap, XKB_MOD_NAME_CTRL);
+    m_AltMask = ModMask(keymap, XKB_MOD_NAME_ALT);
+    m_SuperMask = ModMask(keymap, XKB_MOD_NAME_LOGO);
+    m_CapsMask = ModMask(keymap, XKB_MOD_NAME_CAPS);
+    m_NumMask = ModMask(keymap, XKB_MOD_NAME_NUM);
+
+    m_LevelMasks[LEVEL_SHIFT] = m_ShiftMask;
+    m_LevelMasks[LEVEL_CAPS] = m_CapsMask;
+    m_LevelMasks[LEVEL_NUM] = m_NumMask;
+    m_LevelMasks[LEVEL_THREE] = ModMask(keymap, MOD_NAME_LEVEL_THREE);
+
+    m_LayoutCount = xkb_keymap_num_layouts(keymap);
+    if (m_LayoutCount == 0) m_LayoutCount = 1;
+    if (m_LayoutCount > MAX_LAYOUTS) m_LayoutCount = MAX_LAYOUTS;
+
+    m_RepeatingKeys.Reset();
+    // Indexed by evdev key (wl_keyboard::key), like the symbol rows
+    for (uint32_t key = 0; key < KEY_COUNT; ++key)
+    {
+        if (xkb_keymap_key_repeats(keymap, key + 8))
+            m_RepeatingKeys.Set(static_cast<uint16_t>(key));
+    }
+
+    m_Symbols.assign(static_cast<size_t>(m_LayoutCount) * LEVEL_COMBINATIONS * KEY_COUNT, KeySymbol{});
+
+    // One scratch state resolves every (layout, modifier combination) row;
+    // this is the only place xkb state is queried
+    xkb_state* state = xkb_state_new(keymap);
+    if (!state) return;
+
+    for (uint32_t layout = 0; layout < m_LayoutCount; ++layout)
+    {
+        for (uint32_t combination = 0; combination < LEVEL_COMBINATIONS; ++combination)
+        {
+            uint32_t depressed = 0;
+            uint32_t locked = 0;
+            if (combination & (1u << LEVEL_SHIFT)) depressed |= m_LevelMasks[LEVEL_SHIFT];
+            if (combination & (1u << LEVEL_THREE)) depressed |= m_LevelMasks[LEVEL_THREE];
+            if (combination & (1u << LEVEL_CAPS)) locked |= m_LevelMasks[LEVEL_CAPS];
+            if (combination & (1u << LEVEL_NUM)) locked |= m_LevelMasks[LEVEL_NUM];
+
+            xkb_state_update_mask(state, depressed, 0, locked, 0, 0, layout);
+
+            KeySymbol* row = &m_Symbols[((layout * LEVEL_COMBINATIONS) + combination) * KEY_COUNT];
+            // Rows are indexed by evdev key (wl_keyboard::key); xkb keycodes are 8 higher
+            for (uint32_t key = 0; key < KEY_COUNT; ++key)
+            {
+                xkb_keycode_t keycode = key + 8;
+                row[key].keysym = xkb_state_key_get_one_sym(state, keycode);
+                row[key].codepoint = xkb_state_key_get_utf32(state, keycode);
+            }
+        }
+    }
+
+    xkb_state_unref(state);
+
+    m_ActiveRow = 0;
+    m_Modifiers = 0;
+}
+
+void XkbKeymap::UpdateModifiers(uint32_t depressed, uint32_t latched, uint32_t locked, uint32_t group)
+{
+    const uint32_t effective = depressed | latched | locked;
+
+    uint32_t combination = 0;
+    for (uint32_t i = 0; i < LEVEL_MODIFIER_COUNT; ++i)
+    {
+        if (effective & m_LevelMasks[i])
+            combination |= (1u << i);
+    }
+
+    const uint32_t layout = group < m_LayoutCount ? group : 0;
+    m_ActiveRow = (layout * LEVEL_COMBINATIONS) + combination;
+
+    uint8_t modifiers = 0;
+    if (effective & m_ShiftMask) modifiers |= KeyModifierToBit(KeyModifier::Shift);
+    if (effective & m_CtrlMask) modifiers |= KeyModifierToBit(KeyModifier::Ctrl);
+    if (effective & m_AltMask) modifiers |= KeyModifierToBit(KeyModifier::Alt);
+    if (effective & m_SuperMask) modifiers |= KeyModifierToBit(KeyModifier::Super);
+    if (locked & m_CapsMask) modifiers |= KeyModifierToBit(KeyModifier::CapsLock);
+    if (locked & m_NumMask) modifiers |= KeyModifierToBit(KeyModifier::NumLock);
+    m_Modifiers = modifiers;
+}
+
+#endif // __linux__
@@ -1,5 +1,6 @@
 #include "Logging/Log.h"
 #include "spdlog/async.h"
+#include <filesystem>
 #include <iostream>
 
 void Log::Initialize(
@@ -28,6 +29,7 @@ void Log::Initialize(
         );
         
         s_FileSink->set_level(ToSpdlogLevel(fileLevel));
+        s_LogDirectory = std::filesystem::path(logFilePath).parent_path().string();
         s_FileSink->set_pattern(s_LogPattern);
 
         // Create category loggers
@@ -2,6 +2,11 @@
 #include <algorithm>
 #include <cassert>
 
+namespace
+{
+    thread_local size_t t_WorkerIndex = JobSystem::INVALID_WORKER_INDEX;
+}
+
 JobSystem::JobSystem(size_t numThreads) 
 {
     if (numThreads == 0) {
@@ -196,8 +201,15 @@ void JobSystem::Shutdown()
     m_Workers.clear();
 }
 
+size_t JobSystem::GetCurrentWorkerIndex()
+{
+    return t_WorkerIndex;
+}
+
 void JobSystem::WorkerThread(size_t threadIndex) 
 {
+    t_WorkerIndex = threadIndex;
+
     while (true) {
         bool executedJob = TryExecuteJob();
 
@@ -0,0 +1,81 @@
+#include "Rendering/RHI/DescriptorHeap.h"
+#include "Logging/LogMacros.h"
+#include <algorithm>
+
+DescriptorIndexAllocator::DescriptorIndexAllocator(uint32_t capacity)
+    : m_Capacity(capacity)
+{
+    SOLARC_ASSERT(capacity < RHIDescriptorHandle::INVALID_INDEX, "Descriptor array too large");
+}
+
+uint32_t DescriptorIndexAllocator::Allocate()
+{
+    std::lock_guard lock(m_Mutex);
+
+    uint32_t index = RHIDescriptorHandle::INVALID_INDEX;
+    if (!m_FreeIndices.empty()) {
+        index = m_FreeIndices.back();
+        m_FreeIndices.pop_back();
+    }
+    else if (m_NextUnused < m_Capacity) {
+        index = m_NextUnused++;
+    }
+    else {
+        return RHIDescriptorHandle::INVALID_INDEX;
+    }
+
+    ++m_Allocated;
+    m_PeakAllocated = std::max(m_PeakAllocated, m_Allocated);
+    return index;
+}
+
+void DescriptorIndexAllocator::Free(uint32_t index, uint64_t frame)
+{
+    std::lock_guard lock(m_Mutex);
+    SOLARC_ASSERT(index < m_NextUnused, "Freeing a descriptor index that was never allocated");
+    SOLARC_ASSERT(m_Allocated > 0, "Descriptor index freed twice");
+
+    --m_Allocated;
+    if (frame == 0) {
+        m_FreeIndices.push_back(index);
+        return;
+    }
+
+    // Threads racing to free may arrive out of frame order: waiting for the
+    // later frame keeps the queue sorted and is always safe
+    if (!m_PendingFrees.empty()) {
+        frame = std::max(frame, m_PendingFrees.back().frame);
+    }
+    m_PendingFrees.push_back({ frame, index });
+}
+
+uint32_t DescriptorIndexAllocator::Collect(uint64_t completedFrame)
+{
+    std::lock_guard lock(m_Mutex);
+
+    uint32_t recycled = 0;
+    while (!m_PendingFrees.empty() && m_PendingFrees.front().frame <= completedFrame) {
+        m_FreeIndices.push_back(m_PendingFrees.front().index);
+        m_PendingFrees.pop_front();
+        ++recycled;
+    }
+    return recycled;
+}
+
+uint32_t DescriptorIndexAllocator::GetAllocatedCount() const
+{
+    std::lock_guard lock(m_Mutex);
+    return m_Allocated;
+}
+
+uint32_t DescriptorIndexAllocator::GetPendingFreeCount() const
+{
+    std::lock_guard lock(m_Mutex);
+    return static_cast<uint32_t>(m_PendingFrees.size());
+}
+
+uint32_t DescriptorIndexAllocator::GetPeakAllocatedCount() const
+{
+    std::lock_guard lock(m_Mutex);
+    return m_PeakAllocated;
+}
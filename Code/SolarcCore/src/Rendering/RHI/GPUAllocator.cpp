@@ -0,0 +1,393 @@
+#include "Rendering/RHI/GPUAllocator.h"
+#include "Logging/LogMacros.h"
+#include <algorithm>
+#include <bit>
+
+namespace
+{
+    // Blocks are never smaller than this when retrying after an allocation failure
+    constexpr uint64_t MIN_BLOCK_SIZE = 1024 * 1024;
+
+    size_t PoolIndex(uint32_t memoryType, GPUResourceTiling tiling)
+    {
+        return static_cast<size_t>(memoryType) * 2 + static_cast<size_t>(tiling);
+    }
+}
+
+GPUAllocator::GPUAllocator(GPUMemoryProperties properties, GPUMemoryBackend& backend, uint64_t blockSize)
+    : m_Properties(std::move(properties))
+    , m_Backend(backend)
+    , m_BlockSize(blockSize)
+{
+    SOLARC_ASSERT(blockSize > 0, "Block size cannot be zero");
+    m_Pools.resize(m_Properties.types.size() * 2);
+    m_HeapUsage.resize(m_Properties.heaps.size(), 0);
+
+    SOLARC_RENDER_DEBUG("GPU allocator: {} memory types, {} heaps, {} MiB blocks",
+        m_Properties.types.size(), m_Properties.heaps.size(), blockSize / (1024 * 1024));
+}
+
+GPUAllocator::~GPUAllocator()
+{
+    size_t leaked = 0;
+    for (const Block& block : m_Blocks) {
+        leaked += block.ranges ? block.ranges->GetAllocationCount() : 1;
+    }
+    if (leaked > 0) {
+        SOLARC_RENDER_WARN("GPU allocator destroyed with {} live allocations", leaked);
+    }
+
+    while (!m_Blocks.Empty()) {
+        DestroyBlock(m_Blocks.HandleAt(0));
+    }
+}
+
+// ============================================================================
+// Allocation
+// ============================================================================
+
+GPUAllocation GPUAllocator::Allocate(const GPUAllocationDesc& desc)
+{
+    SOLARC_ASSERT(desc.size > 0, "Cannot allocate zero bytes");
+    SOLARC_ASSERT(std::has_single_bit(desc.alignment), "Alignment must be a power of two");
+
+    std::lock_guard lock(m_Mutex);
+
+    // Preferred types first, then anything with the required flags
+    uint32_t candidates = desc.memoryTypeBits;
+    while (candidates != 0) {
+        const uint32_t memoryType = FindMemoryType(candidates, desc.requiredFlags, desc.preferredFlags);
+        if (memoryType == UINT32_MAX) {
+            break;
+        }
+
+        GPUAllocation allocation = AllocateFromType(memoryType, desc);
+        if (allocation.IsValid()) {
+            return allocation;
+        }
+
+        SOLARC_RENDER_DEBUG("Memory type {} cannot fit {} bytes, trying the next type", memoryType, desc.size);
+        candidates &= ~(1u << memoryType);
+    }
+
+    SOLARC_RENDER_ERROR("GPU allocation of {} bytes failed (types 0x{:x}, required flags 0x{:x})",
+        desc.size, desc.memoryTypeBits, desc.requiredFlags);
+    return {};
+}
+
+GPUAllocation GPUAllocator::AllocateFromType(uint32_t memoryType, const GPUAllocationDesc& desc)
+{
+    const uint64_t blockSize = GetBlockSize(memoryType);
+    if (desc.dedicated || desc.size > blockSize / 2) {
+        return AllocateDedicated(memoryType, desc);
+    }
+
+    std::vector<SlotHandle>& pool = GetPool(memoryType, desc.tiling);
+    for (SlotHandle handle : pool) {
+        GPUAllocation allocation = SubAllocate(handle, desc);
+        if (allocation.IsValid()) {
+            return allocation;
+        }
+    }
+
+    // New block; halve it while the device refuses, as long as the request fits twice
+    for (uint64_t size = blockSize; size >= desc.size * 2 && size >= std::min(MIN_BLOCK_SIZE, blockSize); size /= 2) {
+        Block block;
+        if (!CreateMemory(memoryType, size, block.memory, block.mapped)) {
+            continue;
+        }
+        block.size = size;
+        block.memoryType = memoryType;
+        block.tiling = desc.tiling;
+        block.ranges = std::make_unique<TLSFAllocator>(size);
+
+        const SlotHandle handle = m_Blocks.Insert(std::move(block));
+        pool.push_back(handle);
+
+        SOLARC_RENDER_DEBUG("GPU memory block created: type {}, {} KiB ({} blocks in pool)",
+            memoryType, size / 1024, pool.size());
+        return SubAllocate(handle, desc);
+    }
+
+    return {};
+}
+
+GPUAllocation GPUAllocator::AllocateDedicated(uint32_t memoryType, const GPUAllocationDesc& desc)
+{
+    Block block;
+    if (!CreateMemory(memoryType, desc.size, block.memory, block.mapped)) {
+        return {};
+    }
+    block.size = desc.size;
+    block.memoryType = memoryType;
+    block.tiling = desc.tiling;
+
+    GPUAllocation allocation;
+    allocation.memory = block.memory;
+    allocation.offset = 0;
+    allocation.size = desc.size;
+    allocation.mapped = block.mapped;
+    allocation.memoryType = memoryType;
+    allocation.dedicated = true;
+    allocation.block = m_Blocks.Insert(std::move(block));
+    return allocation;
+}
+
+GPUAllocation GPUAllocator::SubAllocate(SlotHandle blockHandle, const GPUAllocationDesc& desc)
+{
+    Block* block = m_Blocks.Get(blockHandle);
+
+    uint64_t offset = 0;
+    if (!block->ranges->Allocate(desc.size, desc.alignment, offset)) {
+        return {};
+    }
+    block->allocations.emplace(offset, desc);
+
+    GPUAllocation allocation;
+    allocation.memory = block->memory;
+    allocation.offset = offset;
+    allocation.size = desc.size;
+    allocation.mapped = block->mapped ? static_cast<uint8_t*>(block->mapped) + offset : nullptr;
+    allocation.memoryType = block->memoryType;
+    allocation.block = blockHandle;
+    return allocation;
+}
+
+void GPUAllocator::Free(const GPUAllocation& allocation)
+{
+    if (!allocation.IsValid()) {
+        return;
+    }
+
+    std::lock_guard lock(m_Mutex);
+
+    Block* block = m_Blocks.Get(allocation.block);
+    SOLARC_ASSERT(block != nullptr, "Freeing an allocation whose block no longer exists");
+    if (!block) {
+        return;
+    }
+
+    if (!block->ranges) {
+        DestroyBlock(allocation.block);
+        return;
+    }
+
+    block->ranges->Free(allocation.offset);
+    block->allocations.erase(allocation.offset);
+
+    if (block->ranges->IsEmpty()) {
+        ReleaseEmptyBlocks(1);
+    }
+}
+
+// ============================================================================
+// Memory Objects
+// ============================================================================
+
+bool GPUAllocator::CreateMemory(uint32_t memoryType, uint64_t size, GPUDeviceMemory& memory, void*& mapped)
+{
+    if (m_Blocks.Size() >= m_Properties.maxAllocationCount) {
+        SOLARC_RENDER_WARN("GPU allocation count limit reached ({})", m_Properties.maxAllocationCount);
+        return false;
+    }
+
+    const uint32_t heap = m_Properties.types[memoryType].heapIndex;
+    if (m_HeapUsage[heap] + size > m_Properties.heaps[heap].size) {
+        return false;
+    }
+
+    mapped = nullptr;
+    if (!m_Backend.AllocateMemory(memoryType, size, memory, mapped)) {
+        return false;
+    }
+
+    m_HeapUsage[heap] += size;
+    return true;
+}
+
+void GPUAllocator::DestroyBlock(SlotHandle blockHandle)
+{
+    Block* block = m_Blocks.Get(blockHandle);
+    if (!block) {
+        return;
+    }
+
+    if (block->ranges) {
+        std::vector<SlotHandle>& pool = GetPool(block->memoryType, block->tiling);
+        pool.erase(std::remove(pool.begin(), pool.end(), blockHandle), pool.end());
+    }
+
+    m_Backend.FreeMemory(block->memoryType, block->memory);
+    m_HeapUsage[m_Properties.types[block->memoryType].heapIndex] -= block->size;
+    m_Blocks.Erase(blockHandle);
+}
+
+std::vector<SlotHandle>& GPUAllocator::GetPool(uint32_t memoryType, GPUResourceTiling tiling)
+{
+    return m_Pools[PoolIndex(memoryType, tiling)];
+}
+
+uint32_t GPUAllocator::ReleaseEmptyBlocks(size_t keep)
+{
+    uint32_t released = 0;
+    for (std::vector<SlotHandle>& pool : m_Pools) {
+        size_t empty = 0;
+        for (size_t i = 0; i < pool.size();) {
+            const Block* block = m_Blocks.Get(pool[i]);
+            if (block->ranges->IsEmpty() && ++empty > keep) {
+                DestroyBlock(pool[i]); // Erases pool[i]
+                ++released;
+                continue;
+            }
+            ++i;
+        }
+    }
+    return released;
+}
+
+// ============================================================================
+// Defragmentation
+// ============================================================================
+
+GPUDefragmentStats GPUAllocator::Defragment(const GPUDefragmentMove& move, uint64_t maxBytesToMove)
+{
+    std::lock_guard lock(m_Mutex);
+
+    GPUDefragmentStats stats;
+    for (const std::vector<SlotHandle>& pool : m_Pools) {
+        if (pool.size() < 2) {
+            continue;
+        }
+
+        // Fullest blocks are destinations, the emptiest are drained first
+        std::vector<SlotHandle> order = pool;
+        std::sort(order.begin(), order.end(), [this](SlotHandle a, SlotHandle b) {
+            return m_Blocks.Get(a)->ranges->GetUsedBytes() > m_Blocks.Get(b)->ranges->GetUsedBytes();
+            });
+
+        // A block that received moves is never drained: its allocations
+        // would be relocated a second time in the same pass
+        std::vector<bool> received(order.size(), false);
+
+        for (size_t source = order.size() - 1; source > 0; --source) {
+            if (received[source]) {
+                continue;
+            }
+            Block* sourceBlock = m_Blocks.Get(order[source]);
+
+            // Copy: the map changes as allocations leave the block
+            std::vector<std::pair<uint64_t, GPUAllocationDesc>> allocations(
+                sourceBlock->allocations.begin(), sourceBlock->allocations.end());
+            std::sort(allocations.begin(), allocations.end(),
+                [](const auto& a, const auto& b) { return a.first < b.first; });
+
+            for (const auto& [offset, desc] : allocations) {
+                if (stats.bytesMoved + desc.size > maxBytesToMove) {
+                    break;
+                }
+
+                GPUAllocation from;
+                from.memory = sourceBlock->memory;
+                from.offset = offset;
+                from.size = desc.size;
+                from.mapped = sourceBlock->mapped ? static_cast<uint8_t*>(sourceBlock->mapped) + offset : nullptr;
+                from.memoryType = sourceBlock->memoryType;
+                from.block = order[source];
+
+                for (size_t destination = 0; destination < source; ++destination) {
+                    GPUAllocation to = SubAllocate(order[destination], desc);
+                    if (!to.IsValid()) {
+                        continue;
+                    }
+
+                    if (move(from, to)) {
+                        sourceBlock->ranges->Free(offset);
+                        sourceBlock->allocations.erase(offset);
+                        received[destination] = true;
+                        ++stats.moves;
+                        stats.bytesMoved += desc.size;
+                    }
+                    else {
+                        Block* destinationBlock = m_Blocks.Get(order[destination]);
+                        destinationBlock->ranges->Free(to.offset);
+                        destinationBlock->allocations.erase(to.offset);
+                    }
+                    break;
+                }
+            }
+        }
+    }
+
+    stats.blocksFreed = ReleaseEmptyBlocks(0);
+
+    if (stats.moves > 0) {
+        SOLARC_RENDER_DEBUG("GPU defragmentation: {} moves, {} KiB, {} blocks freed",
+            stats.moves, stats.bytesMoved / 1024, stats.blocksFreed);
+    }
+    return stats;
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+GPUAllocatorStats GPUAllocator::GetStats() const
+{
+    std::lock_guard lock(m_Mutex);
+
+    GPUAllocatorStats stats;
+    stats.types.resize(m_Properties.types.size());
+
+    for (const Block& block : m_Blocks) {
+        GPUMemoryTypeStats& type = stats.types[block.memoryType];
+        if (block.ranges) {
+            ++type.blockCount;
+            type.blockBytes += block.size;
+            type.allocationCount += static_cast<uint32_t>(block.ranges->GetAllocationCount());
+            type.usedBytes += block.ranges->GetUsedBytes();
+            type.largestFreeRange = std::max(type.largestFreeRange, block.ranges->GetLargestFreeRange());
+        }
+        else {
+            ++type.dedicatedCount;
+            type.dedicatedBytes += block.size;
+        }
+    }
+
+    for (const GPUMemoryTypeStats& type : stats.types) {
+        stats.total.blockCount += type.blockCount;
+        stats.total.blockBytes += type.blockBytes;
+        stats.total.allocationCount += type.allocationCount;
+        stats.total.usedBytes += type.usedBytes;
+        stats.total.largestFreeRange = std::max(stats.total.largestFreeRange, type.largestFreeRange);
+        stats.total.dedicatedCount += type.dedicatedCount;
+        stats.total.dedicatedBytes += type.dedicatedBytes;
+    }
+    stats.deviceAllocationCount = static_cast<uint32_t>(m_Blocks.Size());
+
+    return stats;
+}
+
+uint32_t GPUAllocator::FindMemoryType(uint32_t memoryTypeBits, uint32_t requiredFlags, uint32_t preferredFlags) const
+{
+    uint32_t fallback = UINT32_MAX;
+    for (uint32_t i = 0; i < m_Properties.types.size(); ++i) {
+        const uint32_t flags = m_Properties.types[i].propertyFlags;
+        if (!(memoryTypeBits & (1u << i)) || (flags & requiredFlags) != requiredFlags) {
+            continue;
+        }
+        if ((flags & preferredFlags) == preferredFlags) {
+            return i;
+        }
+        if (fallback == UINT32_MAX) {
+            fallback = i;
+        }
+    }
+    return fallback;
+}
+
+uint64_t GPUAllocator::GetBlockSize(uint32_t memoryType) const
+{
+    SOLARC_ASSERT(memoryType < m_Properties.types.size(), "Invalid memory type");
+    const uint64_t heapSize = m_Properties.heaps[m_Properties.types[memoryType].heapIndex].size;
+    return std::max<uint64_t>(std::min(m_BlockSize, heapSize / 8), 1);
+}
@@ -0,0 +1,137 @@
+#include "Rendering/RHI/PipelineCache.h"
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <system_error>
+
+namespace
+{
+    struct FileHeader
+    {
+        uint32_t magic;
+        uint32_t version;
+        uint32_t vendorID;
+        uint32_t deviceID;
+        uint32_t driverVersion;
+        uint32_t reserved;
+        uint8_t uuid[16];
+        uint64_t dataSize;
+        uint64_t checksum;
+    };
+    static_assert(sizeof(FileHeader) == 56, "Pipeline cache header layout changed");
+
+    // FNV-1a: catches truncation and torn writes, not tampering
+    uint64_t Checksum(const uint8_t* data, size_t size)
+    {
+        uint64_t hash = 0xcbf29ce484222325ull;
+        for (size_t i = 0; i < size; ++i) {
+            hash ^= data[i];
+            hash *= 0x100000001b3ull;
+        }
+        return hash;
+    }
+}
+
+std::vector<uint8_t> PipelineCacheFile::Serialize(const PipelineCacheDeviceInfo& device, const void* data, size_t size)
+{
+    FileHeader header{};
+    header.magic = MAGIC;
+    header.version = VERSION;
+    header.vendorID = device.vendorID;
+    header.deviceID = device.deviceID;
+    header.driverVersion = device.driverVersion;
+    std::memcpy(header.uuid, device.uuid.data(), sizeof(header.uuid));
+    header.dataSize = size;
+    header.checksum = Checksum(static_cast<const uint8_t*>(data), size);
+
+    std::vector<uint8_t> file(sizeof(FileHeader) + size);
+    std::memcpy(file.data(), &header, sizeof(FileHeader));
+    if (size > 0) {
+        std::memcpy(file.data() + sizeof(FileHeader), data, size);
+    }
+    return file;
+}
+
+PipelineCacheLoadResult PipelineCacheFile::Deserialize(const std::vector<uint8_t>& file,
+    const PipelineCacheDeviceInfo& device, std::vector<uint8_t>& data)
+{
+    data.clear();
+
+    if (file.size() < sizeof(FileHeader))
+        return PipelineCacheLoadResult::Corrupt;
+
+    FileHeader header;
+    std::memcpy(&header, file.data(), sizeof(FileHeader));
+
+    if (header.magic != MAGIC || header.version != VERSION)
+        return PipelineCacheLoadResult::Corrupt;
+
+    if (header.vendorID != device.vendorID || header.deviceID != device.deviceID ||
+        std::memcmp(header.uuid, device.uuid.data(), sizeof(header.uuid)) != 0)
+        return PipelineCacheLoadResult::DeviceMismatch;
+
+    if (header.driverVersion != device.driverVersion)
+        return PipelineCacheLoadResult::DriverMismatch;
+
+    const uint8_t* payload = file.data() + sizeof(FileHeader);
+    if (header.dataSize != file.size() - sizeof(FileHeader) ||
+        header.checksum != Checksum(payload, file.size() - sizeof(FileHeader)))
+        return PipelineCacheLoadResult::Corrupt;
+
+    data.assign(payload, file.data() + file.size());
+    return PipelineCacheLoadResult::Loaded;
+}
+
+PipelineCacheLoadResult PipelineCacheFile::Load(const std::string& path,
+    const PipelineCacheDeviceInfo& device, std::vector<uint8_t>& data)
+{
+    data.clear();
+
+    std::ifstream stream(path, std::ios::binary | std::ios::ate);
+    if (!stream)
+        return PipelineCacheLoadResult::Missing;
+
+    const std::streamoff size = stream.tellg();
+    if (size < 0)
+        return PipelineCacheLoadResult::Corrupt;
+
+    std::vector<uint8_t> file(static_cast<size_t>(size));
+    stream.seekg(0);
+    if (!stream.read(reinterpret_cast<char*>(file.data()), size))
+        return PipelineCacheLoadResult::Corrupt;
+
+    return Deserialize(file, device, data);
+}
+
+bool PipelineCacheFile::Save(const std::string& path, const PipelineCacheDeviceInfo& device, const void* data, size_t size)
+{
+    namespace fs = std::filesystem;
+
+    const fs::path target(path);
+    const fs::path temporary = fs::path(path + ".tmp");
+
+    std::error_code error;
+    if (target.has_parent_path()) {
+        fs::create_directories(target.parent_path(), error);
+        if (error)
+            return false;
+    }
+
+    const std::vector<uint8_t> file = Serialize(device, data, size);
+    std::ofstream stream(temporary, std::ios::binary | std::ios::trunc);
+    stream.write(reinterpret_cast<const char*>(file.data()), static_cast<std::streamsize>(file.size()));
+
+    // The data may only reach the disk when the stream is flushed at close
+    stream.close();
+    if (stream.fail()) {
+        fs::remove(temporary, error);
+        return false;
+    }
+
+    fs::rename(temporary, target, error);
+    if (error) {
+        fs::remove(temporary, error);
+        return false;
+    }
+    return true;
+}
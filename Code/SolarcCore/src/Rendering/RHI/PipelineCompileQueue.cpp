@@ -0,0 +1,168 @@
+#include "Rendering/RHI/PipelineCompileQueue.h"
+#include "MT/JobSystem.h"
+#include "Logging/LogMacros.h"
+#include <algorithm>
+#include <chrono>
+#include <exception>
+
+PipelineCompileQueue::PipelineCompileQueue(JobSystem& jobSystem)
+    : m_JobSystem(jobSystem)
+{
+}
+
+PipelineCompileQueue::~PipelineCompileQueue()
+{
+    WaitIdle();
+}
+
+RHIPipelineHandle PipelineCompileQueue::Request(PipelineKey key, const PipelineCompileFunction& compile, RHIPipelineHandle fallback)
+{
+    std::lock_guard lock(m_Mutex);
+    ++m_Stats.requests;
+
+    auto it = m_Entries.find(key);
+    if (it != m_Entries.end()) {
+        if (it->second.state == State::Ready)
+            return it->second.pipeline;
+
+        ++m_Stats.fallbackRequests;
+        return fallback;
+    }
+
+    // Scheduled under the lock: the job cannot publish before the entry exists
+    m_Entries[key];
+    ++m_Stats.pending;
+    const JobHandle job = m_JobSystem.Schedule([this, key, compile]() { RunJob(key, compile); }, {}, "PipelineCompile");
+
+    // A job that ran would still be waiting for the lock, so a completed
+    // handle means the job system is shutting down and dropped it
+    if (job.IsComplete()) {
+        m_Entries.erase(key);
+        --m_Stats.pending;
+    }
+
+    ++m_Stats.fallbackRequests;
+    return fallback;
+}
+
+RHIPipelineHandle PipelineCompileQueue::CompileNow(PipelineKey key, const PipelineCompileFunction& compile)
+{
+    {
+        std::unique_lock lock(m_Mutex);
+        ++m_Stats.requests;
+
+        auto it = m_Entries.find(key);
+        if (it != m_Entries.end() && (it->second.started || it->second.state != State::Compiling)) {
+            // Someone else is compiling it: wait for their result
+            m_Compiled.wait(lock, [&]() {
+                it = m_Entries.find(key);
+                return it == m_Entries.end() || it->second.state != State::Compiling;
+            });
+            return it != m_Entries.end() && it->second.state == State::Ready ? it->second.pipeline : 0;
+        }
+
+        // New key, or a background job no worker has picked up yet: waiting
+        // for it could wait on this very thread (CompileNow from a job)
+        m_Entries[key].started = true;
+        ++m_Stats.pending;
+    }
+
+    Compile(key, compile);
+
+    std::lock_guard lock(m_Mutex);
+    auto it = m_Entries.find(key);
+    return it != m_Entries.end() && it->second.state == State::Ready ? it->second.pipeline : 0;
+}
+
+bool PipelineCompileQueue::IsReady(PipelineKey key) const
+{
+    std::lock_guard lock(m_Mutex);
+    auto it = m_Entries.find(key);
+    return it != m_Entries.end() && it->second.state == State::Ready;
+}
+
+void PipelineCompileQueue::WaitIdle()
+{
+    std::unique_lock lock(m_Mutex);
+    m_Compiled.wait(lock, [this]() { return m_Stats.pending == 0; });
+}
+
+void PipelineCompileQueue::Clear(const std::function<void(RHIPipelineHandle)>& destroy)
+{
+    // One critical section: no compilation can start between the wait and the clear
+    std::unique_lock lock(m_Mutex);
+    m_Compiled.wait(lock, [this]() { return m_Stats.pending == 0; });
+
+    for (const auto& [key, entry] : m_Entries) {
+        if (entry.state == State::Ready)
+            destroy(entry.pipeline);
+    }
+    m_Entries.clear();
+}
+
+PipelineCompileStats PipelineCompileQueue::GetStats() const
+{
+    std::lock_guard lock(m_Mutex);
+    return m_Stats;
+}
+
+void PipelineCompileQueue::RunJob(PipelineKey key, const PipelineCompileFunction& compile)
+{
+    {
+        std::lock_guard lock(m_Mutex);
+        Entry& entry = m_Entries.at(key);
+        if (entry.started) {
+            // CompileNow ran it inline; only this job's pending count is left
+            --m_Stats.pending;
+            m_Compiled.notify_all();
+            return;
+        }
+        entry.started = true;
+    }
+
+    Compile(key, compile);
+}
+
+void PipelineCompileQueue::Compile(PipelineKey key, const PipelineCompileFunction& compile)
+{
+    const auto start = std::chrono::steady_clock::now();
+
+    PipelineCompileResult result;
+    try {
+        result = compile();
+    }
+    catch (const std::exception& e) {
+        SOLARC_RENDER_ERROR("Pipeline {:016x} failed to compile: {}", key, e.what());
+        result = {};
+    }
+    catch (...) {
+        SOLARC_RENDER_ERROR("Pipeline {:016x} failed to compile: unknown exception", key);
+        result = {};
+    }
+
+    const double ms = std::chrono::duration<double, std::milli>(std::chrono::steady_clock::now() - start).count();
+
+    std::lock_guard lock(m_Mutex);
+    --m_Stats.pending;
+    m_Compiled.notify_all();
+
+    // Entries are only removed with no compilation pending, so it still exists
+    Entry& entry = m_Entries.at(key);
+    if (result.pipeline == 0) {
+        entry.state = State::Failed;
+        ++m_Stats.failures;
+        SOLARC_RENDER_WARN("Pipeline {:016x} unavailable, using its fallback", key);
+        return;
+    }
+
+    entry.state = State::Ready;
+    entry.pipeline = result.pipeline;
+
+    ++m_Stats.compiles;
+    if (result.cacheHit)
+        ++m_Stats.cacheHits;
+    m_Stats.totalCompileMs += ms;
+    m_Stats.maxCompileMs = std::max(m_Stats.maxCompileMs, ms);
+
+    SOLARC_RENDER_TRACE("Pipeline {:016x} compiled in {:.2f} ms{}", key, ms, result.cacheHit ? " (cache hit)" : "");
+}
@@ -26,15 +26,11 @@ DX12CommandContext::~DX12CommandContext()
 
     // Clean up frame resources
     for (auto& frame : m_FrameResources) {
-        if (frame.fenceEvent) {
-            CloseHandle(frame.fenceEvent);
-            frame.fenceEvent = nullptr;
-        }
-        frame.fence.Reset();
         frame.commandList.Reset();
         frame.commandAllocator.Reset();
     }
 
+    m_Fence.Reset();
     m_CommandQueue.Reset();
 
     SOLARC_RENDER_TRACE("DX12 command context destroyed");
@@ -63,6 +59,19 @@ void DX12CommandContext::CreateCommandQueue()
 
     m_CommandQueue->SetName(L"Main Graphics Queue");
 
+    // One fence for the queue; value 0 = nothing submitted
+    hr = m_Device->GetDevice()->CreateFence(
+        0, // Initial value
+        D3D12_FENCE_FLAG_NONE,
+        IID_PPV_ARGS(&m_Fence)
+    );
+
+    if (FAILED(hr)) {
+        auto result = ToRHIResult(hr, "CreateFence");
+        SOLARC_RENDER_ERROR("Failed to create queue fence: {}", result.GetResultMessage());
+        throw std::runtime_error("Failed to create fence");
+    }
+
     SOLARC_RENDER_DEBUG("Command queue created");
 }
 
@@ -105,29 +114,8 @@ void DX12CommandContext::CreateFrameResources()
         // Command lists are created in recording state, close it immediately
         frame.commandList->Close();
 
-        // Create fence
-        hr = m_Device->GetDevice()->CreateFence(
-            0, // Initial value
-            D3D12_FENCE_FLAG_NONE,
-            IID_PPV_ARGS(&frame.fence)
-        );
-
-        if (FAILED(hr)) {
-            auto result = ToRHIResult(hr, "CreateFence");
-            SOLARC_RENDER_ERROR("Failed to create fence for frame {}: {}", 
-                i, result.GetResultMessage());
-            throw std::runtime_error("Failed to create fence");
-        }
-
         frame.fenceValue = 0;
 
-        // Create fence event (Win32 event for CPU-side waiting)
-        frame.fenceEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
-        if (!frame.fenceEvent) {
-            SOLARC_RENDER_ERROR("Failed to create fence event for frame {}", i);
-            throw std::runtime_error("Failed to create fence event");
-        }
-
         SOLARC_RENDER_TRACE("Created resources for frame {}", i);
     }
 
@@ -165,7 +153,7 @@ void DX12CommandContext::BeginFrame()
     SOLARC_RENDER_TRACE("Frame {} began (fence value: {})", m_CurrentFrameIndex, frame.fenceValue);
 }
 
-void DX12CommandContext::EndFrame()
+UINT64 DX12CommandContext::EndFrame()
 {
     auto& frame = m_FrameResources[m_CurrentFrameIndex];
 
@@ -181,65 +169,54 @@ void DX12CommandContext::EndFrame()
     ID3D12CommandList* commandLists[] = { frame.commandList.Get() };
     m_CommandQueue->ExecuteCommandLists(_countof(commandLists), commandLists);
 
-    // Signal fence for this frame
-    SignalFrame(m_CurrentFrameIndex);
+    // Signal the next fence value from the GPU side (only the render thread submits)
+    const UINT64 signalValue = m_LastSubmittedValue.load(std::memory_order_relaxed) + 1;
+    hr = m_CommandQueue->Signal(m_Fence.Get(), signalValue);
+    if (FAILED(hr)) {
+        auto result = ToRHIResult(hr, "CommandQueue::Signal");
+        SOLARC_RENDER_ERROR("Failed to signal fence: {}", result.GetResultMessage());
+        throw std::runtime_error("Failed to signal fence");
+    }
+
+    frame.fenceValue = signalValue;
+    m_LastSubmittedValue.store(signalValue, std::memory_order_release);
 
     SOLARC_RENDER_TRACE("Frame {} ended (fence value: {})", m_CurrentFrameIndex, frame.fenceValue);
 
     // Advance to next frame
     m_CurrentFrameIndex = (m_CurrentFrameIndex + 1) % FRAMES_IN_FLIGHT;
+    return signalValue;
 }
 
 void DX12CommandContext::WaitForFrame(UINT frameIndex)
 {
     SOLARC_ASSERT(frameIndex < FRAMES_IN_FLIGHT, "Invalid frame index");
-
-    auto& frame = m_FrameResources[frameIndex];
-
-    // Check if this frame is still in flight
-    UINT64 completedValue = frame.fence->GetCompletedValue();
-    if (completedValue < frame.fenceValue) {
-        // GPU hasn't finished this frame yet, wait for it
-        HRESULT hr = frame.fence->SetEventOnCompletion(frame.fenceValue, frame.fenceEvent);
-        if (FAILED(hr)) {
-            auto result = ToRHIResult(hr, "SetEventOnCompletion");
-            SOLARC_RENDER_ERROR("Failed to set fence event: {}", result.GetResultMessage());
-            throw std::runtime_error("Failed to set fence event");
-        }
-
-        SOLARC_RENDER_TRACE("Waiting for frame {} (fence value: {})", frameIndex, frame.fenceValue);
-        WaitForSingleObject(frame.fenceEvent, INFINITE);
-    }
+    WaitForValue(m_FrameResources[frameIndex].fenceValue);
 }
 
-void DX12CommandContext::SignalFrame(UINT frameIndex)
+void DX12CommandContext::WaitForValue(UINT64 value)
 {
-    SOLARC_ASSERT(frameIndex < FRAMES_IN_FLIGHT, "Invalid frame index");
-
-    auto& frame = m_FrameResources[frameIndex];
-
-    // Increment fence value for this frame
-    frame.fenceValue++;
+    if (IsValueComplete(value)) {
+        return;
+    }
 
-    // Signal the fence from the GPU side
-    HRESULT hr = m_CommandQueue->Signal(frame.fence.Get(), frame.fenceValue);
+    // A null event blocks this thread until the value is reached, so any
+    // number of threads can wait without sharing an event
+    SOLARC_RENDER_TRACE("Waiting for fence value {}", value);
+    HRESULT hr = m_Fence->SetEventOnCompletion(value, nullptr);
     if (FAILED(hr)) {
-        auto result = ToRHIResult(hr, "CommandQueue::Signal");
-        SOLARC_RENDER_ERROR("Failed to signal fence: {}", result.GetResultMessage());
-        throw std::runtime_error("Failed to signal fence");
+        auto result = ToRHIResult(hr, "SetEventOnCompletion");
+        SOLARC_RENDER_ERROR("Failed to wait for fence value {}: {}", value, result.GetResultMessage());
+        throw std::runtime_error("Failed to set fence event");
     }
 }
 
 void DX12CommandContext::WaitForGPU()
 {
-    SOLARC_RENDER_DEBUG("Waiting for GPU to complete all work...");
-
-    // Wait for all frames in flight
-    for (UINT i = 0; i < FRAMES_IN_FLIGHT; ++i) {
-        WaitForFrame(i);
-    }
-
-    SOLARC_RENDER_DEBUG("GPU idle");
+    const UINT64 value = GetLastSubmittedValue();
+    SOLARC_RENDER_DEBUG("Waiting for GPU to reach fence value {}...", value);
+    WaitForValue(value);
+    SOLARC_RENDER_DEBUG("GPU reached fence value {}", value);
 }
 
 void DX12CommandContext::TransitionResource(
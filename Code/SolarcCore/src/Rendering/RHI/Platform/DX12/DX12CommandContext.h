@@ -7,6 +7,7 @@
 #include <wrl/client.h>
 #include <d3d12.h>
 #include <array>
+#include <atomic>
 #include <cstdint>
 
 using Microsoft::WRL::ComPtr;
@@ -15,7 +16,11 @@ using Microsoft::WRL::ComPtr;
  * DX12 Command Context
  * 
  * Manages command queue, allocators, and command lists for GPU command submission.
- * Implements frame pacing with fences to prevent CPU from getting ahead of GPU.
+ *
+ * GPU progress is tracked with one fence on the queue: every submission
+ * signals the next value (1, 2, 3, ...). A frame slot is free once the value
+ * it last signaled is reached, WaitForGPU waits for the last submitted value
+ * only, and any thread can ask IsValueComplete() to retire resources.
  */
 class DX12CommandContext
 {
@@ -50,7 +55,7 @@ public:
 
     /**
      * Begin a new frame
-     * note: Waits for the fence from FRAMES_IN_FLIGHT ago
+     * note: Waits for the submission from FRAMES_IN_FLIGHT ago
      * note: Resets command allocator and command list for current frame
      */
     void BeginFrame();
@@ -58,17 +63,43 @@ public:
     /**
      * End the current frame
      * note: Closes the command list and submits it to the queue
-     * note: Signals the fence for this frame
+     * note: Signals the next fence value
+     * return The fence value this frame signals on completion
      */
-    void EndFrame();
+    UINT64 EndFrame();
 
     /**
-     * Wait for all frames to complete on GPU
-     * note: Blocks until GPU is idle
-     * note: Used before resize or shutdown
+     * Wait for all submitted work to complete on GPU
+     * note: Waits for the last submitted fence value
+     * note: Thread-safe
      */
     void WaitForGPU();
 
+    /**
+     * Block until the GPU reached a fence value
+     * param value: Value returned by EndFrame (0 returns immediately)
+     * note: Thread-safe
+     */
+    void WaitForValue(UINT64 value);
+
+    /**
+     * Has the GPU finished the submission that signals 'value'?
+     * note: Thread-safe
+     */
+    bool IsValueComplete(UINT64 value) const { return value <= GetCompletedValue(); }
+
+    /**
+     * Get the value signaled by the most recent submission (0 = none yet)
+     * note: Thread-safe
+     */
+    UINT64 GetLastSubmittedValue() const { return m_LastSubmittedValue.load(std::memory_order_acquire); }
+
+    /**
+     * Get the highest value the GPU has reached
+     * note: Thread-safe
+     */
+    UINT64 GetCompletedValue() const { return m_Fence->GetCompletedValue(); }
+
     /**
      * Get current frame index (for debugging)
      */
@@ -114,20 +145,20 @@ private:
     {
         ComPtr<ID3D12CommandAllocator> commandAllocator;
         ComPtr<ID3D12GraphicsCommandList> commandList;
-        ComPtr<ID3D12Fence> fence;
-        UINT64 fenceValue = 0;
-        HANDLE fenceEvent = nullptr;
+        UINT64 fenceValue = 0; // Fence value of this slot's last submission
     };
 
     void CreateCommandQueue();
     void CreateFrameResources();
     void WaitForFrame(UINT frameIndex);
-    void SignalFrame(UINT frameIndex);
 
     DX12Device* m_Device; // Non-owning
     ComPtr<ID3D12CommandQueue> m_CommandQueue;
     std::array<FrameResources, FRAMES_IN_FLIGHT> m_FrameResources;
     UINT m_CurrentFrameIndex = 0;
+
+    ComPtr<ID3D12Fence> m_Fence;
+    std::atomic<UINT64> m_LastSubmittedValue{ 0 };
 };
 
 #endif // SOLARC_RENDERER_DX12
\ No newline at end of file
@@ -14,8 +14,10 @@ DX12Swapchain::DX12Swapchain(DX12Device* device, ID3D12CommandQueue* commandQueu
     SOLARC_ASSERT(commandQueue != nullptr, "Command queue cannot be null");
     SOLARC_ASSERT(window != nullptr, "Window cannot be null");
 
-    m_Width = static_cast<UINT>(window->GetWidth());
-    m_Height = static_cast<UINT>(window->GetHeight());
+    // Buffer size (render scale applied); DXGI_SCALING_STRETCH fills the client area
+    const SurfaceExtent extent = window->GetBufferExtent();
+    m_Width = static_cast<UINT>(extent.width);
+    m_Height = static_cast<UINT>(extent.height);
 
     SOLARC_RENDER_INFO("Creating DX12 swapchain ({}x{})", m_Width, m_Height);
 
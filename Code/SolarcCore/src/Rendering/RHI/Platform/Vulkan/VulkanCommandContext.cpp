@@ -2,19 +2,36 @@
 
 #include "VulkanCommandContext.h"
 #include "Logging/LogMacros.h"
+#include <algorithm>
 #include <stdexcept>
-#include <array>
 
-VulkanCommandContext::VulkanCommandContext(VulkanDevice* device)
+namespace
+{
+    // Raise 'target' to 'value' unless another thread already stored a later value
+    uint64_t StoreMax(std::atomic<uint64_t>& target, uint64_t value)
+    {
+        uint64_t current = target.load(std::memory_order_relaxed);
+        while (current < value &&
+            !target.compare_exchange_weak(current, value, std::memory_order_release, std::memory_order_relaxed)) {
+        }
+        return current < value ? value : current;
+    }
+}
+
+VulkanCommandContext::VulkanCommandContext(VulkanDevice* device, uint32_t framesInFlight)
     : m_Device(device)
+    , m_FrameResources(framesInFlight, FrameResources{})
 {
     SOLARC_ASSERT(device != nullptr, "Device cannot be null");
+    SOLARC_ASSERT(framesInFlight >= RHIDesc::MIN_FRAMES_IN_FLIGHT && framesInFlight <= RHIDesc::MAX_FRAMES_IN_FLIGHT,
+        "Frames in flight out of range");
 
-    SOLARC_RENDER_INFO("Creating Vulkan command context");
+    SOLARC_RENDER_INFO("Creating Vulkan command context ({} frames in flight)", framesInFlight);
 
     CreateCommandPools();
     CreateCommandBuffers();
     CreateSyncObjects();
+    CreateUploadRing();
 
     SOLARC_RENDER_INFO("Vulkan command context created successfully");
 }
@@ -30,14 +47,25 @@ VulkanCommandContext::~VulkanCommandContext()
 
     // Clean up frame resources
     for (auto& frame : m_FrameResources) {
-        if (frame.inFlightFence != VK_NULL_HANDLE) {
-            vkDestroyFence(device, frame.inFlightFence, nullptr);
+        for (auto& workerPool : frame.workerPools) {
+            // Destroying a pool frees its command buffers
+            vkDestroyCommandPool(device, workerPool.commandPool, nullptr);
         }
         if (frame.commandPool != VK_NULL_HANDLE) {
             vkDestroyCommandPool(device, frame.commandPool, nullptr);
         }
     }
 
+    m_UploadRing.reset();
+    if (m_UploadBuffer != VK_NULL_HANDLE) {
+        vkDestroyBuffer(device, m_UploadBuffer, nullptr);
+    }
+    m_Device->GetAllocator().Free(m_UploadMemory);
+
+    if (m_Timeline != VK_NULL_HANDLE) {
+        vkDestroySemaphore(device, m_Timeline, nullptr);
+    }
+
     SOLARC_RENDER_TRACE("Vulkan command context destroyed");
 }
 
@@ -50,7 +78,7 @@ void VulkanCommandContext::CreateCommandPools()
     poolInfo.queueFamilyIndex = m_Device->GetGraphicsQueueFamilyIndex();
     poolInfo.flags = VK_COMMAND_POOL_CREATE_RESET_COMMAND_BUFFER_BIT;
 
-    for (uint32_t i = 0; i < FRAMES_IN_FLIGHT; ++i) {
+    for (uint32_t i = 0; i < GetFramesInFlight(); ++i) {
         VkResult result = vkCreateCommandPool(
             m_Device->GetDevice(),
             &poolInfo,
@@ -75,7 +103,7 @@ void VulkanCommandContext::CreateCommandBuffers()
 {
     SOLARC_RENDER_DEBUG("Creating command buffers");
 
-    for (uint32_t i = 0; i < FRAMES_IN_FLIGHT; ++i) {
+    for (uint32_t i = 0; i < GetFramesInFlight(); ++i) {
         VkCommandBufferAllocateInfo allocInfo = {};
         allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
         allocInfo.commandPool = m_FrameResources[i].commandPool;
@@ -105,33 +133,83 @@ void VulkanCommandContext::CreateSyncObjects()
 {
     SOLARC_RENDER_DEBUG("Creating synchronization objects");
 
-    VkFenceCreateInfo fenceInfo = {};
-    fenceInfo.sType = VK_STRUCTURE_TYPE_FENCE_CREATE_INFO;
-    fenceInfo.flags = VK_FENCE_CREATE_SIGNALED_BIT; // First frame doesn't wait
+    // One timeline for the queue; value 0 = nothing submitted, so the first
+    // frame of every slot doesn't wait
+    VkSemaphoreTypeCreateInfo typeInfo = {};
+    typeInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_TYPE_CREATE_INFO;
+    typeInfo.semaphoreType = VK_SEMAPHORE_TYPE_TIMELINE;
+    typeInfo.initialValue = 0;
 
-    for (uint32_t i = 0; i < FRAMES_IN_FLIGHT; ++i) {
-        VkResult result = vkCreateFence(
-            m_Device->GetDevice(),
-            &fenceInfo,
-            nullptr,
-            &m_FrameResources[i].inFlightFence
-        );
+    VkSemaphoreCreateInfo semaphoreInfo = {};
+    semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
+    semaphoreInfo.pNext = &typeInfo;
 
-        if (result != VK_SUCCESS) {
-            auto rhiResult = ToRHIResult(result, "vkCreateFence");
-            SOLARC_RENDER_ERROR("Failed to create fence for frame {}: {}",
-                i, rhiResult.GetResultMessage());
-            throw std::runtime_error("Failed to create synchronization objects");
-        }
-
-        m_FrameResources[i].imageAvailableSemaphore = VK_NULL_HANDLE;
+    VkResult result = vkCreateSemaphore(m_Device->GetDevice(), &semaphoreInfo, nullptr, &m_Timeline);
+    if (result != VK_SUCCESS) {
+        auto rhiResult = ToRHIResult(result, "vkCreateSemaphore");
+        SOLARC_RENDER_ERROR("Failed to create timeline semaphore: {}", rhiResult.GetResultMessage());
+        throw std::runtime_error("Failed to create synchronization objects");
+    }
 
-        SOLARC_RENDER_TRACE("Created sync objects for frame {}", i);
+    for (auto& frame : m_FrameResources) {
+        frame.submittedValue = 0;
+        frame.imageAvailableSemaphore = VK_NULL_HANDLE;
     }
 
     SOLARC_RENDER_DEBUG("Synchronization objects created");
 }
 
+void VulkanCommandContext::CreateUploadRing()
+{
+    VkDevice device = m_Device->GetDevice();
+    const VkDeviceSize size = UPLOAD_RING_FRAME_SIZE * GetFramesInFlight();
+
+    VkBufferCreateInfo bufferInfo = {};
+    bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+    bufferInfo.size = size;
+    bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_SRC_BIT | VK_BUFFER_USAGE_UNIFORM_BUFFER_BIT |
+        VK_BUFFER_USAGE_STORAGE_BUFFER_BIT | VK_BUFFER_USAGE_INDEX_BUFFER_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT;
+    bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+    VkResult result = vkCreateBuffer(device, &bufferInfo, nullptr, &m_UploadBuffer);
+    if (result != VK_SUCCESS) {
+        auto rhiResult = ToRHIResult(result, "vkCreateBuffer");
+        SOLARC_RENDER_ERROR("Failed to create upload buffer: {}", rhiResult.GetResultMessage());
+        throw std::runtime_error("Failed to create upload buffer");
+    }
+
+    VkMemoryRequirements requirements;
+    vkGetBufferMemoryRequirements(device, m_UploadBuffer, &requirements);
+
+    // Coherent, so CPU writes need no flush; device-local (ReBAR) when available
+    GPUAllocationDesc desc;
+    desc.size = requirements.size;
+    desc.alignment = requirements.alignment;
+    desc.memoryTypeBits = requirements.memoryTypeBits;
+    desc.requiredFlags = GPU_MEMORY_HOST_VISIBLE | GPU_MEMORY_HOST_COHERENT;
+    desc.preferredFlags = GPU_MEMORY_DEVICE_LOCAL;
+
+    m_UploadMemory = m_Device->GetAllocator().Allocate(desc);
+    if (!m_UploadMemory.IsValid()) {
+        SOLARC_RENDER_ERROR("Failed to allocate {} KiB of upload memory", size / 1024);
+        throw std::runtime_error("Failed to allocate upload memory");
+    }
+    vkBindBufferMemory(device, m_UploadBuffer,
+        VulkanMemoryBackend::ToVkMemory(m_UploadMemory.memory), m_UploadMemory.offset);
+
+    VkPhysicalDeviceProperties properties;
+    vkGetPhysicalDeviceProperties(m_Device->GetPhysicalDevice(), &properties);
+    m_MinUploadAlignment = std::max({ UploadRing::DEFAULT_ALIGNMENT,
+        properties.limits.minUniformBufferOffsetAlignment,
+        properties.limits.minStorageBufferOffsetAlignment,
+        properties.limits.optimalBufferCopyOffsetAlignment });
+
+    m_UploadRing = std::make_unique<UploadRing>(m_UploadMemory.mapped, UPLOAD_RING_FRAME_SIZE, GetFramesInFlight());
+
+    SOLARC_RENDER_DEBUG("Upload ring: {} x {} KiB (memory type {})",
+        GetFramesInFlight(), UPLOAD_RING_FRAME_SIZE / 1024, m_UploadMemory.memoryType);
+}
+
 VkCommandBuffer VulkanCommandContext::GetCommandBuffer() const
 {
     return m_FrameResources[m_CurrentFrameIndex].commandBuffer;
@@ -147,8 +225,21 @@ void VulkanCommandContext::BeginFrame(VkSemaphore imageAvailableSemaphore)
     // Wait for this frame's previous submission to complete
     WaitForFrame(m_CurrentFrameIndex);
 
-    // Reset fence for this frame
-    vkResetFences(m_Device->GetDevice(), 1, &frame.inFlightFence);
+    // The GPU is done with this slot's uploads
+    m_UploadRing->BeginFrame(m_CurrentFrameIndex);
+
+    // Descriptors freed for completed frames can be rewritten
+    if (VulkanDescriptorHeap* heap = m_Device->GetDescriptorHeap()) {
+        heap->Collect(GetCompletedValue());
+    }
+
+    // Recycle all secondaries the workers recorded for this slot at once
+    for (auto& workerPool : frame.workerPools) {
+        if (workerPool.usedCount > 0) {
+            vkResetCommandPool(m_Device->GetDevice(), workerPool.commandPool, 0);
+            workerPool.usedCount = 0;
+        }
+    }
 
     // Reset and begin command buffer
     vkResetCommandBuffer(frame.commandBuffer, 0);
@@ -165,31 +256,84 @@ void VulkanCommandContext::BeginFrame(VkSemaphore imageAvailableSemaphore)
         throw std::runtime_error("Failed to begin command buffer");
     }
 
+    // Bound once for the whole frame; draws select descriptors with push constants
+    if (VulkanDescriptorHeap* heap = m_Device->GetDescriptorHeap()) {
+        heap->Bind(frame.commandBuffer);
+    }
+
     SOLARC_RENDER_TRACE("Frame {} began", m_CurrentFrameIndex);
 }
 
-void VulkanCommandContext::BeginRenderPass(
-    VkFramebuffer framebuffer,
-    VkRenderPass renderPass,
+void VulkanCommandContext::SetImageAvailableSemaphore(VkSemaphore imageAvailableSemaphore)
+{
+    m_FrameResources[m_CurrentFrameIndex].imageAvailableSemaphore = imageAvailableSemaphore;
+}
+
+void VulkanCommandContext::TransitionImage(
+    VkImage image,
+    VkImageLayout oldLayout,
+    VkImageLayout newLayout,
+    VkPipelineStageFlags2 srcStage,
+    VkAccessFlags2 srcAccess,
+    VkPipelineStageFlags2 dstStage,
+    VkAccessFlags2 dstAccess)
+{
+    VkImageMemoryBarrier2 barrier = {};
+    barrier.sType = VK_STRUCTURE_TYPE_IMAGE_MEMORY_BARRIER_2;
+    barrier.srcStageMask = srcStage;
+    barrier.srcAccessMask = srcAccess;
+    barrier.dstStageMask = dstStage;
+    barrier.dstAccessMask = dstAccess;
+    barrier.oldLayout = oldLayout;
+    barrier.newLayout = newLayout;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.image = image;
+    barrier.subresourceRange.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    barrier.subresourceRange.baseMipLevel = 0;
+    barrier.subresourceRange.levelCount = 1;
+    barrier.subresourceRange.baseArrayLayer = 0;
+    barrier.subresourceRange.layerCount = 1;
+
+    VkDependencyInfo dependencyInfo = {};
+    dependencyInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+    dependencyInfo.imageMemoryBarrierCount = 1;
+    dependencyInfo.pImageMemoryBarriers = &barrier;
+
+    vkCmdPipelineBarrier2(GetCommandBuffer(), &dependencyInfo);
+}
+
+void VulkanCommandContext::BeginRendering(
+    VkImageView imageView,
     uint32_t width,
     uint32_t height,
-    const float clearColor[4])
+    const float clearColor[4],
+    bool secondaryContents)
 {
-    SOLARC_ASSERT(clearColor != nullptr, "Clear color cannot be null");
+    VkRenderingAttachmentInfo colorAttachment = {};
+    colorAttachment.sType = VK_STRUCTURE_TYPE_RENDERING_ATTACHMENT_INFO;
+    colorAttachment.imageView = imageView;
+    colorAttachment.imageLayout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
+    colorAttachment.loadOp = clearColor != nullptr ? VK_ATTACHMENT_LOAD_OP_CLEAR : VK_ATTACHMENT_LOAD_OP_LOAD;
+    colorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
+    if (clearColor != nullptr) {
+        colorAttachment.clearValue.color = { {clearColor[0], clearColor[1], clearColor[2], clearColor[3]} };
+    }
 
-    VkRenderPassBeginInfo renderPassInfo = {};
-    renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_BEGIN_INFO;
-    renderPassInfo.renderPass = renderPass;
-    renderPassInfo.framebuffer = framebuffer;
-    renderPassInfo.renderArea.offset = { 0, 0 };
-    renderPassInfo.renderArea.extent = { width, height };
+    VkRenderingInfo renderingInfo = {};
+    renderingInfo.sType = VK_STRUCTURE_TYPE_RENDERING_INFO;
+    renderingInfo.flags = secondaryContents ? VK_RENDERING_CONTENTS_SECONDARY_COMMAND_BUFFERS_BIT : 0;
+    renderingInfo.renderArea.offset = { 0, 0 };
+    renderingInfo.renderArea.extent = { width, height };
+    renderingInfo.layerCount = 1;
+    renderingInfo.colorAttachmentCount = 1;
+    renderingInfo.pColorAttachments = &colorAttachment;
 
-    VkClearValue clearValue = {};
-    clearValue.color = { {clearColor[0], clearColor[1], clearColor[2], clearColor[3]} };
-    renderPassInfo.clearValueCount = 1;
-    renderPassInfo.pClearValues = &clearValue;
+    vkCmdBeginRendering(GetCommandBuffer(), &renderingInfo);
 
-    vkCmdBeginRenderPass(GetCommandBuffer(), &renderPassInfo, VK_SUBPASS_CONTENTS_INLINE);
+    if (secondaryContents) {
+        return; // Dynamic state is set in each secondary (BeginSecondary)
+    }
 
     VkViewport viewport = {};
     viewport.x = 0.0f;
@@ -206,13 +350,173 @@ void VulkanCommandContext::BeginRenderPass(
     vkCmdSetScissor(GetCommandBuffer(), 0, 1, &scissor);
 }
 
-void VulkanCommandContext::EndRenderPass()
+void VulkanCommandContext::ClearAttachment(uint32_t width, uint32_t height, const float clearColor[4])
+{
+    VkRect2D rect = {};
+    rect.offset = { 0, 0 };
+    rect.extent = { width, height };
+    ClearAttachment(GetCommandBuffer(), rect, clearColor);
+}
+
+void VulkanCommandContext::ClearAttachment(VkCommandBuffer commandBuffer, const VkRect2D& rect, const float clearColor[4])
+{
+    SOLARC_ASSERT(clearColor != nullptr, "Clear color cannot be null");
+
+    VkClearAttachment attachment = {};
+    attachment.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    attachment.colorAttachment = 0;
+    attachment.clearValue.color = { {clearColor[0], clearColor[1], clearColor[2], clearColor[3]} };
+
+    VkClearRect clearRect = {};
+    clearRect.rect = rect;
+    clearRect.baseArrayLayer = 0;
+    clearRect.layerCount = 1;
+
+    vkCmdClearAttachments(commandBuffer, 1, &attachment, 1, &clearRect);
+}
+
+void VulkanCommandContext::PrepareWorkerPools(uint32_t workerCount)
 {
-    vkCmdEndRenderPass(GetCommandBuffer());
+    VkCommandPoolCreateInfo poolInfo = {};
+    poolInfo.sType = VK_STRUCTURE_TYPE_COMMAND_POOL_CREATE_INFO;
+    poolInfo.queueFamilyIndex = m_Device->GetGraphicsQueueFamilyIndex();
+    poolInfo.flags = VK_COMMAND_POOL_CREATE_TRANSIENT_BIT; // Reset as a whole, never per buffer
+
+    for (uint32_t i = 0; i < GetFramesInFlight(); ++i) {
+        auto& workerPools = m_FrameResources[i].workerPools;
+        if (workerPools.size() >= workerCount) {
+            continue;
+        }
+
+        const size_t firstNew = workerPools.size();
+        workerPools.resize(workerCount);
+
+        for (size_t worker = firstNew; worker < workerCount; ++worker) {
+            VkResult result = vkCreateCommandPool(
+                m_Device->GetDevice(),
+                &poolInfo,
+                nullptr,
+                &workerPools[worker].commandPool
+            );
+
+            if (result != VK_SUCCESS) {
+                auto rhiResult = ToRHIResult(result, "vkCreateCommandPool");
+                SOLARC_RENDER_ERROR("Failed to create command pool for worker {} (frame {}): {}",
+                    worker, i, rhiResult.GetResultMessage());
+                throw std::runtime_error("Failed to create worker command pool");
+            }
+        }
+    }
+
+    SOLARC_RENDER_TRACE("Worker command pools ready ({} workers)", workerCount);
+}
+
+VkCommandBuffer VulkanCommandContext::BeginSecondary(uint32_t workerIndex, VkFormat colorFormat, uint32_t width, uint32_t height)
+{
+    auto& workerPools = m_FrameResources[m_CurrentFrameIndex].workerPools;
+    SOLARC_ASSERT(workerIndex < workerPools.size(), "Worker has no command pool (PrepareWorkerPools)");
+    WorkerPool& workerPool = workerPools[workerIndex];
+
+    if (workerPool.usedCount == workerPool.commandBuffers.size()) {
+        VkCommandBufferAllocateInfo allocInfo = {};
+        allocInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_ALLOCATE_INFO;
+        allocInfo.commandPool = workerPool.commandPool;
+        allocInfo.level = VK_COMMAND_BUFFER_LEVEL_SECONDARY;
+        allocInfo.commandBufferCount = 1;
+
+        VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+        VkResult result = vkAllocateCommandBuffers(m_Device->GetDevice(), &allocInfo, &commandBuffer);
+        if (result != VK_SUCCESS) {
+            auto rhiResult = ToRHIResult(result, "vkAllocateCommandBuffers");
+            SOLARC_RENDER_ERROR("Failed to allocate secondary command buffer for worker {}: {}",
+                workerIndex, rhiResult.GetResultMessage());
+            throw std::runtime_error("Failed to allocate secondary command buffer");
+        }
+        workerPool.commandBuffers.push_back(commandBuffer);
+    }
+
+    VkCommandBuffer commandBuffer = workerPool.commandBuffers[workerPool.usedCount++];
+
+    // Renders inside the primary's dynamic rendering instance
+    VkCommandBufferInheritanceRenderingInfo renderingInfo = {};
+    renderingInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_RENDERING_INFO;
+    renderingInfo.colorAttachmentCount = 1;
+    renderingInfo.pColorAttachmentFormats = &colorFormat;
+    renderingInfo.rasterizationSamples = VK_SAMPLE_COUNT_1_BIT;
+
+    VkCommandBufferInheritanceInfo inheritanceInfo = {};
+    inheritanceInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_INHERITANCE_INFO;
+    inheritanceInfo.pNext = &renderingInfo;
+
+    VkCommandBufferBeginInfo beginInfo = {};
+    beginInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_BEGIN_INFO;
+    beginInfo.flags = VK_COMMAND_BUFFER_USAGE_ONE_TIME_SUBMIT_BIT | VK_COMMAND_BUFFER_USAGE_RENDER_PASS_CONTINUE_BIT;
+    beginInfo.pInheritanceInfo = &inheritanceInfo;
+
+    VkResult result = vkBeginCommandBuffer(commandBuffer, &beginInfo);
+    if (result != VK_SUCCESS) {
+        auto rhiResult = ToRHIResult(result, "vkBeginCommandBuffer");
+        SOLARC_RENDER_ERROR("Failed to begin secondary command buffer: {}", rhiResult.GetResultMessage());
+        throw std::runtime_error("Failed to begin secondary command buffer");
+    }
+
+    // Secondaries inherit no bound descriptor sets
+    if (VulkanDescriptorHeap* heap = m_Device->GetDescriptorHeap()) {
+        heap->Bind(commandBuffer);
+    }
+
+    // Secondaries inherit no dynamic state
+    VkViewport viewport = {};
+    viewport.width = static_cast<float>(width);
+    viewport.height = static_cast<float>(height);
+    viewport.minDepth = 0.0f;
+    viewport.maxDepth = 1.0f;
+    vkCmdSetViewport(commandBuffer, 0, 1, &viewport);
+
+    VkRect2D scissor = {};
+    scissor.extent = { width, height };
+    vkCmdSetScissor(commandBuffer, 0, 1, &scissor);
+
+    return commandBuffer;
+}
+
+void VulkanCommandContext::EndSecondary(VkCommandBuffer commandBuffer)
+{
+    VkResult result = vkEndCommandBuffer(commandBuffer);
+    if (result != VK_SUCCESS) {
+        auto rhiResult = ToRHIResult(result, "vkEndCommandBuffer");
+        SOLARC_RENDER_ERROR("Failed to end secondary command buffer: {}", rhiResult.GetResultMessage());
+        throw std::runtime_error("Failed to end secondary command buffer");
+    }
+}
+
+void VulkanCommandContext::ExecuteSecondaries(const std::vector<VkCommandBuffer>& commandBuffers)
+{
+    if (!commandBuffers.empty()) {
+        vkCmdExecuteCommands(GetCommandBuffer(), static_cast<uint32_t>(commandBuffers.size()), commandBuffers.data());
+    }
+}
+
+UploadAllocation VulkanCommandContext::AllocateUpload(uint64_t size, uint64_t alignment)
+{
+    return m_UploadRing->Allocate(size, std::max(alignment, m_MinUploadAlignment));
+}
+
+void VulkanCommandContext::FreeDescriptor(const RHIDescriptorHandle& handle)
+{
+    // The frame being recorded (or the next one, between frames) may still use it
+    if (VulkanDescriptorHeap* heap = m_Device->GetDescriptorHeap()) {
+        heap->Free(handle, GetLastSubmittedValue() + 1);
+    }
+}
+
+void VulkanCommandContext::EndRendering()
+{
+    vkCmdEndRendering(GetCommandBuffer());
 }
 
 // Accept renderFinishedSemaphore from swapchain (indexed by image, not frame)
-void VulkanCommandContext::EndFrame(VkSemaphore renderFinishedSemaphore)
+uint64_t VulkanCommandContext::EndFrame(VkSemaphore renderFinishedSemaphore)
 {
     auto& frame = m_FrameResources[m_CurrentFrameIndex];
 
@@ -223,31 +527,60 @@ void VulkanCommandContext::EndFrame(VkSemaphore renderFinishedSemaphore)
         throw std::runtime_error("Failed to end command buffer");
     }
 
-    VkSubmitInfo submitInfo{};
-    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO;
+    // Only the render thread submits, so the next value can be computed before publishing it
+    const uint64_t signalValue = m_LastSubmittedValue.load(std::memory_order_relaxed) + 1;
+
+    // Offscreen targets have nothing to acquire or present: the timeline alone paces
+    VkSemaphoreSubmitInfo waitInfo = {};
+    waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+    waitInfo.semaphore = frame.imageAvailableSemaphore;
+    waitInfo.stageMask = VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT;
+
+    VkSemaphoreSubmitInfo signalInfos[2] = {};
+    uint32_t signalCount = 0;
+
+    signalInfos[signalCount].sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+    signalInfos[signalCount].semaphore = m_Timeline;
+    signalInfos[signalCount].value = signalValue;
+    signalInfos[signalCount].stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+    ++signalCount;
+
+    if (renderFinishedSemaphore != VK_NULL_HANDLE) {
+        // Binary, per-swapchain-image semaphore waited on by present
+        signalInfos[signalCount].sType = VK_STRUCTURE_TYPE_SEMAPHORE_SUBMIT_INFO;
+        signalInfos[signalCount].semaphore = renderFinishedSemaphore;
+        signalInfos[signalCount].stageMask = VK_PIPELINE_STAGE_2_ALL_COMMANDS_BIT;
+        ++signalCount;
+    }
 
-    VkSemaphore waitSemaphores[] = { frame.imageAvailableSemaphore };
-    VkPipelineStageFlags waitStages[] = { VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT };
-    submitInfo.waitSemaphoreCount = 1;
-    submitInfo.pWaitSemaphores = waitSemaphores;
-    submitInfo.pWaitDstStageMask = waitStages;
-    submitInfo.commandBufferCount = 1;
-    submitInfo.pCommandBuffers = &frame.commandBuffer;
-    submitInfo.signalSemaphoreCount = 1;
-    submitInfo.pSignalSemaphores = &renderFinishedSemaphore; // per-swapchain-image semaphore
+    VkCommandBufferSubmitInfo commandBufferInfo = {};
+    commandBufferInfo.sType = VK_STRUCTURE_TYPE_COMMAND_BUFFER_SUBMIT_INFO;
+    commandBufferInfo.commandBuffer = frame.commandBuffer;
 
-    // Fence is already reset in BeginFrame; no need to reset again
-    result = vkQueueSubmit(m_Device->GetGraphicsQueue(), 1, &submitInfo, frame.inFlightFence);
+    VkSubmitInfo2 submitInfo = {};
+    submitInfo.sType = VK_STRUCTURE_TYPE_SUBMIT_INFO_2;
+    submitInfo.waitSemaphoreInfoCount = frame.imageAvailableSemaphore != VK_NULL_HANDLE ? 1 : 0;
+    submitInfo.pWaitSemaphoreInfos = &waitInfo;
+    submitInfo.commandBufferInfoCount = 1;
+    submitInfo.pCommandBufferInfos = &commandBufferInfo;
+    submitInfo.signalSemaphoreInfoCount = signalCount;
+    submitInfo.pSignalSemaphoreInfos = signalInfos;
+
+    result = vkQueueSubmit2(m_Device->GetGraphicsQueue(), 1, &submitInfo, VK_NULL_HANDLE);
 
     if (result != VK_SUCCESS) {
-        auto rhiResult = ToRHIResult(result, "vkQueueSubmit");
+        auto rhiResult = ToRHIResult(result, "vkQueueSubmit2");
         SOLARC_RENDER_ERROR("Failed to submit command buffer: {}", rhiResult.GetResultMessage());
         throw std::runtime_error("Failed to submit command buffer");
     }
 
-    SOLARC_RENDER_TRACE("Frame {} ended", m_CurrentFrameIndex);
+    frame.submittedValue = signalValue;
+    m_LastSubmittedValue.store(signalValue, std::memory_order_release);
+
+    SOLARC_RENDER_TRACE("Frame {} ended (timeline value {})", m_CurrentFrameIndex, signalValue);
 
-    m_CurrentFrameIndex = (m_CurrentFrameIndex + 1) % FRAMES_IN_FLIGHT;
+    m_CurrentFrameIndex = (m_CurrentFrameIndex + 1) % GetFramesInFlight();
+    return signalValue;
 }
 
 void VulkanCommandContext::WaitForCurrentFrame()
@@ -257,15 +590,59 @@ void VulkanCommandContext::WaitForCurrentFrame()
 
 void VulkanCommandContext::WaitForFrame(uint32_t frameIndex)
 {
-    SOLARC_ASSERT(frameIndex < FRAMES_IN_FLIGHT, "Invalid frame index");
-    vkWaitForFences(m_Device->GetDevice(), 1, &m_FrameResources[frameIndex].inFlightFence, VK_TRUE, UINT64_MAX);
+    SOLARC_ASSERT(frameIndex < GetFramesInFlight(), "Invalid frame index");
+    WaitForValue(m_FrameResources[frameIndex].submittedValue);
 }
 
 void VulkanCommandContext::WaitForGPU()
 {
-    SOLARC_RENDER_DEBUG("Waiting for GPU to complete all work...");
-    vkDeviceWaitIdle(m_Device->GetDevice());
-    SOLARC_RENDER_DEBUG("GPU idle");
+    const uint64_t value = GetLastSubmittedValue();
+    SOLARC_RENDER_DEBUG("Waiting for GPU to reach timeline value {}...", value);
+    WaitForValue(value);
+    SOLARC_RENDER_DEBUG("GPU reached timeline value {}", value);
+}
+
+void VulkanCommandContext::WaitForValue(uint64_t value)
+{
+    if (IsValueComplete(value)) {
+        return;
+    }
+
+    VkSemaphoreWaitInfo waitInfo = {};
+    waitInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_WAIT_INFO;
+    waitInfo.semaphoreCount = 1;
+    waitInfo.pSemaphores = &m_Timeline;
+    waitInfo.pValues = &value;
+
+    VkResult result = vkWaitSemaphores(m_Device->GetDevice(), &waitInfo, UINT64_MAX);
+    if (result != VK_SUCCESS) {
+        auto rhiResult = ToRHIResult(result, "vkWaitSemaphores");
+        SOLARC_RENDER_ERROR("Failed to wait for timeline value {}: {}", value, rhiResult.GetResultMessage());
+        throw std::runtime_error("Failed to wait for GPU");
+    }
+
+    // Publish for IsValueComplete() callers
+    StoreMax(m_CompletedValue, value);
+}
+
+bool VulkanCommandContext::IsValueComplete(uint64_t value) const
+{
+    if (value <= m_CompletedValue.load(std::memory_order_acquire)) {
+        return true;
+    }
+    return value <= GetCompletedValue();
+}
+
+uint64_t VulkanCommandContext::GetCompletedValue() const
+{
+    uint64_t value = 0;
+    VkResult result = vkGetSemaphoreCounterValue(m_Device->GetDevice(), m_Timeline, &value);
+    if (result != VK_SUCCESS) {
+        // Device lost: report the cached value; waits surface the error
+        return m_CompletedValue.load(std::memory_order_acquire);
+    }
+
+    return StoreMax(m_CompletedValue, value);
 }
 
 #endif // SOLARC_RENDERER_VULKAN
\ No newline at end of file
@@ -4,27 +4,49 @@
 
 #include "VulkanDevice.h"
 #include "Rendering/RHI/RHIResult.h"
+#include "Rendering/RHI/UploadRing.h"
 #include <vulkan/vulkan.h>
-#include <array>
+#include <atomic>
+#include <memory>
 #include <vector>
 
     /**
      * Vulkan Command Context
      *
      * Manages command pools, command buffers, and synchronization for GPU command submission.
-     * Implements frame pacing with fences to prevent CPU from getting ahead of GPU.
+     * The number of frames in flight (1-4) is fixed at creation (RHIDesc).
+     *
+     * GPU progress is tracked with one timeline semaphore on the graphics
+     * queue: every submission signals the next value (1, 2, 3, ...). A frame
+     * slot is free once the value it last signaled is reached, WaitForGPU
+     * waits for the last submitted value only, and any thread can ask
+     * IsValueComplete() to retire resources a frame used.
+     *
+     * Parallel recording: every JobSystem worker gets its own command pool
+     * per frame slot (PrepareWorkerPools). Workers record secondary command
+     * buffers from their pool only, so no pool is touched by two threads;
+     * the pools are reset in bulk when their frame slot is reused.
+     *
+     * Uploads: one persistently mapped, host-coherent buffer split into a
+     * partition per frame slot (UploadRing). Any thread can sub-allocate
+     * uniforms, dynamic vertices or staging data from the current frame's
+     * partition without locks; the partition is rewound when the slot's
+     * timeline value is reached in BeginFrame.
+     *
+     * Descriptors: the device's bindless heap is bound at set 0 of every
+     * primary and secondary command buffer, and its deferred frees are
+     * recycled in BeginFrame against the timeline.
      */
     class VulkanCommandContext
     {
     public:
-        static constexpr uint32_t FRAMES_IN_FLIGHT = 2; // Double-buffered
-
         /**
          * Create command context for device
          * param device: Vulkan device
+         * param framesInFlight: Frames the CPU may record ahead of the GPU (1-4)
          * throws std::runtime_error if creation fails
          */
-        explicit VulkanCommandContext(VulkanDevice* device);
+        VulkanCommandContext(VulkanDevice* device, uint32_t framesInFlight);
         ~VulkanCommandContext();
 
         // Non-copyable, non-movable
@@ -53,76 +75,227 @@
 
         /**
          * Begin a new frame
-         * param imageAvailableSemaphore: Semaphore to wait for (from swapchain)
-         * note: Waits for the fence from FRAMES_IN_FLIGHT ago
+         * param imageAvailableSemaphore: Semaphore to wait for (from swapchain), VK_NULL_HANDLE for none
+         * note: Waits for the timeline value signaled GetFramesInFlight() frames ago
          * note: Resets command buffer for current frame
          */
         void BeginFrame(VkSemaphore imageAvailableSemaphore);
 
         /**
-         * Begin render pass
-         * param framebuffer: Framebuffer to render to
-         * param renderPass: Render pass to use
+         * Set the semaphore the current frame's submission waits on
+         * note: For images acquired after BeginFrame (just-in-time acquire)
+         */
+        void SetImageAvailableSemaphore(VkSemaphore imageAvailableSemaphore);
+
+        /**
+         * Transition an image between layouts (vkCmdPipelineBarrier2)
+         * param image: Single-mip, single-layer color image
+         * param oldLayout: Current layout; UNDEFINED discards the contents
+         * param newLayout: Layout after the barrier
+         * param srcStage, srcAccess: Work and writes to wait for
+         * param dstStage, dstAccess: Work and accesses that wait
+         */
+        void TransitionImage(
+            VkImage image,
+            VkImageLayout oldLayout,
+            VkImageLayout newLayout,
+            VkPipelineStageFlags2 srcStage,
+            VkAccessFlags2 srcAccess,
+            VkPipelineStageFlags2 dstStage,
+            VkAccessFlags2 dstAccess
+        );
+
+        /**
+         * Begin dynamic rendering into one color attachment
+         * param imageView: Attachment view, in COLOR_ATTACHMENT_OPTIMAL
          * param width: Render area width
          * param height: Render area height
-         * param clearColor: RGBA clear color (4 floats)
+         * param clearColor: RGBA load-op clear color (4 floats), nullptr = keep the contents
+         * param secondaryContents: Contents are recorded in secondary command buffers
+         *                          (ExecuteSecondary only until EndRendering)
+         * note: Sets a full-size viewport and scissor
          */
-        void BeginRenderPass(
-            VkFramebuffer framebuffer,
-            VkRenderPass renderPass,
+        void BeginRendering(
+            VkImageView imageView,
             uint32_t width,
             uint32_t height,
-            const float clearColor[4]
+            const float clearColor[4],
+            bool secondaryContents = false
         );
 
         /**
-         * End render pass
+         * Clear the whole color attachment inside BeginRendering/EndRendering
+         * param width: Render area width
+         * param height: Render area height
+         * param clearColor: RGBA clear color (4 floats)
+         */
+        void ClearAttachment(uint32_t width, uint32_t height, const float clearColor[4]);
+
+        /**
+         * Clear part of the color attachment
+         * param commandBuffer: Primary inside BeginRendering, or a secondary from BeginSecondary
+         * param rect: Area to clear, within the render area
+         * param clearColor: RGBA clear color (4 floats)
+         */
+        static void ClearAttachment(VkCommandBuffer commandBuffer, const VkRect2D& rect, const float clearColor[4]);
+
+        /**
+         * Make sure every worker has a command pool in every frame slot
+         * param workerCount: JobSystem::GetWorkerCount()
+         * note: Render thread only, before handing work to the workers
+         */
+        void PrepareWorkerPools(uint32_t workerCount);
+
+        /**
+         * Begin a secondary command buffer for the current frame on a worker
+         * param workerIndex: JobSystem::GetCurrentWorkerIndex() of the calling thread
+         * param colorFormat: Format of the attachment it renders into
+         * param width, height: Render area (sets a full-size viewport and scissor)
+         * return Recording command buffer, valid until the frame slot is reused
+         * note: Thread-safe across distinct workers; the render thread must
+         *       not advance the frame while workers record
          */
-        void EndRenderPass();
+        VkCommandBuffer BeginSecondary(uint32_t workerIndex, VkFormat colorFormat, uint32_t width, uint32_t height);
+
+        /**
+         * Finish a secondary command buffer from BeginSecondary
+         */
+        void EndSecondary(VkCommandBuffer commandBuffer);
+
+        /**
+         * Execute recorded secondaries, in order, inside a BeginRendering
+         * opened with secondaryContents
+         */
+        void ExecuteSecondaries(const std::vector<VkCommandBuffer>& commandBuffers);
+
+        /**
+         * Allocate upload memory for the current frame
+         * param alignment: Power of two; raised to the device's uniform / storage /
+         *                  copy offset alignment
+         * return Range of GetUploadBuffer(), written through 'mapped'; invalid if
+         *        the frame's partition is full
+         * note: Thread-safe (lock-free). Valid until this frame slot is reused,
+         *       so use it in commands of the current frame only
+         */
+        UploadAllocation AllocateUpload(uint64_t size, uint64_t alignment = UploadRing::DEFAULT_ALIGNMENT);
+
+        /**
+         * Buffer behind AllocateUpload (transfer source, uniform, storage,
+         * index and vertex usage)
+         */
+        VkBuffer GetUploadBuffer() const { return m_UploadBuffer; }
+
+        const UploadRing& GetUploadRing() const { return *m_UploadRing; }
+
+        /**
+         * Release a bindless descriptor (VulkanDevice::GetDescriptorHeap) once
+         * every frame submitted so far, and the one being recorded, completed
+         * note: Thread-safe
+         */
+        void FreeDescriptor(const RHIDescriptorHandle& handle);
+
+        /**
+         * End dynamic rendering
+         */
+        void EndRendering();
 
         /**
          * End the current frame
          * note: Ends command buffer recording and submits to queue
-         * note: Signals the fence and render finished semaphore for this frame
+         * note: Signals the next timeline value and the render finished semaphore
+         * note: VK_NULL_HANDLE signals the timeline value only (offscreen)
+         * return The timeline value this frame signals on completion
          */
-        void EndFrame(VkSemaphore renderFinishedSemaphore);
+        uint64_t EndFrame(VkSemaphore renderFinishedSemaphore);
 
         /**
-         * Wait for the current frame's fence to be signaled.
+         * Wait until the current frame slot's previous submission completed.
          * note: Ensures previous use of this frame's resources (including semaphores) is complete.
          */
         void WaitForCurrentFrame();
 
-
         /**
-         * Wait for all frames to complete on GPU
-         * note: Blocks until GPU is idle
-         * note: Used before resize or shutdown
+         * Wait for all submitted work to complete on GPU
+         * note: Waits for the last submitted timeline value, not for device idle;
+         *       presentation is not covered (see VulkanSwapchain)
+         * note: Thread-safe
          */
         void WaitForGPU();
 
+        /**
+         * Block until the GPU reached a timeline value
+         * param value: Value returned by EndFrame (0 returns immediately)
+         * note: Thread-safe
+         */
+        void WaitForValue(uint64_t value);
+
+        /**
+         * Has the GPU finished the submission that signals 'value'?
+         * note: Thread-safe; no driver call when an earlier query already saw it complete
+         */
+        bool IsValueComplete(uint64_t value) const;
+
+        /**
+         * Get the value signaled by the most recent submission (0 = none yet)
+         * note: Thread-safe
+         */
+        uint64_t GetLastSubmittedValue() const { return m_LastSubmittedValue.load(std::memory_order_acquire); }
+
+        /**
+         * Get the highest value the GPU has reached (queries the semaphore)
+         * note: Thread-safe
+         */
+        uint64_t GetCompletedValue() const;
+
         /**
          * Get current frame index (for debugging)
          */
         uint32_t GetCurrentFrameIndex() const { return m_CurrentFrameIndex; }
 
+        /**
+         * Get the number of frames in flight
+         */
+        uint32_t GetFramesInFlight() const { return static_cast<uint32_t>(m_FrameResources.size()); }
+
     private:
+        // One worker's secondaries for one frame slot
+        struct WorkerPool
+        {
+            VkCommandPool commandPool = VK_NULL_HANDLE;
+            std::vector<VkCommandBuffer> commandBuffers; // Allocated so far, reused after each reset
+            uint32_t usedCount = 0;                      // Handed out since the last reset
+        };
+
         struct FrameResources
         {
-            VkCommandPool commandPool;
-            VkCommandBuffer commandBuffer;
-            VkFence inFlightFence;
-            VkSemaphore imageAvailableSemaphore; // Stored from BeginFrame
+            VkCommandPool commandPool = VK_NULL_HANDLE;
+            VkCommandBuffer commandBuffer = VK_NULL_HANDLE;
+            std::vector<WorkerPool> workerPools; // Indexed by JobSystem worker index
+            uint64_t submittedValue = 0; // Timeline value of this slot's last submission
+            VkSemaphore imageAvailableSemaphore = VK_NULL_HANDLE; // Stored from BeginFrame / SetImageAvailableSemaphore
         };
 
         void CreateCommandPools();
         void CreateCommandBuffers();
         void CreateSyncObjects();
+        void CreateUploadRing();
         void WaitForFrame(uint32_t frameIndex);
 
+        // Upload bytes per frame slot
+        static constexpr uint64_t UPLOAD_RING_FRAME_SIZE = 4ull * 1024 * 1024;
+
         VulkanDevice* m_Device; // Non-owning
-        std::array<FrameResources, FRAMES_IN_FLIGHT> m_FrameResources;
+        std::vector<FrameResources> m_FrameResources;
         uint32_t m_CurrentFrameIndex = 0;
+
+        VkSemaphore m_Timeline = VK_NULL_HANDLE;
+        std::atomic<uint64_t> m_LastSubmittedValue{ 0 };
+        mutable std::atomic<uint64_t> m_CompletedValue{ 0 }; // Highest value seen complete (cache)
+
+        VkBuffer m_UploadBuffer = VK_NULL_HANDLE;
+        GPUAllocation m_UploadMemory;
+        std::unique_ptr<UploadRing> m_UploadRing;
+        uint64_t m_MinUploadAlignment = UploadRing::DEFAULT_ALIGNMENT;
     };
 
 #endif // SOLARC_RENDERER_VULKAN
\ No newline at end of file
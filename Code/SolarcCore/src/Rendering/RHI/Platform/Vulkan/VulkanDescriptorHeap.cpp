@@ -0,0 +1,272 @@
+#ifdef SOLARC_RENDERER_VULKAN
+
+#include "VulkanDescriptorHeap.h"
+#include "Rendering/RHI/RHIResult.h"
+#include "Logging/LogMacros.h"
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+    constexpr size_t TYPE_COUNT = static_cast<size_t>(RHIDescriptorType::Count);
+
+    void ThrowOnFailure(VkResult result, const char* function, const char* what)
+    {
+        if (result != VK_SUCCESS) {
+            auto rhiResult = ToRHIResult(result, function);
+            SOLARC_RENDER_ERROR("Failed to create {}: {}", what, rhiResult.GetResultMessage());
+            throw std::runtime_error(std::string("Failed to create Vulkan ") + what);
+        }
+    }
+}
+
+VulkanDescriptorHeap::VulkanDescriptorHeap(VkDevice device, VkPhysicalDevice physicalDevice)
+    : m_Device(device)
+{
+    // Update-after-bind limits are separate from (and usually far above) the regular ones
+    VkPhysicalDeviceVulkan12Properties vulkan12Properties = {};
+    vulkan12Properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_PROPERTIES;
+
+    VkPhysicalDeviceProperties2 properties = {};
+    properties.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_PROPERTIES_2;
+    properties.pNext = &vulkan12Properties;
+    vkGetPhysicalDeviceProperties2(physicalDevice, &properties);
+
+    std::array<uint32_t, TYPE_COUNT> counts = {
+        std::min({ DEFAULT_SAMPLED_IMAGES,
+            vulkan12Properties.maxDescriptorSetUpdateAfterBindSampledImages,
+            vulkan12Properties.maxPerStageDescriptorUpdateAfterBindSampledImages }),
+        std::min({ DEFAULT_STORAGE_BUFFERS,
+            vulkan12Properties.maxDescriptorSetUpdateAfterBindStorageBuffers,
+            vulkan12Properties.maxPerStageDescriptorUpdateAfterBindStorageBuffers }),
+        std::min({ DEFAULT_SAMPLERS,
+            vulkan12Properties.maxDescriptorSetUpdateAfterBindSamplers,
+            vulkan12Properties.maxPerStageDescriptorUpdateAfterBindSamplers })
+    };
+
+    // Every binding is visible to all stages, so all of them count against
+    // the per-stage resource limit: shrink the arrays proportionally
+    const uint64_t total = uint64_t{ counts[0] } + counts[1] + counts[2];
+    const uint64_t budget = vulkan12Properties.maxPerStageUpdateAfterBindResources;
+    if (total > budget) {
+        for (uint32_t& count : counts) {
+            count = static_cast<uint32_t>(count * budget / total);
+        }
+    }
+
+    SOLARC_RENDER_INFO("Descriptor heap: {} sampled images, {} storage buffers, {} samplers",
+        counts[0], counts[1], counts[2]);
+
+    // Set layout
+    std::array<VkDescriptorSetLayoutBinding, TYPE_COUNT> bindings = {};
+    std::array<VkDescriptorBindingFlags, TYPE_COUNT> bindingFlags = {};
+    for (size_t i = 0; i < TYPE_COUNT; ++i) {
+        bindings[i].binding = static_cast<uint32_t>(i);
+        bindings[i].descriptorType = ToVkDescriptorType(static_cast<RHIDescriptorType>(i));
+        bindings[i].descriptorCount = counts[i];
+        bindings[i].stageFlags = VK_SHADER_STAGE_ALL;
+        bindingFlags[i] = VK_DESCRIPTOR_BINDING_UPDATE_AFTER_BIND_BIT |
+            VK_DESCRIPTOR_BINDING_UPDATE_UNUSED_WHILE_PENDING_BIT |
+            VK_DESCRIPTOR_BINDING_PARTIALLY_BOUND_BIT;
+    }
+
+    VkDescriptorSetLayoutBindingFlagsCreateInfo bindingFlagsInfo = {};
+    bindingFlagsInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_BINDING_FLAGS_CREATE_INFO;
+    bindingFlagsInfo.bindingCount = static_cast<uint32_t>(bindingFlags.size());
+    bindingFlagsInfo.pBindingFlags = bindingFlags.data();
+
+    VkDescriptorSetLayoutCreateInfo layoutInfo = {};
+    layoutInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_LAYOUT_CREATE_INFO;
+    layoutInfo.pNext = &bindingFlagsInfo;
+    layoutInfo.flags = VK_DESCRIPTOR_SET_LAYOUT_CREATE_UPDATE_AFTER_BIND_POOL_BIT;
+    layoutInfo.bindingCount = static_cast<uint32_t>(bindings.size());
+    layoutInfo.pBindings = bindings.data();
+
+    ThrowOnFailure(vkCreateDescriptorSetLayout(m_Device, &layoutInfo, nullptr, &m_SetLayout),
+        "vkCreateDescriptorSetLayout", "descriptor heap layout");
+
+    // Pool with room for exactly the one set
+    std::array<VkDescriptorPoolSize, TYPE_COUNT> poolSizes = {};
+    for (size_t i = 0; i < TYPE_COUNT; ++i) {
+        poolSizes[i].type = bindings[i].descriptorType;
+        poolSizes[i].descriptorCount = counts[i];
+    }
+
+    VkDescriptorPoolCreateInfo poolInfo = {};
+    poolInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_POOL_CREATE_INFO;
+    poolInfo.flags = VK_DESCRIPTOR_POOL_CREATE_UPDATE_AFTER_BIND_BIT;
+    poolInfo.maxSets = 1;
+    poolInfo.poolSizeCount = static_cast<uint32_t>(poolSizes.size());
+    poolInfo.pPoolSizes = poolSizes.data();
+
+    ThrowOnFailure(vkCreateDescriptorPool(m_Device, &poolInfo, nullptr, &m_Pool),
+        "vkCreateDescriptorPool", "descriptor heap pool");
+
+    VkDescriptorSetAllocateInfo allocInfo = {};
+    allocInfo.sType = VK_STRUCTURE_TYPE_DESCRIPTOR_SET_ALLOCATE_INFO;
+    allocInfo.descriptorPool = m_Pool;
+    allocInfo.descriptorSetCount = 1;
+    allocInfo.pSetLayouts = &m_SetLayout;
+
+    ThrowOnFailure(vkAllocateDescriptorSets(m_Device, &allocInfo, &m_Set),
+        "vkAllocateDescriptorSets", "descriptor heap set");
+
+    // Shared pipeline layout
+    VkPushConstantRange pushConstantRange = {};
+    pushConstantRange.stageFlags = VK_SHADER_STAGE_ALL;
+    pushConstantRange.offset = 0;
+    pushConstantRange.size = PUSH_CONSTANT_SIZE;
+
+    VkPipelineLayoutCreateInfo pipelineLayoutInfo = {};
+    pipelineLayoutInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_LAYOUT_CREATE_INFO;
+    pipelineLayoutInfo.setLayoutCount = 1;
+    pipelineLayoutInfo.pSetLayouts = &m_SetLayout;
+    pipelineLayoutInfo.pushConstantRangeCount = 1;
+    pipelineLayoutInfo.pPushConstantRanges = &pushConstantRange;
+
+    ThrowOnFailure(vkCreatePipelineLayout(m_Device, &pipelineLayoutInfo, nullptr, &m_PipelineLayout),
+        "vkCreatePipelineLayout", "bindless pipeline layout");
+
+    // Samplers the RHI hands out by filter
+    for (size_t i = 0; i < m_Samplers.size(); ++i) {
+        const VkFilter filter = static_cast<RHISamplerFilter>(i) == RHISamplerFilter::Linear
+            ? VK_FILTER_LINEAR : VK_FILTER_NEAREST;
+
+        VkSamplerCreateInfo samplerInfo = {};
+        samplerInfo.sType = VK_STRUCTURE_TYPE_SAMPLER_CREATE_INFO;
+        samplerInfo.magFilter = filter;
+        samplerInfo.minFilter = filter;
+        samplerInfo.mipmapMode = filter == VK_FILTER_LINEAR
+            ? VK_SAMPLER_MIPMAP_MODE_LINEAR : VK_SAMPLER_MIPMAP_MODE_NEAREST;
+        samplerInfo.addressModeU = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        samplerInfo.addressModeV = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        samplerInfo.addressModeW = VK_SAMPLER_ADDRESS_MODE_CLAMP_TO_EDGE;
+        samplerInfo.maxLod = VK_LOD_CLAMP_NONE;
+
+        ThrowOnFailure(vkCreateSampler(m_Device, &samplerInfo, nullptr, &m_Samplers[i]),
+            "vkCreateSampler", "descriptor heap sampler");
+    }
+
+    for (size_t i = 0; i < TYPE_COUNT; ++i) {
+        m_Allocators[i] = std::make_unique<DescriptorIndexAllocator>(counts[i]);
+    }
+}
+
+VulkanDescriptorHeap::~VulkanDescriptorHeap()
+{
+    for (VkSampler sampler : m_Samplers) {
+        if (sampler != VK_NULL_HANDLE) {
+            vkDestroySampler(m_Device, sampler, nullptr);
+        }
+    }
+
+    // Destroying the pool frees the set
+    if (m_PipelineLayout != VK_NULL_HANDLE) {
+        vkDestroyPipelineLayout(m_Device, m_PipelineLayout, nullptr);
+    }
+    if (m_Pool != VK_NULL_HANDLE) {
+        vkDestroyDescriptorPool(m_Device, m_Pool, nullptr);
+    }
+    if (m_SetLayout != VK_NULL_HANDLE) {
+        vkDestroyDescriptorSetLayout(m_Device, m_SetLayout, nullptr);
+    }
+}
+
+RHIDescriptorHandle VulkanDescriptorHeap::CreateSampledImage(VkImageView imageView, VkImageLayout layout)
+{
+    VkDescriptorImageInfo imageInfo = {};
+    imageInfo.imageView = imageView;
+    imageInfo.imageLayout = layout;
+    return Write(RHIDescriptorType::SampledImage, &imageInfo, nullptr);
+}
+
+RHIDescriptorHandle VulkanDescriptorHeap::CreateStorageBuffer(VkBuffer buffer, VkDeviceSize offset, VkDeviceSize range)
+{
+    VkDescriptorBufferInfo bufferInfo = {};
+    bufferInfo.buffer = buffer;
+    bufferInfo.offset = offset;
+    bufferInfo.range = range;
+    return Write(RHIDescriptorType::StorageBuffer, nullptr, &bufferInfo);
+}
+
+RHIDescriptorHandle VulkanDescriptorHeap::CreateSampler(VkSampler sampler)
+{
+    VkDescriptorImageInfo imageInfo = {};
+    imageInfo.sampler = sampler;
+    return Write(RHIDescriptorType::Sampler, &imageInfo, nullptr);
+}
+
+RHIDescriptorHandle VulkanDescriptorHeap::CreateSampler(RHISamplerFilter filter)
+{
+    SOLARC_ASSERT(filter < RHISamplerFilter::Count, "Invalid sampler filter");
+    return CreateSampler(m_Samplers[static_cast<size_t>(filter)]);
+}
+
+void VulkanDescriptorHeap::Free(const RHIDescriptorHandle& handle, uint64_t frame)
+{
+    if (!handle.IsValid()) {
+        return;
+    }
+    m_Allocators[static_cast<size_t>(handle.type)]->Free(handle.index, frame);
+}
+
+void VulkanDescriptorHeap::Collect(uint64_t completedFrame)
+{
+    for (const auto& allocator : m_Allocators) {
+        allocator->Collect(completedFrame);
+    }
+}
+
+void VulkanDescriptorHeap::Bind(VkCommandBuffer commandBuffer) const
+{
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_GRAPHICS, m_PipelineLayout, 0, 1, &m_Set, 0, nullptr);
+    vkCmdBindDescriptorSets(commandBuffer, VK_PIPELINE_BIND_POINT_COMPUTE, m_PipelineLayout, 0, 1, &m_Set, 0, nullptr);
+}
+
+void VulkanDescriptorHeap::PushConstants(VkCommandBuffer commandBuffer, const void* data, uint32_t size, uint32_t offset) const
+{
+    SOLARC_ASSERT(offset + size <= PUSH_CONSTANT_SIZE, "Push constants out of range");
+    vkCmdPushConstants(commandBuffer, m_PipelineLayout, VK_SHADER_STAGE_ALL, offset, size, data);
+}
+
+RHIDescriptorHandle VulkanDescriptorHeap::Write(RHIDescriptorType type, const VkDescriptorImageInfo* imageInfo,
+    const VkDescriptorBufferInfo* bufferInfo)
+{
+    RHIDescriptorHandle handle;
+    handle.type = type;
+    handle.index = m_Allocators[static_cast<size_t>(type)]->Allocate();
+    if (!handle.IsValid()) {
+        SOLARC_RENDER_ERROR("Descriptor heap: all {} {} slots in use",
+            m_Allocators[static_cast<size_t>(type)]->GetCapacity(), RHIDescriptorTypeToString(type));
+        return handle;
+    }
+
+    VkWriteDescriptorSet write = {};
+    write.sType = VK_STRUCTURE_TYPE_WRITE_DESCRIPTOR_SET;
+    write.dstSet = m_Set;
+    write.dstBinding = static_cast<uint32_t>(type);
+    write.dstArrayElement = handle.index;
+    write.descriptorCount = 1;
+    write.descriptorType = ToVkDescriptorType(type);
+    write.pImageInfo = imageInfo;
+    write.pBufferInfo = bufferInfo;
+
+    std::lock_guard lock(m_WriteMutex);
+    vkUpdateDescriptorSets(m_Device, 1, &write, 0, nullptr);
+    return handle;
+}
+
+VkDescriptorType VulkanDescriptorHeap::ToVkDescriptorType(RHIDescriptorType type)
+{
+    switch (type) {
+        case RHIDescriptorType::SampledImage:  return VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+        case RHIDescriptorType::StorageBuffer: return VK_DESCRIPTOR_TYPE_STORAGE_BUFFER;
+        case RHIDescriptorType::Sampler:       return VK_DESCRIPTOR_TYPE_SAMPLER;
+        default:                               break;
+    }
+    SOLARC_ASSERT(false, "Invalid descriptor type");
+    return VK_DESCRIPTOR_TYPE_SAMPLED_IMAGE;
+}
+
+#endif // SOLARC_RENDERER_VULKAN
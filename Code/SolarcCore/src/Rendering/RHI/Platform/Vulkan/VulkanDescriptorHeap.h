@@ -0,0 +1,110 @@
+#pragma once
+
+#ifdef SOLARC_RENDERER_VULKAN
+
+#include "Rendering/RHI/DescriptorHeap.h"
+#include <vulkan/vulkan.h>
+#include <array>
+#include <memory>
+#include <mutex>
+
+/**
+ * Bindless descriptor heap: one descriptor set holding large arrays of
+ * sampled images (binding 0), storage buffers (binding 1) and samplers
+ * (binding 2), plus the pipeline layout every pipeline shares (that set
+ * and PUSH_CONSTANT_SIZE bytes of push constants for all stages).
+ *
+ * The set is bound once per command buffer; draws select resources by the
+ * indices they push as constants, so per-draw cost does not grow with the
+ * number of resources. Bindings are UPDATE_AFTER_BIND, PARTIALLY_BOUND and
+ * UPDATE_UNUSED_WHILE_PENDING: descriptors can be written while the set is
+ * bound in command buffers still executing, as long as those command
+ * buffers do not use them, which the deferred frees of
+ * DescriptorIndexAllocator guarantee.
+ *
+ * Array sizes are clamped to the device's update-after-bind limits.
+ *
+ * Thread Safety: Thread-safe. Descriptor writes are serialized (writes to
+ * one set need external synchronization).
+ */
+class VulkanDescriptorHeap
+{
+public:
+    // Guaranteed minimum maxPushConstantsSize
+    static constexpr uint32_t PUSH_CONSTANT_SIZE = RHI_PUSH_CONSTANT_SIZE;
+
+    // Array sizes requested before clamping to device limits
+    static constexpr uint32_t DEFAULT_SAMPLED_IMAGES = 65536;
+    static constexpr uint32_t DEFAULT_STORAGE_BUFFERS = 65536;
+    static constexpr uint32_t DEFAULT_SAMPLERS = 1024;
+
+    /**
+     * throws std::runtime_error if the set or layouts cannot be created
+     */
+    VulkanDescriptorHeap(VkDevice device, VkPhysicalDevice physicalDevice);
+    ~VulkanDescriptorHeap();
+
+    VulkanDescriptorHeap(const VulkanDescriptorHeap&) = delete;
+    VulkanDescriptorHeap& operator=(const VulkanDescriptorHeap&) = delete;
+
+    /**
+     * Write a descriptor into a free slot of its array
+     * return Invalid handle if the array is full
+     */
+    RHIDescriptorHandle CreateSampledImage(VkImageView imageView, VkImageLayout layout);
+    RHIDescriptorHandle CreateStorageBuffer(VkBuffer buffer, VkDeviceSize offset, VkDeviceSize range);
+    RHIDescriptorHandle CreateSampler(VkSampler sampler);
+
+    /**
+     * Write one of the heap's own samplers (see RHISamplerFilter)
+     */
+    RHIDescriptorHandle CreateSampler(RHISamplerFilter filter);
+
+    /**
+     * Release a descriptor once the GPU reached 'frame' (no-op for invalid handles)
+     * param frame: Timeline value of the last submission that may use it
+     */
+    void Free(const RHIDescriptorHandle& handle, uint64_t frame);
+
+    /**
+     * Recycle descriptors freed for frames the GPU has completed
+     */
+    void Collect(uint64_t completedFrame);
+
+    /**
+     * Bind the heap at set 0 for graphics and compute
+     * note: Once per command buffer; secondaries do not inherit it
+     */
+    void Bind(VkCommandBuffer commandBuffer) const;
+
+    /**
+     * Set push constants (descriptor indices and per-draw data)
+     * param offset, size: Byte range within PUSH_CONSTANT_SIZE
+     */
+    void PushConstants(VkCommandBuffer commandBuffer, const void* data, uint32_t size, uint32_t offset = 0) const;
+
+    VkDescriptorSetLayout GetSetLayout() const { return m_SetLayout; }
+    VkPipelineLayout GetPipelineLayout() const { return m_PipelineLayout; }
+    VkDescriptorSet GetSet() const { return m_Set; }
+
+    const DescriptorIndexAllocator& GetAllocator(RHIDescriptorType type) const { return *m_Allocators[static_cast<size_t>(type)]; }
+
+private:
+    // Allocate an index of 'type' and write imageInfo (images, samplers) or bufferInfo into it
+    RHIDescriptorHandle Write(RHIDescriptorType type, const VkDescriptorImageInfo* imageInfo,
+        const VkDescriptorBufferInfo* bufferInfo);
+
+    static VkDescriptorType ToVkDescriptorType(RHIDescriptorType type);
+
+    VkDevice m_Device;
+    VkDescriptorSetLayout m_SetLayout = VK_NULL_HANDLE;
+    VkDescriptorPool m_Pool = VK_NULL_HANDLE;
+    VkDescriptorSet m_Set = VK_NULL_HANDLE;
+    VkPipelineLayout m_PipelineLayout = VK_NULL_HANDLE;
+    std::array<VkSampler, static_cast<size_t>(RHISamplerFilter::Count)> m_Samplers = {};
+
+    std::array<std::unique_ptr<DescriptorIndexAllocator>, static_cast<size_t>(RHIDescriptorType::Count)> m_Allocators;
+    std::mutex m_WriteMutex;
+};
+
+#endif // SOLARC_RENDERER_VULKAN
@@ -5,17 +5,42 @@
 #include <stdexcept>
 #include <set>
 #include <algorithm>
+#include <cctype>
+
+namespace
+{
+    const char* DeviceTypeName(VkPhysicalDeviceType type)
+    {
+        switch (type) {
+            case VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU:   return "discrete";
+            case VK_PHYSICAL_DEVICE_TYPE_INTEGRATED_GPU: return "integrated";
+            case VK_PHYSICAL_DEVICE_TYPE_VIRTUAL_GPU:    return "virtual";
+            case VK_PHYSICAL_DEVICE_TYPE_CPU:            return "CPU";
+            default:                                     return "other";
+        }
+    }
+}
 
 
-    VulkanDevice::VulkanDevice()
+    VulkanDevice::VulkanDevice(const RHIDesc& desc)
+        : m_Offscreen(desc.target == RHITarget::Offscreen)
+        , m_PreferredDevice(desc.preferredDevice)
     {
-        SOLARC_RENDER_INFO("Creating Vulkan device...");
+        SOLARC_RENDER_INFO("Creating Vulkan device{}...", m_Offscreen ? " (offscreen)" : "");
+
+        // Nothing is presented: don't require WSI support from the driver
+        if (m_Offscreen) {
+            m_DeviceExtensions.clear();
+        }
 
         CreateInstance();
         SetupDebugMessenger();
         SelectPhysicalDevice();
         CreateLogicalDevice();
         GetQueues();
+        CreateAllocator();
+        CreatePipelineCache(desc.pipelineCachePath);
+        CreateDescriptorHeap();
 
         SOLARC_RENDER_INFO("Vulkan device created successfully");
     }
@@ -26,6 +51,16 @@
 
         if (m_Device != VK_NULL_HANDLE) {
             vkDeviceWaitIdle(m_Device);
+
+            m_DescriptorHeap.reset();
+
+            // Writes the cache file while the device can still read it back
+            m_PipelineCache.reset();
+
+            // Frees every memory block before the device goes
+            m_Allocator.reset();
+            m_MemoryBackend.reset();
+
             vkDestroyDevice(m_Device, nullptr);
         }
 
@@ -159,9 +194,11 @@
         std::vector<VkPhysicalDevice> devices(deviceCount);
         vkEnumeratePhysicalDevices(m_Instance, &deviceCount, devices.data());
 
-        // Rate each device and pick the best one
+        // Rate each device and pick the best one (the best preferred one, if any matches)
         uint32_t bestScore = 0;
         VkPhysicalDevice bestDevice = VK_NULL_HANDLE;
+        uint32_t bestPreferredScore = 0;
+        VkPhysicalDevice bestPreferredDevice = VK_NULL_HANDLE;
 
         for (const auto& device : devices) {
             if (IsDeviceSuitable(device)) {
@@ -170,9 +207,20 @@
                     bestScore = score;
                     bestDevice = device;
                 }
+                if (!m_PreferredDevice.empty() && MatchesPreferredDevice(device) && score > bestPreferredScore) {
+                    bestPreferredScore = score;
+                    bestPreferredDevice = device;
+                }
             }
         }
 
+        if (bestPreferredDevice != VK_NULL_HANDLE) {
+            bestDevice = bestPreferredDevice;
+        }
+        else if (!m_PreferredDevice.empty()) {
+            SOLARC_RENDER_WARN("No suitable Vulkan device matches '{}', using the highest rated one", m_PreferredDevice);
+        }
+
         if (bestDevice == VK_NULL_HANDLE) {
             SOLARC_RENDER_ERROR("Failed to find suitable GPU");
             throw std::runtime_error("No suitable Vulkan GPU found");
@@ -184,8 +232,9 @@
         VkPhysicalDeviceProperties deviceProperties;
         vkGetPhysicalDeviceProperties(m_PhysicalDevice, &deviceProperties);
 
-        SOLARC_RENDER_INFO("Selected GPU: {} (Vulkan {}.{}.{})",
+        SOLARC_RENDER_INFO("Selected GPU: {} ({}, Vulkan {}.{}.{})",
             deviceProperties.deviceName,
+            DeviceTypeName(deviceProperties.deviceType),
             VK_VERSION_MAJOR(deviceProperties.apiVersion),
             VK_VERSION_MINOR(deviceProperties.apiVersion),
             VK_VERSION_PATCH(deviceProperties.apiVersion)
@@ -222,9 +271,49 @@
         // Device features (for Vulkan 1.3, we'll enable required features)
         VkPhysicalDeviceFeatures deviceFeatures = {};
         // Enable features as needed (currently none required for Phase 1)
+
+        // Vulkan 1.2 features
+        VkPhysicalDeviceVulkan12Features vulkan12Features = {};
+        vulkan12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+        vulkan12Features.timelineSemaphore = VK_TRUE; // Frame completion values (VulkanCommandContext)
+
+        // Descriptor indexing for the bindless heap (VulkanDescriptorHeap), if supported
+        VkPhysicalDeviceVulkan12Features supported12Features = {};
+        supported12Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_2_FEATURES;
+
+        VkPhysicalDeviceFeatures2 supportedFeatures = {};
+        supportedFeatures.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_FEATURES_2;
+        supportedFeatures.pNext = &supported12Features;
+        vkGetPhysicalDeviceFeatures2(m_PhysicalDevice, &supportedFeatures);
+
+        m_DescriptorIndexing =
+            supported12Features.descriptorIndexing &&
+            supported12Features.runtimeDescriptorArray &&
+            supported12Features.descriptorBindingPartiallyBound &&
+            supported12Features.descriptorBindingUpdateUnusedWhilePending &&
+            supported12Features.descriptorBindingSampledImageUpdateAfterBind &&
+            supported12Features.descriptorBindingStorageBufferUpdateAfterBind &&
+            supported12Features.shaderSampledImageArrayNonUniformIndexing &&
+            supported12Features.shaderStorageBufferArrayNonUniformIndexing;
+
+        if (m_DescriptorIndexing) {
+            vulkan12Features.descriptorIndexing = VK_TRUE;
+            vulkan12Features.runtimeDescriptorArray = VK_TRUE;
+            vulkan12Features.descriptorBindingPartiallyBound = VK_TRUE;
+            vulkan12Features.descriptorBindingUpdateUnusedWhilePending = VK_TRUE;
+            vulkan12Features.descriptorBindingSampledImageUpdateAfterBind = VK_TRUE;
+            vulkan12Features.descriptorBindingStorageBufferUpdateAfterBind = VK_TRUE;
+            vulkan12Features.shaderSampledImageArrayNonUniformIndexing = VK_TRUE;
+            vulkan12Features.shaderStorageBufferArrayNonUniformIndexing = VK_TRUE;
+        }
+        else {
+            SOLARC_RENDER_WARN("Device lacks descriptor indexing: no bindless descriptor heap");
+        }
+
         // Vulkan 1.3 features
         VkPhysicalDeviceVulkan13Features vulkan13Features = {};
         vulkan13Features.sType = VK_STRUCTURE_TYPE_PHYSICAL_DEVICE_VULKAN_1_3_FEATURES;
+        vulkan13Features.pNext = &vulkan12Features;
         vulkan13Features.dynamicRendering = VK_TRUE; // Enable dynamic rendering
         vulkan13Features.synchronization2 = VK_TRUE; // Enable synchronization2
 
@@ -299,7 +388,8 @@
     {
         std::vector<const char*> extensions;
 
-        // Surface extensions
+        // Surface extensions (offscreen never creates a surface)
+        if (!m_Offscreen) {
 #ifdef _WIN32
         extensions.push_back("VK_KHR_surface");
         extensions.push_back("VK_KHR_win32_surface");
@@ -307,6 +397,7 @@
         extensions.push_back("VK_KHR_surface");
         extensions.push_back("VK_KHR_wayland_surface");
 #endif
+        }
 
         // Debug extensions
 #ifdef SOLARC_DEBUG
@@ -349,6 +440,12 @@
 
         uint32_t score = 0;
 
+        // Software rasterizers (lavapipe, SwiftShader) only when nothing else is
+        // available or they are asked for by name
+        if (deviceProperties.deviceType == VK_PHYSICAL_DEVICE_TYPE_CPU) {
+            return 1;
+        }
+
         // Discrete GPUs have a significant performance advantage
         if (deviceProperties.deviceType == VK_PHYSICAL_DEVICE_TYPE_DISCRETE_GPU) {
             score += 1000;
@@ -360,6 +457,62 @@
         return score;
     }
 
+    bool VulkanDevice::MatchesPreferredDevice(VkPhysicalDevice device) const
+    {
+        VkPhysicalDeviceProperties deviceProperties;
+        vkGetPhysicalDeviceProperties(device, &deviceProperties);
+
+        auto lower = [](std::string text) {
+            std::transform(text.begin(), text.end(), text.begin(),
+                [](unsigned char c) { return static_cast<char>(std::tolower(c)); });
+            return text;
+        };
+
+        return lower(deviceProperties.deviceName).find(lower(m_PreferredDevice)) != std::string::npos;
+    }
+
+    uint32_t VulkanDevice::FindMemoryType(uint32_t typeBits, VkMemoryPropertyFlags properties) const
+    {
+        VkPhysicalDeviceMemoryProperties memoryProperties;
+        vkGetPhysicalDeviceMemoryProperties(m_PhysicalDevice, &memoryProperties);
+
+        for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; ++i) {
+            if ((typeBits & (1u << i)) &&
+                (memoryProperties.memoryTypes[i].propertyFlags & properties) == properties) {
+                return i;
+            }
+        }
+
+        throw std::runtime_error("No suitable Vulkan memory type");
+    }
+
+    void VulkanDevice::CreateAllocator()
+    {
+        // One query feeds both the backend and the allocator
+        VkPhysicalDeviceMemoryProperties memoryProperties;
+        vkGetPhysicalDeviceMemoryProperties(m_PhysicalDevice, &memoryProperties);
+
+        VkPhysicalDeviceProperties deviceProperties;
+        vkGetPhysicalDeviceProperties(m_PhysicalDevice, &deviceProperties);
+
+        m_MemoryBackend = std::make_unique<VulkanMemoryBackend>(m_Device, memoryProperties);
+        m_Allocator = std::make_unique<GPUAllocator>(
+            VulkanMemoryBackend::ToGPUMemoryProperties(memoryProperties, deviceProperties.limits.maxMemoryAllocationCount),
+            *m_MemoryBackend);
+    }
+
+    void VulkanDevice::CreatePipelineCache(const std::string& path)
+    {
+        m_PipelineCache = std::make_unique<VulkanPipelineCache>(m_Device, m_PhysicalDevice, path);
+    }
+
+    void VulkanDevice::CreateDescriptorHeap()
+    {
+        if (m_DescriptorIndexing) {
+            m_DescriptorHeap = std::make_unique<VulkanDescriptorHeap>(m_Device, m_PhysicalDevice);
+        }
+    }
+
     bool VulkanDevice::FindQueueFamilies(VkPhysicalDevice device, uint32_t& graphicsFamily, uint32_t& presentFamily)
     {
         uint32_t queueFamilyCount = 0;
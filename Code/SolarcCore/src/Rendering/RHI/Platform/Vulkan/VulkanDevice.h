@@ -3,7 +3,11 @@
 #ifdef SOLARC_RENDERER_VULKAN
 
 #include "Rendering/RHI/RHIResult.h"
+#include "Rendering/RHI/RHIDesc.h"
 #include "Window/Window.h"
+#include "VulkanMemoryBackend.h"
+#include "VulkanPipelineCache.h"
+#include "VulkanDescriptorHeap.h"
 #include <vulkan/vulkan.h>
 #include <vector>
 #include <string>
@@ -14,16 +18,19 @@
  *
  * Manages Vulkan instance, physical device, and logical device creation.
  * Enables validation layers in debug builds.
- * Prefers discrete GPU over integrated.
+ * Prefers discrete GPU over integrated. CPU implementations (lavapipe)
+ * are accepted but rated last unless picked by RHIDesc::preferredDevice.
+ * Offscreen devices enable no surface / swapchain extensions.
  */
 class VulkanDevice
 {
 public:
     /**
      * Create Vulkan device
+     * param desc: Target (offscreen skips the WSI extensions) and preferred adapter
      * throws std::runtime_error if device creation fails
      */
-    VulkanDevice();
+    explicit VulkanDevice(const RHIDesc& desc = {});
     ~VulkanDevice();
 
     // Non-copyable, non-movable
@@ -74,12 +81,47 @@ public:
      */
     VkQueue GetPresentQueue() const { return m_PresentQueue; }
 
+    /**
+     * Was the device created without surface / swapchain support?
+     */
+    bool IsOffscreen() const { return m_Offscreen; }
+
+    /**
+     * Find a memory type
+     * param typeBits: VkMemoryRequirements::memoryTypeBits of the resource
+     * param properties: Required property flags
+     * return Memory type index
+     * throws std::runtime_error if no type matches
+     */
+    uint32_t FindMemoryType(uint32_t typeBits, VkMemoryPropertyFlags properties) const;
+
+    /**
+     * Device memory sub-allocator; resource memory should come from here
+     * rather than from one vkAllocateMemory per resource
+     */
+    GPUAllocator& GetAllocator() { return *m_Allocator; }
+
+    /**
+     * Pipeline cache shared by all pipeline creation, persisted at
+     * RHIDesc::pipelineCachePath
+     */
+    VulkanPipelineCache& GetPipelineCache() { return *m_PipelineCache; }
+
+    /**
+     * Bindless descriptor heap and the pipeline layout pipelines share
+     * return nullptr if the device lacks descriptor indexing
+     */
+    VulkanDescriptorHeap* GetDescriptorHeap() { return m_DescriptorHeap.get(); }
+
 private:
     void CreateInstance();
     void SetupDebugMessenger();
     void SelectPhysicalDevice();
     void CreateLogicalDevice();
     void GetQueues();
+    void CreateAllocator();
+    void CreatePipelineCache(const std::string& path);
+    void CreateDescriptorHeap();
 
     // Helper methods
     bool CheckValidationLayerSupport();
@@ -87,6 +129,7 @@ private:
     bool IsDeviceSuitable(VkPhysicalDevice device);
     uint32_t RateDeviceSuitability(VkPhysicalDevice device);
     bool FindQueueFamilies(VkPhysicalDevice device, uint32_t& graphicsFamily, uint32_t& presentFamily);
+    bool MatchesPreferredDevice(VkPhysicalDevice device) const;
 
     // Debug callback
     static VKAPI_ATTR VkBool32 VKAPI_CALL DebugCallback(
@@ -106,6 +149,15 @@ private:
     uint32_t m_GraphicsQueueFamilyIndex = UINT32_MAX;
     uint32_t m_PresentQueueFamilyIndex = UINT32_MAX;
 
+    std::unique_ptr<VulkanMemoryBackend> m_MemoryBackend;
+    std::unique_ptr<GPUAllocator> m_Allocator;
+    std::unique_ptr<VulkanPipelineCache> m_PipelineCache;
+    std::unique_ptr<VulkanDescriptorHeap> m_DescriptorHeap;
+
+    bool m_Offscreen = false;
+    bool m_DescriptorIndexing = false;  // Vulkan 1.2 descriptor indexing features enabled
+    std::string m_PreferredDevice;
+
 #ifdef SOLARC_DEBUG_BUILD
     VkDebugUtilsMessengerEXT m_DebugMessenger = VK_NULL_HANDLE;
 
@@ -115,8 +167,8 @@ private:
     };
 #endif
 
-    // Required device extensions
-    const std::vector<const char*> m_DeviceExtensions = {
+    // Required device extensions (none when offscreen)
+    std::vector<const char*> m_DeviceExtensions = {
         VK_KHR_SWAPCHAIN_EXTENSION_NAME
     };
 };
@@ -0,0 +1,67 @@
+#ifdef SOLARC_RENDERER_VULKAN
+
+#include "VulkanMemoryBackend.h"
+#include "Rendering/RHI/RHIResult.h"
+#include "Logging/LogMacros.h"
+
+VulkanMemoryBackend::VulkanMemoryBackend(VkDevice device, const VkPhysicalDeviceMemoryProperties& memoryProperties)
+    : m_Device(device)
+    , m_MemoryProperties(memoryProperties)
+{
+}
+
+bool VulkanMemoryBackend::AllocateMemory(uint32_t memoryType, uint64_t size, GPUDeviceMemory& memory, void*& mapped)
+{
+    VkMemoryAllocateInfo allocInfo = {};
+    allocInfo.sType = VK_STRUCTURE_TYPE_MEMORY_ALLOCATE_INFO;
+    allocInfo.allocationSize = size;
+    allocInfo.memoryTypeIndex = memoryType;
+
+    VkDeviceMemory vkMemory = VK_NULL_HANDLE;
+    VkResult result = vkAllocateMemory(m_Device, &allocInfo, nullptr, &vkMemory);
+    if (result != VK_SUCCESS) {
+        // Out of memory is expected here; the allocator falls back
+        auto rhiResult = ToRHIResult(result, "vkAllocateMemory");
+        SOLARC_RENDER_DEBUG("vkAllocateMemory ({} bytes, type {}) failed: {}",
+            size, memoryType, rhiResult.GetResultMessage());
+        return false;
+    }
+
+    mapped = nullptr;
+    if (m_MemoryProperties.memoryTypes[memoryType].propertyFlags & VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT) {
+        result = vkMapMemory(m_Device, vkMemory, 0, VK_WHOLE_SIZE, 0, &mapped);
+        if (result != VK_SUCCESS) {
+            auto rhiResult = ToRHIResult(result, "vkMapMemory");
+            SOLARC_RENDER_ERROR("Failed to map host-visible memory: {}", rhiResult.GetResultMessage());
+            vkFreeMemory(m_Device, vkMemory, nullptr);
+            return false;
+        }
+    }
+
+    memory = ToGPUMemory(vkMemory);
+    return true;
+}
+
+void VulkanMemoryBackend::FreeMemory(uint32_t /*memoryType*/, GPUDeviceMemory memory)
+{
+    // Freeing unmaps implicitly
+    vkFreeMemory(m_Device, ToVkMemory(memory), nullptr);
+}
+
+GPUMemoryProperties VulkanMemoryBackend::ToGPUMemoryProperties(const VkPhysicalDeviceMemoryProperties& memoryProperties,
+    uint32_t maxAllocationCount)
+{
+    GPUMemoryProperties properties;
+    for (uint32_t i = 0; i < memoryProperties.memoryTypeCount; ++i) {
+        properties.types.push_back({ memoryProperties.memoryTypes[i].propertyFlags,
+            memoryProperties.memoryTypes[i].heapIndex });
+    }
+    for (uint32_t i = 0; i < memoryProperties.memoryHeapCount; ++i) {
+        properties.heaps.push_back({ memoryProperties.memoryHeaps[i].size });
+    }
+    properties.maxAllocationCount = maxAllocationCount;
+
+    return properties;
+}
+
+#endif // SOLARC_RENDERER_VULKAN
@@ -0,0 +1,38 @@
+#pragma once
+
+#ifdef SOLARC_RENDERER_VULKAN
+
+#include "Rendering/RHI/GPUAllocator.h"
+#include <vulkan/vulkan.h>
+
+/**
+ * GPUMemoryBackend over vkAllocateMemory / vkFreeMemory.
+ *
+ * Host-visible memory objects are mapped whole for their lifetime, so
+ * sub-allocations in them are CPU-writable without vkMapMemory calls.
+ */
+class VulkanMemoryBackend final : public GPUMemoryBackend
+{
+public:
+    VulkanMemoryBackend(VkDevice device, const VkPhysicalDeviceMemoryProperties& memoryProperties);
+
+    bool AllocateMemory(uint32_t memoryType, uint64_t size, GPUDeviceMemory& memory, void*& mapped) override;
+    void FreeMemory(uint32_t memoryType, GPUDeviceMemory memory) override;
+
+    /**
+     * Memory types, heaps and allocation count limit as the allocator sees them
+     * param memoryProperties: Queried once by the device, shared with the constructor
+     * param maxAllocationCount: VkPhysicalDeviceLimits::maxMemoryAllocationCount
+     */
+    static GPUMemoryProperties ToGPUMemoryProperties(const VkPhysicalDeviceMemoryProperties& memoryProperties,
+        uint32_t maxAllocationCount);
+
+    static GPUDeviceMemory ToGPUMemory(VkDeviceMemory memory) { return (GPUDeviceMemory)memory; }
+    static VkDeviceMemory ToVkMemory(GPUDeviceMemory memory) { return (VkDeviceMemory)memory; }
+
+private:
+    VkDevice m_Device;
+    VkPhysicalDeviceMemoryProperties m_MemoryProperties;
+};
+
+#endif // SOLARC_RENDERER_VULKAN
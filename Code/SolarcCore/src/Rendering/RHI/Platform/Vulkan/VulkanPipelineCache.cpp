@@ -0,0 +1,147 @@
+#ifdef SOLARC_RENDERER_VULKAN
+
+#include "VulkanPipelineCache.h"
+#include "Rendering/RHI/RHIResult.h"
+#include "Logging/LogMacros.h"
+#include <cstring>
+#include <stdexcept>
+#include <vector>
+
+namespace
+{
+    // Chain creation feedback in front of the caller's pNext chain
+    template<typename CreateInfo, typename CreateFunction>
+    PipelineCompileResult CreatePipeline(const CreateInfo& createInfo, const char* function, CreateFunction create)
+    {
+        VkPipelineCreationFeedback feedback = {};
+
+        VkPipelineCreationFeedbackCreateInfo feedbackInfo = {};
+        feedbackInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CREATION_FEEDBACK_CREATE_INFO;
+        feedbackInfo.pNext = createInfo.pNext;
+        feedbackInfo.pPipelineCreationFeedback = &feedback;
+
+        CreateInfo info = createInfo;
+        info.pNext = &feedbackInfo;
+
+        VkPipeline pipeline = VK_NULL_HANDLE;
+        VkResult result = create(info, pipeline);
+        if (result != VK_SUCCESS) {
+            auto rhiResult = ToRHIResult(result, function);
+            SOLARC_RENDER_ERROR("Failed to create pipeline: {}", rhiResult.GetResultMessage());
+            return {};
+        }
+
+        PipelineCompileResult compiled;
+        compiled.pipeline = VulkanPipelineCache::ToRHIPipeline(pipeline);
+        compiled.cacheHit = (feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_VALID_BIT) &&
+            (feedback.flags & VK_PIPELINE_CREATION_FEEDBACK_APPLICATION_PIPELINE_CACHE_HIT_BIT);
+        return compiled;
+    }
+}
+
+VulkanPipelineCache::VulkanPipelineCache(VkDevice device, VkPhysicalDevice physicalDevice, std::string path)
+    : m_Device(device)
+    , m_DeviceInfo(GetDeviceInfo(physicalDevice))
+    , m_Path(std::move(path))
+{
+    std::vector<uint8_t> data;
+    if (!m_Path.empty()) {
+        PipelineCacheLoadResult loaded = PipelineCacheFile::Load(m_Path, m_DeviceInfo, data);
+        if (loaded == PipelineCacheLoadResult::Loaded) {
+            SOLARC_RENDER_INFO("Pipeline cache: loaded {} KiB from '{}'", data.size() / 1024, m_Path);
+        }
+        else if (loaded == PipelineCacheLoadResult::Missing) {
+            SOLARC_RENDER_INFO("Pipeline cache: '{}' not found, starting empty", m_Path);
+        }
+        else {
+            SOLARC_RENDER_WARN("Pipeline cache: discarding '{}' ({})", m_Path, PipelineCacheLoadResultToString(loaded));
+        }
+    }
+
+    VkPipelineCacheCreateInfo createInfo = {};
+    createInfo.sType = VK_STRUCTURE_TYPE_PIPELINE_CACHE_CREATE_INFO;
+    createInfo.initialDataSize = data.size();
+    createInfo.pInitialData = data.empty() ? nullptr : data.data();
+
+    VkResult result = vkCreatePipelineCache(m_Device, &createInfo, nullptr, &m_Cache);
+    if (result != VK_SUCCESS && !data.empty()) {
+        // The driver rejected data that passed our checks: start empty
+        SOLARC_RENDER_WARN("Pipeline cache: driver rejected the cached data, starting empty");
+        createInfo.initialDataSize = 0;
+        createInfo.pInitialData = nullptr;
+        result = vkCreatePipelineCache(m_Device, &createInfo, nullptr, &m_Cache);
+    }
+
+    if (result != VK_SUCCESS) {
+        auto rhiResult = ToRHIResult(result, "vkCreatePipelineCache");
+        SOLARC_RENDER_ERROR("Failed to create pipeline cache: {}", rhiResult.GetResultMessage());
+        throw std::runtime_error("Failed to create Vulkan pipeline cache");
+    }
+}
+
+VulkanPipelineCache::~VulkanPipelineCache()
+{
+    if (m_Cache != VK_NULL_HANDLE) {
+        Save();
+        vkDestroyPipelineCache(m_Device, m_Cache, nullptr);
+    }
+}
+
+bool VulkanPipelineCache::Save()
+{
+    if (m_Path.empty()) {
+        return false;
+    }
+
+    size_t size = 0;
+    VkResult result = vkGetPipelineCacheData(m_Device, m_Cache, &size, nullptr);
+    std::vector<uint8_t> data(size);
+    if (result == VK_SUCCESS && size > 0) {
+        result = vkGetPipelineCacheData(m_Device, m_Cache, &size, data.data());
+    }
+
+    if (result != VK_SUCCESS) {
+        auto rhiResult = ToRHIResult(result, "vkGetPipelineCacheData");
+        SOLARC_RENDER_WARN("Pipeline cache: could not read cache data: {}", rhiResult.GetResultMessage());
+        return false;
+    }
+
+    if (!PipelineCacheFile::Save(m_Path, m_DeviceInfo, data.data(), size)) {
+        SOLARC_RENDER_WARN("Pipeline cache: could not write '{}'", m_Path);
+        return false;
+    }
+
+    SOLARC_RENDER_DEBUG("Pipeline cache: saved {} KiB to '{}'", size / 1024, m_Path);
+    return true;
+}
+
+PipelineCompileResult VulkanPipelineCache::CreateGraphicsPipeline(const VkGraphicsPipelineCreateInfo& createInfo) const
+{
+    return CreatePipeline(createInfo, "vkCreateGraphicsPipelines",
+        [this](const VkGraphicsPipelineCreateInfo& info, VkPipeline& pipeline) {
+            return vkCreateGraphicsPipelines(m_Device, m_Cache, 1, &info, nullptr, &pipeline);
+        });
+}
+
+PipelineCompileResult VulkanPipelineCache::CreateComputePipeline(const VkComputePipelineCreateInfo& createInfo) const
+{
+    return CreatePipeline(createInfo, "vkCreateComputePipelines",
+        [this](const VkComputePipelineCreateInfo& info, VkPipeline& pipeline) {
+            return vkCreateComputePipelines(m_Device, m_Cache, 1, &info, nullptr, &pipeline);
+        });
+}
+
+PipelineCacheDeviceInfo VulkanPipelineCache::GetDeviceInfo(VkPhysicalDevice physicalDevice)
+{
+    VkPhysicalDeviceProperties deviceProperties;
+    vkGetPhysicalDeviceProperties(physicalDevice, &deviceProperties);
+
+    PipelineCacheDeviceInfo info;
+    info.vendorID = deviceProperties.vendorID;
+    info.deviceID = deviceProperties.deviceID;
+    info.driverVersion = deviceProperties.driverVersion;
+    std::memcpy(info.uuid.data(), deviceProperties.pipelineCacheUUID, info.uuid.size());
+    return info;
+}
+
+#endif // SOLARC_RENDERER_VULKAN
@@ -0,0 +1,67 @@
+#pragma once
+
+#ifdef SOLARC_RENDERER_VULKAN
+
+#include "Rendering/RHI/PipelineCache.h"
+#include "Rendering/RHI/PipelineCompileQueue.h"
+#include <vulkan/vulkan.h>
+#include <string>
+
+/**
+ * VkPipelineCache persisted across runs.
+ *
+ * Loads the cache file at creation (see PipelineCacheFile; a cache from
+ * another device or driver version is discarded) and writes it back on
+ * Save() and destruction, so pipelines compiled in one run are cache hits
+ * in the next.
+ *
+ * Thread Safety: Thread-safe (the VkPipelineCache is internally synchronized).
+ */
+class VulkanPipelineCache
+{
+public:
+    /**
+     * param path: Cache file; empty = in-memory cache only
+     * throws std::runtime_error if the cache object cannot be created
+     */
+    VulkanPipelineCache(VkDevice device, VkPhysicalDevice physicalDevice, std::string path);
+
+    /**
+     * Saves, then destroys the cache object
+     */
+    ~VulkanPipelineCache();
+
+    VulkanPipelineCache(const VulkanPipelineCache&) = delete;
+    VulkanPipelineCache& operator=(const VulkanPipelineCache&) = delete;
+
+    /**
+     * Write the cache file
+     * return false if there is no file or it could not be written
+     */
+    bool Save();
+
+    VkPipelineCache GetHandle() const { return m_Cache; }
+
+    /**
+     * Create a pipeline through the cache, reporting cache hits via
+     * pipeline creation feedback
+     * return Failed result (pipeline == 0) on error
+     * note: Suitable as a PipelineCompileFunction body
+     */
+    PipelineCompileResult CreateGraphicsPipeline(const VkGraphicsPipelineCreateInfo& createInfo) const;
+    PipelineCompileResult CreateComputePipeline(const VkComputePipelineCreateInfo& createInfo) const;
+
+    // What a cache file must have been written by to be loaded
+    static PipelineCacheDeviceInfo GetDeviceInfo(VkPhysicalDevice physicalDevice);
+
+    static RHIPipelineHandle ToRHIPipeline(VkPipeline pipeline) { return (RHIPipelineHandle)pipeline; }
+    static VkPipeline ToVkPipeline(RHIPipelineHandle pipeline) { return (VkPipeline)pipeline; }
+
+private:
+    VkDevice m_Device;
+    VkPipelineCache m_Cache = VK_NULL_HANDLE;
+    PipelineCacheDeviceInfo m_DeviceInfo;
+    std::string m_Path;
+};
+
+#endif // SOLARC_RENDERER_VULKAN
@@ -12,14 +12,19 @@
 #include <vulkan/vulkan_wayland.h>
 #endif
 
-    VulkanSwapchain::VulkanSwapchain(VulkanDevice* device, std::shared_ptr<Window> window)
+    VulkanSwapchain::VulkanSwapchain(VulkanDevice* device, std::shared_ptr<Window> window, uint32_t framesInFlight)
         : m_Device(device)
         , m_Window(window)
+        , m_FramesInFlight(framesInFlight)
+        , m_Offscreen(device && device->IsOffscreen())
     {
         SOLARC_ASSERT(device != nullptr, "Device cannot be null");
         SOLARC_ASSERT(window != nullptr, "Window cannot be null");
-        m_SwapchainExtent.width = static_cast<uint32_t>(window->GetWidth());
-        m_SwapchainExtent.height = static_cast<uint32_t>(window->GetHeight());
+        SOLARC_ASSERT(framesInFlight > 0, "Frames in flight cannot be zero");
+        // Buffer size, not logical size (fractional scale / render scale, see SurfaceScale)
+        const SurfaceExtent extent = window->GetBufferExtent();
+        m_SwapchainExtent.width = static_cast<uint32_t>(extent.width);
+        m_SwapchainExtent.height = static_cast<uint32_t>(extent.height);
         SOLARC_RENDER_DEBUG("Vulkan swapchain wrapper created (deferred init)");
     }
 
@@ -29,20 +34,19 @@
             return RHIResult(RHIStatus::SUCCESS);
         }
 
+        // Offscreen images only need a size, not a visible surface
         auto window = m_Window.lock();
-        if (!window || !window->IsVisible() || window->IsMinimized() ||
+        if (!window || (!m_Offscreen && (!window->IsVisible() || window->IsMinimized())) ||
             window->GetWidth() <= 0 || window->GetHeight() <= 0) {
             return RHIResult(RHIStatus::SWAPCHAIN_OUT_OF_DATE, "Window not ready for rendering");
         }
 
         try {
-            SOLARC_RENDER_INFO("Creating Vulkan swapchain ({}x{})",
+            SOLARC_RENDER_INFO("Creating Vulkan {} ({}x{})", m_Offscreen ? "offscreen target" : "swapchain",
                 m_SwapchainExtent.width, m_SwapchainExtent.height);
             CreateSurface();
             CreateSwapchain();
             CreateImageViews();
-            CreateRenderPass();
-            CreateFramebuffers();
             CreateSyncObjects();
             m_IsInitialized = true;
             SOLARC_RENDER_INFO("Vulkan swapchain initialized successfully");
@@ -58,6 +62,11 @@
     {
         SOLARC_RENDER_TRACE("Destroying Vulkan swapchain");
 
+    #ifdef __linux__
+        // Listener user data points into this object
+        DestroyPendingFeedback();
+    #endif
+
         VkDevice device = m_Device->GetDevice();
 
         // Wait for device to be idle
@@ -82,6 +91,10 @@
 
     void VulkanSwapchain::CreateSurface()
     {
+        if (m_Offscreen) {
+            return;
+        }
+
         SOLARC_RENDER_DEBUG("Creating Vulkan surface");
 
         auto window = m_Window.lock();
@@ -143,6 +156,11 @@
 
     void VulkanSwapchain::CreateSwapchain()
     {
+        if (m_Offscreen) {
+            CreateOffscreenTargets();
+            return;
+        }
+
         SOLARC_RENDER_DEBUG("Creating Vulkan swapchain");
 
         VkPhysicalDevice physicalDevice = m_Device->GetPhysicalDevice();
@@ -170,8 +188,9 @@
         m_SwapchainImageFormat = surfaceFormat.format;
         m_SwapchainExtent = extent;
 
-        // Image count (prefer triple buffering if available)
-        uint32_t imageCount = capabilities.minImageCount + 1;
+        // Image count (prefer triple buffering if available); one image per
+        // frame in flight plus the one on screen keeps acquire from blocking
+        uint32_t imageCount = std::max(capabilities.minImageCount + 1, m_FramesInFlight + 1);
         if (capabilities.maxImageCount > 0 && imageCount > capabilities.maxImageCount) {
             imageCount = capabilities.maxImageCount;
         }
@@ -259,95 +278,21 @@
         SOLARC_RENDER_DEBUG("Created {} image views", m_SwapchainImageViews.size());
     }
 
-    void VulkanSwapchain::CreateRenderPass()
-    {
-        SOLARC_RENDER_DEBUG("Creating render pass");
-
-        VkAttachmentDescription colorAttachment = {};
-        colorAttachment.format = m_SwapchainImageFormat;
-        colorAttachment.samples = VK_SAMPLE_COUNT_1_BIT;
-        colorAttachment.loadOp = VK_ATTACHMENT_LOAD_OP_CLEAR; // Clear on load
-        colorAttachment.storeOp = VK_ATTACHMENT_STORE_OP_STORE;
-        colorAttachment.stencilLoadOp = VK_ATTACHMENT_LOAD_OP_DONT_CARE;
-        colorAttachment.stencilStoreOp = VK_ATTACHMENT_STORE_OP_DONT_CARE;
-        colorAttachment.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
-        colorAttachment.finalLayout = VK_IMAGE_LAYOUT_PRESENT_SRC_KHR;
-
-        VkAttachmentReference colorAttachmentRef = {};
-        colorAttachmentRef.attachment = 0;
-        colorAttachmentRef.layout = VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL;
-
-        VkSubpassDescription subpass = {};
-        subpass.pipelineBindPoint = VK_PIPELINE_BIND_POINT_GRAPHICS;
-        subpass.colorAttachmentCount = 1;
-        subpass.pColorAttachments = &colorAttachmentRef;
-
-        // Subpass dependency for layout transitions
-        VkSubpassDependency dependency = {};
-        dependency.srcSubpass = VK_SUBPASS_EXTERNAL;
-        dependency.dstSubpass = 0;
-        dependency.srcStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-        dependency.srcAccessMask = 0;
-        dependency.dstStageMask = VK_PIPELINE_STAGE_COLOR_ATTACHMENT_OUTPUT_BIT;
-        dependency.dstAccessMask = VK_ACCESS_COLOR_ATTACHMENT_WRITE_BIT;
-
-        VkRenderPassCreateInfo renderPassInfo = {};
-        renderPassInfo.sType = VK_STRUCTURE_TYPE_RENDER_PASS_CREATE_INFO;
-        renderPassInfo.attachmentCount = 1;
-        renderPassInfo.pAttachments = &colorAttachment;
-        renderPassInfo.subpassCount = 1;
-        renderPassInfo.pSubpasses = &subpass;
-        renderPassInfo.dependencyCount = 1;
-        renderPassInfo.pDependencies = &dependency;
-
-        VkResult result = vkCreateRenderPass(m_Device->GetDevice(), &renderPassInfo, nullptr, &m_RenderPass);
-        if (result != VK_SUCCESS) {
-            auto rhiResult = ToRHIResult(result, "vkCreateRenderPass");
-            SOLARC_RENDER_ERROR("Failed to create render pass: {}", rhiResult.GetResultMessage());
-            throw std::runtime_error("Failed to create Vulkan render pass");
-        }
-
-        SOLARC_RENDER_DEBUG("Render pass created");
-    }
-
-    void VulkanSwapchain::CreateFramebuffers()
+    void VulkanSwapchain::CreateSyncObjects()
     {
-        SOLARC_RENDER_DEBUG("Creating framebuffers");
-
-        m_Framebuffers.resize(m_SwapchainImageViews.size());
-
-        for (size_t i = 0; i < m_SwapchainImageViews.size(); ++i) {
-            VkImageView attachments[] = { m_SwapchainImageViews[i] };
-
-            VkFramebufferCreateInfo framebufferInfo = {};
-            framebufferInfo.sType = VK_STRUCTURE_TYPE_FRAMEBUFFER_CREATE_INFO;
-            framebufferInfo.renderPass = m_RenderPass;
-            framebufferInfo.attachmentCount = 1;
-            framebufferInfo.pAttachments = attachments;
-            framebufferInfo.width = m_SwapchainExtent.width;
-            framebufferInfo.height = m_SwapchainExtent.height;
-            framebufferInfo.layers = 1;
-            VkResult result = vkCreateFramebuffer(m_Device->GetDevice(), &framebufferInfo, nullptr, &m_Framebuffers[i]);
-            if (result != VK_SUCCESS) {
-                auto rhiResult = ToRHIResult(result, "vkCreateFramebuffer");
-                SOLARC_RENDER_ERROR("Failed to create framebuffer {}: {}", i, rhiResult.GetResultMessage());
-                throw std::runtime_error("Failed to create framebuffers");
-            }
+        // Offscreen frames are ordered by the command context's timeline alone
+        if (m_Offscreen) {
+            return;
         }
 
-        SOLARC_RENDER_DEBUG("Created {} framebuffers", m_Framebuffers.size());
-    }
-
-    void VulkanSwapchain::CreateSyncObjects()
-    {
         SOLARC_RENDER_DEBUG("Creating synchronization objects");
 
         // Create image available semaphores (per frame-in-flight)
-        m_ImageAvailableSemaphores.resize(MAX_FRAMES_IN_FLIGHT);
+        m_ImageAvailableSemaphores.resize(m_FramesInFlight);
         VkSemaphoreCreateInfo semaphoreInfo{};
         semaphoreInfo.sType = VK_STRUCTURE_TYPE_SEMAPHORE_CREATE_INFO;
 
-        for (size_t i = 0; i < MAX_FRAMES_IN_FLIGHT; ++i) {
+        for (size_t i = 0; i < m_FramesInFlight; ++i) {
             VkResult result = vkCreateSemaphore(
                 m_Device->GetDevice(), &semaphoreInfo, nullptr,
                 &m_ImageAvailableSemaphores[i]
@@ -380,16 +325,6 @@
     {
         VkDevice device = m_Device->GetDevice();
 
-        for (auto framebuffer : m_Framebuffers) {
-            vkDestroyFramebuffer(device, framebuffer, nullptr);
-        }
-        m_Framebuffers.clear();
-
-        if (m_RenderPass != VK_NULL_HANDLE) {
-            vkDestroyRenderPass(device, m_RenderPass, nullptr);
-            m_RenderPass = VK_NULL_HANDLE;
-        }
-
         for (auto imageView : m_SwapchainImageViews) {
             vkDestroyImageView(device, imageView, nullptr);
         }
@@ -400,11 +335,19 @@
             m_Swapchain = VK_NULL_HANDLE;
         }
 
+        if (m_Offscreen) {
+            DestroyOffscreenTargets();
+        }
+
         m_SwapchainImages.clear();
     }
 
     RHIResult VulkanSwapchain::AcquireNextImage()
     {
+        if (m_Offscreen) {
+            return OffscreenAcquireNextImage();
+        }
+
         VkSemaphore imageAvailableSemaphore = m_ImageAvailableSemaphores[m_CurrentFrame];
 
         VkResult result = vkAcquireNextImageKHR(
@@ -430,8 +373,19 @@
         return RHIResult(RHIStatus::SUCCESS);
     }
 
-    RHIResult VulkanSwapchain::Present(bool vsync)
+    RHIResult VulkanSwapchain::Present(bool vsync, std::chrono::steady_clock::time_point frameStart)
     {
+        if (m_Offscreen) {
+            return OffscreenPresent();
+        }
+
+    #ifdef __linux__
+        // Feedback is surface state applied by the next commit, which the
+        // WSI makes inside vkQueuePresentKHR: request it before presenting
+        if (auto window = m_Window.lock())
+            RequestPresentFeedback(window->GetPlatform()->GetWaylandSurface(), frameStart);
+    #endif
+
         VkSemaphore renderFinishedSemaphore = m_RenderFinishedSemaphores[m_CurrentImageIndex];
 
         VkPresentInfoKHR presentInfo{};
@@ -480,6 +434,93 @@
         swapchain->m_FrameCallback = nullptr;
         swapchain->m_WaitingForFrame = false;
     }
+
+    // ========================================================================
+    // Presentation Feedback (wp_presentation)
+    // ========================================================================
+
+    const wp_presentation_feedback_listener VulkanSwapchain::s_PresentationFeedbackListener = {
+        .sync_output = feedback_sync_output,
+        .presented = feedback_presented,
+        .discarded = feedback_discarded
+    };
+
+    bool VulkanSwapchain::HasPresentFeedback() const
+    {
+        return !m_Offscreen && WindowContextPlatform::Get().GetPresentation() != nullptr;
+    }
+
+    void VulkanSwapchain::RequestPresentFeedback(wl_surface* surface, std::chrono::steady_clock::time_point frameStart)
+    {
+        wp_presentation* presentation = WindowContextPlatform::Get().GetPresentation();
+        if (!m_PresentTiming || !presentation || !surface)
+            return;
+
+        auto slot = std::find_if(m_PendingFeedback.begin(), m_PendingFeedback.end(),
+            [](const PendingPresentFeedback& pending) { return pending.feedback == nullptr; });
+        if (slot == m_PendingFeedback.end()) {
+            SOLARC_RENDER_TRACE("Presentation feedback pool exhausted; frame not timed");
+            return;
+        }
+
+        slot->swapchain = this;
+        slot->frameStart = frameStart;
+        slot->presentTime = std::chrono::steady_clock::now();
+        slot->feedback = wp_presentation_feedback(presentation, surface);
+        wp_presentation_feedback_add_listener(slot->feedback, &s_PresentationFeedbackListener, &*slot);
+    }
+
+    void VulkanSwapchain::DestroyPendingFeedback()
+    {
+        for (auto& pending : m_PendingFeedback) {
+            if (pending.feedback) {
+                wp_presentation_feedback_destroy(pending.feedback);
+                pending.feedback = nullptr;
+            }
+        }
+    }
+
+    void VulkanSwapchain::feedback_sync_output(void*, struct wp_presentation_feedback*, wl_output*)
+    {
+    }
+
+    void VulkanSwapchain::feedback_presented(void* data, struct wp_presentation_feedback* feedback,
+        uint32_t tvSecHi, uint32_t tvSecLo, uint32_t tvNsec, uint32_t refresh,
+        uint32_t, uint32_t, uint32_t flags)
+    {
+        auto* pending = static_cast<PendingPresentFeedback*>(data);
+        wp_presentation_feedback_destroy(feedback);
+        pending->feedback = nullptr;
+
+        PresentTimingModel* model = pending->swapchain->m_PresentTiming;
+        if (!model)
+            return;
+
+        const uint64_t seconds = (static_cast<uint64_t>(tvSecHi) << 32) | tvSecLo;
+
+        PresentFeedback sample;
+        sample.frameStart = pending->frameStart;
+        sample.presentTime = pending->presentTime;
+        sample.displayTime = WindowContextPlatform::Get().PresentationTimeToSteady(seconds, tvNsec);
+        sample.refreshInterval = std::chrono::nanoseconds(refresh);
+        sample.zeroCopy = (flags & WP_PRESENTATION_FEEDBACK_KIND_ZERO_COPY) != 0;
+        model->OnPresented(sample);
+    }
+
+    void VulkanSwapchain::feedback_discarded(void* data, struct wp_presentation_feedback* feedback)
+    {
+        auto* pending = static_cast<PendingPresentFeedback*>(data);
+        wp_presentation_feedback_destroy(feedback);
+        pending->feedback = nullptr;
+
+        if (PresentTimingModel* model = pending->swapchain->m_PresentTiming)
+            model->OnDiscarded();
+    }
+#else
+    bool VulkanSwapchain::HasPresentFeedback() const
+    {
+        return false;
+    }
 #endif
 
     RHIResult VulkanSwapchain::Resize(uint32_t width, uint32_t height)
@@ -505,7 +546,12 @@
     void VulkanSwapchain::ReleaseBackBuffers()
     {
         SOLARC_RENDER_TRACE("Releasing swapchain back buffers");
-        vkDeviceWaitIdle(m_Device->GetDevice());
+
+        // Rendering was waited on via the timeline (RHI::ResizeSwapchain);
+        // only pending presents can still reference the images
+        if (!m_Offscreen) {
+            vkQueueWaitIdle(m_Device->GetPresentQueue());
+        }
         CleanupSwapchain();
     }
 
@@ -515,8 +561,6 @@
 
         CreateSwapchain();
         CreateImageViews();
-        CreateRenderPass();
-        CreateFramebuffers();
 
         SOLARC_RENDER_DEBUG("Swapchain back buffers recreated");
     }
@@ -531,11 +575,6 @@
         return m_SwapchainImageViews[m_CurrentImageIndex];
     }
 
-    VkFramebuffer VulkanSwapchain::GetCurrentFramebuffer() const
-    {
-        return m_Framebuffers[m_CurrentImageIndex];
-    }
-
     VkSurfaceFormatKHR VulkanSwapchain::ChooseSwapSurfaceFormat(const std::vector<VkSurfaceFormatKHR>& availableFormats)
     {
         // Prefer BGRA8_UNORM with SRGB color space
@@ -5,12 +5,16 @@
 #include "VulkanDevice.h"
 #include "Rendering/RHI/RHIResult.h"
 #include "Window/Window.h"
+#include "Utility/PresentTimingModel.h"
 #include <vulkan/vulkan.h>
+#include <array>
+#include <chrono>
 #include <vector>
 #include <memory>
 #ifdef __linux__
 #include <wayland-client.h>
 #include "xdg-shell-client-protocol.h"
+#include "presentation-time-client-protocol.h"
 #endif
 
 
@@ -20,11 +24,21 @@
      *
      * Manages swapchain, surface, and image views for presenting to window.
      * Handles resize and format selection.
+     *
+     * Frames render with dynamic rendering straight into the image views:
+     * there is no VkRenderPass or VkFramebuffer, so a resize only recreates
+     * the images and their views. The RHI moves each image into
+     * COLOR_ATTACHMENT_OPTIMAL after acquire and out to PRESENT_SRC (or
+     * TRANSFER_SRC offscreen) before submit.
+     *
+     * On an offscreen device (VulkanDevice::IsOffscreen) there is no surface:
+     * the "swapchain" is a ring of device images sized like the window's
+     * buffer, each with a host-visible readback buffer the frame is copied
+     * into (RecordReadback). Acquire/Present only rotate the ring.
      */
     class VulkanSwapchain
     {
     public:
-        static constexpr uint32_t MAX_FRAMES_IN_FLIGHT = 2; // Double-buffered
         static constexpr VkFormat PREFERRED_FORMAT = VK_FORMAT_B8G8R8A8_UNORM;
         static constexpr VkColorSpaceKHR PREFERRED_COLOR_SPACE = VK_COLOR_SPACE_SRGB_NONLINEAR_KHR;
 
@@ -32,9 +46,10 @@
          * Create swapchain for given window
          * param device: Vulkan device
          * param window: Target window
+         * param framesInFlight: The command context's frames in flight (one acquire semaphore each)
          * throws std::runtime_error if creation fails
          */
-        VulkanSwapchain(VulkanDevice* device, std::shared_ptr<Window> window);
+        VulkanSwapchain(VulkanDevice* device, std::shared_ptr<Window> window, uint32_t framesInFlight);
         ~VulkanSwapchain();
 
         // Non-copyable, non-movable
@@ -51,9 +66,11 @@
 
         /**
          * Advance frame
+         * note: Call after every command context EndFrame so the acquire
+         *       semaphores stay on the command context's frame index
          */
         void AdvanceFrame() {
-            m_CurrentFrame = (m_CurrentFrame + 1) % MAX_FRAMES_IN_FLIGHT;
+            m_CurrentFrame = (m_CurrentFrame + 1) % m_FramesInFlight;
         }
 
         /**
@@ -74,25 +91,13 @@
          */
         VkImageView GetCurrentImageView() const;
 
-        /**
-         * Get the current framebuffer
-         * return VkFramebuffer handle
-         */
-        VkFramebuffer GetCurrentFramebuffer() const;
-
-        /**
-         * Get the render pass
-         * return VkRenderPass handle
-         */
-        VkRenderPass GetRenderPass() const { return m_RenderPass; }
-
         /**
          * Get image available semaphore for current frame
          * return VkSemaphore handle
          */
         VkSemaphore GetImageAvailableSemaphore() const
         {
-            return m_ImageAvailableSemaphores[m_CurrentFrame];
+            return m_Offscreen ? VK_NULL_HANDLE : m_ImageAvailableSemaphores[m_CurrentFrame];
         }
 
 
@@ -102,16 +107,28 @@
          */
         VkSemaphore GetRenderFinishedSemaphoreForImage() const 
         {
-            return m_RenderFinishedSemaphores[m_CurrentImageIndex];
+            return m_Offscreen ? VK_NULL_HANDLE : m_RenderFinishedSemaphores[m_CurrentImageIndex];
         }
 
         /**
          * Present the current frame
-         * param renderFinishedSemaphore: Semaphore to wait on before presenting
          * param vsync: If true, use FIFO (VSync). If false, use MAILBOX or IMMEDIATE
+         * param frameStart: When the frame began (BeginFrame), for presentation feedback
          * return RHIResult indicating success or failure
          */
-        RHIResult Present(bool vsync);
+        RHIResult Present(bool vsync, std::chrono::steady_clock::time_point frameStart);
+
+        /**
+         * Report when presented frames reach the display (Wayland
+         * wp_presentation) into 'model'. nullptr stops reporting.
+         * note: Non-owning; feedback is delivered during WindowContext::PollEvents()
+         */
+        void SetPresentTimingModel(PresentTimingModel* model) { m_PresentTiming = model; }
+
+        /**
+         * Can this swapchain report display timestamps?
+         */
+        bool HasPresentFeedback() const;
 
         /**
          * Resize swapchain to new dimensions
@@ -137,6 +154,25 @@
          */
         VkFormat GetFormat() const { return m_SwapchainImageFormat; }
 
+        /**
+         * Rendering to an image ring instead of a surface?
+         */
+        bool IsOffscreen() const { return m_Offscreen; }
+
+        /**
+         * Copy the current image into its readback buffer (offscreen only)
+         * param commandBuffer: The frame's command buffer, image in TRANSFER_SRC_OPTIMAL
+         */
+        void RecordReadback(VkCommandBuffer commandBuffer);
+
+        /**
+         * Copy the last presented frame out of its readback buffer (offscreen only)
+         * param pixels: Receives width * height tightly packed pixels in GetFormat()
+         * return false if nothing was presented since creation / the last resize
+         * note: The frame's GPU work must be complete (RHI::ReadbackFrame waits for it)
+         */
+        bool ReadbackLastFrame(std::vector<uint8_t>& pixels, uint32_t& width, uint32_t& height) const;
+
     private:
 
         bool m_IsInitialized = false;
@@ -145,12 +181,16 @@
         void CreateSurface();
         void CreateSwapchain();
         void CreateImageViews();
-        void CreateRenderPass();
-        void CreateFramebuffers();
         void CreateSyncObjects();
 
         void CleanupSwapchain();
 
+        // Offscreen image ring (VulkanSwapchainOffscreen.cpp)
+        void CreateOffscreenTargets();
+        void DestroyOffscreenTargets();
+        RHIResult OffscreenAcquireNextImage();
+        RHIResult OffscreenPresent();
+
         void ReleaseBackBuffers();
         void RecreateBackBuffers();
 
@@ -167,23 +207,66 @@
 
         std::vector<VkImage> m_SwapchainImages;
         std::vector<VkImageView> m_SwapchainImageViews;
-        std::vector<VkFramebuffer> m_Framebuffers;
 
         VkFormat m_SwapchainImageFormat;
         VkExtent2D m_SwapchainExtent;
-        VkRenderPass m_RenderPass = VK_NULL_HANDLE;
 
         std::vector<VkSemaphore> m_ImageAvailableSemaphores;
         std::vector<VkSemaphore> m_RenderFinishedSemaphores; // size = m_SwapchainImages.size()
 
+        uint32_t m_FramesInFlight;
         uint32_t m_CurrentFrame = 0;
         uint32_t m_CurrentImageIndex = 0;
 
+        PresentTimingModel* m_PresentTiming = nullptr; // Non-owning
+
+        /**
+         * Backing memory and readback buffer of one offscreen image.
+         * Parallel to m_SwapchainImages, which owns the images when offscreen.
+         */
+        struct OffscreenTarget
+        {
+            GPUAllocation imageMemory;
+            VkBuffer readbackBuffer = VK_NULL_HANDLE;
+            GPUAllocation readbackMemory; // Persistently mapped, host-coherent
+        };
+
+        bool m_Offscreen = false;
+        std::vector<OffscreenTarget> m_OffscreenTargets; // Frames in flight + 1
+        uint32_t m_LastPresentedImage = UINT32_MAX;
+
 #ifdef __linux__
         wl_callback* m_FrameCallback = nullptr;
         bool m_WaitingForFrame = false;
         static void frame_done_callback(void* data, wl_callback* cb, uint32_t time);
         static const wl_callback_listener s_FrameListener;
+
+        /**
+         * One outstanding wp_presentation_feedback (listener user data).
+         * Fixed pool: no allocation per frame.
+         */
+        struct PendingPresentFeedback
+        {
+            VulkanSwapchain* swapchain = nullptr;
+            struct wp_presentation_feedback* feedback = nullptr;
+            std::chrono::steady_clock::time_point frameStart;
+            std::chrono::steady_clock::time_point presentTime;
+        };
+
+        // Feedback arrives a few refreshes after Present(); more in flight are skipped
+        static constexpr size_t MAX_PENDING_FEEDBACK = 8;
+
+        void RequestPresentFeedback(wl_surface* surface, std::chrono::steady_clock::time_point frameStart);
+        void DestroyPendingFeedback();
+
+        std::array<PendingPresentFeedback, MAX_PENDING_FEEDBACK> m_PendingFeedback{};
+
+        static void feedback_sync_output(void* data, struct wp_presentation_feedback* feedback, wl_output* output);
+        static void feedback_presented(void* data, struct wp_presentation_feedback* feedback,
+            uint32_t tvSecHi, uint32_t tvSecLo, uint32_t tvNsec, uint32_t refresh,
+            uint32_t seqHi, uint32_t seqLo, uint32_t flags);
+        static void feedback_discarded(void* data, struct wp_presentation_feedback* feedback);
+        static const wp_presentation_feedback_listener s_PresentationFeedbackListener;
 #endif
 };
 
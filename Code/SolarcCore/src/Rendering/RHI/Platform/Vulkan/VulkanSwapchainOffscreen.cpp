@@ -0,0 +1,208 @@
+#ifdef SOLARC_RENDERER_VULKAN
+
+#include "VulkanSwapchain.h"
+#include "Logging/LogMacros.h"
+#include <stdexcept>
+#include <cstring>
+
+// ============================================================================
+// Offscreen targets
+// ============================================================================
+//
+// Used when the device was created for RHITarget::Offscreen. There is no
+// surface and nothing is presented: the images are owned device images the
+// RHI leaves in TRANSFER_SRC_OPTIMAL at the end of a frame, RecordReadback() copies each
+// frame into a persistently mapped host buffer, and Acquire/Present only
+// rotate the ring. The ring has one image more than frames in flight, so
+// the image being acquired was last used by a frame whose timeline value
+// has been waited on.
+
+namespace
+{
+    GPUAllocation AllocateFor(VulkanDevice* device, const VkMemoryRequirements& requirements,
+        VkMemoryPropertyFlags preferred, VkMemoryPropertyFlags required, GPUResourceTiling tiling)
+    {
+        GPUAllocationDesc desc;
+        desc.size = requirements.size;
+        desc.alignment = requirements.alignment;
+        desc.memoryTypeBits = requirements.memoryTypeBits;
+        desc.requiredFlags = required;
+        desc.preferredFlags = preferred;
+        desc.tiling = tiling;
+
+        GPUAllocation allocation = device->GetAllocator().Allocate(desc);
+        if (!allocation.IsValid()) {
+            SOLARC_RENDER_ERROR("Failed to allocate {} bytes of offscreen memory", requirements.size);
+            throw std::runtime_error("Failed to allocate offscreen target memory");
+        }
+        return allocation;
+    }
+}
+
+void VulkanSwapchain::CreateOffscreenTargets()
+{
+    const uint32_t imageCount = m_FramesInFlight + 1;
+    SOLARC_RENDER_DEBUG("Creating {} offscreen images ({}x{})",
+        imageCount, m_SwapchainExtent.width, m_SwapchainExtent.height);
+
+    VkDevice device = m_Device->GetDevice();
+    m_SwapchainImageFormat = PREFERRED_FORMAT;
+
+    const VkDeviceSize readbackSize =
+        static_cast<VkDeviceSize>(m_SwapchainExtent.width) * m_SwapchainExtent.height * 4;
+
+    m_SwapchainImages.assign(imageCount, VK_NULL_HANDLE);
+    m_OffscreenTargets.assign(imageCount, OffscreenTarget{});
+
+    for (uint32_t i = 0; i < imageCount; ++i) {
+        OffscreenTarget& target = m_OffscreenTargets[i];
+
+        VkImageCreateInfo imageInfo = {};
+        imageInfo.sType = VK_STRUCTURE_TYPE_IMAGE_CREATE_INFO;
+        imageInfo.imageType = VK_IMAGE_TYPE_2D;
+        imageInfo.format = m_SwapchainImageFormat;
+        imageInfo.extent = { m_SwapchainExtent.width, m_SwapchainExtent.height, 1 };
+        imageInfo.mipLevels = 1;
+        imageInfo.arrayLayers = 1;
+        imageInfo.samples = VK_SAMPLE_COUNT_1_BIT;
+        imageInfo.tiling = VK_IMAGE_TILING_OPTIMAL;
+        imageInfo.usage = VK_IMAGE_USAGE_COLOR_ATTACHMENT_BIT | VK_IMAGE_USAGE_TRANSFER_SRC_BIT;
+        imageInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+        imageInfo.initialLayout = VK_IMAGE_LAYOUT_UNDEFINED;
+
+        VkResult result = vkCreateImage(device, &imageInfo, nullptr, &m_SwapchainImages[i]);
+        if (result != VK_SUCCESS) {
+            auto rhiResult = ToRHIResult(result, "vkCreateImage");
+            SOLARC_RENDER_ERROR("Failed to create offscreen image {}: {}", i, rhiResult.GetResultMessage());
+            throw std::runtime_error("Failed to create offscreen images");
+        }
+
+        VkMemoryRequirements imageRequirements;
+        vkGetImageMemoryRequirements(device, m_SwapchainImages[i], &imageRequirements);
+        target.imageMemory = AllocateFor(m_Device, imageRequirements, VK_MEMORY_PROPERTY_DEVICE_LOCAL_BIT, 0,
+            GPUResourceTiling::Optimal);
+        vkBindImageMemory(device, m_SwapchainImages[i],
+            VulkanMemoryBackend::ToVkMemory(target.imageMemory.memory), target.imageMemory.offset);
+
+        VkBufferCreateInfo bufferInfo = {};
+        bufferInfo.sType = VK_STRUCTURE_TYPE_BUFFER_CREATE_INFO;
+        bufferInfo.size = readbackSize;
+        bufferInfo.usage = VK_BUFFER_USAGE_TRANSFER_DST_BIT;
+        bufferInfo.sharingMode = VK_SHARING_MODE_EXCLUSIVE;
+
+        result = vkCreateBuffer(device, &bufferInfo, nullptr, &target.readbackBuffer);
+        if (result != VK_SUCCESS) {
+            auto rhiResult = ToRHIResult(result, "vkCreateBuffer");
+            SOLARC_RENDER_ERROR("Failed to create readback buffer {}: {}", i, rhiResult.GetResultMessage());
+            throw std::runtime_error("Failed to create offscreen readback buffers");
+        }
+
+        // HOST_VISIBLE | HOST_COHERENT always exists; cached is faster to read from
+        constexpr VkMemoryPropertyFlags hostCoherent =
+            VK_MEMORY_PROPERTY_HOST_VISIBLE_BIT | VK_MEMORY_PROPERTY_HOST_COHERENT_BIT;
+
+        VkMemoryRequirements bufferRequirements;
+        vkGetBufferMemoryRequirements(device, target.readbackBuffer, &bufferRequirements);
+        target.readbackMemory = AllocateFor(m_Device, bufferRequirements,
+            hostCoherent | VK_MEMORY_PROPERTY_HOST_CACHED_BIT, hostCoherent, GPUResourceTiling::Linear);
+        vkBindBufferMemory(device, target.readbackBuffer,
+            VulkanMemoryBackend::ToVkMemory(target.readbackMemory.memory), target.readbackMemory.offset);
+    }
+
+    m_CurrentImageIndex = imageCount - 1; // First acquire returns image 0
+    m_LastPresentedImage = UINT32_MAX;
+
+    SOLARC_RENDER_DEBUG("Offscreen images created");
+}
+
+void VulkanSwapchain::DestroyOffscreenTargets()
+{
+    VkDevice device = m_Device->GetDevice();
+
+    for (size_t i = 0; i < m_OffscreenTargets.size(); ++i) {
+        OffscreenTarget& target = m_OffscreenTargets[i];
+
+        if (target.readbackBuffer != VK_NULL_HANDLE) {
+            vkDestroyBuffer(device, target.readbackBuffer, nullptr);
+        }
+        m_Device->GetAllocator().Free(target.readbackMemory);
+        if (i < m_SwapchainImages.size() && m_SwapchainImages[i] != VK_NULL_HANDLE) {
+            vkDestroyImage(device, m_SwapchainImages[i], nullptr);
+        }
+        m_Device->GetAllocator().Free(target.imageMemory);
+    }
+
+    m_OffscreenTargets.clear();
+    m_LastPresentedImage = UINT32_MAX;
+}
+
+RHIResult VulkanSwapchain::OffscreenAcquireNextImage()
+{
+    m_CurrentImageIndex = (m_CurrentImageIndex + 1) % static_cast<uint32_t>(m_SwapchainImages.size());
+    return RHIResult(RHIStatus::SUCCESS);
+}
+
+RHIResult VulkanSwapchain::OffscreenPresent()
+{
+    // Submitted in EndFrame; readable once the frame's timeline value is reached
+    m_LastPresentedImage = m_CurrentImageIndex;
+    return RHIResult(RHIStatus::SUCCESS);
+}
+
+void VulkanSwapchain::RecordReadback(VkCommandBuffer commandBuffer)
+{
+    SOLARC_ASSERT(m_Offscreen, "Readback requires an offscreen target");
+
+    // Image is in TRANSFER_SRC_OPTIMAL and visible to copies (RHI::EndFrame barrier)
+    VkBufferImageCopy region = {};
+    region.bufferOffset = 0;
+    region.bufferRowLength = 0;   // Tightly packed
+    region.bufferImageHeight = 0;
+    region.imageSubresource.aspectMask = VK_IMAGE_ASPECT_COLOR_BIT;
+    region.imageSubresource.mipLevel = 0;
+    region.imageSubresource.baseArrayLayer = 0;
+    region.imageSubresource.layerCount = 1;
+    region.imageOffset = { 0, 0, 0 };
+    region.imageExtent = { m_SwapchainExtent.width, m_SwapchainExtent.height, 1 };
+
+    const OffscreenTarget& target = m_OffscreenTargets[m_CurrentImageIndex];
+    vkCmdCopyImageToBuffer(commandBuffer, m_SwapchainImages[m_CurrentImageIndex],
+        VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL, target.readbackBuffer, 1, &region);
+
+    // Make the copy visible to the host once the frame's timeline value is waited on
+    VkBufferMemoryBarrier2 barrier = {};
+    barrier.sType = VK_STRUCTURE_TYPE_BUFFER_MEMORY_BARRIER_2;
+    barrier.srcStageMask = VK_PIPELINE_STAGE_2_COPY_BIT;
+    barrier.srcAccessMask = VK_ACCESS_2_TRANSFER_WRITE_BIT;
+    barrier.dstStageMask = VK_PIPELINE_STAGE_2_HOST_BIT;
+    barrier.dstAccessMask = VK_ACCESS_2_HOST_READ_BIT;
+    barrier.srcQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.dstQueueFamilyIndex = VK_QUEUE_FAMILY_IGNORED;
+    barrier.buffer = target.readbackBuffer;
+    barrier.offset = 0;
+    barrier.size = VK_WHOLE_SIZE;
+
+    VkDependencyInfo dependencyInfo = {};
+    dependencyInfo.sType = VK_STRUCTURE_TYPE_DEPENDENCY_INFO;
+    dependencyInfo.bufferMemoryBarrierCount = 1;
+    dependencyInfo.pBufferMemoryBarriers = &barrier;
+
+    vkCmdPipelineBarrier2(commandBuffer, &dependencyInfo);
+}
+
+bool VulkanSwapchain::ReadbackLastFrame(std::vector<uint8_t>& pixels, uint32_t& width, uint32_t& height) const
+{
+    if (!m_Offscreen || m_LastPresentedImage >= m_OffscreenTargets.size()) {
+        return false;
+    }
+
+    width = m_SwapchainExtent.width;
+    height = m_SwapchainExtent.height;
+
+    const size_t size = static_cast<size_t>(width) * height * 4;
+    pixels.resize(size);
+    std::memcpy(pixels.data(), m_OffscreenTargets[m_LastPresentedImage].readbackMemory.mapped, size);
+    return true;
+}
+
+#endif // SOLARC_RENDERER_VULKAN
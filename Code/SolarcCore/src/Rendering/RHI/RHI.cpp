@@ -1,5 +1,8 @@
 #include "Rendering/RHI/RHI.h"
 #include "Logging/LogMacros.h"
+#include "MT/JobSystem.h"
+#include <algorithm>
+#include <exception>
 #include <stdexcept>
 
 // Backend-specific includes
@@ -16,6 +19,70 @@
 #endif
 
 
+namespace
+{
+    uint64_t ElapsedUs(std::chrono::steady_clock::time_point since)
+    {
+        return static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+            std::chrono::steady_clock::now() - since).count());
+    }
+}
+
+// ============================================================================
+// RHICommandRecorder
+// ============================================================================
+
+void RHICommandRecorder::Clear(float r, float g, float b, float a)
+{
+    ClearRect(0, 0, m_Width, m_Height, r, g, b, a);
+}
+
+void RHICommandRecorder::ClearRect(int32_t x, int32_t y, uint32_t width, uint32_t height, float r, float g, float b, float a)
+{
+    SOLARC_ASSERT(m_CommandList != nullptr, "Recorder used outside its RecordParallel task");
+
+    // Clip to the target; clearing outside the render area is invalid
+    const int64_t left = std::max<int64_t>(x, 0);
+    const int64_t top = std::max<int64_t>(y, 0);
+    const int64_t right = std::min<int64_t>(static_cast<int64_t>(x) + width, m_Width);
+    const int64_t bottom = std::min<int64_t>(static_cast<int64_t>(y) + height, m_Height);
+    if (left >= right || top >= bottom) {
+        return;
+    }
+
+    const float clearColor[4] = { r, g, b, a };
+#ifdef SOLARC_RENDERER_DX12
+    const D3D12_RECT rect = {
+        static_cast<LONG>(left), static_cast<LONG>(top),
+        static_cast<LONG>(right), static_cast<LONG>(bottom)
+    };
+    m_CommandList->ClearRenderTargetView(m_Swapchain->GetCurrentRTV(), clearColor, 1, &rect);
+#elif SOLARC_RENDERER_VULKAN
+    VkRect2D rect = {};
+    rect.offset = { static_cast<int32_t>(left), static_cast<int32_t>(top) };
+    rect.extent = { static_cast<uint32_t>(right - left), static_cast<uint32_t>(bottom - top) };
+    RHICommandContext::ClearAttachment(m_CommandList, rect, clearColor);
+#endif
+}
+
+void RHICommandRecorder::PushConstants(const void* data, uint32_t size, uint32_t offset)
+{
+    SOLARC_ASSERT(m_CommandList != nullptr, "Recorder used outside its RecordParallel task");
+
+#ifdef SOLARC_RENDERER_DX12
+    // No bindless heap on DX12 yet
+    (void)data; (void)size; (void)offset;
+#elif SOLARC_RENDERER_VULKAN
+    if (VulkanDescriptorHeap* heap = m_Device->GetDescriptorHeap()) {
+        heap->PushConstants(m_CommandList, data, size, offset);
+    }
+#endif
+}
+
+// ============================================================================
+// RHI
+// ============================================================================
+
 // Static member initialization
 std::unique_ptr<RHI> RHI::s_Instance = nullptr;
 std::mutex RHI::s_InstanceMutex;
@@ -26,7 +93,7 @@ RHI& RHI::Get()
     return *s_Instance;
 }
 
-void RHI::Initialize(std::shared_ptr<Window> window)
+void RHI::Initialize(std::shared_ptr<Window> window, const RHIDesc& desc)
 {
     std::lock_guard lock(s_InstanceMutex);
 
@@ -42,7 +109,7 @@ void RHI::Initialize(std::shared_ptr<Window> window)
     #endif
 
     s_Instance = std::unique_ptr<RHI>(new RHI);
-    s_Instance->InitializeInternal(window);
+    s_Instance->InitializeInternal(window, desc);
 
     SOLARC_RENDER_INFO("RHI initialized successfully");
 }
@@ -77,7 +144,7 @@ RHI::~RHI()
     }
 }
 
-void RHI::InitializeInternal(std::shared_ptr<Window> window)
+void RHI::InitializeInternal(std::shared_ptr<Window> window, const RHIDesc& desc)
 {
     SOLARC_ASSERT(window != nullptr, "Window cannot be null");
 
@@ -88,14 +155,46 @@ void RHI::InitializeInternal(std::shared_ptr<Window> window)
 
     m_Window = window;
 
+    // A simulated window has no surface to present to
+    RHIDesc deviceDesc = desc;
+    if (window->GetPlatform()->IsHeadless() && deviceDesc.target != RHITarget::Offscreen) {
+        SOLARC_RENDER_INFO("Headless window: rendering offscreen");
+        deviceDesc.target = RHITarget::Offscreen;
+    }
+    m_Target = deviceDesc.target;
+    m_LatencyMode = deviceDesc.latencyMode;
+#ifdef SOLARC_RENDERER_DX12
+    m_FramesInFlight = DX12CommandContext::FRAMES_IN_FLIGHT;
+    if (deviceDesc.GetFramesInFlight() != m_FramesInFlight) {
+        SOLARC_RENDER_WARN("DX12 backend runs {} frames in flight; requested {} ignored",
+            m_FramesInFlight, deviceDesc.GetFramesInFlight());
+    }
+#elif SOLARC_RENDERER_VULKAN
+    m_FramesInFlight = deviceDesc.GetFramesInFlight();
+    m_JustInTimeAcquire = deviceDesc.IsJustInTimeAcquire();
+#endif
+    SOLARC_RENDER_INFO("Latency mode: {} ({} frame(s) in flight)",
+        RHILatencyModeToString(m_LatencyMode), m_FramesInFlight);
+
     try {
         // Create device
         SOLARC_RENDER_DEBUG("Creating RHI device...");
-        m_Device = std::make_unique<RHIDevice>();
+        #ifdef SOLARC_RENDERER_DX12
+            if (m_Target == RHITarget::Offscreen) {
+                throw std::runtime_error("Offscreen rendering is not supported by the DX12 backend");
+            }
+            m_Device = std::make_unique<RHIDevice>();
+        #elif SOLARC_RENDERER_VULKAN
+            m_Device = std::make_unique<RHIDevice>(deviceDesc);
+        #endif
 
         // Create command context
         SOLARC_RENDER_DEBUG("Creating command context...");
-        m_CommandContext = std::make_unique<RHICommandContext>(m_Device.get());
+        #ifdef SOLARC_RENDERER_DX12
+            m_CommandContext = std::make_unique<RHICommandContext>(m_Device.get());
+        #elif SOLARC_RENDERER_VULKAN
+            m_CommandContext = std::make_unique<RHICommandContext>(m_Device.get(), m_FramesInFlight);
+        #endif
 
         // Create swapchain (backend-specific)
         SOLARC_RENDER_DEBUG("Creating swapchain...");
@@ -111,8 +210,12 @@ void RHI::InitializeInternal(std::shared_ptr<Window> window)
             // Vulkan swapchain doesn't need command queue at creation
             m_Swapchain = std::make_unique<RHISwapchain>(
                 m_Device.get(),
-                window
+                window,
+                m_FramesInFlight
             );
+            // Timing of a previous device / display does not carry over
+            m_PresentTiming.Reset();
+            m_Swapchain->SetPresentTimingModel(&m_PresentTiming);
         #endif
 
         m_Initialized = true;
@@ -126,6 +229,7 @@ void RHI::InitializeInternal(std::shared_ptr<Window> window)
         m_Swapchain.reset();
         m_CommandContext.reset();
         m_Device.reset();
+        m_Target = RHITarget::Window;
         
         throw;
     }
@@ -144,10 +248,10 @@ void RHI::ShutdownInternal()
             m_CommandContext->EndFrame();
 #elif SOLARC_RENDERER_VULKAN
             // For Vulkan, we need to properly end the frame/command buffer
-            // Check if render pass is active and end it
-            if (m_RenderPassActive) {
-                m_CommandContext->EndRenderPass();
-                m_RenderPassActive = false;
+            // Check if rendering is active and end it
+            if (m_RenderingActive) {
+                m_CommandContext->EndRendering();
+                m_RenderingActive = false;
             }
 #endif
             m_InFrame = false;
@@ -197,24 +301,28 @@ void RHI::BeginFrame()
     // Check if we're already in a frame (real or dummy)
     SOLARC_ASSERT(!m_InFrame && !m_InDummyFrame, "BeginFrame called twice without EndFrame");
 
+    m_FrameTimings = {};
+    m_FrameStartTime = std::chrono::steady_clock::now();
+
+    // One wait-free read: size and flags from the same window update
     auto window = m_Window.lock();
-    bool windowReady = window &&
-        !window->IsMinimized() &&
-        window->IsVisible() &&
-        window->GetWidth() > 0 &&
-        window->GetHeight() > 0;
+    const WindowState windowState = window ? window->GetState() : WindowState{};
+    bool windowReady = IsTargetReady(windowState);
 
     if (!windowReady) {
         // Enter dummy frame: state machine active, but no GPU work
         m_InDummyFrame = true;
         m_InFrame = false;
+        m_LastPresentTime = {}; // Don't count the hidden period as one long frame
         SOLARC_RENDER_TRACE("Entering dummy frame (window hidden/minimized/invalid)");
         return;
     }
 
 #ifdef SOLARC_RENDERER_DX12
-    // Begin command recording
+    // Begin command recording (waits for the slot's previous submission internally)
+    auto waitStart = std::chrono::steady_clock::now();
     m_CommandContext->BeginFrame();
+    m_FrameTimings.waitForFrameUs = ElapsedUs(waitStart);
 
     // DX12: Transition back buffer from PRESENT to RENDER_TARGET
     m_CommandContext->TransitionResource(
@@ -243,22 +351,38 @@ void RHI::BeginFrame()
         throw std::runtime_error("Failed to initialize swapchain: " + initResult.GetResultMessage());
     }
 
+    auto waitStart = std::chrono::steady_clock::now();
     m_CommandContext->WaitForCurrentFrame();
-
-    auto result = m_Swapchain->AcquireNextImage();
-    if (!result) {
-        if (result.GetStatus() == RHIStatus::SWAPCHAIN_OUT_OF_DATE) {
-            ResizeSwapchain(window->GetWidth(), window->GetHeight());
-            m_InDummyFrame = true;
-            m_InFrame = false;
-            SOLARC_RENDER_TRACE("Entering dummy frame (swapchain out of date)");
-            return;
+    m_FrameTimings.waitForFrameUs = ElapsedUs(waitStart);
+
+    m_ImageAcquired = false;
+    m_AcquireFailed = false;
+
+    // Low latency mode records first and acquires at the image's first use
+    // (EnsureImageAcquired), so the wait for a free image overlaps recording
+    if (!m_JustInTimeAcquire) {
+        auto acquireStart = std::chrono::steady_clock::now();
+        auto result = m_Swapchain->AcquireNextImage();
+        m_FrameTimings.acquireUs = ElapsedUs(acquireStart);
+        if (!result) {
+            if (result.GetStatus() == RHIStatus::SWAPCHAIN_OUT_OF_DATE) {
+                const SurfaceExtent extent = window->GetBufferExtent();
+                ResizeSwapchain(extent.width, extent.height);
+                m_InDummyFrame = true;
+                m_InFrame = false;
+                SOLARC_RENDER_TRACE("Entering dummy frame (swapchain out of date)");
+                return;
+            }
+            throw std::runtime_error("Failed to acquire swapchain image: " + result.GetResultMessage());
         }
-        throw std::runtime_error("Failed to acquire swapchain image: " + result.GetResultMessage());
     }
 
-    m_CommandContext->BeginFrame(m_Swapchain->GetImageAvailableSemaphore());
-    m_RenderPassActive = false;
+    m_CommandContext->BeginFrame(m_JustInTimeAcquire ? VK_NULL_HANDLE : m_Swapchain->GetImageAvailableSemaphore());
+    if (!m_JustInTimeAcquire) {
+        BeginImageAccess();
+    }
+    m_RenderingActive = false;
+    m_ImageWritten = false;
 #endif
 
     m_InFrame = true;
@@ -284,23 +408,156 @@ void RHI::Clear(float r, float g, float b, float a)
     const float clearColor[4] = { r, g, b, a };
     m_CommandContext->ClearRenderTarget(m_Swapchain->GetCurrentRTV(), clearColor);
 #elif SOLARC_RENDERER_VULKAN
-    if (!m_RenderPassActive) {
-        const float clearColor[4] = { r, g, b, a };
-        m_CommandContext->BeginRenderPass(
-            m_Swapchain->GetCurrentFramebuffer(),
-            m_Swapchain->GetRenderPass(),
+    if (!EnsureImageAcquired()) {
+        return; // Frame dropped, swapchain out of date
+    }
+
+    const float clearColor[4] = { r, g, b, a };
+    if (!m_RenderingActive) {
+        // First clear is the attachment's load op
+        m_CommandContext->BeginRendering(
+            m_Swapchain->GetCurrentImageView(),
             m_Swapchain->GetWidth(),
             m_Swapchain->GetHeight(),
             clearColor
         );
-        m_RenderPassActive = true;
+        m_RenderingActive = true;
+        m_ImageWritten = true;
     }
     else {
-        SOLARC_RENDER_WARN("Clear called multiple times in same frame - only first clear takes effect");
+        m_CommandContext->ClearAttachment(m_Swapchain->GetWidth(), m_Swapchain->GetHeight(), clearColor);
     }
 #endif
 }
 
+void RHI::RecordParallel(JobSystem& jobSystem, std::vector<RHIRecordTask> tasks)
+{
+    SOLARC_ASSERT(m_Initialized, "RHI not initialized");
+    std::lock_guard lock(m_RHIMutex);
+
+    if (!m_InFrame && !m_InDummyFrame) {
+        SOLARC_ASSERT(false, "RecordParallel called outside BeginFrame/EndFrame");
+    }
+
+    // Dummy frames record nothing
+    if (m_InDummyFrame || tasks.empty()) {
+        return;
+    }
+
+    std::vector<RHICommandRecorder> recorders;
+    std::vector<std::exception_ptr> errors(tasks.size());
+    recorders.reserve(tasks.size());
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        RHICommandRecorder recorder;
+        recorder.m_Device = m_Device.get();
+        recorder.m_Swapchain = m_Swapchain.get();
+        recorder.m_Width = m_Swapchain->GetWidth();
+        recorder.m_Height = m_Swapchain->GetHeight();
+        recorder.m_TaskIndex = i;
+        recorders.push_back(recorder);
+    }
+
+#ifdef SOLARC_RENDERER_DX12
+    // No per-thread command allocators yet: record in order into the frame's list
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        recorders[i].m_CommandList = m_CommandContext->GetCommandList();
+        try {
+            tasks[i](recorders[i]);
+        }
+        catch (...) {
+            errors[i] = std::current_exception();
+        }
+    }
+#elif SOLARC_RENDERER_VULKAN
+    if (!EnsureImageAcquired()) {
+        return; // Frame dropped, swapchain out of date
+    }
+
+    // Secondaries run in their own rendering instance
+    if (m_RenderingActive) {
+        m_CommandContext->EndRendering();
+        m_RenderingActive = false;
+    }
+
+    // One pool per worker, plus one for the calling thread (lone tasks)
+    const uint32_t workerCount = static_cast<uint32_t>(jobSystem.GetWorkerCount());
+    const uint32_t callerPool = workerCount;
+    m_CommandContext->PrepareWorkerPools(workerCount + 1);
+
+    const VkFormat format = m_Swapchain->GetFormat();
+    const uint32_t width = m_Swapchain->GetWidth();
+    const uint32_t height = m_Swapchain->GetHeight();
+
+    // Record task i into a secondary from 'pool'; a throwing task's
+    // secondary is left out of the merge, so its commands are dropped
+    auto record = [&](size_t i, uint32_t pool) {
+        RHICommandRecorder& recorder = recorders[i];
+        try {
+            VkCommandBuffer commandBuffer = m_CommandContext->BeginSecondary(pool, format, width, height);
+            recorder.m_CommandList = commandBuffer;
+
+            tasks[i](recorder);
+            m_CommandContext->EndSecondary(commandBuffer);
+        }
+        catch (...) {
+            errors[i] = std::current_exception();
+        }
+    };
+
+    if (tasks.size() == 1) {
+        // A lone task gains nothing from a worker: skip the dispatch
+        record(0, callerPool);
+    }
+    else {
+        std::vector<std::function<void()>> jobs;
+        jobs.reserve(tasks.size());
+        for (size_t i = 0; i < tasks.size(); ++i) {
+            jobs.push_back([&, i]() {
+                // The worker's own pool: no other thread records from it
+                const size_t worker = JobSystem::GetCurrentWorkerIndex();
+                SOLARC_ASSERT(worker != JobSystem::INVALID_WORKER_INDEX, "Recording task must run on a JobSystem worker");
+                record(i, static_cast<uint32_t>(worker));
+            });
+        }
+
+        jobSystem.WaitAll(jobSystem.ScheduleBatch(std::move(jobs), "RHI::RecordParallel"));
+    }
+
+    // Merge in task order, not completion order
+    std::vector<VkCommandBuffer> secondaries;
+    secondaries.reserve(tasks.size());
+    for (size_t i = 0; i < tasks.size(); ++i) {
+        if (errors[i]) {
+            continue;
+        }
+        if (recorders[i].m_CommandList == VK_NULL_HANDLE) {
+            SOLARC_RENDER_WARN("RecordParallel task {} did not run (job system shut down)", i);
+            continue;
+        }
+        secondaries.push_back(recorders[i].m_CommandList);
+    }
+
+    // Keep what was rendered before; frames start black like EndFrame's default
+    const float defaultClear[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
+    m_CommandContext->BeginRendering(
+        m_Swapchain->GetCurrentImageView(),
+        width,
+        height,
+        m_ImageWritten ? nullptr : defaultClear,
+        true
+    );
+    m_CommandContext->ExecuteSecondaries(secondaries);
+    m_CommandContext->EndRendering();
+    m_ImageWritten = true;
+#endif
+
+    for (const auto& error : errors) {
+        if (error) {
+            std::rethrow_exception(error);
+        }
+    }
+}
+
 void RHI::EndFrame()
 {
     SOLARC_ASSERT(m_Initialized, "RHI not initialized");
@@ -329,24 +586,63 @@ void RHI::EndFrame()
 
     m_CommandContext->EndFrame();
 #elif SOLARC_RENDERER_VULKAN
-    if (m_RenderPassActive) {
-        m_CommandContext->EndRenderPass();
-        m_RenderPassActive = false;
+    if (!EnsureImageAcquired()) {
+        // Nothing was recorded; submit anyway so the frame's timeline value signals
+        m_CommandContext->EndFrame(VK_NULL_HANDLE);
+        m_Swapchain->AdvanceFrame();
+        m_InFrame = false;
+        m_FrameIndex++;
+        return;
     }
-    else {
+
+    if (!m_ImageWritten) {
+        // Never present undefined contents: frames without Clear() are black
         const float defaultClear[4] = { 0.0f, 0.0f, 0.0f, 1.0f };
-        m_CommandContext->BeginRenderPass(
-            m_Swapchain->GetCurrentFramebuffer(),
-            m_Swapchain->GetRenderPass(),
+        m_CommandContext->BeginRendering(
+            m_Swapchain->GetCurrentImageView(),
             m_Swapchain->GetWidth(),
             m_Swapchain->GetHeight(),
             defaultClear
         );
-        m_CommandContext->EndRenderPass();
+        m_RenderingActive = true;
+        m_ImageWritten = true;
+    }
+    if (m_RenderingActive) {
+        m_CommandContext->EndRendering();
+        m_RenderingActive = false;
+    }
+
+    if (m_Swapchain->IsOffscreen()) {
+        m_CommandContext->TransitionImage(
+            m_Swapchain->GetCurrentImage(),
+            VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+            VK_IMAGE_LAYOUT_TRANSFER_SRC_OPTIMAL,
+            VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT,
+            VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT,
+            VK_PIPELINE_STAGE_2_COPY_BIT,
+            VK_ACCESS_2_TRANSFER_READ_BIT
+        );
+        m_Swapchain->RecordReadback(m_CommandContext->GetCommandBuffer());
+    }
+    else {
+        // Presentation is ordered by the render finished semaphore, not by a stage
+        m_CommandContext->TransitionImage(
+            m_Swapchain->GetCurrentImage(),
+            VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+            VK_IMAGE_LAYOUT_PRESENT_SRC_KHR,
+            VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT,
+            VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT,
+            VK_PIPELINE_STAGE_2_NONE,
+            VK_ACCESS_2_NONE
+        );
     }
 
     VkSemaphore renderFinished = m_Swapchain->GetRenderFinishedSemaphoreForImage();
     m_CommandContext->EndFrame(renderFinished);
+
+    // The command context moved to its next frame; the swapchain's acquire
+    // semaphores follow here, not in Present(), which may return early
+    m_Swapchain->AdvanceFrame();
 #endif
 
     m_InFrame = false;
@@ -362,8 +658,7 @@ void RHI::Present()
     SOLARC_ASSERT(!m_InFrame && !m_InDummyFrame, "Present called before EndFrame");
 
     auto window = m_Window.lock();
-    if (!window || window->IsMinimized() || !window->IsVisible() ||
-        window->GetWidth() <= 0 || window->GetHeight() <= 0) {
+    if (!window || !IsTargetReady(window->GetState())) {
         // Nothing to present
         return;
     }
@@ -371,19 +666,42 @@ void RHI::Present()
 #ifdef SOLARC_RENDERER_DX12
     auto result = m_Swapchain->Present(m_VSync);
 #elif SOLARC_RENDERER_VULKAN
-    auto result = m_Swapchain->Present(m_VSync);
+    if (m_AcquireFailed) {
+        // Just-in-time acquire found the swapchain out of date; nothing to present
+        const SurfaceExtent extent = window->GetBufferExtent();
+        ResizeSwapchain(extent.width, extent.height);
+        return;
+    }
 
-    m_Swapchain->AdvanceFrame();
+    auto result = m_Swapchain->Present(m_VSync, m_FrameStartTime);
 #endif
 
+    if (result) {
+        auto now = std::chrono::steady_clock::now();
+        if (m_LastPresentTime != std::chrono::steady_clock::time_point{}) {
+            m_FrameTimings.presentIntervalUs = static_cast<uint64_t>(
+                std::chrono::duration_cast<std::chrono::microseconds>(now - m_LastPresentTime).count());
+        }
+        m_LastPresentTime = now;
+        m_FrameTimings.presented = true;
+
+        InputTimestamp oldestInput = window->GetOldestInputTimestamp();
+        m_InputToPresentLatencyUs = oldestInput != 0 ? InputClock::Now() - oldestInput : 0;
+
+        if (oldestInput != 0) {
+            SOLARC_RENDER_TRACE("Input-to-present latency: {} us", m_InputToPresentLatencyUs);
+        }
+    }
+
     if (!result) {
         if (result.GetStatus() == RHIStatus::DEVICE_LOST) {
             SOLARC_RENDER_ERROR("Device lost! Application should exit.");
         }
         if (result.GetStatus() == RHIStatus::SWAPCHAIN_OUT_OF_DATE) {
             auto window = m_Window.lock();
-            if (window && window->GetWidth() > 0 && window->GetHeight() > 0) {
-                ResizeSwapchain(window->GetWidth(), window->GetHeight());
+            const SurfaceExtent extent = window ? window->GetBufferExtent() : SurfaceExtent{};
+            if (extent.width > 0 && extent.height > 0) {
+                ResizeSwapchain(extent.width, extent.height);
             }
             else {
                 SOLARC_RENDER_WARN("Swapchain out of date but window not ready for resize");
@@ -392,6 +710,87 @@ void RHI::Present()
     }
 }
 
+PresentTimingModel* RHI::GetPresentTiming()
+{
+#ifdef SOLARC_RENDERER_VULKAN
+    if (m_Swapchain && m_Swapchain->HasPresentFeedback())
+        return &m_PresentTiming;
+#endif
+    return nullptr;
+}
+
+bool RHI::ReadbackFrame(std::vector<uint8_t>& pixels, uint32_t& width, uint32_t& height)
+{
+    SOLARC_ASSERT(m_Initialized, "RHI not initialized");
+
+    if (!IsOffscreen()) {
+        return false;
+    }
+
+    // The last presented frame may still be in flight (waits for its timeline value only)
+    m_CommandContext->WaitForGPU();
+
+    std::lock_guard lock(m_RHIMutex);
+#ifdef SOLARC_RENDERER_VULKAN
+    return m_Swapchain->ReadbackLastFrame(pixels, width, height);
+#else
+    return false;
+#endif
+}
+
+#ifdef SOLARC_RENDERER_VULKAN
+void RHI::BeginImageAccess()
+{
+    // Every frame clears the whole image, so the old contents are discarded.
+    // Waits on COLOR_ATTACHMENT_OUTPUT to chain with the acquire semaphore wait.
+    m_CommandContext->TransitionImage(
+        m_Swapchain->GetCurrentImage(),
+        VK_IMAGE_LAYOUT_UNDEFINED,
+        VK_IMAGE_LAYOUT_COLOR_ATTACHMENT_OPTIMAL,
+        VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT,
+        VK_ACCESS_2_NONE,
+        VK_PIPELINE_STAGE_2_COLOR_ATTACHMENT_OUTPUT_BIT,
+        VK_ACCESS_2_COLOR_ATTACHMENT_WRITE_BIT
+    );
+    m_ImageAcquired = true;
+}
+
+bool RHI::EnsureImageAcquired()
+{
+    if (m_ImageAcquired) {
+        return true;
+    }
+    if (m_AcquireFailed) {
+        return false;
+    }
+
+    auto acquireStart = std::chrono::steady_clock::now();
+    auto result = m_Swapchain->AcquireNextImage();
+    m_FrameTimings.acquireUs = ElapsedUs(acquireStart);
+    if (!result) {
+        if (result.GetStatus() == RHIStatus::SWAPCHAIN_OUT_OF_DATE) {
+            // The command buffer is already recording: drop the frame, resize in Present()
+            m_AcquireFailed = true;
+            SOLARC_RENDER_TRACE("Dropping frame (swapchain out of date at acquire)");
+            return false;
+        }
+        throw std::runtime_error("Failed to acquire swapchain image: " + result.GetResultMessage());
+    }
+
+    m_CommandContext->SetImageAvailableSemaphore(m_Swapchain->GetImageAvailableSemaphore());
+    BeginImageAccess();
+    return true;
+}
+#endif
+
+bool RHI::IsTargetReady(const WindowState& state) const
+{
+    if (IsOffscreen()) {
+        return !state.IsClosed() && !state.IsMinimized() && state.width > 0 && state.height > 0;
+    }
+    return state.IsRenderable();
+}
+
 void RHI::SetVSync(bool enabled)
 {
     std::lock_guard lock(m_RHIMutex);
@@ -417,6 +816,81 @@ void RHI::WaitForGPU()
     m_CommandContext->WaitForGPU();
 }
 
+uint64_t RHI::GetLastSubmittedFrame() const
+{
+    SOLARC_ASSERT(m_Initialized, "RHI not initialized");
+    return m_CommandContext->GetLastSubmittedValue();
+}
+
+bool RHI::IsFrameComplete(uint64_t frame) const
+{
+    SOLARC_ASSERT(m_Initialized, "RHI not initialized");
+    return m_CommandContext->IsValueComplete(frame);
+}
+
+// ============================================================================
+// Descriptors
+// ============================================================================
+
+bool RHI::HasDescriptorHeap() const
+{
+    SOLARC_ASSERT(m_Initialized, "RHI not initialized");
+#ifdef SOLARC_RENDERER_VULKAN
+    return m_Device->GetDescriptorHeap() != nullptr;
+#else
+    return false;
+#endif
+}
+
+RHIDescriptorHandle RHI::CreateSampledImageDescriptor(RHINativeHandle imageView)
+{
+    SOLARC_ASSERT(m_Initialized, "RHI not initialized");
+#ifdef SOLARC_RENDERER_VULKAN
+    if (VulkanDescriptorHeap* heap = m_Device->GetDescriptorHeap()) {
+        return heap->CreateSampledImage((VkImageView)imageView, VK_IMAGE_LAYOUT_SHADER_READ_ONLY_OPTIMAL);
+    }
+#else
+    (void)imageView;
+#endif
+    return {};
+}
+
+RHIDescriptorHandle RHI::CreateStorageBufferDescriptor(RHINativeHandle buffer, uint64_t offset, uint64_t range)
+{
+    SOLARC_ASSERT(m_Initialized, "RHI not initialized");
+#ifdef SOLARC_RENDERER_VULKAN
+    if (VulkanDescriptorHeap* heap = m_Device->GetDescriptorHeap()) {
+        return heap->CreateStorageBuffer((VkBuffer)buffer, offset, range);
+    }
+#else
+    (void)buffer; (void)offset; (void)range;
+#endif
+    return {};
+}
+
+RHIDescriptorHandle RHI::CreateSamplerDescriptor(RHISamplerFilter filter)
+{
+    SOLARC_ASSERT(m_Initialized, "RHI not initialized");
+#ifdef SOLARC_RENDERER_VULKAN
+    if (VulkanDescriptorHeap* heap = m_Device->GetDescriptorHeap()) {
+        return heap->CreateSampler(filter);
+    }
+#else
+    (void)filter;
+#endif
+    return {};
+}
+
+void RHI::FreeDescriptor(const RHIDescriptorHandle& handle)
+{
+    SOLARC_ASSERT(m_Initialized, "RHI not initialized");
+#ifdef SOLARC_RENDERER_VULKAN
+    m_CommandContext->FreeDescriptor(handle);
+#else
+    (void)handle;
+#endif
+}
+
 void RHI::OnWindowResize(int32_t width, int32_t height)
 {
     SOLARC_ASSERT(m_Initialized, "RHI not initialized");
@@ -427,9 +901,14 @@ void RHI::OnWindowResize(int32_t width, int32_t height)
         return;
     }
 
-    SOLARC_RENDER_INFO("Handling window resize: {}x{}", width, height);
+    // Swapchain is sized in buffer pixels (display scale and render scale applied)
+    auto window = m_Window.lock();
+    const SurfaceExtent extent = window ? window->GetSurfaceScale().ToBuffer(width, height)
+                                        : SurfaceExtent{ width, height };
+
+    SOLARC_RENDER_INFO("Handling window resize: {}x{} (buffer {}x{})", width, height, extent.width, extent.height);
 
-    ResizeSwapchain(width, height);
+    ResizeSwapchain(extent.width, extent.height);
 }
 
 void RHI::ResizeSwapchain(int32_t width, int32_t height)
@@ -449,6 +928,9 @@ void RHI::ResizeSwapchain(int32_t width, int32_t height)
         throw std::runtime_error("Failed to resize swapchain");
     }
 
+    // New swapchain: refresh phase and lead time are learned again
+    m_PresentTiming.Reset();
+
     SOLARC_RENDER_INFO("Swapchain resized successfully to {}x{}", width, height);
 }
 
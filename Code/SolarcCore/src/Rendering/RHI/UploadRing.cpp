@@ -0,0 +1,71 @@
+#include "Rendering/RHI/UploadRing.h"
+#include "Logging/LogMacros.h"
+#include <algorithm>
+#include <bit>
+#include <cstring>
+
+UploadRing::UploadRing(void* mapped, uint64_t frameSize, uint32_t frameCount)
+    : m_Mapped(static_cast<uint8_t*>(mapped))
+    , m_FrameSize(frameSize)
+    , m_FrameCount(frameCount)
+{
+    SOLARC_ASSERT(mapped != nullptr, "Upload ring needs mapped memory");
+    SOLARC_ASSERT(frameSize > 0 && frameCount > 0, "Upload ring cannot be empty");
+}
+
+void UploadRing::BeginFrame(uint32_t frameIndex)
+{
+    SOLARC_ASSERT(frameIndex < m_FrameCount, "Frame index out of range");
+
+    const uint32_t failed = m_Failed.exchange(0, std::memory_order_relaxed);
+    if (failed > 0) {
+        SOLARC_RENDER_WARN("Upload ring: {} allocations did not fit in frame {} ({} KiB partitions)",
+            failed, m_FrameIndex, m_FrameSize / 1024);
+    }
+
+    m_PeakUsedBytes = std::max(m_PeakUsedBytes, m_Head.load(std::memory_order_relaxed));
+
+    m_FrameIndex = frameIndex;
+    m_FrameBase = static_cast<uint64_t>(frameIndex) * m_FrameSize;
+    m_Head.store(0, std::memory_order_relaxed);
+}
+
+UploadAllocation UploadRing::Allocate(uint64_t size, uint64_t alignment)
+{
+    SOLARC_ASSERT(size > 0, "Cannot allocate zero bytes");
+    SOLARC_ASSERT(std::has_single_bit(alignment), "Alignment must be a power of two");
+
+    uint64_t head = m_Head.load(std::memory_order_relaxed);
+    uint64_t offset = 0;
+    for (;;) {
+        // Align the offset in the buffer, not in the partition
+        offset = ((m_FrameBase + head + alignment - 1) & ~(alignment - 1)) - m_FrameBase;
+        if (offset + size > m_FrameSize) {
+            m_Failed.fetch_add(1, std::memory_order_relaxed);
+            return {};
+        }
+        if (m_Head.compare_exchange_weak(head, offset + size, std::memory_order_relaxed)) {
+            break;
+        }
+    }
+
+    UploadAllocation allocation;
+    allocation.offset = m_FrameBase + offset;
+    allocation.mapped = m_Mapped + allocation.offset;
+    allocation.size = size;
+    return allocation;
+}
+
+UploadAllocation UploadRing::Upload(const void* data, uint64_t size, uint64_t alignment)
+{
+    UploadAllocation allocation = Allocate(size, alignment);
+    if (allocation.IsValid()) {
+        std::memcpy(allocation.mapped, data, size);
+    }
+    return allocation;
+}
+
+uint64_t UploadRing::GetPeakUsedBytes() const
+{
+    return std::max(m_PeakUsedBytes, GetUsedBytes());
+}
@@ -0,0 +1,314 @@
+#include "Rendering/RenderGraph/RenderGraph.h"
+#include "Logging/LogMacros.h"
+#include <algorithm>
+#include <numeric>
+
+// ============================================================================
+// RGPassBuilder
+// ============================================================================
+
+RGResourceHandle RGPassBuilder::CreateTexture(std::string name, const RGTextureDesc& desc)
+{
+    SOLARC_ASSERT(desc.width > 0 && desc.height > 0, "Transient texture cannot be empty");
+    return m_Graph.AddResource(std::move(name), desc, false, RGAccess::None, RGAccess::None);
+}
+
+RGResourceHandle RGPassBuilder::Read(RGResourceHandle resource, RGAccess access)
+{
+    SOLARC_ASSERT(access != RGAccess::None && !RGIsWriteAccess(access), "Read needs a read access");
+    m_Graph.AddAccess(m_PassIndex, resource, access);
+    return resource;
+}
+
+RGResourceHandle RGPassBuilder::Write(RGResourceHandle resource, RGAccess access)
+{
+    SOLARC_ASSERT(RGIsWriteAccess(access), "Write needs a write access");
+    m_Graph.AddAccess(m_PassIndex, resource, access);
+    return resource;
+}
+
+void RGPassBuilder::SetSideEffects()
+{
+    m_Graph.m_Passes[m_PassIndex].sideEffects = true;
+}
+
+// ============================================================================
+// Building
+// ============================================================================
+
+void RenderGraph::Reset()
+{
+    m_Resources.clear();
+    m_Passes.clear();
+    m_ExecutionOrder.clear();
+    m_Batches.clear();
+    m_FinalBarriers.clear();
+    m_TransientHeapSize = 0;
+    m_Compiled = false;
+}
+
+RGResourceHandle RenderGraph::ImportTexture(std::string name, const RGTextureDesc& desc,
+    RGAccess initialAccess, RGAccess finalAccess)
+{
+    SOLARC_ASSERT(finalAccess != RGAccess::None, "Imported resources need a final access");
+    return AddResource(std::move(name), desc, true, initialAccess, finalAccess);
+}
+
+RGPassHandle RenderGraph::AddPass(std::string name, const std::function<void(RGPassBuilder&)>& setup,
+    RGExecuteFunc execute)
+{
+    m_Compiled = false;
+
+    const uint32_t index = static_cast<uint32_t>(m_Passes.size());
+    Pass& pass = m_Passes.emplace_back();
+    pass.name = std::move(name);
+    pass.execute = std::move(execute);
+
+    if (setup) {
+        RGPassBuilder builder(*this, index);
+        setup(builder);
+    }
+
+    return RGPassHandle{ index };
+}
+
+RGResourceHandle RenderGraph::AddResource(std::string name, const RGTextureDesc& desc, bool imported,
+    RGAccess initialAccess, RGAccess finalAccess)
+{
+    m_Compiled = false;
+
+    Resource& resource = m_Resources.emplace_back();
+    resource.name = std::move(name);
+    resource.desc = desc;
+    resource.imported = imported;
+    resource.initialAccess = initialAccess;
+    resource.finalAccess = finalAccess;
+
+    return RGResourceHandle{ static_cast<uint32_t>(m_Resources.size() - 1) };
+}
+
+void RenderGraph::AddAccess(uint32_t passIndex, RGResourceHandle resource, RGAccess access)
+{
+    SOLARC_ASSERT(resource.index < m_Resources.size(), "Invalid render graph resource");
+
+    Pass& pass = m_Passes[passIndex];
+    SOLARC_ASSERT(std::none_of(pass.accesses.begin(), pass.accesses.end(),
+        [resource](const ResourceAccess& existing) { return existing.resource == resource; }),
+        "Pass accesses a resource twice");
+    pass.accesses.push_back({ resource, access });
+
+    // Presenting is visible outside the graph
+    if (access == RGAccess::Present) {
+        pass.sideEffects = true;
+    }
+}
+
+// ============================================================================
+// Compilation
+// ============================================================================
+
+void RenderGraph::Compile()
+{
+    m_ExecutionOrder.clear();
+    m_Batches.clear();
+    m_FinalBarriers.clear();
+    m_TransientHeapSize = 0;
+
+    for (Resource& resource : m_Resources) {
+        resource.firstUse = UINT32_MAX;
+        resource.lastUse = 0;
+        resource.allocation = {};
+    }
+    for (Pass& pass : m_Passes) {
+        pass.culled = false;
+        pass.barriers.clear();
+    }
+
+    CullPasses();
+    ComputeBarriers();
+    PlaceTransients();
+
+    m_Compiled = true;
+}
+
+void RenderGraph::CullPasses()
+{
+    // Walk backwards from the outputs: a pass survives if it has side
+    // effects or writes something a surviving pass (or the caller) needs.
+    // Writes are partial, so a surviving writer keeps earlier writers alive.
+    std::vector<bool> needed(m_Resources.size(), false);
+    for (size_t i = 0; i < m_Resources.size(); ++i) {
+        needed[i] = m_Resources[i].imported;
+    }
+
+    for (size_t i = m_Passes.size(); i-- > 0;) {
+        Pass& pass = m_Passes[i];
+
+        bool live = pass.sideEffects;
+        for (const ResourceAccess& access : pass.accesses) {
+            live = live || (RGIsWriteAccess(access.access) && needed[access.resource.index]);
+        }
+
+        pass.culled = !live;
+        if (!live) {
+            continue;
+        }
+
+        for (const ResourceAccess& access : pass.accesses) {
+            needed[access.resource.index] = true;
+        }
+    }
+
+    for (uint32_t i = 0; i < m_Passes.size(); ++i) {
+        if (!m_Passes[i].culled) {
+            m_ExecutionOrder.push_back(RGPassHandle{ i });
+        }
+    }
+}
+
+bool RenderGraph::NeedsBarrier(RGAccess before, RGAccess after)
+{
+    if (before != after || before == RGAccess::None) {
+        return true; // Layout / state change, or first use
+    }
+
+    // Same access again: reads never conflict, and attachment writes are
+    // ordered by rasterization order within a batch's rendering instance.
+    // Transfer writes are not ordered against each other.
+    return after == RGAccess::TransferWrite;
+}
+
+void RenderGraph::ComputeBarriers()
+{
+    std::vector<RGAccess> current(m_Resources.size());
+    for (size_t i = 0; i < m_Resources.size(); ++i) {
+        current[i] = m_Resources[i].initialAccess;
+    }
+
+    for (uint32_t position = 0; position < m_ExecutionOrder.size(); ++position) {
+        Pass& pass = m_Passes[m_ExecutionOrder[position].index];
+
+        for (const ResourceAccess& access : pass.accesses) {
+            const uint32_t index = access.resource.index;
+            Resource& resource = m_Resources[index];
+
+            SOLARC_ASSERT(resource.imported || current[index] != RGAccess::None || RGIsWriteAccess(access.access),
+                "Pass reads a transient texture before any pass writes it");
+
+            if (NeedsBarrier(current[index], access.access)) {
+                pass.barriers.push_back({ access.resource, current[index], access.access });
+            }
+            current[index] = access.access;
+
+            resource.firstUse = std::min(resource.firstUse, position);
+            resource.lastUse = std::max(resource.lastUse, position);
+        }
+
+        // A barrier ends the batch: everything before it must be recorded first
+        if (m_Batches.empty() || !pass.barriers.empty()) {
+            m_Batches.emplace_back();
+        }
+        m_Batches.back().push_back(m_ExecutionOrder[position]);
+    }
+
+    for (uint32_t i = 0; i < m_Resources.size(); ++i) {
+        const Resource& resource = m_Resources[i];
+        if (resource.imported && current[i] != resource.finalAccess) {
+            m_FinalBarriers.push_back({ RGResourceHandle{ i }, current[i], resource.finalAccess });
+        }
+    }
+}
+
+void RenderGraph::PlaceTransients()
+{
+    std::vector<uint32_t> transients;
+    for (uint32_t i = 0; i < m_Resources.size(); ++i) {
+        const Resource& resource = m_Resources[i];
+        if (!resource.imported && resource.firstUse != UINT32_MAX) {
+            transients.push_back(i);
+        }
+    }
+
+    for (uint32_t index : transients) {
+        const RGTextureDesc& desc = m_Resources[index].desc;
+        const uint64_t bytes = static_cast<uint64_t>(desc.width) * desc.height * RGFormatBytesPerPixel(desc.format);
+        m_Resources[index].allocation.size = (bytes + TRANSIENT_ALIGNMENT - 1) / TRANSIENT_ALIGNMENT * TRANSIENT_ALIGNMENT;
+    }
+
+    // Largest first, then first-fit below everything alive at the same time
+    std::stable_sort(transients.begin(), transients.end(), [this](uint32_t a, uint32_t b) {
+        return m_Resources[a].allocation.size > m_Resources[b].allocation.size;
+        });
+
+    std::vector<uint32_t> placed;
+    for (uint32_t index : transients) {
+        Resource& resource = m_Resources[index];
+
+        // Intervals of placed textures whose lifetimes overlap this one, by offset
+        std::vector<RGTransientAllocation> occupied;
+        for (uint32_t other : placed) {
+            const Resource& o = m_Resources[other];
+            if (o.firstUse <= resource.lastUse && resource.firstUse <= o.lastUse) {
+                occupied.push_back(o.allocation);
+            }
+        }
+        std::sort(occupied.begin(), occupied.end(), [](const RGTransientAllocation& a, const RGTransientAllocation& b) {
+            return a.offset < b.offset;
+            });
+
+        uint64_t offset = 0;
+        for (const RGTransientAllocation& interval : occupied) {
+            if (offset + resource.allocation.size <= interval.offset) {
+                break; // Fits in the gap before this interval
+            }
+            offset = std::max(offset, interval.offset + interval.size);
+        }
+
+        resource.allocation.offset = offset;
+        m_TransientHeapSize = std::max(m_TransientHeapSize, offset + resource.allocation.size);
+        placed.push_back(index);
+    }
+}
+
+// ============================================================================
+// Queries
+// ============================================================================
+
+bool RenderGraph::IsPassCulled(RGPassHandle pass) const
+{
+    SOLARC_ASSERT(m_Compiled, "Render graph not compiled");
+    SOLARC_ASSERT(pass.index < m_Passes.size(), "Invalid render graph pass");
+    return m_Passes[pass.index].culled;
+}
+
+const std::vector<RGBarrier>& RenderGraph::GetPassBarriers(RGPassHandle pass) const
+{
+    SOLARC_ASSERT(m_Compiled, "Render graph not compiled");
+    SOLARC_ASSERT(pass.index < m_Passes.size(), "Invalid render graph pass");
+    return m_Passes[pass.index].barriers;
+}
+
+RGTransientAllocation RenderGraph::GetTransientAllocation(RGResourceHandle resource) const
+{
+    SOLARC_ASSERT(m_Compiled, "Render graph not compiled");
+    SOLARC_ASSERT(resource.index < m_Resources.size(), "Invalid render graph resource");
+    return m_Resources[resource.index].allocation;
+}
+
+uint64_t RenderGraph::GetTransientBytesWithoutAliasing() const
+{
+    return std::accumulate(m_Resources.begin(), m_Resources.end(), uint64_t{ 0 },
+        [](uint64_t sum, const Resource& resource) { return sum + resource.allocation.size; });
+}
+
+std::string_view RenderGraph::GetPassName(RGPassHandle pass) const
+{
+    SOLARC_ASSERT(pass.index < m_Passes.size(), "Invalid render graph pass");
+    return m_Passes[pass.index].name;
+}
+
+std::string_view RenderGraph::GetResourceName(RGResourceHandle resource) const
+{
+    SOLARC_ASSERT(resource.index < m_Resources.size(), "Invalid render graph resource");
+    return m_Resources[resource.index].name;
+}
@@ -0,0 +1,51 @@
+#include "Rendering/RenderGraph/RenderGraph.h"
+#include "Rendering/RHI/RHI.h"
+#include "MT/JobSystem.h"
+#include "Logging/LogMacros.h"
+
+// ============================================================================
+// Execution (the RHI side of RenderGraph; compilation stays GPU-free)
+// ============================================================================
+
+void RenderGraph::Execute(RHI& rhi, JobSystem& jobSystem)
+{
+    SOLARC_ASSERT(m_Compiled, "Render graph not compiled");
+
+    for (const Resource& resource : m_Resources) {
+        SOLARC_ASSERT(resource.imported || resource.firstUse == UINT32_MAX,
+            "Transient textures are not backed by GPU memory yet");
+    }
+
+    rhi.BeginFrame();
+
+    bool present = false;
+    try {
+        for (const std::vector<RGPassHandle>& batch : m_Batches) {
+            std::vector<RHIRecordTask> tasks;
+            for (RGPassHandle handle : batch) {
+                const Pass& pass = m_Passes[handle.index];
+                if (pass.execute) {
+                    tasks.push_back(pass.execute);
+                }
+                for (const ResourceAccess& access : pass.accesses) {
+                    present = present || access.access == RGAccess::Present;
+                }
+            }
+
+            // Barriers are not recorded: the back buffer, the only resource
+            // executed graphs use, is transitioned by the RHI itself
+            if (!tasks.empty()) {
+                rhi.RecordParallel(jobSystem, std::move(tasks));
+            }
+        }
+    }
+    catch (...) {
+        rhi.EndFrame(); // Leave the RHI ready for the next BeginFrame
+        throw;
+    }
+
+    rhi.EndFrame();
+    if (present) {
+        rhi.Present();
+    }
+}
@@ -3,6 +3,7 @@
 #include <thread>
 #include <algorithm>
 #include <cmath>
+#include <filesystem>
 #include "Logging/LogMacros.h"
 #include "Rendering/RHI/RHI.h"
 
@@ -29,10 +30,7 @@ SolarcApp::SolarcApp(const std::string& configDataPath)
     : m_ConfigDataPath(configDataPath)
 {
     // Note: We don't parse config here anymore - that happens in INITIALIZE state
-
-    // Create the WindowContext with the platform
-
-    m_Ctx.windowCtx = &WindowContext::Get();
+    // The WindowContext is created there too, once [window] headless is known
 
     m_StateMachine = std::make_unique<SolarcStateMachine>(m_Ctx , configDataPath);
 
@@ -44,7 +42,8 @@ SolarcApp::~SolarcApp()
 {
     // Destroy in reverse order of creation
     m_StateMachine.reset();
-    m_Ctx.windowCtx->Shutdown();
+    if (m_Ctx.windowCtx)
+        m_Ctx.windowCtx->Shutdown();
     m_JobSystem.reset();
 }
 
@@ -66,11 +65,34 @@ void SolarcApp::Run()
 {
     while (m_IsRunning)
     {
+        m_FrameTimer.BeginFrame();
+
         if (m_Ctx.windowCtx)
             m_Ctx.windowCtx->PollEvents();
 
         if (m_StateMachine)
             m_StateMachine->Update();
+
+        m_FrameTimer.EndFrame();
+
+        if (!m_IsRunning || !m_Ctx.windowCtx || !m_StateMachine)
+            continue;
+
+        // Block instead of spinning: rendering states wait for the next
+        // frame slot (vsync alone paces when target_fps is 0, unless frames
+        // are aligned to the display), idle states and minimized windows
+        // sleep until input, a wake-up or the timeout
+        auto now = FramePacer::Clock::now();
+        if (m_StateMachine->WantsContinuousFrames())
+        {
+            if (!m_FramePacer.IsUnlimited() || m_FramePacer.IsDisplaySynced())
+                m_Ctx.windowCtx->WaitForEvents(m_FramePacer.NextFrameDeadline(now), false);
+        }
+        else
+        {
+            m_FramePacer.Reset();
+            m_Ctx.windowCtx->WaitForEvents(now + FramePacer::IDLE_TIMEOUT);
+        }
     }
 }
 
@@ -97,6 +119,9 @@ void SolarcApp::ParseWindowData(const toml::value& configData)
     m_WindowHeight = toml::find_or(window, "height", 1080);
     m_WindowFullscreen = toml::find_or(window, "fullscreen", false);
     m_WindowName = toml::find_or(window, "Name", "Solarc Window");
+
+    if (!m_HeadlessOverride)
+        m_Headless = toml::find_or(window, "headless", false);
 }
 
 void SolarcApp::ParseMTData(const toml::value& configData)
@@ -212,6 +237,197 @@ void SolarcApp::ParseRenderingData(const toml::value& configData)
     bool vsync = toml::find_or(rendering, "vsync", true);
     SetVSyncPreference(vsync);
     SOLARC_APP_INFO("Config: VSync = {}", vsync ? "enabled" : "disabled");
+
+    // Parse frame rate cap
+    int64_t targetFps = toml::find_or(rendering, "target_fps", int64_t(0));
+    if (targetFps < 0 || targetFps > 1000)
+    {
+        SOLARC_APP_WARN("Config: target_fps = {} out of range [0, 1000], using unlimited", targetFps);
+        targetFps = 0;
+    }
+    m_FramePacer.SetTargetFrameRate(static_cast<uint32_t>(targetFps));
+    if (targetFps > 0)
+        SOLARC_APP_INFO("Config: Target frame rate = {} FPS", targetFps);
+    else
+        SOLARC_APP_INFO("Config: Target frame rate = unlimited");
+
+    // Parse internal render resolution (fraction of the window's native resolution)
+    double renderScale = toml::find_or(rendering, "render_scale", 1.0);
+    m_RenderScale = SurfaceScale::ClampRenderScale(static_cast<float>(renderScale));
+    if (m_RenderScale != static_cast<float>(renderScale))
+        SOLARC_APP_WARN("Config: render_scale = {} out of range [{}, {}], using {}", renderScale,
+            SurfaceScale::MIN_RENDER_SCALE, SurfaceScale::MAX_RENDER_SCALE, m_RenderScale);
+    SOLARC_APP_INFO("Config: Render scale = {:.2f}", m_RenderScale);
+
+    // Parse render target and adapter preference
+    if (!m_OffscreenOverride)
+        m_RHIDesc.target = toml::find_or(rendering, "offscreen", false) ? RHITarget::Offscreen : RHITarget::Window;
+    if (!m_DeviceOverride)
+        m_RHIDesc.preferredDevice = toml::find_or(rendering, "device", std::string{});
+    SOLARC_APP_INFO("Config: Render target = {}, device = {}",
+        m_RHIDesc.target == RHITarget::Offscreen ? "offscreen" : "window",
+        m_RHIDesc.preferredDevice.empty() ? "auto" : m_RHIDesc.preferredDevice);
+
+    // Parse latency mode and frames in flight
+    std::string latencyMode = toml::find_or(rendering, "latency_mode", std::string("balanced"));
+    if (auto mode = RHILatencyModeFromString(latencyMode))
+        m_RHIDesc.latencyMode = *mode;
+    else
+        SOLARC_APP_WARN("Config: unknown latency_mode '{}' (low_latency, balanced, throughput), using balanced", latencyMode);
+
+    int64_t framesInFlight = toml::find_or(rendering, "frames_in_flight", int64_t(0));
+    if (framesInFlight != 0 && (framesInFlight < RHIDesc::MIN_FRAMES_IN_FLIGHT || framesInFlight > RHIDesc::MAX_FRAMES_IN_FLIGHT))
+    {
+        SOLARC_APP_WARN("Config: frames_in_flight = {} out of range [{}, {}], using latency mode default",
+            framesInFlight, RHIDesc::MIN_FRAMES_IN_FLIGHT, RHIDesc::MAX_FRAMES_IN_FLIGHT);
+        framesInFlight = 0;
+    }
+    m_RHIDesc.framesInFlight = static_cast<uint32_t>(framesInFlight);
+    SOLARC_APP_INFO("Config: Latency mode = {}, frames in flight = {}",
+        RHILatencyModeToString(m_RHIDesc.latencyMode), m_RHIDesc.GetFramesInFlight());
+
+    // Parse pipeline cache (stored next to the log file)
+    if (toml::find_or(rendering, "pipeline_cache", true))
+        m_RHIDesc.pipelineCachePath = (std::filesystem::path(Log::GetLogDirectory()) / "pipeline_cache.bin").string();
+    else
+        m_RHIDesc.pipelineCachePath.clear();
+    SOLARC_APP_INFO("Config: Pipeline cache = {}",
+        m_RHIDesc.pipelineCachePath.empty() ? "off" : m_RHIDesc.pipelineCachePath);
+
+    // Parse frame statistics log interval
+    double statsInterval = toml::find_or(rendering, "frame_stats_interval", 10.0);
+    if (statsInterval < 0.0)
+    {
+        SOLARC_APP_WARN("Config: frame_stats_interval = {} is negative, disabling frame stats log", statsInterval);
+        statsInterval = 0.0;
+    }
+    m_FrameTimer.SetLogInterval(std::chrono::duration_cast<FrameTimer::Clock::duration>(
+        std::chrono::duration<double>(statsInterval)));
+    SOLARC_APP_INFO("Config: Frame stats log interval = {}s", statsInterval);
+}
+
+void SolarcApp::ParseInputData(const toml::value& configData)
+{
+    if (!configData.contains("input"))
+    {
+        SOLARC_APP_DEBUG("No [input] section in config, no actions bound");
+        return;
+    }
+
+    const auto& input = toml::find(configData, "input");
+    if (!input.is_table())
+    {
+        SOLARC_APP_ERROR("[input] must be a table");
+        return;
+    }
+
+    // Read input on a dedicated thread (lower latency under long frames)
+    bool inputThread = toml::find_or(input, "input_thread", false);
+    if (inputThread && m_Ctx.windowCtx)
+    {
+        if (m_Ctx.windowCtx->StartInputThread())
+            SOLARC_APP_INFO("Config: Input thread = enabled");
+        else
+            SOLARC_APP_WARN("Config: Input thread requested but unavailable, reading input on main thread");
+    }
+
+    auto actionMap = std::make_shared<InputActionMap>();
+
+    // [input.actions]: Name = ["Chord", "Chord", ...]
+    if (input.contains("actions"))
+    {
+        const auto& actions = toml::find(input, "actions");
+        if (!actions.is_table())
+        {
+            SOLARC_APP_ERROR("[input.actions] must be a table");
+            return;
+        }
+
+        for (const auto& [name, bindings] : toml::get<toml::table>(actions))
+        {
+            InputActionId id = actionMap->AddAction(name);
+            if (id == INVALID_INPUT_ACTION)
+            {
+                SOLARC_APP_ERROR("Too many input actions (max {}), ignoring '{}'", MAX_INPUT_ACTIONS, name);
+                continue;
+            }
+
+            if (!bindings.is_array())
+            {
+                SOLARC_APP_ERROR("Bindings for action '{}' must be an array of strings", name);
+                continue;
+            }
+
+            for (const auto& binding : bindings.as_array())
+            {
+                if (!binding.is_string())
+                {
+                    SOLARC_APP_ERROR("Binding for action '{}' must be a string", name);
+                    continue;
+                }
+
+                std::string chord = toml::get<std::string>(binding);
+                if (!actionMap->AddBinding(id, chord))
+                    SOLARC_APP_WARN("Unknown binding '{}' for action '{}'", chord, name);
+            }
+        }
+    }
+
+    // [input.axes]: Name = { positive = "Action", negative = "Action", scale = 1.0 }
+    //           or  Name = { source = "MouseX", scale = 0.1 }
+    if (input.contains("axes"))
+    {
+        const auto& axes = toml::find(input, "axes");
+        if (!axes.is_table())
+        {
+            SOLARC_APP_ERROR("[input.axes] must be a table");
+            return;
+        }
+
+        for (const auto& [name, axis] : toml::get<toml::table>(axes))
+        {
+            if (!axis.is_table())
+            {
+                SOLARC_APP_ERROR("Axis '{}' must be a table", name);
+                continue;
+            }
+
+            float scale = static_cast<float>(toml::find_or(axis, "scale", 1.0));
+            InputAxisId id = INVALID_INPUT_AXIS;
+
+            if (axis.contains("source"))
+            {
+                std::string sourceName = toml::find<std::string>(axis, "source");
+                auto source = InputActionMap::ParseAxisSource(sourceName);
+                if (!source)
+                {
+                    SOLARC_APP_ERROR("Unknown source '{}' for axis '{}'", sourceName, name);
+                    continue;
+                }
+                id = actionMap->AddAxis(name, *source, scale);
+            }
+            else
+            {
+                std::string positive = toml::find_or(axis, "positive", std::string());
+                std::string negative = toml::find_or(axis, "negative", std::string());
+                InputActionId positiveId = actionMap->FindAction(positive);
+                InputActionId negativeId = actionMap->FindAction(negative);
+
+                if (!positive.empty() && positiveId == INVALID_INPUT_ACTION)
+                    SOLARC_APP_WARN("Axis '{}' references unknown action '{}'", name, positive);
+                if (!negative.empty() && negativeId == INVALID_INPUT_ACTION)
+                    SOLARC_APP_WARN("Axis '{}' references unknown action '{}'", name, negative);
+
+                id = actionMap->AddAxis(name, positiveId, negativeId, scale);
+            }
+
+            if (id == INVALID_INPUT_AXIS)
+                SOLARC_APP_ERROR("Could not add axis '{}' (duplicate or more than {} axes)", name, MAX_INPUT_AXES);
+        }
+    }
+
+    SOLARC_APP_INFO("Config: {} input actions, {} axes", actionMap->GetActionCount(), actionMap->GetAxisCount());
+    m_InputActionMap = std::move(actionMap);
 }
 
 // ============================================================================
@@ -229,6 +445,7 @@ SolarcApp::SolarcStateMachine::SolarcStateMachine(SolarcContext& solarcCtx,
 
 void SolarcApp::SolarcStateMachine::Update()
 {
+    m_TransitionedThisFrame = false;
     if (!m_CurrentState) return;
 
     // Update current state
@@ -238,9 +455,18 @@ void SolarcApp::SolarcStateMachine::Update()
     if (result.transition != StateTransition::NONE)
     {
         TransitionTo(result.transition, result.projectPath);
+        m_TransitionedThisFrame = true;
     }
 }
 
+bool SolarcApp::SolarcStateMachine::WantsContinuousFrames() const
+{
+    if (m_TransitionedThisFrame)
+        return true;
+
+    return m_CurrentState && m_CurrentState->WantsContinuousFrames();
+}
+
 void SolarcApp::SolarcStateMachine::TransitionTo(StateTransition transition,
     const std::string& data)
 {
@@ -330,6 +556,26 @@ SolarcApp::StateTransitionData SolarcApp::SolarcStateInitialize::Update()
     // Parse window data
     app.ParseWindowData(configData);
 
+    // Create the window context in the selected mode
+    if (!WindowContext::SetHeadless(app.m_Headless))
+        SOLARC_APP_WARN("Window context already exists; headless = {} ignored", app.m_Headless);
+
+    app.m_Ctx.windowCtx = &WindowContext::Get();
+    if (app.m_Ctx.windowCtx->IsHeadless())
+        SOLARC_APP_INFO("Running headless: windows are simulated, no renderer");
+
+    if (!app.m_InputRecordingPath.empty() &&
+        !app.m_Ctx.windowCtx->StartInputRecording(app.m_InputRecordingPath))
+    {
+        SOLARC_APP_ERROR("Input recording disabled: could not open '{}'", app.m_InputRecordingPath);
+    }
+
+    if (!app.m_InputReplayPath.empty() &&
+        !app.m_Ctx.windowCtx->StartInputReplay(app.m_InputReplayPath))
+    {
+        SOLARC_APP_ERROR("Input replay disabled: could not load '{}'", app.m_InputReplayPath);
+    }
+
     // Parse threading data
     app.ParseMTData(configData);
 
@@ -339,6 +585,9 @@ SolarcApp::StateTransitionData SolarcApp::SolarcStateInitialize::Update()
     // Parse rendering data
     app.ParseRenderingData(configData);
 
+    // Parse input action bindings
+    app.ParseInputData(configData);
+
     // Create JobSystem now that we have thread counts
     size_t numWorkers = app.GetThreadCountFor("job_system");
     if (numWorkers == 0) {
@@ -349,6 +598,10 @@ SolarcApp::StateTransitionData SolarcApp::SolarcStateInitialize::Update()
     app.m_JobSystem = std::make_unique<JobSystem>(numWorkers);
     app.m_Ctx.jobSystem = app.m_JobSystem.get();
 
+    // Windows update their input in parallel once there are several
+    if (app.m_Ctx.windowCtx)
+        app.m_Ctx.windowCtx->SetJobSystem(app.m_JobSystem.get());
+
     SOLARC_APP_INFO("JobSystem created with {} worker threads", numWorkers);
 
     // Decide next state based on whether we have an initial project
@@ -405,7 +658,7 @@ void SolarcApp::SolarcStateLoading::OnEnter()
     // Kick off async asset loading
     auto& jobSys = *m_SolarctCtxRef.jobSystem;
 
-    m_LoadingJob = jobSys.Schedule([projectPath = m_ProjectPath]() {// Simulate loading project configuration and assets
+    m_LoadingJob = jobSys.Schedule([projectPath = m_ProjectPath, windowCtx = m_SolarctCtxRef.windowCtx]() {// Simulate loading project configuration and assets
         SOLARC_APP_INFO("Loading project data for: {}", projectPath);
 
         // TODO: Real implementation would:
@@ -417,6 +670,10 @@ void SolarcApp::SolarcStateLoading::OnEnter()
         std::this_thread::sleep_for(std::chrono::milliseconds(500));
         SOLARC_APP_INFO("Project loading complete: {}", projectPath);
 
+        // Main loop may be blocked waiting for events
+        if (windowCtx)
+            windowCtx->WakeMainThread();
+
         }, {}, "Load Project");
 }
 
@@ -447,8 +704,10 @@ void SolarcApp::SolarcStateRunning::OnEnter()
     SOLARC_APP_INFO("Entering running state - creating main window");
 
     SolarcApp& app = SolarcApp::Get();
+    m_RunningFrames = 0;
 
     // Create the main window using parsed configuration
+    m_Headless = m_SolarctCtxRef.windowCtx->IsHeadless();
     m_MainWindow = m_SolarctCtxRef.windowCtx->CreateWindow(
         app.m_WindowName,
         app.m_WindowWidth,
@@ -457,16 +716,26 @@ void SolarcApp::SolarcStateRunning::OnEnter()
 
     m_Bus.RegisterProducer(m_MainWindow.get());
 
+    if (app.m_InputActionMap)
+        m_MainWindow->SetInputActionMap(app.m_InputActionMap);
+
+    if (app.m_RenderScale != 1.0f)
+        m_MainWindow->SetRenderScale(app.m_RenderScale);
+
     m_MainWindow->Show();
     m_MainWindow->Update();
     SOLARC_APP_INFO("Main window created and shown");
 
     // Initialize RHI with the main window
     try {
-        if (m_MainWindow->IsVisible() && !m_MainWindow->IsMinimized())
+        if (m_Headless && app.m_RHIDesc.target != RHITarget::Offscreen)
+        {
+            SOLARC_APP_INFO("Headless: RHI not initialized (no surface to present to; use offscreen to render)");
+        }
+        else if (m_MainWindow->IsVisible() && !m_MainWindow->IsMinimized())
         {
             SOLARC_APP_INFO("Initializing RHI...");
-            RHI::Initialize(m_MainWindow);
+            RHI::Initialize(m_MainWindow, app.m_RHIDesc);
             m_Bus.RegisterListener(&RHI::Get());
             SOLARC_APP_INFO("RHI initialized successfully");
 
@@ -483,7 +752,39 @@ void SolarcApp::SolarcStateRunning::OnEnter()
         throw; // Re-throw to trigger cleanup state
     }
 
+    BuildFrameGraph();
+}
 
+void SolarcApp::SolarcStateRunning::BuildFrameGraph()
+{
+    // Swapchain clear / present as graph nodes. The back buffer's size does
+    // not matter to the graph (it is imported), so resizes need no rebuild.
+    const RGTextureDesc backBufferDesc = {
+        static_cast<uint32_t>(std::max(m_MainWindow->GetWidth(), 1)),
+        static_cast<uint32_t>(std::max(m_MainWindow->GetHeight(), 1)),
+        RGFormat::BGRA8_UNORM
+    };
+
+    m_FrameGraph.Reset();
+    RGResourceHandle backBuffer = m_FrameGraph.ImportTexture("BackBuffer", backBufferDesc,
+        RGAccess::None, RGAccess::Present);
+
+    // Clear screen to dark blue
+    m_FrameGraph.AddPass("Clear",
+        [&](RGPassBuilder& builder) { builder.Write(backBuffer); },
+        [](RHICommandRecorder& recorder) { recorder.Clear(0.1f, 0.2f, 0.3f, 1.0f); });
+
+    // TODO: Future rendering work goes here, between Clear and Present:
+    // - Draw scene geometry
+    // - Render UI
+    // - Post-processing effects
+
+    m_FrameGraph.AddPass("Present",
+        [&](RGPassBuilder& builder) { builder.Read(backBuffer, RGAccess::Present); });
+
+    m_FrameGraph.Compile();
+    SOLARC_APP_DEBUG("Frame graph compiled: {} passes, {} batches",
+        m_FrameGraph.GetExecutionOrder().size(), m_FrameGraph.GetBatches().size());
 }
 
 SolarcApp::StateTransitionData SolarcApp::SolarcStateRunning::Update()
@@ -491,17 +792,17 @@ SolarcApp::StateTransitionData SolarcApp::SolarcStateRunning::Update()
     // Update the window (processes its event queue)
     m_MainWindow->Update();
 
-    if (!RHI::IsInitialized())
+    if (!RHI::IsInitialized() && (!m_Headless || SolarcApp::Get().m_RHIDesc.target == RHITarget::Offscreen))
     {
         if (m_MainWindow->IsVisible() && !m_MainWindow->IsMinimized())
         {
+            SolarcApp& app = SolarcApp::Get();
+
             SOLARC_APP_INFO("Initializing RHI...");
-            RHI::Initialize(m_MainWindow);
+            RHI::Initialize(m_MainWindow, app.m_RHIDesc);
             m_Bus.RegisterListener(&RHI::Get());
             SOLARC_APP_INFO("RHI initialized successfully");
 
-
-            SolarcApp& app = SolarcApp::Get();
             // Apply VSync preference if overridden
             if (app.m_VSyncOverride)
             {
@@ -517,20 +818,29 @@ SolarcApp::StateTransitionData SolarcApp::SolarcStateRunning::Update()
     {
         auto& rhi = RHI::Get();
 
-        // Begin frame
-        rhi.BeginFrame();
-
-        // Clear screen to dark blue
-        rhi.Clear(0.1f, 0.2f, 0.3f, 1.0f);
+        // Begin frame, record the graph's passes, end frame and present
+        m_FrameGraph.Execute(rhi, *SolarcApp::Get().m_JobSystem);
 
-        // TODO: Future rendering work goes here:
-        // - Draw scene geometry
-        // - Render UI
-        // - Post-processing effects
+        // Renderer blocking times for the frame statistics
+        const RHIFrameTimings& timings = rhi.GetLastFrameTimings();
+        FrameTimer& frameTimer = SolarcApp::Get().m_FrameTimer;
+        if (timings.presented)
+        {
+            frameTimer.RecordSample(FrameMetric::GpuWait, std::chrono::microseconds(timings.waitForFrameUs));
+            frameTimer.RecordSample(FrameMetric::Acquire, std::chrono::microseconds(timings.acquireUs));
+            if (timings.presentIntervalUs > 0)
+                frameTimer.RecordSample(FrameMetric::PresentInterval, std::chrono::microseconds(timings.presentIntervalUs));
+        }
 
-        // End frame and present
-        rhi.EndFrame();
-        rhi.Present();
+        // Compositor feedback: start frames just before the vblank they can
+        // make (vsync only - without it there is no refresh to wait for)
+        PresentTimingModel* presentTiming = rhi.GetPresentTiming();
+        SolarcApp::Get().m_FramePacer.SetPresentTiming(rhi.GetVSync() ? presentTiming : nullptr);
+        if (presentTiming && presentTiming->GetPresentedCount() != m_LastPresentFeedback)
+        {
+            m_LastPresentFeedback = presentTiming->GetPresentedCount();
+            frameTimer.RecordSample(FrameMetric::DisplayLatency, presentTiming->GetLastDisplayLatency());
+        }
     }
 
     // Check if window was closed
@@ -540,13 +850,33 @@ SolarcApp::StateTransitionData SolarcApp::SolarcStateRunning::Update()
         return { StateTransition::TO_CLEANUP, "" };
     }
 
+    // Only frames of this state count: the frame timer also counted the
+    // initialization and loading frames
+    const uint64_t frameLimit = SolarcApp::Get().m_FrameLimit;
+    if (frameLimit != 0 && ++m_RunningFrames >= frameLimit)
+    {
+        SOLARC_APP_INFO("Frame limit reached ({} frames)", frameLimit);
+        return { StateTransition::TO_CLEANUP, "" };
+    }
+
     return { StateTransition::NONE, "" };
 }
 
+bool SolarcApp::SolarcStateRunning::WantsContinuousFrames() const
+{
+    // Minimized / hidden: nothing to present, sleep until the window changes.
+    // Headless windows are paced like real ones so the loop can be measured.
+    return m_MainWindow && (RHI::IsInitialized() || m_Headless)
+        && m_MainWindow->IsVisible() && !m_MainWindow->IsMinimized();
+}
+
 void SolarcApp::SolarcStateRunning::OnExit()
 {
     SOLARC_APP_INFO("Exiting running state - cleaning up RHI and window");
 
+    // The pacer must not outlive the RHI's display timing
+    SolarcApp::Get().m_FramePacer.SetPresentTiming(nullptr);
+
     // Shutdown RHI BEFORE destroying the window
     if (RHI::IsInitialized())
     {
@@ -0,0 +1,47 @@
+#include "Utility/FramePacer.h"
+#include "Utility/PresentTimingModel.h"
+
+FramePacer::FramePacer(uint32_t targetFrameRate)
+{
+    SetTargetFrameRate(targetFrameRate);
+}
+
+void FramePacer::SetTargetFrameRate(uint32_t framesPerSecond)
+{
+    m_TargetFrameRate = framesPerSecond;
+    m_Period = framesPerSecond > 0
+        ? std::chrono::duration_cast<Clock::duration>(std::chrono::nanoseconds(1000000000ull / framesPerSecond))
+        : Clock::duration::zero();
+    m_HasDeadline = false;
+}
+
+bool FramePacer::IsDisplaySynced() const
+{
+    return m_PresentTiming && m_PresentTiming->HasPrediction();
+}
+
+FramePacer::Clock::time_point FramePacer::NextFrameDeadline(Clock::time_point now)
+{
+    if (IsUnlimited())
+        return IsDisplaySynced() ? m_PresentTiming->ScheduleFrame(now) : now;
+
+    if (!m_HasDeadline)
+    {
+        m_Deadline = now + m_Period;
+        m_HasDeadline = true;
+    }
+    else
+    {
+        m_Deadline += m_Period;
+
+        // More than a full period late: drop the missed slots instead of
+        // running back-to-back frames to catch up
+        if (m_Deadline + m_Period < now)
+            m_Deadline = now;
+    }
+
+    // Snap only the returned start: feeding it back into the grid would round
+    // every period up to whole refreshes (a cap between refresh / 2 and the
+    // refresh rate would then run at refresh / 2)
+    return IsDisplaySynced() ? m_PresentTiming->ScheduleFrame(m_Deadline) : m_Deadline;
+}
@@ -0,0 +1,140 @@
+#include "Utility/FrameTimer.h"
+#include "Logging/LogMacros.h"
+#include <algorithm>
+
+namespace
+{
+    float ToMilliseconds(FrameTimer::Clock::duration duration)
+    {
+        return std::chrono::duration<float, std::milli>(duration).count();
+    }
+}
+
+const char* FrameMetricToString(FrameMetric metric)
+{
+    switch (metric)
+    {
+    case FrameMetric::CpuFrame:        return "CpuFrame";
+    case FrameMetric::PresentInterval: return "PresentInterval";
+    case FrameMetric::GpuWait:         return "GpuWait";
+    case FrameMetric::Acquire:         return "Acquire";
+    case FrameMetric::DisplayLatency:  return "DisplayLatency";
+    default:                           return "Unknown";
+    }
+}
+
+void FrameTimer::BeginFrame(Clock::time_point now)
+{
+    if (m_HasFrameStart)
+    {
+        Clock::duration interval = now - m_FrameStart;
+        m_DeltaTime = std::chrono::duration<float>(interval).count();
+        m_FrameIntervals.Push(ToMilliseconds(interval));
+    }
+    else
+    {
+        m_LastLog = now;
+    }
+
+    m_FrameStart = now;
+    m_HasFrameStart = true;
+}
+
+void FrameTimer::EndFrame(Clock::time_point now)
+{
+    if (!m_HasFrameStart) return;
+
+    RecordSample(FrameMetric::CpuFrame, now - m_FrameStart);
+    ++m_FrameCount;
+
+    if (m_LogInterval > Clock::duration::zero() && now - m_LastLog >= m_LogInterval)
+    {
+        LogStats();
+        m_LastLog = now;
+    }
+}
+
+void FrameTimer::RecordSample(FrameMetric metric, Clock::duration duration)
+{
+    m_Samples[static_cast<size_t>(metric)].Push(ToMilliseconds(duration));
+}
+
+FrameTimeStats FrameTimer::GetStats(FrameMetric metric) const
+{
+    return ComputeStats(m_Samples[static_cast<size_t>(metric)]);
+}
+
+float FrameTimer::GetFps() const
+{
+    FrameTimeStats intervals = ComputeStats(m_FrameIntervals);
+    return intervals.mean > 0.0f ? 1000.0f / intervals.mean : 0.0f;
+}
+
+void FrameTimer::Reset()
+{
+    for (auto& samples : m_Samples)
+        samples.Clear();
+    m_FrameIntervals.Clear();
+    m_HasFrameStart = false;
+    m_DeltaTime = 0.0f;
+}
+
+FrameTimeStats FrameTimer::ComputeStats(const SampleWindow& samples)
+{
+    FrameTimeStats stats;
+    stats.sampleCount = static_cast<uint32_t>(samples.Size());
+    if (samples.Empty()) return stats;
+
+    // Scratch copy: nth_element reorders
+    std::array<float, WINDOW_SIZE> sorted;
+    const size_t count = samples.Size();
+    float sum = 0.0f;
+    for (size_t i = 0; i < count; ++i)
+    {
+        sorted[i] = samples[i];
+        sum += sorted[i];
+    }
+
+    // Nearest-rank percentiles (index ceil(p * n) - 1, in integers so 0.95f
+    // and 0.99f cannot round up a rank); each nth_element only searches
+    // above the previous rank
+    auto rank = [count](size_t percent) { return std::max<size_t>((percent * count + 99) / 100, 1) - 1; };
+    const size_t i50 = rank(50), i95 = rank(95), i99 = rank(99);
+
+    auto end = sorted.begin() + count;
+    std::nth_element(sorted.begin(), sorted.begin() + i50, end);
+    if (i95 > i50)
+        std::nth_element(sorted.begin() + i50 + 1, sorted.begin() + i95, end);
+    if (i99 > i95)
+        std::nth_element(sorted.begin() + i95 + 1, sorted.begin() + i99, end);
+
+    stats.p50 = sorted[i50];
+    stats.p95 = sorted[i95];
+    stats.p99 = sorted[i99];
+    stats.max = *std::max_element(sorted.begin() + i99, end);
+    stats.mean = sum / static_cast<float>(count);
+    return stats;
+}
+
+void FrameTimer::LogStats() const
+{
+    FrameTimeStats cpu = GetStats(FrameMetric::CpuFrame);
+    FrameTimeStats present = GetStats(FrameMetric::PresentInterval);
+    FrameTimeStats wait = GetStats(FrameMetric::GpuWait);
+    FrameTimeStats acquire = GetStats(FrameMetric::Acquire);
+
+    SOLARC_APP_INFO("Frame stats (p50/p95/p99 ms): cpu {:.2f}/{:.2f}/{:.2f} | present {:.2f}/{:.2f}/{:.2f} | "
+        "gpu wait {:.2f}/{:.2f}/{:.2f} | acquire {:.2f}/{:.2f}/{:.2f} | {:.1f} fps",
+        cpu.p50, cpu.p95, cpu.p99,
+        present.p50, present.p95, present.p99,
+        wait.p50, wait.p95, wait.p99,
+        acquire.p50, acquire.p95, acquire.p99,
+        GetFps());
+
+    FrameTimeStats display = GetStats(FrameMetric::DisplayLatency);
+    if (display.sampleCount > 0)
+    {
+        SOLARC_APP_INFO("Display latency (p50/p95/p99 ms): {:.2f}/{:.2f}/{:.2f}",
+            display.p50, display.p95, display.p99);
+    }
+}
@@ -0,0 +1,90 @@
+#include "Utility/PresentTimingModel.h"
+#include <algorithm>
+
+void PresentTimingModel::OnPresented(const PresentFeedback& feedback)
+{
+    ++m_PresentedCount;
+    if (feedback.zeroCopy)
+        ++m_ZeroCopyCount;
+
+    m_LastDisplayLatency = std::max(feedback.displayTime - feedback.presentTime, Clock::duration::zero());
+
+    // Variable / unknown refresh: nothing to align to
+    m_RefreshInterval = std::max(feedback.refreshInterval, Clock::duration::zero());
+    if (m_RefreshInterval == Clock::duration::zero())
+        m_Schedule.Clear();
+
+    // Judge the margin only on frames this model scheduled
+    if (const ScheduledFrame* scheduled = FindScheduledFrame(feedback.frameStart);
+        scheduled && m_RefreshInterval > Clock::duration::zero())
+    {
+        if (feedback.displayTime > scheduled->vblank + m_RefreshInterval / 2)
+        {
+            ++m_MissedCount;
+            m_HitStreak = 0;
+            m_SafetyMargin = std::min(m_SafetyMargin + MARGIN_STEP, std::max(m_RefreshInterval, MIN_SAFETY_MARGIN));
+        }
+        else if (++m_HitStreak >= HIT_STREAK)
+        {
+            m_HitStreak = 0;
+            m_SafetyMargin = std::max(m_SafetyMargin - MARGIN_STEP, MIN_SAFETY_MARGIN);
+        }
+    }
+
+    // Work estimate: worst start-to-present time of the recent frames
+    m_WorkSamples.Push(std::max(feedback.presentTime - feedback.frameStart, Clock::duration::zero()));
+    m_WorkEstimate = Clock::duration::zero();
+    for (size_t i = 0; i < m_WorkSamples.Size(); ++i)
+        m_WorkEstimate = std::max(m_WorkEstimate, m_WorkSamples[i]);
+
+    m_LastVBlank = feedback.displayTime;
+    m_HasVBlank = true;
+}
+
+void PresentTimingModel::Reset()
+{
+    *this = PresentTimingModel{};
+}
+
+PresentTimingModel::Clock::time_point PresentTimingModel::PredictVBlank(Clock::time_point notBefore) const
+{
+    if (!HasPrediction())
+        return notBefore;
+
+    // Refreshes from the last vblank, rounded up (negative when notBefore is in the past)
+    const auto ticks = (notBefore - m_LastVBlank).count();
+    const auto period = m_RefreshInterval.count();
+    auto refreshes = ticks / period;
+    if (refreshes * period < ticks)
+        ++refreshes;
+
+    return m_LastVBlank + refreshes * m_RefreshInterval;
+}
+
+PresentTimingModel::Clock::time_point PresentTimingModel::ScheduleFrame(Clock::time_point notBefore)
+{
+    if (!HasPrediction())
+        return notBefore;
+
+    const Clock::duration lead = GetLeadTime();
+    const Clock::time_point vblank = PredictVBlank(notBefore + lead);
+    const Clock::time_point start = vblank - lead;
+
+    m_Schedule.Push({ start, vblank });
+    return start;
+}
+
+const PresentTimingModel::ScheduledFrame* PresentTimingModel::FindScheduledFrame(Clock::time_point frameStart) const
+{
+    // Newest schedule at or before the frame start; a frame that began more
+    // than its lead time late was not started by the schedule
+    for (size_t i = m_Schedule.Size(); i-- > 0;)
+    {
+        const ScheduledFrame& scheduled = m_Schedule[i];
+        if (scheduled.start > frameStart)
+            continue;
+
+        return (frameStart - scheduled.start) <= (scheduled.vblank - scheduled.start) ? &scheduled : nullptr;
+    }
+    return nullptr;
+}
@@ -0,0 +1,269 @@
+#include "Utility/TLSFAllocator.h"
+#include "Logging/LogMacros.h"
+#include <algorithm>
+#include <bit>
+
+TLSFAllocator::TLSFAllocator(uint64_t size)
+    : m_Size(size)
+{
+    SOLARC_ASSERT(size > 0, "TLSF allocator needs a non-empty range");
+
+    for (auto& heads : m_FreeHeads) {
+        std::fill(std::begin(heads), std::end(heads), NIL);
+    }
+
+    const uint32_t whole = NewRange();
+    m_Ranges[whole].offset = 0;
+    m_Ranges[whole].size = size;
+    InsertFree(whole);
+}
+
+// ============================================================================
+// Allocation
+// ============================================================================
+
+bool TLSFAllocator::Allocate(uint64_t size, uint64_t alignment, uint64_t& offset)
+{
+    SOLARC_ASSERT(size > 0, "Cannot allocate an empty range");
+    SOLARC_ASSERT(alignment > 0 && std::has_single_bit(alignment), "Alignment must be a power of two");
+
+    if (size > GetFreeBytes()) {
+        return false;
+    }
+
+    auto fits = [&](uint32_t candidate) {
+        const Range& range = m_Ranges[candidate];
+        const uint64_t aligned = (range.offset + alignment - 1) & ~(alignment - 1);
+        return aligned + size <= range.offset + range.size;
+    };
+
+    // Most ranges start aligned already; otherwise searching for
+    // size + alignment - 1 guarantees the aligned range fits
+    uint32_t index = FindFree(size);
+    if (index == NIL || !fits(index)) {
+        index = FindFree(size + alignment - 1);
+    }
+    if (index == NIL) {
+        return false;
+    }
+    RemoveFree(index);
+
+    const uint64_t aligned = (m_Ranges[index].offset + alignment - 1) & ~(alignment - 1);
+    const uint64_t padding = aligned - m_Ranges[index].offset;
+
+    // Alignment padding stays free. Its physical predecessor is allocated
+    // (free neighbours are always merged), so nothing to merge with.
+    if (padding > 0) {
+        const uint32_t front = NewRange();
+        Range& range = m_Ranges[index];
+        m_Ranges[front].offset = range.offset;
+        m_Ranges[front].size = padding;
+        m_Ranges[front].prevPhysical = range.prevPhysical;
+        m_Ranges[front].nextPhysical = index;
+        if (range.prevPhysical != NIL) {
+            m_Ranges[range.prevPhysical].nextPhysical = front;
+        }
+        range.prevPhysical = front;
+        range.offset = aligned;
+        range.size -= padding;
+        InsertFree(front);
+    }
+
+    if (m_Ranges[index].size > size) {
+        const uint32_t back = NewRange();
+        Range& range = m_Ranges[index];
+        m_Ranges[back].offset = aligned + size;
+        m_Ranges[back].size = range.size - size;
+        m_Ranges[back].prevPhysical = index;
+        m_Ranges[back].nextPhysical = range.nextPhysical;
+        if (range.nextPhysical != NIL) {
+            m_Ranges[range.nextPhysical].prevPhysical = back;
+        }
+        range.nextPhysical = back;
+        range.size = size;
+        InsertFree(back);
+    }
+
+    m_Ranges[index].free = false;
+    m_UsedBytes += size;
+    m_Allocated.emplace(aligned, index);
+
+    offset = aligned;
+    return true;
+}
+
+void TLSFAllocator::Free(uint64_t offset)
+{
+    auto it = m_Allocated.find(offset);
+    SOLARC_ASSERT(it != m_Allocated.end(), "Freeing a range that is not allocated");
+    if (it == m_Allocated.end()) {
+        return;
+    }
+
+    uint32_t index = it->second;
+    m_Allocated.erase(it);
+    m_UsedBytes -= m_Ranges[index].size;
+
+    // Merge with the free physical neighbours
+    const uint32_t prev = m_Ranges[index].prevPhysical;
+    if (prev != NIL && m_Ranges[prev].free) {
+        RemoveFree(prev);
+        m_Ranges[prev].size += m_Ranges[index].size;
+        m_Ranges[prev].nextPhysical = m_Ranges[index].nextPhysical;
+        if (m_Ranges[index].nextPhysical != NIL) {
+            m_Ranges[m_Ranges[index].nextPhysical].prevPhysical = prev;
+        }
+        ReleaseRange(index);
+        index = prev;
+    }
+
+    const uint32_t next = m_Ranges[index].nextPhysical;
+    if (next != NIL && m_Ranges[next].free) {
+        RemoveFree(next);
+        m_Ranges[index].size += m_Ranges[next].size;
+        m_Ranges[index].nextPhysical = m_Ranges[next].nextPhysical;
+        if (m_Ranges[next].nextPhysical != NIL) {
+            m_Ranges[m_Ranges[next].nextPhysical].prevPhysical = index;
+        }
+        ReleaseRange(next);
+    }
+
+    InsertFree(index);
+}
+
+uint64_t TLSFAllocator::GetLargestFreeRange() const
+{
+    if (m_FirstLevelBitmap == 0) {
+        return 0;
+    }
+
+    // The largest range is in the highest non-empty bin
+    const uint32_t firstLevel = 63 - std::countl_zero(m_FirstLevelBitmap);
+    const uint32_t secondLevel = 31 - std::countl_zero(m_SecondLevelBitmaps[firstLevel]);
+
+    uint64_t largest = 0;
+    for (uint32_t index = m_FreeHeads[firstLevel][secondLevel]; index != NIL; index = m_Ranges[index].nextFree) {
+        largest = std::max(largest, m_Ranges[index].size);
+    }
+    return largest;
+}
+
+// ============================================================================
+// Bins
+// ============================================================================
+
+void TLSFAllocator::MapSize(uint64_t size, uint32_t& firstLevel, uint32_t& secondLevel)
+{
+    if (size < SMALL_SIZE) {
+        firstLevel = 0;
+        secondLevel = static_cast<uint32_t>(size / (SMALL_SIZE / SECOND_LEVEL_COUNT));
+        return;
+    }
+
+    constexpr uint32_t smallLog2 = std::countr_zero(SMALL_SIZE);
+    const uint32_t log2 = 63 - std::countl_zero(size);
+    firstLevel = log2 - smallLog2 + 1;
+    secondLevel = static_cast<uint32_t>(size >> (log2 - SECOND_LEVEL_LOG2)) - SECOND_LEVEL_COUNT;
+}
+
+uint32_t TLSFAllocator::FindFree(uint64_t size) const
+{
+    // Round up to the next bin boundary so every range in the bin fits
+    if (size < SMALL_SIZE) {
+        size += SMALL_SIZE / SECOND_LEVEL_COUNT - 1;
+    }
+    else {
+        const uint32_t log2 = 63 - std::countl_zero(size);
+        size += (uint64_t{ 1 } << (log2 - SECOND_LEVEL_LOG2)) - 1;
+    }
+
+    uint32_t firstLevel, secondLevel;
+    MapSize(size, firstLevel, secondLevel);
+    if (firstLevel >= FIRST_LEVEL_COUNT) {
+        return NIL;
+    }
+
+    uint32_t secondLevelMap = m_SecondLevelBitmaps[firstLevel] & (~0u << secondLevel);
+    if (secondLevelMap == 0) {
+        if (firstLevel + 1 >= FIRST_LEVEL_COUNT) {
+            return NIL;
+        }
+        const uint64_t firstLevelMap = m_FirstLevelBitmap & (~uint64_t{ 0 } << (firstLevel + 1));
+        if (firstLevelMap == 0) {
+            return NIL;
+        }
+        firstLevel = std::countr_zero(firstLevelMap);
+        secondLevelMap = m_SecondLevelBitmaps[firstLevel];
+    }
+
+    secondLevel = std::countr_zero(secondLevelMap);
+    return m_FreeHeads[firstLevel][secondLevel];
+}
+
+void TLSFAllocator::InsertFree(uint32_t index)
+{
+    uint32_t firstLevel, secondLevel;
+    MapSize(m_Ranges[index].size, firstLevel, secondLevel);
+
+    Range& range = m_Ranges[index];
+    range.free = true;
+    range.prevFree = NIL;
+    range.nextFree = m_FreeHeads[firstLevel][secondLevel];
+    if (range.nextFree != NIL) {
+        m_Ranges[range.nextFree].prevFree = index;
+    }
+
+    m_FreeHeads[firstLevel][secondLevel] = index;
+    m_SecondLevelBitmaps[firstLevel] |= 1u << secondLevel;
+    m_FirstLevelBitmap |= uint64_t{ 1 } << firstLevel;
+}
+
+void TLSFAllocator::RemoveFree(uint32_t index)
+{
+    uint32_t firstLevel, secondLevel;
+    MapSize(m_Ranges[index].size, firstLevel, secondLevel);
+
+    Range& range = m_Ranges[index];
+    if (range.prevFree != NIL) {
+        m_Ranges[range.prevFree].nextFree = range.nextFree;
+    }
+    if (range.nextFree != NIL) {
+        m_Ranges[range.nextFree].prevFree = range.prevFree;
+    }
+
+    if (m_FreeHeads[firstLevel][secondLevel] == index) {
+        m_FreeHeads[firstLevel][secondLevel] = range.nextFree;
+        if (range.nextFree == NIL) {
+            m_SecondLevelBitmaps[firstLevel] &= ~(1u << secondLevel);
+            if (m_SecondLevelBitmaps[firstLevel] == 0) {
+                m_FirstLevelBitmap &= ~(uint64_t{ 1 } << firstLevel);
+            }
+        }
+    }
+
+    range.free = false;
+    range.prevFree = NIL;
+    range.nextFree = NIL;
+}
+
+// ============================================================================
+// Range storage
+// ============================================================================
+
+uint32_t TLSFAllocator::NewRange()
+{
+    if (!m_UnusedRanges.empty()) {
+        const uint32_t index = m_UnusedRanges.back();
+        m_UnusedRanges.pop_back();
+        m_Ranges[index] = Range{};
+        return index;
+    }
+
+    m_Ranges.emplace_back();
+    return static_cast<uint32_t>(m_Ranges.size() - 1);
+}
+
+void TLSFAllocator::ReleaseRange(uint32_t index)
+{
+    m_UnusedRanges.push_back(index);
+}
@@ -0,0 +1,101 @@
+#include "Window/WindowPlatform.h"
+#include "Logging/LogMacros.h"
+
+// ============================================================================
+// Headless windows
+// ============================================================================
+//
+// Used on every platform when WindowContextPlatform::IsHeadless(). There is
+// no OS surface: commands take effect immediately, publish the new state and
+// dispatch the event the OS would have produced for them.
+
+void WindowPlatform::InitializeHeadless()
+{
+    m_Headless = true;
+    PublishState();
+
+    SOLARC_WINDOW_TRACE("Headless window platform created: '{}' ({}x{})", m_Title, m_Width, m_Height);
+}
+
+void WindowPlatform::HeadlessShow()
+{
+    std::lock_guard lk(mtx);
+    if (m_Visible) return;
+
+    m_Visible = true;
+    PublishState();
+    DispatchWindowEvent(std::make_shared<WindowShownEvent>());
+}
+
+void WindowPlatform::HeadlessHide()
+{
+    std::lock_guard lk(mtx);
+    if (!m_Visible) return;
+
+    m_Visible = false;
+    PublishState();
+    DispatchWindowEvent(std::make_shared<WindowHiddenEvent>());
+}
+
+void WindowPlatform::HeadlessResize(int32_t width, int32_t height)
+{
+    std::lock_guard lk(mtx);
+    if (width <= 0 || height <= 0)
+    {
+        SOLARC_WINDOW_WARN("Headless resize of '{}' to {}x{} ignored", m_Title, width, height);
+        return;
+    }
+    if (width == m_Width && height == m_Height) return;
+
+    m_Width = width;
+    m_Height = height;
+    PublishState();
+    DispatchWindowEvent(std::make_shared<WindowResizeEvent>(width, height));
+}
+
+void WindowPlatform::HeadlessMinimize()
+{
+    std::lock_guard lk(mtx);
+    if (m_Minimized) return;
+
+    m_Minimized = true;
+    PublishState();
+    DispatchWindowEvent(std::make_shared<WindowMinimizedEvent>());
+}
+
+void WindowPlatform::HeadlessMaximize()
+{
+    std::lock_guard lk(mtx);
+
+    m_Minimized = false;
+    m_Maximized = true;
+    PublishState();
+    DispatchWindowEvent(std::make_shared<WindowMaximizedEvent>());
+}
+
+void WindowPlatform::HeadlessRestore()
+{
+    std::lock_guard lk(mtx);
+
+    m_Minimized = false;
+    m_Maximized = false;
+    PublishState();
+    DispatchWindowEvent(std::make_shared<WindowRestoredEvent>());
+}
+
+void WindowPlatform::HeadlessSetCursorMode(CursorMode mode)
+{
+    // No pointer to constrain; the mode is only recorded
+    std::lock_guard lk(mtx);
+    m_CursorMode = mode;
+}
+
+void WindowPlatform::HeadlessSetRenderScale(float scale)
+{
+    // Display scale stays 1.0: headless sizes are device pixels
+    std::lock_guard lk(mtx);
+
+    SurfaceScale surfaceScale = m_SurfaceScale;
+    surfaceScale.renderScale = SurfaceScale::ClampRenderScale(scale);
+    UpdateSurfaceScale(surfaceScale);
+}
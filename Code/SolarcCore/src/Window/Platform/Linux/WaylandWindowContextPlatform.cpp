@@ -3,12 +3,50 @@
 #include "Window/WindowPlatform.h"
 #include "Logging/LogMacros.h"
 #include <stdexcept>
+#include <algorithm>
 #include <cstring>
 #include <poll.h>
-#include "Input/WaylandKeyMapping.h"
+#include "Input/Platform/Linux/WaylandKeyMapping.h"
+#include "Input/InputTimestamp.h"
 #include "Input/MouseButton.h"
+#include "Input/InputEventQueue.h"
+#include "Input/KeyModifiers.h"
+#include "Input/TextInput.h"
 #include <linux/input-event-codes.h>  // For BTN_LEFT, BTN_RIGHT, etc.
 #include <unistd.h>  // For close()
+#include <time.h>    // For clock_gettime()
+#include <cstdlib>   // For getenv()
+#include <wayland-cursor.h>
+#include <sys/eventfd.h>
+#include <sys/timerfd.h>
+#include <cerrno>
+
+namespace
+{
+    /**
+     * Convert a Wayland event 'time' argument (milliseconds, compositor clock,
+     * CLOCK_MONOTONIC on all mainstream compositors) to an InputTimestamp.
+     */
+    InputTimestamp WaylandEventTimestamp(uint32_t time)
+    {
+        timespec ts{};
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        uint32_t nowMs = static_cast<uint32_t>(
+            static_cast<uint64_t>(ts.tv_sec) * 1000 + static_cast<uint64_t>(ts.tv_nsec) / 1000000);
+        return InputClock::FromEventTimeMs(time, nowMs);
+    }
+
+    /**
+     * Same as WaylandEventTimestamp, for 64-bit microsecond event times.
+     */
+    InputTimestamp WaylandEventTimestampUs(uint64_t timeUs)
+    {
+        timespec ts{};
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+        uint64_t nowUs = static_cast<uint64_t>(ts.tv_sec) * 1000000 + static_cast<uint64_t>(ts.tv_nsec) / 1000;
+        return InputClock::FromEventTimeUs(timeUs, nowUs, InputClock::Now());
+    }
+}
 
 
 const wl_registry_listener WindowContextPlatform::s_RegistryListener = {
@@ -20,8 +58,27 @@ const xdg_wm_base_listener WindowContextPlatform::s_XdgWmBaseListener = {
     .ping = xdg_wm_base_ping
 };
 
+const wp_presentation_listener WindowContextPlatform::s_PresentationListener = {
+    .clock_id = presentation_clock_id
+};
+
 WindowContextPlatform::WindowContextPlatform()
 {
+    m_Headless = s_HeadlessRequested.load(std::memory_order_acquire);
+    s_Created.store(true, std::memory_order_release);
+
+    // Wait primitives for the event-driven main loop
+    m_WakeFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    m_TimerFd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+    if (m_WakeFd < 0 || m_TimerFd < 0)
+        SOLARC_WINDOW_WARN("eventfd/timerfd unavailable ({}); frame waits fall back to poll timeouts", strerror(errno));
+
+    if (m_Headless)
+    {
+        SOLARC_WINDOW_INFO("Headless window context initialized (no Wayland connection)");
+        return;
+    }
+
     m_Display = wl_display_connect(nullptr);
     if (!m_Display)
         throw std::runtime_error("Failed to connect to Wayland display");
@@ -37,6 +94,18 @@ WindowContextPlatform::WindowContextPlatform()
     }
 
     xdg_wm_base_add_listener(m_XdgWmBase, &s_XdgWmBaseListener, this);
+
+    if (!m_RelativePointerManager)
+        SOLARC_WINDOW_WARN("Compositor doesn't support relative pointer; mouse deltas will be accelerated");
+    if (!m_PointerConstraints)
+        SOLARC_WINDOW_WARN("Compositor doesn't support pointer constraints; cursor lock/confine unavailable");
+
+    LoadCursorTheme();
+
+    m_RepeatTimerFd = timerfd_create(CLOCK_MONOTONIC, TFD_CLOEXEC | TFD_NONBLOCK);
+    if (m_RepeatTimerFd < 0)
+        SOLARC_WINDOW_WARN("Key repeat timerfd unavailable ({}); idle windows repeat keys late", strerror(errno));
+
     SOLARC_WINDOW_INFO("Wayland context initialized");
 }
 
@@ -80,27 +149,156 @@ void WindowContextPlatform::PollEvents()
     // Dispatch any events now available
 
     wl_display_dispatch_pending(m_Display);
+
+    // Repeats due since the last frame, in one batch (the input thread
+    // generates its own as they fall due)
+    if (!m_SeatQueue)
+    {
+        uint64_t expirations;
+        if (m_RepeatTimerFd >= 0)
+            (void)read(m_RepeatTimerFd, &expirations, sizeof(expirations));
+        GenerateKeyRepeats(InputClock::Now());
+    }
+
     wl_display_flush(m_Display);
 }
 
+void WindowContextPlatform::WaitForEvents(std::chrono::steady_clock::time_point deadline, bool wakeOnInput)
+{
+    if (m_ShuttingDown) return;
+    if (!m_Display && !m_Headless) return;
+
+    // Headless: no OS input, only the deadline and Wake()
+    if (m_Headless) wakeOnInput = false;
+
+    const auto now = std::chrono::steady_clock::now();
+    const bool hasDeadline = deadline != std::chrono::steady_clock::time_point::max();
+    if (hasDeadline && deadline <= now) return;
+
+    // Events already queued: nothing to wait for. They are dispatched by the
+    // next PollEvents() (after the frame's input accumulators are reset).
+    bool reading = false;
+    if (wakeOnInput)
+    {
+        if (wl_display_prepare_read(m_Display) != 0)
+            return;
+        reading = true;
+        wl_display_flush(m_Display);
+    }
+
+    // steady_clock is CLOCK_MONOTONIC on Linux, so the deadline can be used
+    // as an absolute timerfd expiry directly.
+    int timeoutMs = -1;
+    if (hasDeadline && m_TimerFd >= 0)
+    {
+        auto ns = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline.time_since_epoch()).count();
+        itimerspec spec{};
+        spec.it_value.tv_sec = static_cast<time_t>(ns / 1000000000);
+        spec.it_value.tv_nsec = static_cast<long>(ns % 1000000000);
+        timerfd_settime(m_TimerFd, TFD_TIMER_ABSTIME, &spec, nullptr);
+    }
+    else if (hasDeadline)
+    {
+        auto remaining = std::chrono::ceil<std::chrono::milliseconds>(deadline - now).count();
+        timeoutMs = static_cast<int>(std::min<int64_t>(remaining, INT32_MAX));
+    }
+
+    // A held key's next repeat counts as input: it wakes an idle loop but
+    // never a paced one (those pick repeats up in the next PollEvents()).
+    // Only polled here, the timer is drained where repeats are generated.
+    // While the input thread owns the timer it is not polled: only that
+    // thread drains it, so it would stay readable and spin this loop.
+    const bool pollRepeatTimer = wakeOnInput && !m_SeatQueue;
+    pollfd fds[4] =
+    {
+        { .fd = reading ? wl_display_get_fd(m_Display) : -1, .events = POLLIN, .revents = 0 },
+        { .fd = m_WakeFd, .events = POLLIN, .revents = 0 },
+        { .fd = hasDeadline ? m_TimerFd : -1, .events = POLLIN, .revents = 0 },
+        { .fd = pollRepeatTimer ? m_RepeatTimerFd : -1, .events = POLLIN, .revents = 0 }
+    };
+
+    int result;
+    do
+    {
+        result = poll(fds, 4, timeoutMs);
+    } while (result < 0 && errno == EINTR);
+
+    if (reading)
+    {
+        if (result > 0 && (fds[0].revents & POLLIN))
+            wl_display_read_events(m_Display);
+        else
+            wl_display_cancel_read(m_Display);
+    }
+
+    // Drain wake / timer counters so they don't fire again immediately
+    uint64_t counter;
+    if (fds[1].revents & POLLIN)
+        (void)read(m_WakeFd, &counter, sizeof(counter));
+    if (fds[2].revents & POLLIN)
+        (void)read(m_TimerFd, &counter, sizeof(counter));
+
+    if (hasDeadline && m_TimerFd >= 0)
+    {
+        itimerspec disarm{};
+        timerfd_settime(m_TimerFd, 0, &disarm, nullptr);
+    }
+}
+
+void WindowContextPlatform::Wake()
+{
+    if (m_WakeFd < 0) return;
+
+    uint64_t one = 1;
+    (void)write(m_WakeFd, &one, sizeof(one));
+}
+
 void WindowContextPlatform::Shutdown()
 {
     if (m_ShuttingDown) return;
+
+    // Seat objects must not be dispatched while they are destroyed
+    StopInputThread();
     m_ShuttingDown = true;
 
+    if (m_RelativePointer) { zwp_relative_pointer_v1_destroy(m_RelativePointer); m_RelativePointer = nullptr; }
     if (m_Pointer) { wl_pointer_destroy(m_Pointer); m_Pointer = nullptr; }
     if (m_Keyboard) { wl_keyboard_destroy(m_Keyboard); m_Keyboard = nullptr; }
     if (m_Seat) { wl_seat_destroy(m_Seat); m_Seat = nullptr; }
 
-    if (m_XdgWmBase) { xdg_wm_base_destroy(m_XdgWmBase); m_XdgWmBase = nullptr; }
-    if (m_Compositor) { wl_compositor_destroy(m_Compositor); m_Compositor = nullptr; }
-    if (m_Registry) { wl_registry_destroy(m_Registry); m_Registry = nullptr; }
-    if (m_Display) { wl_display_disconnect(m_Display); m_Display = nullptr; }
+    if (m_CursorSurface) { wl_surface_destroy(m_CursorSurface); m_CursorSurface = nullptr; }
+    if (m_CursorTheme) { wl_cursor_theme_destroy(m_CursorTheme); m_CursorTheme = nullptr; m_DefaultCursor = nullptr; }
+    if (m_Shm) { wl_shm_destroy(m_Shm); m_Shm = nullptr; }
+    if (m_Presentation) { wp_presentation_destroy(m_Presentation); m_Presentation = nullptr; }
+    if (m_FractionalScaleManager) {
+        wp_fractional_scale_manager_v1_destroy(m_FractionalScaleManager);
+        m_FractionalScaleManager = nullptr;
+    }
+    if (m_Viewporter) { wp_viewporter_destroy(m_Viewporter); m_Viewporter = nullptr; }
+
+    if (m_PointerConstraints) {
+        zwp_pointer_constraints_v1_destroy(m_PointerConstraints);
+        m_PointerConstraints = nullptr;
+    }
+    if (m_RelativePointerManager) {
+        zwp_relative_pointer_manager_v1_destroy(m_RelativePointerManager);
+        m_RelativePointerManager = nullptr;
+    }
+
     if (m_DecorationManager) {
         zxdg_decoration_manager_v1_destroy(m_DecorationManager);
         m_DecorationManager = nullptr;
     }
 
+    if (m_XdgWmBase) { xdg_wm_base_destroy(m_XdgWmBase); m_XdgWmBase = nullptr; }
+    if (m_Compositor) { wl_compositor_destroy(m_Compositor); m_Compositor = nullptr; }
+    if (m_Registry) { wl_registry_destroy(m_Registry); m_Registry = nullptr; }
+    if (m_Display) { wl_display_disconnect(m_Display); m_Display = nullptr; }
+
+    if (m_TimerFd >= 0) { close(m_TimerFd); m_TimerFd = -1; }
+    if (m_RepeatTimerFd >= 0) { close(m_RepeatTimerFd); m_RepeatTimerFd = -1; }
+    if (m_WakeFd >= 0) { close(m_WakeFd); m_WakeFd = -1; }
+
     SOLARC_WINDOW_INFO("Wayland context shut down");
 }
 
@@ -133,6 +331,41 @@ void WindowContextPlatform::registry_global(
         ctx->m_DecorationManager = static_cast<zxdg_decoration_manager_v1*>(
             wl_registry_bind(registry, name, &zxdg_decoration_manager_v1_interface, 1));
     }
+    else if (strcmp(interface, zwp_relative_pointer_manager_v1_interface.name) == 0)
+    {
+        ctx->m_RelativePointerManager = static_cast<zwp_relative_pointer_manager_v1*>(
+            wl_registry_bind(registry, name, &zwp_relative_pointer_manager_v1_interface, 1));
+
+        std::lock_guard lock(ctx->m_SeatMtx);
+        ctx->CreateRelativePointer();
+    }
+    else if (strcmp(interface, zwp_pointer_constraints_v1_interface.name) == 0)
+    {
+        ctx->m_PointerConstraints = static_cast<zwp_pointer_constraints_v1*>(
+            wl_registry_bind(registry, name, &zwp_pointer_constraints_v1_interface, 1));
+    }
+    else if (strcmp(interface, wp_presentation_interface.name) == 0)
+    {
+        ctx->m_Presentation = static_cast<wp_presentation*>(
+            wl_registry_bind(registry, name, &wp_presentation_interface, 1));
+
+        wp_presentation_add_listener(ctx->m_Presentation, &s_PresentationListener, ctx);
+    }
+    else if (strcmp(interface, wp_viewporter_interface.name) == 0)
+    {
+        ctx->m_Viewporter = static_cast<wp_viewporter*>(
+            wl_registry_bind(registry, name, &wp_viewporter_interface, 1));
+    }
+    else if (strcmp(interface, wp_fractional_scale_manager_v1_interface.name) == 0)
+    {
+        ctx->m_FractionalScaleManager = static_cast<wp_fractional_scale_manager_v1*>(
+            wl_registry_bind(registry, name, &wp_fractional_scale_manager_v1_interface, 1));
+    }
+    else if (strcmp(interface, wl_shm_interface.name) == 0)
+    {
+        ctx->m_Shm = static_cast<wl_shm*>(
+            wl_registry_bind(registry, name, &wl_shm_interface, 1));
+    }
     else if (strcmp(interface, wl_seat_interface.name) == 0)
     {
         ctx->m_Seat = static_cast<wl_seat*>(
@@ -149,6 +382,33 @@ void WindowContextPlatform::xdg_wm_base_ping(void* data, xdg_wm_base* wm_base, u
     xdg_wm_base_pong(wm_base, serial);
 }
 
+void WindowContextPlatform::presentation_clock_id(void* data, wp_presentation*, uint32_t clockId)
+{
+    auto* ctx = static_cast<WindowContextPlatform*>(data);
+    ctx->m_PresentationClock = static_cast<clockid_t>(clockId);
+
+    if (ctx->m_PresentationClock != CLOCK_MONOTONIC)
+        SOLARC_WINDOW_DEBUG("Presentation clock is {} (not CLOCK_MONOTONIC); timestamps are rebased", clockId);
+}
+
+std::chrono::steady_clock::time_point WindowContextPlatform::PresentationTimeToSteady(
+    uint64_t seconds, uint32_t nanoseconds) const
+{
+    const auto timestamp = std::chrono::seconds(seconds) + std::chrono::nanoseconds(nanoseconds);
+
+    // steady_clock is CLOCK_MONOTONIC on Linux
+    if (m_PresentationClock == CLOCK_MONOTONIC)
+        return std::chrono::steady_clock::time_point(
+            std::chrono::duration_cast<std::chrono::steady_clock::duration>(timestamp));
+
+    // Other clocks (e.g. CLOCK_MONOTONIC_RAW): shift by the current offset
+    timespec now{};
+    clock_gettime(m_PresentationClock, &now);
+    const auto clockNow = std::chrono::seconds(now.tv_sec) + std::chrono::nanoseconds(now.tv_nsec);
+    return std::chrono::steady_clock::now() +
+        std::chrono::duration_cast<std::chrono::steady_clock::duration>(timestamp - clockNow);
+}
+
 // ============================================================================
 // Seat Listener (Manages Input Device Availability)
 // ============================================================================
@@ -190,10 +450,16 @@ void WindowContextPlatform::seat_capabilities(void* data, wl_seat* seat, uint32_
     {
         ctx->m_Pointer = wl_seat_get_pointer(seat);
         wl_pointer_add_listener(ctx->m_Pointer, &s_PointerListener, ctx);
+        ctx->CreateRelativePointer();
         SOLARC_WINDOW_INFO("Wayland pointer acquired");
     }
     else if (!hasPointer && ctx->m_Pointer)
     {
+        if (ctx->m_RelativePointer)
+        {
+            zwp_relative_pointer_v1_destroy(ctx->m_RelativePointer);
+            ctx->m_RelativePointer = nullptr;
+        }
         wl_pointer_destroy(ctx->m_Pointer);
         ctx->m_Pointer = nullptr;
         SOLARC_WINDOW_INFO("Wayland pointer lost");
@@ -218,36 +484,37 @@ const wl_keyboard_listener WindowContextPlatform::s_KeyboardListener = {
     .repeat_info = keyboard_repeat_info
 };
 
-void WindowContextPlatform::keyboard_key(void* data, wl_keyboard* keyboard,
-    uint32_t serial, uint32_t time, uint32_t key, uint32_t state)
+void WindowContextPlatform::keyboard_keymap(void* data, wl_keyboard* keyboard,
+    uint32_t format, int32_t fd, uint32_t size)
 {
     auto* ctx = static_cast<WindowContextPlatform*>(data);
-    WindowPlatform* window = ctx->m_KeyboardFocusedWindow;
-    if (!window) return;
 
-    uint16_t scancode = WaylandKeyMapping::XKBKeyToScancode(key);
-    bool pressed = (state == WL_KEYBOARD_KEY_STATE_PRESSED);
-
-    bool isRepeat = false;
-    if (pressed)
+    if (format != WL_KEYBOARD_KEYMAP_FORMAT_XKB_V1)
     {
-        std::lock_guard lock(window->mtx);
-        isRepeat = window->m_CurrentKeyState[scancode];
+        SOLARC_WINDOW_WARN("Unsupported keymap format {}; text input disabled", format);
+        close(fd);
+        return;
     }
 
-    window->RecordKeyTransition(scancode, pressed, isRepeat);
+    // Repeat flags may differ in the new keymap
+    ctx->m_KeyRepeat.Stop();
+    ctx->ArmKeyRepeatTimer();
+
+    ctx->m_Keymap.Load(fd, size);
 }
 
 void WindowContextPlatform::keyboard_enter(void* data, wl_keyboard* keyboard,
     uint32_t serial, wl_surface* surface, wl_array* keys)
 {
+    // Surface may already be destroyed when the event is dispatched
+    if (!surface) return;
     WindowPlatform* window = static_cast<WindowPlatform*>(wl_surface_get_user_data(surface));
     if (!window) return;
 
     auto* ctx = static_cast<WindowContextPlatform*>(data);
     ctx->m_KeyboardFocusedWindow = window;
 
-    window->SetKeyboardFocus(true);
+    ctx->DeliverInput(window, { .type = PlatformInputEvent::TYPE::FOCUS_GAINED });
     SOLARC_WINDOW_DEBUG("Window '{}' gained keyboard focus", window->GetTitle());
 }
 
@@ -258,7 +525,10 @@ void WindowContextPlatform::keyboard_leave(void* data, wl_keyboard* keyboard,
     WindowPlatform* window = ctx->m_KeyboardFocusedWindow;
     if (!window) return;
 
-    window->OnFocusLost();
+    ctx->m_KeyRepeat.Stop();
+    ctx->ArmKeyRepeatTimer();
+
+    ctx->DeliverInput(window, { .type = PlatformInputEvent::TYPE::FOCUS_LOST });
     ctx->m_KeyboardFocusedWindow = nullptr;
     SOLARC_WINDOW_DEBUG("Window '{}' lost keyboard focus", window->GetTitle());
 }
@@ -270,18 +540,34 @@ void WindowContextPlatform::keyboard_key(void* data, wl_keyboard* keyboard,
     WindowPlatform* window = ctx->m_KeyboardFocusedWindow;
     if (!window) return;
 
-    uint16_t scancode = WaylandKeyMapping::XKBKeyToScancode(key);
-    bool pressed = (state == WL_KEYBOARD_KEY_STATE_PRESSED);
+    const bool pressed = (state == WL_KEYBOARD_KEY_STATE_PRESSED);
+    const uint16_t scancode = WaylandKeyMapping::XKBKeyToScancode(key);
+    const InputTimestamp timestamp = WaylandEventTimestamp(time);
+
+    // Repeats that fell due before this event come first
+    ctx->GenerateKeyRepeats(timestamp);
+
+    // Repeat detection needs the held-key state, so it happens where the
+    // event is applied (main thread), not here
+    ctx->DeliverInput(window, {
+        .type = PlatformInputEvent::TYPE::KEY,
+        .pressed = pressed,
+        .code = scancode,
+        .timestamp = timestamp });
 
-    // Detect repeat: if key is already down and pressed again -> repeat
-    bool isRepeat = false;
     if (pressed)
     {
-        std::lock_guard lock(window->mtx);
-        isRepeat = window->m_CurrentKeyState[scancode];
+        // The keymap is indexed by the evdev key, not the internal scancode
+        ctx->DeliverText(window, key, timestamp);
+        if (ctx->m_Keymap.KeyRepeats(key))
+            ctx->m_KeyRepeat.Press(scancode, timestamp);
+    }
+    else
+    {
+        ctx->m_KeyRepeat.Release(scancode);
     }
 
-    window->RecordKeyTransition(scancode, pressed, isRepeat);
+    ctx->ArmKeyRepeatTimer();
 }
 
 void WindowContextPlatform::keyboard_modifiers(void* data, wl_keyboard* keyboard,
@@ -289,14 +575,26 @@ void WindowContextPlatform::keyboard_modifiers(void* data, wl_keyboard* keyboard
     uint32_t mods_latched, uint32_t mods_locked,
     uint32_t group)
 {
-    // Modifier state tracking (Shift, Ctrl, Alt, etc.)
-    // This would integrate with xkbcommon in production
-    SOLARC_WINDOW_TRACE("Keyboard modifiers updated");
+    auto* ctx = static_cast<WindowContextPlatform*>(data);
+    ctx->m_Keymap.UpdateModifiers(mods_depressed, mods_latched, mods_locked, group);
+
+    // Sent right after keyboard_enter too, so a newly focused window starts
+    // with the current state
+    if (WindowPlatform* window = ctx->m_KeyboardFocusedWindow)
+    {
+        ctx->DeliverInput(window, {
+            .type = PlatformInputEvent::TYPE::MODIFIERS,
+            .code = ctx->m_Keymap.GetModifiers() });
+    }
 }
 
 void WindowContextPlatform::keyboard_repeat_info(void* data, wl_keyboard* keyboard,
     int32_t rate, int32_t delay)
 {
+    auto* ctx = static_cast<WindowContextPlatform*>(data);
+    ctx->m_KeyRepeat.SetRepeatInfo(rate, delay);
+    ctx->ArmKeyRepeatTimer();
+
     SOLARC_WINDOW_DEBUG("Keyboard repeat: rate={}/sec, delay={}ms", rate, delay);
 }
 
@@ -319,15 +617,25 @@ const wl_pointer_listener WindowContextPlatform::s_PointerListener = {
 void WindowContextPlatform::pointer_enter(void* data, wl_pointer* pointer,
     uint32_t serial, wl_surface* surface, wl_fixed_t sx, wl_fixed_t sy)
 {
+    if (!surface) return;
     WindowPlatform* window = static_cast<WindowPlatform*>(wl_surface_get_user_data(surface));
     if (!window) return;
 
     auto* ctx = static_cast<WindowContextPlatform*>(data);
     ctx->m_PointerFocusedWindow = window;
+    ctx->m_PointerEnterSerial = serial;
 
     int32_t x = wl_fixed_to_int(sx);
     int32_t y = wl_fixed_to_int(sy);
-    window->RecordMousePosition(x, y);
+
+    // Relative motion source, pointer constraints and cursor image are
+    // applied with the event (see WindowPlatform::ApplyInputEvent)
+    ctx->DeliverInput(window, {
+        .type = PlatformInputEvent::TYPE::POINTER_ENTER,
+        .pressed = ctx->m_RelativePointer != nullptr,
+        .x = x,
+        .y = y,
+        .timestamp = InputClock::Now() });
 
     SOLARC_WINDOW_DEBUG("Pointer entered window '{}' at ({}, {})", window->GetTitle(), x, y);
 }
@@ -347,9 +655,11 @@ void WindowContextPlatform::pointer_motion(void* data, wl_pointer* pointer,
     WindowPlatform* window = ctx->m_PointerFocusedWindow;
     if (!window) return;
 
-    int32_t x = wl_fixed_to_int(sx);
-    int32_t y = wl_fixed_to_int(sy);
-    window->RecordMousePosition(x, y);
+    ctx->DeliverInput(window, {
+        .type = PlatformInputEvent::TYPE::MOUSE_POSITION,
+        .x = wl_fixed_to_int(sx),
+        .y = wl_fixed_to_int(sy),
+        .timestamp = WaylandEventTimestamp(time) });
 }
 
 void WindowContextPlatform::pointer_button(void* data, wl_pointer* pointer,
@@ -370,8 +680,11 @@ void WindowContextPlatform::pointer_button(void* data, wl_pointer* pointer,
     default: return;
     }
 
-    bool pressed = (state == WL_POINTER_BUTTON_STATE_PRESSED);
-    window->RecordMouseButton(mouseBtn, pressed);
+    ctx->DeliverInput(window, {
+        .type = PlatformInputEvent::TYPE::MOUSE_BUTTON,
+        .pressed = (state == WL_POINTER_BUTTON_STATE_PRESSED),
+        .code = static_cast<uint16_t>(mouseBtn),
+        .timestamp = WaylandEventTimestamp(time) });
 }
 
 void WindowContextPlatform::pointer_axis(void* data, wl_pointer* pointer,
@@ -381,14 +694,14 @@ void WindowContextPlatform::pointer_axis(void* data, wl_pointer* pointer,
     WindowPlatform* window = ctx->m_PointerFocusedWindow;
     if (!window) return;
 
-    float delta = wl_fixed_to_double(value);
+    double delta = wl_fixed_to_double(value);
     if (axis == WL_POINTER_AXIS_VERTICAL_SCROLL)
     {
-        window->RecordMouseWheel(delta, 0.0f);
+        ctx->DeliverInput(window, { .type = PlatformInputEvent::TYPE::WHEEL, .dy = delta });
     }
     else if (axis == WL_POINTER_AXIS_HORIZONTAL_SCROLL)
     {
-        window->RecordMouseWheel(0.0f, delta);
+        ctx->DeliverInput(window, { .type = PlatformInputEvent::TYPE::WHEEL, .dx = delta });
     }
 }
 
@@ -417,4 +730,324 @@ void WindowContextPlatform::pointer_axis_discrete(void* data, wl_pointer* pointe
     SOLARC_WINDOW_TRACE("Pointer discrete scroll: axis={}, clicks={}", axis, discrete);
 }
 
-#endif
\ No newline at end of file
+// ============================================================================
+// Relative Pointer (Unaccelerated Motion)
+// ============================================================================
+
+const zwp_relative_pointer_v1_listener WindowContextPlatform::s_RelativePointerListener = {
+    .relative_motion = relative_pointer_motion
+};
+
+void WindowContextPlatform::CreateRelativePointer()
+{
+    // Needs both the manager global and the seat pointer; whichever arrives
+    // second creates the object
+    if (m_RelativePointer || !m_RelativePointerManager || !m_Pointer) return;
+
+    if (m_SeatQueue)
+    {
+        // Create directly on the seat queue so no event can be dispatched
+        // on the main thread before the queue is switched
+        auto* manager = static_cast<zwp_relative_pointer_manager_v1*>(
+            wl_proxy_create_wrapper(m_RelativePointerManager));
+        wl_proxy_set_queue(reinterpret_cast<wl_proxy*>(manager), m_SeatQueue);
+        m_RelativePointer = zwp_relative_pointer_manager_v1_get_relative_pointer(manager, m_Pointer);
+        wl_proxy_wrapper_destroy(manager);
+    }
+    else
+    {
+        m_RelativePointer = zwp_relative_pointer_manager_v1_get_relative_pointer(
+            m_RelativePointerManager, m_Pointer);
+    }
+    zwp_relative_pointer_v1_add_listener(m_RelativePointer, &s_RelativePointerListener, this);
+
+    SOLARC_WINDOW_INFO("Wayland relative pointer acquired");
+}
+
+void WindowContextPlatform::relative_pointer_motion(void* data, zwp_relative_pointer_v1* relativePointer,
+    uint32_t utime_hi, uint32_t utime_lo,
+    wl_fixed_t dx, wl_fixed_t dy,
+    wl_fixed_t dx_unaccel, wl_fixed_t dy_unaccel)
+{
+    auto* ctx = static_cast<WindowContextPlatform*>(data);
+    WindowPlatform* window = ctx->m_PointerFocusedWindow;
+    if (!window) return;
+
+    uint64_t timeUs = (static_cast<uint64_t>(utime_hi) << 32) | utime_lo;
+
+    ctx->DeliverInput(window, {
+        .type = PlatformInputEvent::TYPE::RELATIVE_MOTION,
+        .dx = wl_fixed_to_double(dx_unaccel),
+        .dy = wl_fixed_to_double(dy_unaccel),
+        .timestamp = WaylandEventTimestampUs(timeUs) });
+}
+
+// ============================================================================
+// Cursor Image
+// ============================================================================
+
+void WindowContextPlatform::LoadCursorTheme()
+{
+    if (!m_Shm || !m_Compositor) return;
+
+    const char* themeName = std::getenv("XCURSOR_THEME");
+    const char* sizeEnv = std::getenv("XCURSOR_SIZE");
+    int size = sizeEnv ? std::atoi(sizeEnv) : 0;
+    if (size <= 0) size = 24;
+
+    m_CursorTheme = wl_cursor_theme_load(themeName, size, m_Shm);
+    if (!m_CursorTheme)
+    {
+        SOLARC_WINDOW_WARN("Failed to load cursor theme '{}'", themeName ? themeName : "default");
+        return;
+    }
+
+    m_DefaultCursor = wl_cursor_theme_get_cursor(m_CursorTheme, "left_ptr");
+    if (!m_DefaultCursor)
+        m_DefaultCursor = wl_cursor_theme_get_cursor(m_CursorTheme, "default");
+
+    m_CursorSurface = wl_compositor_create_surface(m_Compositor);
+}
+
+void WindowContextPlatform::RefreshCursor(WindowPlatform* window)
+{
+    std::lock_guard lock(m_SeatMtx);
+    if (!m_Pointer || !window || window != m_PointerFocusedWindow) return;
+
+    if (window->GetCursorMode() == CursorMode::Locked)
+    {
+        // Null surface hides the cursor while this surface has pointer focus
+        wl_pointer_set_cursor(m_Pointer, m_PointerEnterSerial, nullptr, 0, 0);
+        return;
+    }
+
+    if (!m_DefaultCursor || !m_CursorSurface || m_DefaultCursor->image_count == 0) return;
+
+    wl_cursor_image* image = m_DefaultCursor->images[0];
+    wl_buffer* buffer = wl_cursor_image_get_buffer(image);
+    if (!buffer) return;
+
+    wl_pointer_set_cursor(m_Pointer, m_PointerEnterSerial, m_CursorSurface,
+        static_cast<int32_t>(image->hotspot_x), static_cast<int32_t>(image->hotspot_y));
+    wl_surface_attach(m_CursorSurface, buffer, 0, 0);
+    wl_surface_damage(m_CursorSurface, 0, 0,
+        static_cast<int32_t>(image->width), static_cast<int32_t>(image->height));
+    wl_surface_commit(m_CursorSurface);
+}
+
+void WindowContextPlatform::ForgetWindow(WindowPlatform* window)
+{
+    std::lock_guard lock(m_SeatMtx);
+    if (m_PointerFocusedWindow == window) m_PointerFocusedWindow = nullptr;
+    if (m_KeyboardFocusedWindow == window) m_KeyboardFocusedWindow = nullptr;
+}
+
+// ============================================================================
+// Input Thread
+// ============================================================================
+
+void WindowContextPlatform::DeliverInput(WindowPlatform* window, const PlatformInputEvent& event)
+{
+    // Keep ordering when the thread was just stopped and events are still queued
+    if (m_SeatQueue || !window->m_InputQueue.IsEmpty())
+        window->QueueInputEvent(event);
+    else
+        window->ApplyInputEvent(event);
+}
+
+void WindowContextPlatform::DeliverText(WindowPlatform* window, uint32_t key, InputTimestamp timestamp)
+{
+    XkbKeymap::KeySymbol symbol = m_Keymap.Translate(key);
+    if (!TextInput::IsPrintable(symbol.codepoint))
+        return;
+
+    // Ctrl/Alt combinations are shortcuts, not text (AltGr is not Alt)
+    constexpr uint8_t SHORTCUT_MODIFIERS =
+        KeyModifierToBit(KeyModifier::Ctrl) | KeyModifierToBit(KeyModifier::Alt);
+    if (m_Keymap.GetModifiers() & SHORTCUT_MODIFIERS)
+        return;
+
+    DeliverInput(window, {
+        .type = PlatformInputEvent::TYPE::TEXT,
+        .x = static_cast<int32_t>(symbol.codepoint),
+        .timestamp = timestamp });
+}
+
+// ============================================================================
+// Key Repeat
+// ============================================================================
+
+void WindowContextPlatform::GenerateKeyRepeats(InputTimestamp now)
+{
+    if (!m_KeyRepeat.IsRepeating()) return;
+
+    WindowPlatform* window = m_KeyboardFocusedWindow;
+    if (!window)
+    {
+        m_KeyRepeat.Stop();
+        ArmKeyRepeatTimer();
+        return;
+    }
+
+    // A press of a held key is recorded as a repeat when applied
+    uint32_t count = m_KeyRepeat.Generate(now, [this, window](uint16_t scancode, InputTimestamp timestamp)
+    {
+        DeliverInput(window, {
+            .type = PlatformInputEvent::TYPE::KEY,
+            .pressed = true,
+            .code = scancode,
+            .timestamp = timestamp });
+        DeliverText(window, WaylandKeyMapping::ScancodeToXKBKey(scancode), timestamp);
+    });
+
+    if (count > 0)
+        ArmKeyRepeatTimer();
+}
+
+void WindowContextPlatform::ArmKeyRepeatTimer()
+{
+    if (m_RepeatTimerFd < 0) return;
+
+    // InputTimestamp is steady_clock (CLOCK_MONOTONIC) microseconds
+    itimerspec spec{};
+    if (InputTimestamp next = m_KeyRepeat.GetNextRepeatTime())
+    {
+        spec.it_value.tv_sec = static_cast<time_t>(next / 1000000);
+        spec.it_value.tv_nsec = static_cast<long>((next % 1000000) * 1000);
+        if (spec.it_value.tv_sec == 0 && spec.it_value.tv_nsec == 0)
+            spec.it_value.tv_nsec = 1; // All-zero would disarm
+    }
+    timerfd_settime(m_RepeatTimerFd, TFD_TIMER_ABSTIME, &spec, nullptr);
+}
+
+bool WindowContextPlatform::StartInputThread()
+{
+    if (m_InputThread.joinable()) return true;
+    if (!m_Display || m_ShuttingDown) return false;
+
+    if (!m_Seat)
+    {
+        SOLARC_WINDOW_WARN("No Wayland seat; input thread not started");
+        return false;
+    }
+
+    m_InputStopFd = eventfd(0, EFD_CLOEXEC | EFD_NONBLOCK);
+    if (m_InputStopFd < 0)
+    {
+        SOLARC_WINDOW_ERROR("Failed to create input thread eventfd: {}", strerror(errno));
+        return false;
+    }
+
+    // Anything already queued for the seat is handled here, before its
+    // objects change queues
+    wl_display_dispatch_pending(m_Display);
+
+    m_SeatQueue = wl_display_create_queue(m_Display);
+    {
+        std::lock_guard lock(m_SeatMtx);
+
+        // Objects created from these later (keyboard, pointer) inherit the queue
+        wl_proxy_set_queue(reinterpret_cast<wl_proxy*>(m_Seat), m_SeatQueue);
+        if (m_Keyboard) wl_proxy_set_queue(reinterpret_cast<wl_proxy*>(m_Keyboard), m_SeatQueue);
+        if (m_Pointer) wl_proxy_set_queue(reinterpret_cast<wl_proxy*>(m_Pointer), m_SeatQueue);
+        if (m_RelativePointer) wl_proxy_set_queue(reinterpret_cast<wl_proxy*>(m_RelativePointer), m_SeatQueue);
+    }
+
+    m_InputThread = std::thread(&WindowContextPlatform::InputThreadMain, this);
+
+    SOLARC_WINDOW_INFO("Wayland input thread started");
+    return true;
+}
+
+void WindowContextPlatform::StopInputThread()
+{
+    if (!m_InputThread.joinable()) return;
+
+    uint64_t one = 1;
+    (void)write(m_InputStopFd, &one, sizeof(one));
+    m_InputThread.join();
+
+    close(m_InputStopFd);
+    m_InputStopFd = -1;
+
+    {
+        std::lock_guard lock(m_SeatMtx);
+        wl_proxy_set_queue(reinterpret_cast<wl_proxy*>(m_Seat), nullptr);
+        if (m_Keyboard) wl_proxy_set_queue(reinterpret_cast<wl_proxy*>(m_Keyboard), nullptr);
+        if (m_Pointer) wl_proxy_set_queue(reinterpret_cast<wl_proxy*>(m_Pointer), nullptr);
+        if (m_RelativePointer) wl_proxy_set_queue(reinterpret_cast<wl_proxy*>(m_RelativePointer), nullptr);
+    }
+
+    // Events read but not yet dispatched by the input thread
+    wl_display_dispatch_queue_pending(m_Display, m_SeatQueue);
+    wl_event_queue_destroy(m_SeatQueue);
+    m_SeatQueue = nullptr;
+
+    SOLARC_WINDOW_INFO("Wayland input thread stopped");
+}
+
+bool WindowContextPlatform::IsInputThreadRunning() const
+{
+    return m_InputThread.joinable();
+}
+
+void WindowContextPlatform::InputThreadMain()
+{
+    pollfd fds[3] =
+    {
+        { .fd = wl_display_get_fd(m_Display), .events = POLLIN, .revents = 0 },
+        { .fd = m_InputStopFd, .events = POLLIN, .revents = 0 },
+        { .fd = m_RepeatTimerFd, .events = POLLIN, .revents = 0 }
+    };
+
+    for (;;)
+    {
+        // Another reader (the main thread) may already have queued events for us
+        while (wl_display_prepare_read_queue(m_Display, m_SeatQueue) != 0)
+        {
+            std::lock_guard lock(m_SeatMtx);
+            wl_display_dispatch_queue_pending(m_Display, m_SeatQueue);
+        }
+        wl_display_flush(m_Display);
+
+        int result;
+        do
+        {
+            result = poll(fds, 3, -1);
+        } while (result < 0 && errno == EINTR);
+
+        if (result > 0 && (fds[0].revents & POLLIN))
+        {
+            if (wl_display_read_events(m_Display) < 0)
+            {
+                SOLARC_WINDOW_ERROR("Input thread failed to read Wayland events: {}", strerror(errno));
+                break;
+            }
+        }
+        else
+        {
+            wl_display_cancel_read(m_Display);
+        }
+
+        if (fds[1].revents & POLLIN)
+            break;
+
+        if (result < 0 || (fds[0].revents & (POLLERR | POLLHUP)))
+        {
+            SOLARC_WINDOW_ERROR("Wayland display connection lost; input thread exiting");
+            break;
+        }
+
+        if (fds[2].revents & POLLIN)
+        {
+            uint64_t expirations;
+            (void)read(m_RepeatTimerFd, &expirations, sizeof(expirations));
+        }
+
+        std::lock_guard lock(m_SeatMtx);
+        wl_display_dispatch_queue_pending(m_Display, m_SeatQueue);
+        GenerateKeyRepeats(InputClock::Now());
+    }
+}
+
+#endif
@@ -14,6 +14,20 @@ const xdg_toplevel_listener WindowPlatform::s_XdgToplevelListener = {
     .close = xdg_toplevel_close
 };
 
+const zwp_locked_pointer_v1_listener WindowPlatform::s_LockedPointerListener = {
+    .locked = locked_pointer_locked,
+    .unlocked = locked_pointer_unlocked
+};
+
+const zwp_confined_pointer_v1_listener WindowPlatform::s_ConfinedPointerListener = {
+    .confined = confined_pointer_confined,
+    .unconfined = confined_pointer_unconfined
+};
+
+const wp_fractional_scale_v1_listener WindowPlatform::s_FractionalScaleListener = {
+    .preferred_scale = fractional_scale_preferred_scale
+};
+
 WindowPlatform::WindowPlatform(
     const std::string& title, const int32_t& width, const int32_t& height)
     :m_Title(title)
@@ -29,6 +43,13 @@ WindowPlatform::WindowPlatform(
 
     m_CurrentKeyState.fill(false);
 
+    if (context.IsHeadless())
+    {
+        m_Configured = true;
+        InitializeHeadless();
+        return;
+    }
+
     // Create Wayland surface
     m_Surface = context.CreateSurface();
     if (!m_Surface)
@@ -84,6 +105,24 @@ WindowPlatform::WindowPlatform(
         SOLARC_WINDOW_WARN("Compositor doesn't support xdg-decoration protocol");
     }
 
+    // Decouple buffer size from logical size: fractional scaling and render
+    // scales need the compositor to scale the buffer onto the window
+    if (auto* viewporter = context.GetViewporter()) {
+        m_Viewport = wp_viewporter_get_viewport(viewporter, m_Surface);
+        UpdateViewportDestination();
+
+        if (auto* fractionalScaleManager = context.GetFractionalScaleManager()) {
+            m_FractionalScale = wp_fractional_scale_manager_v1_get_fractional_scale(fractionalScaleManager, m_Surface);
+            wp_fractional_scale_v1_add_listener(m_FractionalScale, &s_FractionalScaleListener, this);
+        }
+        else {
+            SOLARC_WINDOW_DEBUG("Compositor doesn't support fractional-scale; rendering at scale 1");
+        }
+    }
+    else {
+        SOLARC_WINDOW_WARN("Compositor doesn't support viewporter; buffer size follows the logical size");
+    }
+
     // Commit the surface to apply initial configuration
     wl_surface_commit(m_Surface);
 
@@ -92,6 +131,20 @@ WindowPlatform::WindowPlatform(
 
 WindowPlatform::~WindowPlatform()
 {
+    DestroyPointerConstraint();
+
+    // Detach from the surface before forgetting focus so input listeners
+    // (possibly on the input thread) can no longer resolve this window
+    if (m_Surface)
+        wl_surface_set_user_data(m_Surface, nullptr);
+    WindowContextPlatform::Get().ForgetWindow(this);
+
+    if (m_FractionalScale)
+        wp_fractional_scale_v1_destroy(m_FractionalScale);
+
+    if (m_Viewport)
+        wp_viewport_destroy(m_Viewport);
+
     if (m_XdgToplevel)
         xdg_toplevel_destroy(m_XdgToplevel);
     
@@ -100,7 +153,6 @@ WindowPlatform::~WindowPlatform()
     
     if (m_Surface)
     {
-        wl_surface_set_user_data(m_Surface, nullptr);
         wl_surface_destroy(m_Surface);
         m_Surface = nullptr;
     }
@@ -113,6 +165,8 @@ WindowPlatform::~WindowPlatform()
 
 void WindowPlatform::Show()
 {
+    if (m_Headless) { HeadlessShow(); return; }
+
     std::lock_guard lk(mtx);
 
     if (m_Visible) {
@@ -120,6 +174,7 @@ void WindowPlatform::Show()
     }
 
     m_Visible = true;
+    PublishState();
     wl_surface_commit(m_Surface);
 
     SOLARC_WINDOW_DEBUG("Wayland surface show requested (pending configure): '{}'", m_Title);
@@ -127,12 +182,15 @@ void WindowPlatform::Show()
 
 void WindowPlatform::Hide()
 {
+    if (m_Headless) { HeadlessHide(); return; }
+
     std::lock_guard lk(mtx);
 
     if (m_Visible)
     {
         // Wayland doesn't have explicit hide - we can attach a null buffer
         m_Visible = false;
+        PublishState();
         wl_surface_attach(m_Surface, nullptr, 0, 0);
         wl_surface_commit(m_Surface);
         DispatchWindowEvent(std::make_shared<WindowHiddenEvent>());
@@ -143,7 +201,20 @@ bool WindowPlatform::IsVisible() const
 {
     std::lock_guard lk(mtx);
 
-    return m_Visible && m_Configured;
+    return IsMappedUnlocked();
+}
+
+void WindowPlatform::PublishState()
+{
+    if (!m_StateSnapshot) return;
+
+    // Same rules as IsVisible() / IsMinimized() / IsMaximized()
+    uint8_t flags = 0;
+    if (IsMappedUnlocked()) flags |= WINDOW_STATE_VISIBLE;
+    if (IsMinimizedUnlocked()) flags |= WINDOW_STATE_MINIMIZED;
+    if (m_Maximized) flags |= WINDOW_STATE_MAXIMIZED;
+
+    m_StateSnapshot->Publish(m_Width, m_Height, flags);
 }
 
 void WindowPlatform::SetTitle(const std::string& title)
@@ -161,6 +232,8 @@ void WindowPlatform::SetTitle(const std::string& title)
 
 void WindowPlatform::Resize(int32_t width, int32_t height)
 {
+    if (m_Headless) { HeadlessResize(width, height); return; }
+
     std::lock_guard lk(mtx);
 
     // Note: On Wayland, we can only suggest sizes via min/max size hints
@@ -177,6 +250,8 @@ void WindowPlatform::Resize(int32_t width, int32_t height)
 
 void WindowPlatform::Minimize()
 {
+    if (m_Headless) { HeadlessMinimize(); return; }
+
     std::lock_guard lk(mtx);
 
     if (m_XdgToplevel)
@@ -189,6 +264,8 @@ void WindowPlatform::Minimize()
 
 void WindowPlatform::Maximize()
 {
+    if (m_Headless) { HeadlessMaximize(); return; }
+
     std::lock_guard lk(mtx);
 
     if (m_XdgToplevel)
@@ -201,6 +278,8 @@ void WindowPlatform::Maximize()
 
 void WindowPlatform::Restore()
 {
+    if (m_Headless) { HeadlessRestore(); return; }
+
     std::lock_guard lk(mtx);
 
     if (m_XdgToplevel)
@@ -223,6 +302,7 @@ void WindowPlatform::HandleConfigure(int32_t width, int32_t height)
 
         m_Width = width;
         m_Height = height;
+        UpdateViewportDestination();
 
         if (m_Configured)
         {
@@ -231,6 +311,7 @@ void WindowPlatform::HandleConfigure(int32_t width, int32_t height)
     }
 
     m_Configured = true;
+    PublishState();
 }
 
 void WindowPlatform::HandleClose()
@@ -255,6 +336,7 @@ void WindowPlatform::xdg_surface_configure(
 
     bool wasConfigured = window->m_Configured;
     window->m_Configured = true;
+    window->PublishState();
 
     // Commit to finalize configuration
     wl_surface_commit(window->m_Surface);
@@ -312,9 +394,12 @@ void WindowPlatform::xdg_toplevel_configure(
             else if (width != window->m_Width || height != window->m_Height) {
                 window->m_Width = width;
                 window->m_Height = height;
+                window->UpdateViewportDestination();
                 window->DispatchWindowEvent(std::make_shared<WindowResizeEvent>(width, height));
             }
         }
+
+        window->PublishState();
     }
 }
 
@@ -328,10 +413,57 @@ void WindowPlatform::xdg_toplevel_close(
     window->DispatchWindowEvent(std::make_shared<WindowCloseEvent>());
 }
 
+// ============================================================================
+// Surface Scale (wp_viewporter / wp_fractional_scale_v1)
+// ============================================================================
+
+void WindowPlatform::SetRenderScale(float scale)
+{
+    if (m_Headless) { HeadlessSetRenderScale(scale); return; }
+
+    std::lock_guard lk(mtx);
+
+    if (!m_Viewport)
+    {
+        if (scale != 1.0f)
+            SOLARC_WINDOW_WARN("Render scale unavailable for '{}': compositor lacks viewporter", m_Title);
+        return;
+    }
+
+    SurfaceScale surfaceScale = m_SurfaceScale;
+    surfaceScale.renderScale = SurfaceScale::ClampRenderScale(scale);
+    UpdateSurfaceScale(surfaceScale);
+
+    SOLARC_WINDOW_DEBUG("Render scale for '{}' set to {:.2f}", m_Title, surfaceScale.renderScale);
+}
+
+void WindowPlatform::UpdateViewportDestination()
+{
+    std::lock_guard lk(mtx);
+
+    if (m_Viewport && m_Width > 0 && m_Height > 0)
+        wp_viewport_set_destination(m_Viewport, m_Width, m_Height);
+}
+
+void WindowPlatform::fractional_scale_preferred_scale(void* data, wp_fractional_scale_v1*, uint32_t scale)
+{
+    if (!data || scale == 0) return;
+    auto* window = static_cast<WindowPlatform*>(data);
+    std::lock_guard lk(window->mtx);
+
+    if (scale == window->m_SurfaceScale.displayScale) return;
+
+    SurfaceScale surfaceScale = window->m_SurfaceScale;
+    surfaceScale.displayScale = scale;
+    window->UpdateSurfaceScale(surfaceScale);
+
+    SOLARC_WINDOW_INFO("Preferred scale for '{}': {:.3f}", window->m_Title, surfaceScale.GetDisplayScale());
+}
+
 bool WindowPlatform::IsMinimized() const
 {
     std::lock_guard lk(mtx);
-    return m_Visible & (m_Width == 0 && m_Height == 0);
+    return IsMinimizedUnlocked();
 }
 
 void WindowPlatform::OnFocusLost()
@@ -341,19 +473,204 @@ void WindowPlatform::OnFocusLost()
     SOLARC_WINDOW_DEBUG("Window '{}' lost focus, clearing held keys", m_Title);
 
     // Synthesize key release transitions for all held keys
+    InputTimestamp now = InputClock::Now();
     for (uint16_t scancode = 0; scancode < 512; ++scancode)
     {
         if (m_CurrentKeyState[scancode])
         {
             // Generate release transition
-            m_ThisFrameInput.keyTransitions.emplace_back(scancode, false, false);
+            m_ThisFrameInput.keyTransitions.emplace_back(scancode, false, false, now);
 
             // Clear held state
             m_CurrentKeyState[scancode] = false;
         }
     }
 
+    // Held modifiers were released with the keys; the compositor resends
+    // the full state on the next keyboard enter
+    m_ThisFrameInput.modifiers = 0;
     m_HasKeyboardFocus = false;
 }
 
-#endif
\ No newline at end of file
+// ============================================================================
+// Input Events
+// ============================================================================
+
+void WindowPlatform::ApplyInputEvent(const PlatformInputEvent& event)
+{
+    switch (event.type)
+    {
+    case PlatformInputEvent::TYPE::KEY:
+    {
+        // wl_keyboard has no repeat flag: a press for a held key is a repeat
+        bool isRepeat = false;
+        if (event.pressed && event.code < m_CurrentKeyState.size())
+        {
+            std::lock_guard lk(mtx);
+            isRepeat = m_CurrentKeyState[event.code];
+        }
+        RecordKeyTransition(event.code, event.pressed, isRepeat, event.timestamp);
+        break;
+    }
+
+    case PlatformInputEvent::TYPE::MOUSE_BUTTON:
+        RecordMouseButton(static_cast<MouseButton>(event.code), event.pressed, event.timestamp);
+        break;
+
+    case PlatformInputEvent::TYPE::MOUSE_POSITION:
+        RecordMousePosition(event.x, event.y, event.timestamp);
+        break;
+
+    case PlatformInputEvent::TYPE::RELATIVE_MOTION:
+        RecordRelativeMotion(event.dx, event.dy, event.timestamp);
+        break;
+
+    case PlatformInputEvent::TYPE::WHEEL:
+        RecordMouseWheel(static_cast<float>(event.dy), static_cast<float>(event.dx));
+        break;
+
+    case PlatformInputEvent::TYPE::TEXT:
+        RecordText(static_cast<uint32_t>(event.x));
+        break;
+
+    case PlatformInputEvent::TYPE::MODIFIERS:
+        RecordModifiers(static_cast<uint8_t>(event.code));
+        break;
+
+    case PlatformInputEvent::TYPE::FOCUS_GAINED:
+        SetKeyboardFocus(true);
+        break;
+
+    case PlatformInputEvent::TYPE::FOCUS_LOST:
+        OnFocusLost();
+        break;
+
+    case PlatformInputEvent::TYPE::POINTER_ENTER:
+        // Deltas come from the relative pointer when available (unaccelerated,
+        // not clamped at surface edges, still reported while locked)
+        SetRelativeMotionActive(event.pressed);
+        RecordMousePosition(event.x, event.y, event.timestamp);
+
+        // Constraints requested before a pointer existed are created now
+        ApplyPointerConstraint();
+        WindowContextPlatform::Get().RefreshCursor(this);
+        break;
+    }
+}
+
+void WindowPlatform::DrainInputQueue()
+{
+    PlatformInputEvent event;
+    while (m_InputQueue.TryPop(event))
+    {
+        if (!m_InputReplaced)
+            ApplyInputEvent(event);
+    }
+
+    uint32_t dropped = m_DroppedInputEvents.exchange(0, std::memory_order_relaxed);
+    if (dropped > 0)
+        SOLARC_WINDOW_WARN("Input queue for '{}' overflowed: {} event(s) dropped", m_Title, dropped);
+}
+
+// ============================================================================
+// Cursor Constraints (zwp_pointer_constraints_v1)
+// ============================================================================
+
+void WindowPlatform::SetCursorMode(CursorMode mode)
+{
+    if (m_Headless) { HeadlessSetCursorMode(mode); return; }
+
+    std::lock_guard lk(mtx);
+    if (mode == m_CursorMode) return;
+
+    auto& context = WindowContextPlatform::Get();
+    if (mode != CursorMode::Normal && !context.GetPointerConstraints())
+    {
+        SOLARC_WINDOW_WARN("Cursor mode '{}' unavailable for '{}': compositor lacks pointer constraints",
+            CursorModeToString(mode), m_Title);
+        return;
+    }
+
+    // Only one constraint may exist per surface/seat
+    DestroyPointerConstraint();
+    m_CursorMode = mode;
+    ApplyPointerConstraint();
+    context.RefreshCursor(this);
+
+    SOLARC_WINDOW_DEBUG("Cursor mode for '{}' set to {}", m_Title, CursorModeToString(mode));
+}
+
+void WindowPlatform::ApplyPointerConstraint()
+{
+    std::lock_guard lk(mtx);
+    if (m_CursorMode == CursorMode::Normal || m_LockedPointer || m_ConfinedPointer) return;
+
+    auto& context = WindowContextPlatform::Get();
+    zwp_pointer_constraints_v1* constraints = context.GetPointerConstraints();
+    wl_pointer* pointer = context.GetPointer();
+
+    // No pointer yet: retried on the next pointer enter
+    if (!constraints || !pointer || !m_Surface) return;
+
+    // Persistent lifetime: the compositor re-activates the constraint each
+    // time the surface regains pointer focus
+    if (m_CursorMode == CursorMode::Locked)
+    {
+        m_LockedPointer = zwp_pointer_constraints_v1_lock_pointer(
+            constraints, m_Surface, pointer, nullptr,
+            ZWP_POINTER_CONSTRAINTS_V1_LIFETIME_PERSISTENT);
+        zwp_locked_pointer_v1_add_listener(m_LockedPointer, &s_LockedPointerListener, this);
+    }
+    else
+    {
+        m_ConfinedPointer = zwp_pointer_constraints_v1_confine_pointer(
+            constraints, m_Surface, pointer, nullptr,
+            ZWP_POINTER_CONSTRAINTS_V1_LIFETIME_PERSISTENT);
+        zwp_confined_pointer_v1_add_listener(m_ConfinedPointer, &s_ConfinedPointerListener, this);
+    }
+
+    wl_surface_commit(m_Surface);
+}
+
+void WindowPlatform::DestroyPointerConstraint()
+{
+    std::lock_guard lk(mtx);
+
+    if (m_LockedPointer)
+    {
+        zwp_locked_pointer_v1_destroy(m_LockedPointer);
+        m_LockedPointer = nullptr;
+    }
+
+    if (m_ConfinedPointer)
+    {
+        zwp_confined_pointer_v1_destroy(m_ConfinedPointer);
+        m_ConfinedPointer = nullptr;
+    }
+}
+
+void WindowPlatform::locked_pointer_locked(void* data, zwp_locked_pointer_v1* locked)
+{
+    auto* window = static_cast<WindowPlatform*>(data);
+    SOLARC_WINDOW_DEBUG("Pointer locked to '{}'", window->GetTitle());
+}
+
+void WindowPlatform::locked_pointer_unlocked(void* data, zwp_locked_pointer_v1* locked)
+{
+    auto* window = static_cast<WindowPlatform*>(data);
+    SOLARC_WINDOW_DEBUG("Pointer unlocked from '{}'", window->GetTitle());
+}
+
+void WindowPlatform::confined_pointer_confined(void* data, zwp_confined_pointer_v1* confined)
+{
+    auto* window = static_cast<WindowPlatform*>(data);
+    SOLARC_WINDOW_DEBUG("Pointer confined to '{}'", window->GetTitle());
+}
+
+void WindowPlatform::confined_pointer_unconfined(void* data, zwp_confined_pointer_v1* confined)
+{
+    auto* window = static_cast<WindowPlatform*>(data);
+    SOLARC_WINDOW_DEBUG("Pointer unconfined from '{}'", window->GetTitle());
+}
+
+#endif
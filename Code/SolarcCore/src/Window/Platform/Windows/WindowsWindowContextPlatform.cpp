@@ -3,11 +3,47 @@
 #include "Window/WindowPlatform.h"
 #include "Input/Platform/Windows/WindowsKeyMapping.h"
 #include "Input/MouseButton.h"
+#include "Input/InputTimestamp.h"
+#include "Input/TextInput.h"
 #include <windowsx.h>
 #include <stdexcept>
 
+namespace
+{
+    /**
+     * Timestamp of the message currently being processed by WndProc.
+     * GetMessageTime() and GetTickCount() share the same millisecond clock.
+     */
+    InputTimestamp GetCurrentMessageTimestamp()
+    {
+        return InputClock::FromEventTimeMs(
+            static_cast<uint32_t>(GetMessageTime()),
+            static_cast<uint32_t>(GetTickCount()));
+    }
+}
+
 WindowContextPlatform::WindowContextPlatform()
 {
+    m_Headless = s_HeadlessRequested.load(std::memory_order_acquire);
+    s_Created.store(true, std::memory_order_release);
+
+    // Wait primitives for the event-driven main loop. A high-resolution
+    // waitable timer avoids the ~15.6 ms granularity of wait timeouts.
+    m_WakeEvent = CreateEvent(nullptr, FALSE, FALSE, nullptr);
+#ifdef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+    m_FrameTimer = CreateWaitableTimerEx(nullptr, nullptr, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+#endif
+    if (!m_FrameTimer)
+        m_FrameTimer = CreateWaitableTimer(nullptr, FALSE, nullptr);
+
+    // Headless: no window class, MsgWaitForMultipleObjects still serves the
+    // wake event and frame timer
+    if (m_Headless)
+    {
+        SOLARC_WINDOW_INFO("Headless window context initialized (no Win32 windows)");
+        return;
+    }
+
     std::lock_guard lock(m_WindowClassMtx);
     if (m_ClassRegistered) return;
 
@@ -53,6 +89,8 @@ WindowContextPlatform& WindowContextPlatform::Get()
 
 void WindowContextPlatform::Shutdown()
 {
+    if (m_FrameTimer) { CloseHandle(m_FrameTimer); m_FrameTimer = nullptr; }
+    if (m_WakeEvent) { CloseHandle(m_WakeEvent); m_WakeEvent = nullptr; }
 }
 
 void WindowContextPlatform::PollEvents()
@@ -65,6 +103,72 @@ void WindowContextPlatform::PollEvents()
     }
 }
 
+void WindowContextPlatform::WaitForEvents(std::chrono::steady_clock::time_point deadline, bool wakeOnInput)
+{
+    const auto now = std::chrono::steady_clock::now();
+    const bool hasDeadline = deadline != std::chrono::steady_clock::time_point::max();
+    if (hasDeadline && deadline <= now) return;
+
+    HANDLE handles[2];
+    DWORD handleCount = 0;
+    DWORD timeoutMs = INFINITE;
+
+    if (m_WakeEvent)
+        handles[handleCount++] = m_WakeEvent;
+
+    if (hasDeadline)
+    {
+        auto remaining = std::chrono::duration_cast<std::chrono::nanoseconds>(deadline - now).count();
+        LARGE_INTEGER due;
+        due.QuadPart = -static_cast<LONGLONG>((remaining + 99) / 100); // Relative, 100 ns units
+
+        if (m_FrameTimer && SetWaitableTimer(m_FrameTimer, &due, 0, nullptr, nullptr, FALSE))
+            handles[handleCount++] = m_FrameTimer;
+        else
+            timeoutMs = static_cast<DWORD>((remaining + 999999) / 1000000);
+    }
+
+    if (wakeOnInput)
+    {
+        // MWMO_INPUTAVAILABLE: also return for messages already in the queue
+        MsgWaitForMultipleObjectsEx(handleCount, handles, timeoutMs, QS_ALLINPUT, MWMO_INPUTAVAILABLE);
+    }
+    else if (handleCount > 0)
+    {
+        WaitForMultipleObjects(handleCount, handles, FALSE, timeoutMs);
+    }
+    else if (timeoutMs != INFINITE)
+    {
+        Sleep(timeoutMs);
+    }
+
+    if (hasDeadline && m_FrameTimer)
+        CancelWaitableTimer(m_FrameTimer);
+}
+
+void WindowContextPlatform::Wake()
+{
+    if (m_WakeEvent)
+        SetEvent(m_WakeEvent);
+}
+
+bool WindowContextPlatform::StartInputThread()
+{
+    // Messages for an HWND are only delivered to the thread that created it,
+    // so input stays on the main thread (WndProc records it directly)
+    SOLARC_WINDOW_WARN("Dedicated input thread is not supported on Win32; input is read on the main thread");
+    return false;
+}
+
+void WindowContextPlatform::StopInputThread()
+{
+}
+
+bool WindowContextPlatform::IsInputThreadRunning() const
+{
+    return false;
+}
+
 LRESULT CALLBACK WindowContextPlatform::WndProc(HWND hWnd, UINT msg, WPARAM wParam, LPARAM lParam)
 {
     // ========================================================================
@@ -105,7 +209,7 @@ LRESULT CALLBACK WindowContextPlatform::WndProc(HWND hWnd, UINT msg, WPARAM wPar
         bool isRepeat = Win32KeyMapping::IsKeyRepeat(lParam);
         bool isSys = (msg == WM_SYSKEYDOWN);
 
-        windowPlatform->RecordKeyTransition(scancode, true, isRepeat);
+        windowPlatform->RecordKeyTransition(scancode, true, isRepeat, GetCurrentMessageTimestamp());
 
         SOLARC_WINDOW_DEBUG("WM_{}KEYDOWN: scancode=0x{:02X}, repeat={}",
             isSys ? "SYS" : "", scancode, isRepeat ? "true" : "false");
@@ -124,7 +228,7 @@ LRESULT CALLBACK WindowContextPlatform::WndProc(HWND hWnd, UINT msg, WPARAM wPar
         uint16_t scancode = Win32KeyMapping::ExtractScancode(lParam);
         bool isSys = (msg == WM_SYSKEYUP);
 
-        windowPlatform->RecordKeyTransition(scancode, false, false);
+        windowPlatform->RecordKeyTransition(scancode, false, false, GetCurrentMessageTimestamp());
 
         SOLARC_WINDOW_DEBUG("WM_{}KEYUP: scancode=0x{:02X}",
             isSys ? "SYS" : "", scancode);
@@ -135,6 +239,32 @@ LRESULT CALLBACK WindowContextPlatform::WndProc(HWND hWnd, UINT msg, WPARAM wPar
         return 0;
     }
 
+    case WM_CHAR:
+    {
+        // UTF-16 code unit; characters outside the BMP arrive as two messages
+        uint32_t unit = static_cast<uint32_t>(wParam);
+        if (TextInput::IsHighSurrogate(unit))
+        {
+            windowPlatform->m_PendingHighSurrogate = static_cast<uint16_t>(unit);
+            return 0;
+        }
+
+        uint32_t codepoint = unit;
+        if (TextInput::IsLowSurrogate(unit))
+        {
+            if (windowPlatform->m_PendingHighSurrogate == 0)
+                return 0;
+            codepoint = TextInput::CombineSurrogates(windowPlatform->m_PendingHighSurrogate, static_cast<uint16_t>(unit));
+        }
+        windowPlatform->m_PendingHighSurrogate = 0;
+
+        // Ctrl+letter arrives as a control character and is filtered here
+        if (TextInput::IsPrintable(codepoint))
+            windowPlatform->RecordText(codepoint);
+
+        return 0;
+    }
+
     // ========================================================================
     // Mouse Movement
     // ========================================================================
@@ -145,7 +275,7 @@ LRESULT CALLBACK WindowContextPlatform::WndProc(HWND hWnd, UINT msg, WPARAM wPar
         int32_t x = GET_X_LPARAM(lParam);
         int32_t y = GET_Y_LPARAM(lParam);
 
-        windowPlatform->RecordMousePosition(x, y);
+        windowPlatform->RecordMousePosition(x, y, GetCurrentMessageTimestamp());
 
 
         SOLARC_WINDOW_DEBUG("WM_MOUSEMOVE: pos=({},{})", x, y);
@@ -160,7 +290,7 @@ LRESULT CALLBACK WindowContextPlatform::WndProc(HWND hWnd, UINT msg, WPARAM wPar
     case WM_LBUTTONDOWN:
     {
 
-        windowPlatform->RecordMouseButton(MouseButton::Left, true);
+        windowPlatform->RecordMouseButton(MouseButton::Left, true, GetCurrentMessageTimestamp());
 
         SOLARC_WINDOW_DEBUG("WM_LBUTTONDOWN");
         return 0;
@@ -168,7 +298,7 @@ LRESULT CALLBACK WindowContextPlatform::WndProc(HWND hWnd, UINT msg, WPARAM wPar
 
     case WM_LBUTTONUP:
     {
-        windowPlatform->RecordMouseButton(MouseButton::Left, false);
+        windowPlatform->RecordMouseButton(MouseButton::Left, false, GetCurrentMessageTimestamp());
 
         SOLARC_WINDOW_DEBUG("WM_LBUTTONUP");
         return 0;
@@ -176,7 +306,7 @@ LRESULT CALLBACK WindowContextPlatform::WndProc(HWND hWnd, UINT msg, WPARAM wPar
 
     case WM_RBUTTONDOWN:
     {
-        windowPlatform->RecordMouseButton(MouseButton::Right, true);
+        windowPlatform->RecordMouseButton(MouseButton::Right, true, GetCurrentMessageTimestamp());
 
         SOLARC_WINDOW_DEBUG("WM_RBUTTONDOWN");
         return 0;
@@ -184,7 +314,7 @@ LRESULT CALLBACK WindowContextPlatform::WndProc(HWND hWnd, UINT msg, WPARAM wPar
 
     case WM_RBUTTONUP:
     {
-        windowPlatform->RecordMouseButton(MouseButton::Right, false);
+        windowPlatform->RecordMouseButton(MouseButton::Right, false, GetCurrentMessageTimestamp());
 
         SOLARC_WINDOW_DEBUG("WM_RBUTTONUP");
         return 0;
@@ -192,7 +322,7 @@ LRESULT CALLBACK WindowContextPlatform::WndProc(HWND hWnd, UINT msg, WPARAM wPar
 
     case WM_MBUTTONDOWN:
     {
-        windowPlatform->RecordMouseButton(MouseButton::Middle, true);
+        windowPlatform->RecordMouseButton(MouseButton::Middle, true, GetCurrentMessageTimestamp());
 
         SOLARC_WINDOW_DEBUG("WM_MBUTTONDOWN");
         return 0;
@@ -200,7 +330,7 @@ LRESULT CALLBACK WindowContextPlatform::WndProc(HWND hWnd, UINT msg, WPARAM wPar
 
     case WM_MBUTTONUP:
     {
-        windowPlatform->RecordMouseButton(MouseButton::Middle, false);
+        windowPlatform->RecordMouseButton(MouseButton::Middle, false, GetCurrentMessageTimestamp());
 
         SOLARC_WINDOW_DEBUG("WM_MBUTTONUP");
         return 0;
@@ -213,7 +343,7 @@ LRESULT CALLBACK WindowContextPlatform::WndProc(HWND hWnd, UINT msg, WPARAM wPar
 
         MouseButton button = (xButton == XBUTTON1) ? MouseButton::X1 : MouseButton::X2;
 
-        windowPlatform->RecordMouseButton(button, true);
+        windowPlatform->RecordMouseButton(button, true, GetCurrentMessageTimestamp());
 
         SOLARC_WINDOW_DEBUG("WM_XBUTTONDOWN: button={}", MouseButtonToString(button));
 
@@ -226,13 +356,39 @@ LRESULT CALLBACK WindowContextPlatform::WndProc(HWND hWnd, UINT msg, WPARAM wPar
 
         MouseButton button = (xButton == XBUTTON1) ? MouseButton::X1 : MouseButton::X2;
 
-        windowPlatform->RecordMouseButton(button, false);
+        windowPlatform->RecordMouseButton(button, false, GetCurrentMessageTimestamp());
 
         SOLARC_WINDOW_DEBUG("WM_XBUTTONUP: button={}", MouseButtonToString(button));
 
         return TRUE;
     }
 
+    // ========================================================================
+    // Raw Mouse Input (registered only while the cursor is Locked)
+    // ========================================================================
+
+    case WM_INPUT:
+    {
+        RAWINPUT raw = {};
+        UINT size = sizeof(raw);
+        UINT read = GetRawInputData(reinterpret_cast<HRAWINPUT>(lParam), RID_INPUT,
+            &raw, &size, sizeof(RAWINPUTHEADER));
+
+        if (read != static_cast<UINT>(-1) &&
+            raw.header.dwType == RIM_TYPEMOUSE &&
+            !(raw.data.mouse.usFlags & MOUSE_MOVE_ABSOLUTE))
+        {
+            // Raw counts: no pointer acceleration, not clamped by the clip rect
+            windowPlatform->RecordRelativeMotion(
+                static_cast<double>(raw.data.mouse.lLastX),
+                static_cast<double>(raw.data.mouse.lLastY),
+                GetCurrentMessageTimestamp());
+        }
+
+        // DefWindowProc must see WM_INPUT to release the raw input buffer
+        break;
+    }
+
     // ========================================================================
     // Mouse Wheel (Vertical)
     // ========================================================================
@@ -271,6 +427,7 @@ LRESULT CALLBACK WindowContextPlatform::WndProc(HWND hWnd, UINT msg, WPARAM wPar
     case WM_SETFOCUS:
     {
         windowPlatform->SetKeyboardFocus(true);
+        windowPlatform->ApplyCursorClip();
 
         SOLARC_WINDOW_DEBUG("Window '{}' gained keyboard focus",
             windowPlatform->GetTitle());
@@ -284,6 +441,7 @@ LRESULT CALLBACK WindowContextPlatform::WndProc(HWND hWnd, UINT msg, WPARAM wPar
         // 2. Clears m_CurrentKeyState
         // 3. Sets m_HasKeyboardFocus = false
         windowPlatform->OnFocusLost();
+        windowPlatform->ApplyCursorClip();
 
         SOLARC_WINDOW_DEBUG("Window '{}' lost keyboard focus",
             windowPlatform->GetTitle());
@@ -331,12 +489,20 @@ LRESULT CALLBACK WindowContextPlatform::WndProc(HWND hWnd, UINT msg, WPARAM wPar
 
         windowPlatform->SyncDimensions(newWidth, newHeight);
         windowPlatform->DispatchWindowEvent(std::make_shared<WindowResizeEvent>(newWidth, newHeight));
+        windowPlatform->ApplyCursorClip();
 
         SOLARC_WINDOW_DEBUG("Window resize msg: {}x{}", newWidth, newHeight);
 
         return 0;
     }
 
+    case WM_MOVE:
+    {
+        // Clip rect is in screen coordinates
+        windowPlatform->ApplyCursorClip();
+        return 0;
+    }
+
     case WM_DESTROY:
         return 0;
     }
@@ -17,6 +17,11 @@ WindowPlatform::WindowPlatform(
     m_PrevMouseY = 0;
 
     auto& context = WindowContextPlatform::Get();
+    if (context.IsHeadless())
+    {
+        InitializeHeadless();
+        return;
+    }
 
     // Compute window rect that gives us desired client area
     DWORD style = WS_OVERLAPPEDWINDOW;
@@ -49,6 +54,8 @@ WindowPlatform::WindowPlatform(
 
 WindowPlatform::~WindowPlatform()
 {
+    SetCursorMode(CursorMode::Normal);
+
     if (m_hWnd)
         DestroyWindow(m_hWnd);
 
@@ -57,6 +64,8 @@ WindowPlatform::~WindowPlatform()
 
 void WindowPlatform::Show()
 {
+    if (m_Headless) { HeadlessShow(); return; }
+
     std::lock_guard lk(mtx);
     if (m_hWnd)
     {
@@ -64,6 +73,7 @@ void WindowPlatform::Show()
         UpdateWindow(m_hWnd);
 
         m_Visible = true;
+        PublishState();
 
         DispatchWindowEvent(std::make_shared<WindowShownEvent>());
         SOLARC_WINDOW_TRACE("Win32 window shown request: '{}'", m_Title);
@@ -72,12 +82,15 @@ void WindowPlatform::Show()
 
 void WindowPlatform::Hide()
 {
+    if (m_Headless) { HeadlessHide(); return; }
+
     std::lock_guard lk(mtx);
     if (m_hWnd)
     {
         ShowWindow(m_hWnd, SW_HIDE);
 
         m_Visible = false;
+        PublishState();
 
         DispatchWindowEvent(std::make_shared<WindowHiddenEvent>());
         SOLARC_WINDOW_TRACE("Win32 window hidden request: '{}'", m_Title);
@@ -95,9 +108,9 @@ void WindowPlatform::SetTitle(const std::string& title)
 {
     std::lock_guard lk(mtx);
 
+    m_Title = title;
     if (m_hWnd)
     {
-        m_Title = title;
         SetWindowTextA(m_hWnd, title.c_str());
         SOLARC_WINDOW_TRACE("Win32 window title changed: '{}'", m_Title);
     }
@@ -105,6 +118,8 @@ void WindowPlatform::SetTitle(const std::string& title)
 
 void WindowPlatform::Resize(int32_t width, int32_t height)
 {
+    if (m_Headless) { HeadlessResize(width, height); return; }
+
     std::lock_guard lk(mtx);
     if (!m_hWnd) return;
 
@@ -128,6 +143,8 @@ void WindowPlatform::Resize(int32_t width, int32_t height)
 
 void WindowPlatform::Minimize()
 {
+    if (m_Headless) { HeadlessMinimize(); return; }
+
     std::lock_guard lk(mtx);
 
     if (m_hWnd)
@@ -140,6 +157,8 @@ void WindowPlatform::Minimize()
 
 void WindowPlatform::Maximize()
 {
+    if (m_Headless) { HeadlessMaximize(); return; }
+
     std::lock_guard lk(mtx);
 
     if (m_hWnd)
@@ -152,6 +171,8 @@ void WindowPlatform::Maximize()
 
 void WindowPlatform::Restore()
 {
+    if (m_Headless) { HeadlessRestore(); return; }
+
     std::lock_guard lk(mtx);
 
     if (m_hWnd)
@@ -175,6 +196,18 @@ bool WindowPlatform::IsMaximized() const
     return m_Maximized;
 }
 
+void WindowPlatform::PublishState()
+{
+    if (!m_StateSnapshot) return;
+
+    uint8_t flags = 0;
+    if (m_Visible) flags |= WINDOW_STATE_VISIBLE;
+    if (m_Minimized) flags |= WINDOW_STATE_MINIMIZED;
+    if (m_Maximized) flags |= WINDOW_STATE_MAXIMIZED;
+
+    m_StateSnapshot->Publish(m_Width, m_Height, flags);
+}
+
 void WindowPlatform::OnFocusLost()
 {
     std::lock_guard lk(mtx);
@@ -182,12 +215,13 @@ void WindowPlatform::OnFocusLost()
     SOLARC_WINDOW_DEBUG("Window '{}' lost focus, clearing held keys", m_Title);
 
     // Synthesize key release transitions for all held keys
+    InputTimestamp now = InputClock::Now();
     for (uint16_t scancode = 0; scancode < 512; ++scancode)
     {
         if (m_CurrentKeyState[scancode])
         {
             // Generate release transition
-            m_ThisFrameInput.keyTransitions.emplace_back(scancode, false, false);
+            m_ThisFrameInput.keyTransitions.emplace_back(scancode, false, false, now);
 
             // Clear held state
             m_CurrentKeyState[scancode] = false;
@@ -197,4 +231,99 @@ void WindowPlatform::OnFocusLost()
     m_HasKeyboardFocus = false;
 }
 
-#endif
\ No newline at end of file
+// ============================================================================
+// Surface Scale
+// ============================================================================
+
+void WindowPlatform::SetRenderScale(float scale)
+{
+    if (m_Headless) { HeadlessSetRenderScale(scale); return; }
+
+    // Per-monitor DPI aware: client sizes are already device pixels, so only
+    // the render scale applies (the swapchain stretches to the client area)
+    std::lock_guard lk(mtx);
+
+    SurfaceScale surfaceScale = m_SurfaceScale;
+    surfaceScale.renderScale = SurfaceScale::ClampRenderScale(scale);
+    UpdateSurfaceScale(surfaceScale);
+
+    SOLARC_WINDOW_DEBUG("Render scale for '{}' set to {:.2f}", m_Title, surfaceScale.renderScale);
+}
+
+// ============================================================================
+// Cursor Constraints (ClipCursor / Raw Input)
+// ============================================================================
+
+void WindowPlatform::SetCursorMode(CursorMode mode)
+{
+    if (m_Headless) { HeadlessSetCursorMode(mode); return; }
+
+    std::lock_guard lk(mtx);
+    if (!m_hWnd || mode == m_CursorMode) return;
+
+    // Locked mode reads unaccelerated deltas from WM_INPUT instead of WM_MOUSEMOVE
+    bool wantRawInput = (mode == CursorMode::Locked);
+    if (wantRawInput != m_RelativeMotionActive)
+    {
+        RAWINPUTDEVICE rid = {};
+        rid.usUsagePage = 0x01; // HID_USAGE_PAGE_GENERIC
+        rid.usUsage = 0x02;     // HID_USAGE_GENERIC_MOUSE
+        rid.dwFlags = wantRawInput ? 0 : RIDEV_REMOVE;
+        rid.hwndTarget = wantRawInput ? m_hWnd : nullptr;
+
+        if (!RegisterRawInputDevices(&rid, 1, sizeof(rid)))
+        {
+            SOLARC_WINDOW_WARN("Cursor mode '{}' unavailable for '{}': RegisterRawInputDevices failed ({})",
+                CursorModeToString(mode), m_Title, GetLastError());
+            return;
+        }
+
+        SetRelativeMotionActive(wantRawInput);
+    }
+
+    bool hideCursor = (mode == CursorMode::Locked);
+    if (hideCursor != m_CursorHidden)
+    {
+        ShowCursor(hideCursor ? FALSE : TRUE);
+        m_CursorHidden = hideCursor;
+    }
+
+    CursorMode previous = m_CursorMode;
+    m_CursorMode = mode;
+
+    if (previous != CursorMode::Normal && mode == CursorMode::Normal)
+        ClipCursor(nullptr);
+    else
+        ApplyCursorClip();
+
+    SOLARC_WINDOW_DEBUG("Cursor mode for '{}' set to {}", m_Title, CursorModeToString(mode));
+}
+
+void WindowPlatform::ApplyCursorClip()
+{
+    std::lock_guard lk(mtx);
+    if (!m_hWnd || m_CursorMode == CursorMode::Normal) return;
+
+    // Clip only while focused; other applications must get a free cursor
+    if (GetFocus() != m_hWnd)
+    {
+        ClipCursor(nullptr);
+        return;
+    }
+
+    RECT rect;
+    GetClientRect(m_hWnd, &rect);
+    MapWindowPoints(m_hWnd, nullptr, reinterpret_cast<POINT*>(&rect), 2);
+
+    if (m_CursorMode == CursorMode::Locked)
+    {
+        // Pin to the client-area center; motion is read from raw input
+        LONG cx = (rect.left + rect.right) / 2;
+        LONG cy = (rect.top + rect.bottom) / 2;
+        rect = { cx, cy, cx + 1, cy + 1 };
+    }
+
+    ClipCursor(&rect);
+}
+
+#endif
@@ -0,0 +1,92 @@
+#include "Window/ReplayWindowPlatform.h"
+
+ReplayWindowPlatform::ReplayWindowPlatform(const std::string& title, const int32_t& width, const int32_t& height,
+                                           std::shared_ptr<const InputRecording> recording, uint32_t stream)
+    : m_Title(title)
+    , m_Width(width)
+    , m_Height(height)
+    , m_Playback(recording, stream)
+    , m_Frame(m_Playback.GetFirstFrame())
+{
+    if (!recording)
+        SOLARC_WINDOW_WARN("Replay window '{}' created without a recording", m_Title);
+}
+
+// ============================================================================
+// Commands
+// ============================================================================
+
+void ReplayWindowPlatform::Show()
+{
+    m_Visible = true;
+    PublishState();
+    DispatchEvent(std::make_shared<WindowShownEvent>());
+}
+
+void ReplayWindowPlatform::Hide()
+{
+    m_Visible = false;
+    PublishState();
+    DispatchEvent(std::make_shared<WindowHiddenEvent>());
+}
+
+void ReplayWindowPlatform::Resize(int32_t width, int32_t height)
+{
+    m_Width = width;
+    m_Height = height;
+    PublishState();
+    DispatchEvent(std::make_shared<WindowResizeEvent>(width, height));
+}
+
+void ReplayWindowPlatform::Minimize()
+{
+    m_Minimized = true;
+    PublishState();
+    DispatchEvent(std::make_shared<WindowMinimizedEvent>());
+}
+
+void ReplayWindowPlatform::Maximize()
+{
+    m_Minimized = false;
+    PublishState();
+    DispatchEvent(std::make_shared<WindowMaximizedEvent>());
+}
+
+void ReplayWindowPlatform::Restore()
+{
+    m_Minimized = false;
+    PublishState();
+    DispatchEvent(std::make_shared<WindowRestoredEvent>());
+}
+
+void ReplayWindowPlatform::SetRenderScale(float scale)
+{
+    const SurfaceExtent previous = GetBufferExtent();
+    m_SurfaceScale.renderScale = SurfaceScale::ClampRenderScale(scale);
+
+    if (GetBufferExtent() != previous)
+    {
+        PublishState();
+        DispatchEvent(std::make_shared<WindowResizeEvent>(m_Width, m_Height));
+    }
+}
+
+void ReplayWindowPlatform::PublishState()
+{
+    if (!m_StateSnapshot) return;
+
+    uint8_t flags = 0;
+    if (m_Visible) flags |= WINDOW_STATE_VISIBLE;
+    if (m_Minimized) flags |= WINDOW_STATE_MINIMIZED;
+
+    m_StateSnapshot->Publish(m_Width, m_Height, flags);
+}
+
+// ============================================================================
+// Playback
+// ============================================================================
+
+void ReplayWindowPlatform::ResetThisFrameInput()
+{
+    m_Playback.Play(m_Frame++, m_ThisFrameInput, m_HasKeyboardFocus);
+}
@@ -1,5 +1,9 @@
 #include "Window/Window.h"
 #include "Window/WindowPlatform.h"
+#include "Window/ReplayWindowPlatform.h"
 
 // Explicit instantiation for production type
-template class SOLARC_CORE_API WindowT<WindowPlatform>;
\ No newline at end of file
+template class SOLARC_CORE_API WindowT<WindowPlatform>;
+
+// Headless input playback (benchmarks, regression runs)
+template class SOLARC_CORE_API WindowT<ReplayWindowPlatform>;
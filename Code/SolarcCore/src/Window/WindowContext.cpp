@@ -1,4 +1,5 @@
 ﻿#include "Window/WindowContext.h"
+#include "MT/JobSystem.h"
 #include <algorithm>
 #include <memory>
 
@@ -20,24 +21,40 @@ WindowContext::~WindowContext()
 
 void WindowContext::OnDestroyWindow(Window* window)
 {
-    std::lock_guard lock(m_WindowsMutex);
+    std::shared_ptr<Window> removed; // Released after the lock
+    {
+        std::lock_guard lock(m_WindowsMutex);
 
-    auto it = std::find_if(m_Windows.begin(), m_Windows.end(),
-        [window](const auto& w) { return w.get() == window; });
+        WindowEntry* entry = m_Windows.Get(window->GetHandle());
+        if (entry && entry->window.get() == window)
+        {
+            SOLARC_WINDOW_DEBUG("Removing window from tracking: '{}'", window->GetTitle());
 
-    if (it != m_Windows.end())
-    {
-        SOLARC_WINDOW_DEBUG("Removing window from tracking: '{}'", (*it)->GetTitle());
-        
-        m_Windows.erase(it);
+            removed = std::move(entry->window);
+            m_Windows.Erase(window->GetHandle());
+        }
     }
 }
 
+void WindowContext::SetJobSystem(JobSystem* jobSystem)
+{
+    m_ThreadChecker.AssertOnOwnerThread("WindowContext::SetJobSystem");
+    m_JobSystem = jobSystem;
+}
+
 void WindowContext::PollEvents()
 {
     m_ThreadChecker.AssertOnOwnerThread("WindowContext::PollEvents");
 
     if (m_Shutdown) return;
+
+    // ========================================================================
+    // Phase 0: Record the frame that just ended (if enabled)
+    // ========================================================================
+    // Written before the reset so everything accumulated during the frame is
+    // captured, including input drained by late Window::Update() calls.
+    RecordInputFrame();
+
     // ========================================================================
     // Phase 1: Reset all windows' input accumulators
     // ========================================================================
@@ -45,13 +62,13 @@ void WindowContext::PollEvents()
     // during this frame starts from a clean slate.
     {
         std::lock_guard lock(m_WindowsMutex);
-        for (auto& window : m_Windows)
+        for (auto& entry : m_Windows)
         {
-            if (window)
+            if (entry.window)
             {
                 // Access platform via non-const method (we need to mutate it)
                 // Note: This is safe because Window manages platform lifetime
-                WindowPlatform* platform = window->GetPlatform();
+                WindowPlatform* platform = entry.window->GetPlatform();
                 if (platform)
                 {
                     platform->ResetThisFrameInput();
@@ -65,29 +82,201 @@ void WindowContext::PollEvents()
     // ========================================================================
     // Win32: Calls DispatchMessage() which triggers WndProc
     // Wayland: Calls wl_display_dispatch_pending() which triggers listeners
+    //          (seat listeners run on the input thread instead, if started)
     // 
     // During this phase, WindowPlatform::m_ThisFrameInput is populated
     // with key/mouse transitions and deltas.
     m_Platform.PollEvents();
 
+    // Replayed input replaces whatever the OS delivered
+    ReplayInputFrame();
+
+    m_RecordFramePending = m_InputRecorder != nullptr;
+
     // ========================================================================
-    // Phase 3: Update all windows (process input, emit events)
+    // Phase 3 + 4: Update all windows (process input, emit events)
     // ========================================================================
-    // Window::Update() will call UpdateInput() which reads m_ThisFrameInput
-    // and updates InputState, then emits transition events.
-    std::vector<std::shared_ptr<Window>> windows;
+    UpdateWindows();
+}
+
+void WindowContext::UpdateWindows()
+{
+    // Snapshot: keeps windows alive and the list stable while close events
+    // destroy windows in Phase 4. Reuses the vector's capacity every frame.
     {
         std::lock_guard lock(m_WindowsMutex);
-        windows.assign(m_Windows.begin(), m_Windows.end());
+        m_UpdateWindows.clear();
+        for (auto& entry : m_Windows)
+        {
+            if (entry.window)
+                m_UpdateWindows.push_back(entry.window);
+        }
+    }
+
+    // ========================================================================
+    // Phase 3: Input (reads m_ThisFrameInput, updates InputState, queues events)
+    // ========================================================================
+    // Windows share no input state, so they are independent jobs. Events are
+    // only queued here (EventProducer::DispatchEvent is thread-safe); no
+    // listener runs until Phase 4.
+    const size_t count = m_UpdateWindows.size();
+    if (m_JobSystem && count >= PARALLEL_UPDATE_MIN_WINDOWS)
+    {
+        // One batch per thread: the workers take the leading batches and the
+        // main thread updates the last one itself instead of idling in Wait()
+        const size_t threads = m_JobSystem->GetWorkerCount() + 1;
+        const size_t batchSize = (count + threads - 1) / threads;
+        const size_t workerCount = count - batchSize;
+
+        JobHandle workers = m_JobSystem->ParallelFor(workerCount,
+            [this](size_t index) { m_UpdateWindows[index]->UpdateInput(); },
+            batchSize);
+
+        for (size_t index = workerCount; index < count; ++index)
+            m_UpdateWindows[index]->UpdateInput();
+
+        workers.Wait();
+    }
+    else
+    {
+        for (auto& window : m_UpdateWindows)
+            window->UpdateInput();
+    }
+
+    // ========================================================================
+    // Phase 4: Deliver window events on the main thread
+    // ========================================================================
+    for (auto& window : m_UpdateWindows)
+        window->CommunicateEvents();
+
+    // Drop the references; windows closed above are destroyed here
+    m_UpdateWindows.clear();
+}
+
+void WindowContext::WaitForEvents(std::chrono::steady_clock::time_point deadline, bool wakeOnInput)
+{
+    m_ThreadChecker.AssertOnOwnerThread("WindowContext::WaitForEvents");
+
+    if (m_Shutdown) return;
+    m_Platform.WaitForEvents(deadline, wakeOnInput);
+}
+
+void WindowContext::WakeMainThread()
+{
+    m_Platform.Wake();
+}
+
+bool WindowContext::StartInputThread()
+{
+    m_ThreadChecker.AssertOnOwnerThread("WindowContext::StartInputThread");
+
+    if (m_Shutdown) return false;
+    return m_Platform.StartInputThread();
+}
+
+void WindowContext::StopInputThread()
+{
+    m_ThreadChecker.AssertOnOwnerThread("WindowContext::StopInputThread");
+    m_Platform.StopInputThread();
+}
+
+bool WindowContext::StartInputRecording(const std::string& path)
+{
+    m_ThreadChecker.AssertOnOwnerThread("WindowContext::StartInputRecording");
+
+    auto recorder = std::make_unique<InputRecorder>();
+    if (!recorder->Open(path))
+    {
+        SOLARC_WINDOW_ERROR("Failed to open input recording file: '{}'", path);
+        return false;
     }
 
-    for (auto& window : windows)
+    StopInputRecording();
+    m_InputRecorder = std::move(recorder);
+    SOLARC_WINDOW_INFO("Recording input to '{}'", path);
+    return true;
+}
+
+void WindowContext::RecordInputFrame()
+{
+    if (!m_InputRecorder || !m_RecordFramePending) return;
+    m_RecordFramePending = false;
+
+    std::lock_guard lock(m_WindowsMutex);
+
+    m_InputRecorder->BeginFrame();
+    for (auto& entry : m_Windows)
     {
-        if (window)
+        WindowPlatform* platform = entry.window ? entry.window->GetPlatform() : nullptr;
+        if (platform)
         {
-            window->Update();
+            m_InputRecorder->Record(entry.recordStreamId, platform->GetThisFrameInput(), platform->HasKeyboardFocus());
         }
     }
+    m_InputRecorder->EndFrame();
+}
+
+void WindowContext::StopInputRecording()
+{
+    if (!m_InputRecorder) return;
+
+    // Flush the frame in progress
+    RecordInputFrame();
+
+    m_InputRecorder->Close();
+    SOLARC_WINDOW_INFO("Input recording stopped: {} frames, {} bytes",
+        m_InputRecorder->GetFrameCount(), m_InputRecorder->GetBytesWritten());
+    m_InputRecorder.reset();
+}
+
+bool WindowContext::StartInputReplay(const std::string& path)
+{
+    m_ThreadChecker.AssertOnOwnerThread("WindowContext::StartInputReplay");
+
+    auto recording = std::make_shared<InputRecording>();
+    if (!recording->Load(path))
+    {
+        SOLARC_WINDOW_ERROR("Failed to load input recording: '{}'", path);
+        return false;
+    }
+
+    StopInputReplay();
+    m_InputReplay = std::move(recording);
+    m_ReplayFrame = 0;
+    m_ReplayEpoch = InputClock::Now();
+    SOLARC_WINDOW_INFO("Replaying input from '{}': {} frames, {} stream(s)",
+        path, m_InputReplay->GetFrameCount(), m_InputReplay->GetStreamIds().size());
+    return true;
+}
+
+void WindowContext::ReplayInputFrame()
+{
+    if (!m_InputReplay) return;
+
+    {
+        std::lock_guard lock(m_WindowsMutex);
+        for (auto& entry : m_Windows)
+        {
+            WindowPlatform* platform = entry.window ? entry.window->GetPlatform() : nullptr;
+            if (!platform) continue;
+
+            auto [it, inserted] = m_ReplayStreams.try_emplace(
+                entry.recordStreamId, m_InputReplay, entry.recordStreamId, m_ReplayEpoch);
+            platform->ReplaceThisFrameInput(it->second, m_ReplayFrame);
+        }
+    }
+
+    if (++m_ReplayFrame == m_InputReplay->GetFrameCount())
+        SOLARC_WINDOW_INFO("Input replay finished after {} frames", m_ReplayFrame);
+}
+
+void WindowContext::StopInputReplay()
+{
+    if (!m_InputReplay) return;
+
+    m_InputReplay.reset();
+    m_ReplayStreams.clear();
+    SOLARC_WINDOW_INFO("Input replay stopped after {} frames", m_ReplayFrame);
 }
 
 void WindowContext::Shutdown()
@@ -97,10 +286,18 @@ void WindowContext::Shutdown()
     SOLARC_WINDOW_INFO("WindowContext shutting down...");
     m_Shutdown = true;
 
+    // Last frame is written while its windows still exist
+    StopInputRecording();
+    StopInputReplay();
+
+    m_JobSystem = nullptr;
+
     std::vector<std::shared_ptr<Window>> windowsToDestroy;
     {
         std::lock_guard lock(m_WindowsMutex);
-        windowsToDestroy.assign(m_Windows.begin(), m_Windows.end());
+        windowsToDestroy.reserve(m_Windows.Size());
+        for (auto& entry : m_Windows)
+            windowsToDestroy.push_back(entry.window);
     }
 
     SOLARC_WINDOW_INFO("Destroying {} window(s)", windowsToDestroy.size());
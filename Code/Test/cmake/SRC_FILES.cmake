@@ -7,20 +7,45 @@ ${${PROJECT_NAME}_SRC_DIR}/Event/ObserverBusTest.cpp
 ${${PROJECT_NAME}_SRC_DIR}/Event/EventSystemStressTest.cpp
 
 ${${PROJECT_NAME}_SRC_DIR}/MT/JobSystemTest.cpp
+${${PROJECT_NAME}_SRC_DIR}/MT/SPSCQueueTest.cpp
 
 ${${PROJECT_NAME}_SRC_DIR}/Window/WindowTest.cpp
 ${${PROJECT_NAME}_SRC_DIR}/Window/WindowIntegrationTest.cpp
+${${PROJECT_NAME}_SRC_DIR}/Window/WindowStateTest.cpp
+${${PROJECT_NAME}_SRC_DIR}/Window/SurfaceScaleTest.cpp
 ${${PROJECT_NAME}_SRC_DIR}/Window/MockWindowPlatform.h
 
 ${${PROJECT_NAME}_SRC_DIR}/Input/WindowInputUnitTest.cpp
 ${${PROJECT_NAME}_SRC_DIR}/Input/WindowInputIntegrationTest.cpp
-
+${${PROJECT_NAME}_SRC_DIR}/Input/KeyBitsetTest.cpp
+${${PROJECT_NAME}_SRC_DIR}/Input/InputTimestampTest.cpp
+${${PROJECT_NAME}_SRC_DIR}/Input/InputActionMapTest.cpp
+${${PROJECT_NAME}_SRC_DIR}/Input/InputRecordingTest.cpp
+${${PROJECT_NAME}_SRC_DIR}/Input/TextInputTest.cpp
+${${PROJECT_NAME}_SRC_DIR}/Input/KeyRepeatTest.cpp
+${${PROJECT_NAME}_SRC_DIR}/Input/XkbKeymapTest.cpp
+
+${${PROJECT_NAME}_SRC_DIR}/Utility/FramePacerTest.cpp
+${${PROJECT_NAME}_SRC_DIR}/Utility/FrameTimerTest.cpp
+${${PROJECT_NAME}_SRC_DIR}/Utility/PresentTimingModelTest.cpp
+${${PROJECT_NAME}_SRC_DIR}/Utility/SlotMapTest.cpp
+${${PROJECT_NAME}_SRC_DIR}/Utility/TLSFAllocatorTest.cpp
+
+${${PROJECT_NAME}_SRC_DIR}/Rendering/RHIDescTest.cpp
+${${PROJECT_NAME}_SRC_DIR}/Rendering/RenderGraphTest.cpp
+${${PROJECT_NAME}_SRC_DIR}/Rendering/GPUAllocatorTest.cpp
+${${PROJECT_NAME}_SRC_DIR}/Rendering/UploadRingTest.cpp
+${${PROJECT_NAME}_SRC_DIR}/Rendering/PipelineCacheTest.cpp
+${${PROJECT_NAME}_SRC_DIR}/Rendering/DescriptorHeapTest.cpp
 ${${PROJECT_NAME}_SRC_DIR}/Rendering/RHIIntegrationTestFixture.h
 ${${PROJECT_NAME}_SRC_DIR}/Rendering/RHIIntegrationTest.cpp
 ${${PROJECT_NAME}_SRC_DIR}/Rendering/RHIFrameCycleIntegrationTest.cpp
 ${${PROJECT_NAME}_SRC_DIR}/Rendering/RHIVsyncIntegrationTest.cpp
 ${${PROJECT_NAME}_SRC_DIR}/Rendering/RHIWindowStateIntegrationTest.cpp
 ${${PROJECT_NAME}_SRC_DIR}/Rendering/RHIGPUSyncIntegrationTest.cpp
+${${PROJECT_NAME}_SRC_DIR}/Rendering/RHIOffscreenIntegrationTest.cpp
+${${PROJECT_NAME}_SRC_DIR}/Rendering/RHILatencyModeIntegrationTest.cpp
+${${PROJECT_NAME}_SRC_DIR}/Rendering/RHIParallelRecordingIntegrationTest.cpp
 
 ${${PROJECT_NAME}_SRC_DIR}/main.cpp
 ${${PROJECT_NAME}_SRC_DIR}/FreqUsedSymbolsOfTesting.h
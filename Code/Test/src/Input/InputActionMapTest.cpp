@@ -0,0 +1,296 @@
+#include <gtest/gtest.h>
+#include "Input/InputActionMap.h"
+#include "Input/KeyMapping.h"
+#include <bit>
+#include <chrono>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace
+{
+    uint16_t Sc(KeyCode key)
+    {
+        return KeyMapping::KeyCodeToScancode(key);
+    }
+}
+
+// ============================================================================
+// Binding Parsing
+// ============================================================================
+
+TEST(InputActionMapTest, ParseBinding_KeysMouseAndChords)
+{
+    auto single = InputActionMap::ParseBinding("W");
+    ASSERT_TRUE(single.has_value());
+    EXPECT_EQ(single->keyCount, 1);
+    EXPECT_EQ(single->scancodes[0], Sc(KeyCode::W));
+
+    auto chord = InputActionMap::ParseBinding("leftctrl + S");
+    ASSERT_TRUE(chord.has_value());
+    EXPECT_EQ(chord->keyCount, 2);
+    EXPECT_EQ(chord->scancodes[0], Sc(KeyCode::LeftCtrl));
+    EXPECT_EQ(chord->scancodes[1], Sc(KeyCode::S));
+
+    auto mouse = InputActionMap::ParseBinding("LeftAlt+MouseRight");
+    ASSERT_TRUE(mouse.has_value());
+    EXPECT_EQ(mouse->keyCount, 1);
+    EXPECT_EQ(mouse->mouseButtons, MouseButtonToBit(MouseButton::Right));
+}
+
+TEST(InputActionMapTest, ParseBinding_RejectsInvalid)
+{
+    EXPECT_FALSE(InputActionMap::ParseBinding("").has_value());
+    EXPECT_FALSE(InputActionMap::ParseBinding("NotAKey").has_value());
+    EXPECT_FALSE(InputActionMap::ParseBinding("W+").has_value());
+    EXPECT_FALSE(InputActionMap::ParseBinding("MouseMiddleish").has_value());
+    EXPECT_FALSE(InputActionMap::ParseBinding("A+B+C+D+E").has_value()); // Exceeds MAX_CHORD_KEYS
+}
+
+// ============================================================================
+// Registration
+// ============================================================================
+
+TEST(InputActionMapTest, AddAction_ReusesNamesAndEnforcesLimit)
+{
+    InputActionMap map;
+    InputActionId jump = map.AddAction("Jump");
+    EXPECT_EQ(map.AddAction("Jump"), jump);
+    EXPECT_EQ(map.FindAction("Jump"), jump);
+    EXPECT_EQ(map.GetActionName(jump), "Jump");
+    EXPECT_EQ(map.FindAction("Missing"), INVALID_INPUT_ACTION);
+
+    for (size_t i = map.GetActionCount(); i < MAX_INPUT_ACTIONS; ++i)
+        EXPECT_NE(map.AddAction("Action" + std::to_string(i)), INVALID_INPUT_ACTION);
+
+    EXPECT_EQ(map.AddAction("OneTooMany"), INVALID_INPUT_ACTION);
+    EXPECT_FALSE(map.AddBinding(INVALID_INPUT_ACTION, "W"));
+}
+
+// ============================================================================
+// Evaluation
+// ============================================================================
+
+TEST(InputActionMapTest, Evaluate_ChordRequiresAllInputs)
+{
+    InputActionMap map;
+    InputActionId save = map.AddAction("QuickSave");
+    ASSERT_TRUE(map.AddBinding(save, "LeftCtrl+S"));
+
+    InputState input;
+    KeyBitset previousKeys;
+    ActionState state;
+
+    input.keys.Set(Sc(KeyCode::S));
+    map.Evaluate(input, previousKeys, 0, state);
+    EXPECT_FALSE(state.IsDown(save));
+
+    previousKeys = input.keys;
+    input.keys.Set(Sc(KeyCode::LeftCtrl));
+    map.Evaluate(input, previousKeys, 0, state);
+    EXPECT_TRUE(state.IsDown(save));
+    EXPECT_TRUE(state.WasPressed(save));
+
+    // Releasing either key releases the chord
+    previousKeys = input.keys;
+    input.keys.Clear(Sc(KeyCode::LeftCtrl));
+    map.Evaluate(input, previousKeys, 0, state);
+    EXPECT_FALSE(state.IsDown(save));
+    EXPECT_TRUE(state.WasReleased(save));
+}
+
+TEST(InputActionMapTest, Evaluate_MultipleBindingsAreOred)
+{
+    InputActionMap map;
+    InputActionId forward = map.AddAction("MoveForward");
+    map.AddBinding(forward, "W");
+    map.AddBinding(forward, "Up");
+
+    InputState input;
+    KeyBitset previousKeys;
+    ActionState state;
+
+    input.keys.Set(Sc(KeyCode::W));
+    map.Evaluate(input, previousKeys, 0, state);
+    EXPECT_TRUE(state.WasPressed(forward));
+
+    // Up pressed while W held: still down, no second press edge
+    previousKeys = input.keys;
+    input.keys.Set(Sc(KeyCode::Up));
+    map.Evaluate(input, previousKeys, 0, state);
+    EXPECT_TRUE(state.IsDown(forward));
+    EXPECT_FALSE(state.WasPressed(forward));
+
+    // W released, Up still held
+    previousKeys = input.keys;
+    input.keys.Clear(Sc(KeyCode::W));
+    map.Evaluate(input, previousKeys, 0, state);
+    EXPECT_TRUE(state.IsDown(forward));
+    EXPECT_FALSE(state.WasReleased(forward));
+}
+
+TEST(InputActionMapTest, Evaluate_UnchangedActionsKeepState)
+{
+    InputActionMap map;
+    InputActionId fire = map.AddAction("Fire");
+    InputActionId jump = map.AddAction("Jump");
+    map.AddBinding(fire, "MouseLeft");
+    map.AddBinding(jump, "Space");
+
+    InputState input;
+    ActionState state;
+
+    input.mouseButtons = MouseButtonToBit(MouseButton::Left);
+    map.Evaluate(input, KeyBitset{}, 0, state);
+    EXPECT_TRUE(state.WasPressed(fire));
+
+    // Next frame nothing changed: held, no edges
+    map.Evaluate(input, input.keys, input.mouseButtons, state);
+    EXPECT_TRUE(state.IsDown(fire));
+    EXPECT_EQ(state.pressed, 0u);
+    EXPECT_EQ(state.released, 0u);
+    EXPECT_FALSE(state.IsDown(jump));
+}
+
+TEST(InputActionMapTest, EvaluateAll_PicksUpHeldKeys)
+{
+    InputActionMap map;
+    InputActionId sprint = map.AddAction("Sprint");
+    map.AddBinding(sprint, "LeftShift");
+
+    InputState input;
+    input.keys.Set(Sc(KeyCode::LeftShift));
+
+    // Incremental evaluation sees no transition
+    ActionState incremental;
+    map.Evaluate(input, input.keys, 0, incremental);
+    EXPECT_FALSE(incremental.IsDown(sprint));
+
+    ActionState full;
+    map.EvaluateAll(input, full);
+    EXPECT_TRUE(full.IsDown(sprint));
+    EXPECT_TRUE(full.WasPressed(sprint));
+}
+
+TEST(InputActionMapTest, Axes_FromActionsAndMouse)
+{
+    InputActionMap map;
+    InputActionId right = map.AddAction("MoveRight");
+    InputActionId left = map.AddAction("MoveLeft");
+    map.AddBinding(right, "D");
+    map.AddBinding(left, "A");
+
+    InputAxisId moveX = map.AddAxis("MoveX", right, left);
+    InputAxisId lookY = map.AddAxis("LookY", InputAxisSource::MouseY, -0.5f);
+    EXPECT_EQ(map.AddAxis("MoveX", right, left), INVALID_INPUT_AXIS); // Duplicate name
+
+    InputState input;
+    ActionState state;
+
+    input.keys.Set(Sc(KeyCode::D));
+    input.mouseDeltaY = 10;
+    map.Evaluate(input, KeyBitset{}, 0, state);
+    EXPECT_FLOAT_EQ(state.GetAxis(moveX), 1.0f);
+    EXPECT_FLOAT_EQ(state.GetAxis(lookY), -5.0f);
+
+    // Both directions held cancel out
+    KeyBitset previousKeys = input.keys;
+    input.keys.Set(Sc(KeyCode::A));
+    map.Evaluate(input, previousKeys, 0, state);
+    EXPECT_FLOAT_EQ(state.GetAxis(moveX), 0.0f);
+
+    EXPECT_FLOAT_EQ(state.GetAxis(INVALID_INPUT_AXIS), 0.0f);
+}
+
+// ============================================================================
+// Performance Benchmark (Not a test, just for measurement)
+// ============================================================================
+
+TEST(InputActionMapBenchmark, MeasureBindingEvaluationCost)
+{
+    constexpr int NUM_FRAMES = 20000;
+    constexpr KeyCode KEYS[] = {
+        KeyCode::W, KeyCode::A, KeyCode::S, KeyCode::D, KeyCode::Q, KeyCode::E,
+        KeyCode::R, KeyCode::F, KeyCode::Space, KeyCode::LeftShift, KeyCode::LeftCtrl,
+        KeyCode::Num1, KeyCode::Num2, KeyCode::Num3, KeyCode::Num4, KeyCode::Tab
+    };
+    constexpr size_t KEY_COUNT = sizeof(KEYS) / sizeof(KEYS[0]);
+
+    // Every action has several bindings: ~4 x MAX_INPUT_ACTIONS bindings total
+    InputActionMap map;
+    std::vector<std::vector<KeyCode>> polledBindings(MAX_INPUT_ACTIONS);
+    for (size_t a = 0; a < MAX_INPUT_ACTIONS; ++a)
+    {
+        InputActionId id = map.AddAction("Action" + std::to_string(a));
+        for (size_t b = 0; b < 4; ++b)
+        {
+            KeyCode key = KEYS[(a * 7 + b * 3) % KEY_COUNT];
+            InputBinding binding;
+            binding.scancodes[0] = Sc(key);
+            binding.keyCount = 1;
+            map.AddBinding(id, binding);
+            polledBindings[a].push_back(key);
+        }
+    }
+
+    auto frameKey = [&](int frame) { return KEYS[(frame * 5) % KEY_COUNT]; };
+
+    // ------------------------------------------------------------------------
+    // Polling: one KeyCode -> scancode lookup and bit test per binding
+    // ------------------------------------------------------------------------
+    InputState polledInput;
+    uint64_t polledDown = 0;
+    uint32_t polledPresses = 0;
+
+    auto pollStart = std::chrono::high_resolution_clock::now();
+    for (int frame = 0; frame < NUM_FRAMES; ++frame)
+    {
+        uint16_t sc = Sc(frameKey(frame));
+        polledInput.keys.Assign(sc, !polledInput.keys.Test(sc));
+
+        uint64_t down = 0;
+        for (size_t a = 0; a < MAX_INPUT_ACTIONS; ++a)
+        {
+            for (KeyCode key : polledBindings[a])
+            {
+                if (polledInput.keys.Test(KeyMapping::KeyCodeToScancode(key)))
+                {
+                    down |= (1ull << a);
+                    break;
+                }
+            }
+        }
+        polledPresses += static_cast<uint32_t>(std::popcount(down & ~polledDown));
+        polledDown = down;
+    }
+    auto pollEnd = std::chrono::high_resolution_clock::now();
+
+    // ------------------------------------------------------------------------
+    // Compiled: one pass over changed keys, re-test dirty actions only
+    // ------------------------------------------------------------------------
+    InputState compiledInput;
+    KeyBitset previousKeys;
+    ActionState state;
+    uint32_t compiledPresses = 0;
+
+    auto compiledStart = std::chrono::high_resolution_clock::now();
+    for (int frame = 0; frame < NUM_FRAMES; ++frame)
+    {
+        previousKeys = compiledInput.keys;
+        uint16_t sc = Sc(frameKey(frame));
+        compiledInput.keys.Assign(sc, !compiledInput.keys.Test(sc));
+
+        map.Evaluate(compiledInput, previousKeys, 0, state);
+        compiledPresses += static_cast<uint32_t>(std::popcount(state.pressed));
+    }
+    auto compiledEnd = std::chrono::high_resolution_clock::now();
+
+    // Both approaches must observe the same press edges
+    ASSERT_EQ(polledPresses, compiledPresses);
+
+    auto pollNs = std::chrono::duration_cast<std::chrono::nanoseconds>(pollEnd - pollStart).count();
+    auto compiledNs = std::chrono::duration_cast<std::chrono::nanoseconds>(compiledEnd - compiledStart).count();
+
+    std::cout << "Per-binding polling: " << (pollNs / NUM_FRAMES) << " ns/frame" << std::endl;
+    std::cout << "Compiled tables:     " << (compiledNs / NUM_FRAMES) << " ns/frame" << std::endl;
+}
@@ -0,0 +1,359 @@
+#include <gtest/gtest.h>
+#include "Input/InputRecording.h"
+#include "Window/ReplayWindowPlatform.h"
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+
+namespace
+{
+    class InputRecordingTest : public ::testing::Test
+    {
+    protected:
+        void SetUp() override
+        {
+            m_Path = (std::filesystem::temp_directory_path() /
+                ("solarc_input_" + std::to_string(reinterpret_cast<uintptr_t>(this)) + ".bin")).string();
+        }
+
+        void TearDown() override
+        {
+            std::error_code ec;
+            std::filesystem::remove(m_Path, ec);
+        }
+
+        std::vector<uint8_t> ReadFile() const
+        {
+            std::ifstream file(m_Path, std::ios::binary);
+            return { std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>() };
+        }
+
+        std::string m_Path;
+    };
+
+    InputFrame MakeFrame(InputTimestamp base)
+    {
+        InputFrame frame;
+        frame.mouseX = 320;
+        frame.mouseY = -12;
+        frame.mouseDeltaX = -7;
+        frame.mouseDeltaY = 3;
+        frame.wheelDelta = 1.5f;
+        frame.keyTransitions.emplace_back(0x11, true, false, base + 100);
+        frame.keyTransitions.emplace_back(0x1E, false, true, 0);
+        frame.mouseButtonTransitions.emplace_back(MouseButton::Right, true, base + 50);
+
+        InputFrame::MouseSample sample;
+        sample.timestamp = base + 120;
+        sample.x = 320;
+        sample.y = -12;
+        sample.deltaX = -7;
+        sample.deltaY = 3;
+        frame.mouseSamples.Push(sample);
+        return frame;
+    }
+}
+
+// ============================================================================
+// Round Trip
+// ============================================================================
+
+TEST_F(InputRecordingTest, RoundTrip_PreservesFrames)
+{
+    InputTimestamp base = InputClock::Now();
+    InputFrame frame = MakeFrame(base);
+
+    InputRecorder recorder;
+    ASSERT_TRUE(recorder.Open(m_Path));
+
+    recorder.BeginFrame();
+    recorder.Record(0, frame, true);
+    recorder.Record(3, InputFrame{}, false);
+    recorder.EndFrame();
+
+    recorder.BeginFrame(); // Frame with no windows
+    recorder.EndFrame();
+
+    recorder.BeginFrame();
+    recorder.Record(0, InputFrame{}, true);
+    recorder.EndFrame();
+    recorder.Close();
+
+    EXPECT_EQ(recorder.GetFrameCount(), 3u);
+    EXPECT_EQ(recorder.GetBytesWritten(), ReadFile().size());
+
+    InputRecording recording;
+    ASSERT_TRUE(recording.Load(m_Path));
+    EXPECT_EQ(recording.GetFrameCount(), 3u);
+    EXPECT_EQ(recording.GetStreamIds(), (std::vector<uint32_t>{ 0, 3 }));
+
+    const auto& stream0 = recording.GetStream(0);
+    ASSERT_EQ(stream0.size(), 2u);
+    EXPECT_EQ(stream0[0].frameIndex, 0u);
+    EXPECT_EQ(stream0[1].frameIndex, 2u);
+    EXPECT_TRUE(stream0[0].hasFocus);
+
+    const InputFrame& loaded = stream0[0].input;
+    EXPECT_EQ(loaded.mouseX, 320);
+    EXPECT_EQ(loaded.mouseY, -12);
+    EXPECT_EQ(loaded.mouseDeltaX, -7);
+    EXPECT_EQ(loaded.mouseDeltaY, 3);
+    EXPECT_FLOAT_EQ(loaded.wheelDelta, 1.5f);
+
+    ASSERT_EQ(loaded.keyTransitions.size(), 2u);
+    EXPECT_EQ(loaded.keyTransitions[0].scancode, 0x11);
+    EXPECT_TRUE(loaded.keyTransitions[0].pressed);
+    EXPECT_EQ(loaded.keyTransitions[0].timestamp, base + 100);
+    EXPECT_TRUE(loaded.keyTransitions[1].isRepeat);
+    EXPECT_EQ(loaded.keyTransitions[1].timestamp, 0u);
+
+    ASSERT_EQ(loaded.mouseButtonTransitions.size(), 1u);
+    EXPECT_EQ(loaded.mouseButtonTransitions[0].button, MouseButton::Right);
+    EXPECT_EQ(loaded.mouseButtonTransitions[0].timestamp, base + 50);
+
+    ASSERT_EQ(loaded.mouseSamples.Size(), 1u);
+    EXPECT_EQ(loaded.mouseSamples[0].timestamp, base + 120);
+    EXPECT_EQ(loaded.mouseSamples[0].deltaX, -7);
+
+    EXPECT_FALSE(recording.GetStream(3)[0].hasFocus);
+    EXPECT_TRUE(recording.GetStream(42).empty());
+}
+
+TEST_F(InputRecordingTest, Parse_RejectsBadOrTruncatedData)
+{
+    InputRecorder recorder;
+    ASSERT_TRUE(recorder.Open(m_Path));
+    recorder.BeginFrame();
+    recorder.Record(0, MakeFrame(InputClock::Now()), true);
+    recorder.EndFrame();
+    recorder.Close();
+
+    std::vector<uint8_t> data = ReadFile();
+    InputRecording recording;
+    ASSERT_TRUE(recording.Parse(data.data(), data.size()));
+
+    // Truncated
+    EXPECT_FALSE(recording.Parse(data.data(), data.size() - 3));
+    EXPECT_EQ(recording.GetFrameCount(), 0u);
+
+    // Bad magic
+    data[0] = 'X';
+    EXPECT_FALSE(recording.Parse(data.data(), data.size()));
+
+    EXPECT_FALSE(recording.Load(m_Path + ".missing"));
+}
+
+// ============================================================================
+// Replay
+// ============================================================================
+
+TEST_F(InputRecordingTest, Replay_ReproducesWindowInput)
+{
+    InputRecorder recorder;
+    ASSERT_TRUE(recorder.Open(m_Path));
+
+    // Frame 0: press W, Frame 1: move mouse, Frame 2: release W
+    InputFrame press;
+    press.keyTransitions.emplace_back(0x11, true, false, InputClock::Now());
+    InputFrame move;
+    move.mouseX = 10;
+    move.mouseY = 20;
+    move.mouseDeltaX = 4;
+    InputFrame release;
+    release.mouseX = 10;
+    release.mouseY = 20;
+    release.keyTransitions.emplace_back(0x11, false);
+
+    for (const InputFrame* frame : { &press, &move, &release })
+    {
+        recorder.BeginFrame();
+        recorder.Record(0, *frame, true);
+        recorder.EndFrame();
+    }
+    recorder.Close();
+
+    auto recording = std::make_shared<InputRecording>();
+    ASSERT_TRUE(recording->Load(m_Path));
+
+    auto platform = std::make_unique<ReplayWindowPlatform>("Replay", 640, 480, recording, 0);
+    ReplayWindowPlatform* replay = platform.get();
+    auto window = std::make_shared<ReplayWindow>(std::move(platform));
+
+    replay->ResetThisFrameInput();
+    window->Update();
+    EXPECT_TRUE(window->WasKeyJustPressed(KeyCode::W));
+    EXPECT_GT(window->GetOldestInputTimestamp(), 0u);
+
+    replay->ResetThisFrameInput();
+    window->Update();
+    EXPECT_TRUE(window->IsKeyDown(KeyCode::W));
+    EXPECT_EQ(window->GetMouseX(), 10);
+    EXPECT_EQ(window->GetMouseDeltaX(), 4);
+    EXPECT_FALSE(replay->IsFinished());
+
+    replay->ResetThisFrameInput();
+    window->Update();
+    EXPECT_TRUE(window->WasKeyJustReleased(KeyCode::W));
+    EXPECT_TRUE(replay->IsFinished());
+    EXPECT_EQ(replay->GetPlayedFrameCount(), 3u);
+
+    // Past the end: empty frames
+    replay->ResetThisFrameInput();
+    window->Update();
+    EXPECT_FALSE(window->IsAnyKeyDown());
+    EXPECT_EQ(window->GetMouseDeltaX(), 0);
+}
+
+TEST_F(InputRecordingTest, Replay_DeliversTextAndModifiers)
+{
+    InputRecorder recorder;
+    ASSERT_TRUE(recorder.Open(m_Path));
+
+    // Frame 0: typed text with Shift + Caps Lock reported by the keymap
+    InputFrame typed;
+    typed.textInput = { 'H', 0x00E9, 0x1F600 };
+    typed.modifiers = KeyModifierToBit(KeyModifier::Shift) | KeyModifierToBit(KeyModifier::CapsLock);
+    typed.hasModifiers = true;
+
+    recorder.BeginFrame();
+    recorder.Record(0, typed, true);
+    recorder.EndFrame();
+
+    recorder.BeginFrame();
+    recorder.Record(0, InputFrame{}, true);
+    recorder.EndFrame();
+    recorder.Close();
+
+    auto recording = std::make_shared<InputRecording>();
+    ASSERT_TRUE(recording->Load(m_Path));
+    EXPECT_EQ(recording->GetStream(0)[0].input.textInput, typed.textInput);
+
+    auto platform = std::make_unique<ReplayWindowPlatform>("Replay", 640, 480, recording, 0);
+    ReplayWindowPlatform* replay = platform.get();
+    auto window = std::make_shared<ReplayWindow>(std::move(platform));
+
+    replay->ResetThisFrameInput();
+    window->Update();
+    EXPECT_EQ(window->GetTextInput(), "H\xC3\xA9\xF0\x9F\x98\x80");
+    EXPECT_TRUE(window->IsShiftDown());
+    EXPECT_TRUE(window->IsCapsLockOn());
+    EXPECT_FALSE(window->IsCtrlDown());
+
+    // Text is per frame; no keymap modifiers recorded means scancode fallback
+    replay->ResetThisFrameInput();
+    window->Update();
+    EXPECT_TRUE(window->GetTextInput().empty());
+    EXPECT_FALSE(window->IsShiftDown());
+}
+
+TEST_F(InputRecordingTest, Replay_FrameWithoutRecord_IsEmpty)
+{
+    InputRecorder recorder;
+    ASSERT_TRUE(recorder.Open(m_Path));
+
+    // Stream 0 has nothing recorded in frame 1 (only stream 1 does)
+    InputFrame press;
+    press.keyTransitions.emplace_back(0x11, true, false, InputClock::Now());
+    press.mouseDeltaX = 5;
+    InputFrame release;
+    release.keyTransitions.emplace_back(0x11, false);
+
+    recorder.BeginFrame();
+    recorder.Record(0, press, true);
+    recorder.Record(1, InputFrame{}, true);
+    recorder.EndFrame();
+
+    recorder.BeginFrame();
+    recorder.Record(1, InputFrame{}, true);
+    recorder.EndFrame();
+
+    recorder.BeginFrame();
+    recorder.Record(0, release, true);
+    recorder.Record(1, InputFrame{}, true);
+    recorder.EndFrame();
+    recorder.Close();
+
+    auto recording = std::make_shared<InputRecording>();
+    ASSERT_TRUE(recording->Load(m_Path));
+    ASSERT_EQ(recording->GetStream(0).size(), 2u);
+
+    auto platform = std::make_unique<ReplayWindowPlatform>("Replay", 640, 480, recording, 0);
+    ReplayWindowPlatform* replay = platform.get();
+    auto window = std::make_shared<ReplayWindow>(std::move(platform));
+
+    replay->ResetThisFrameInput();
+    window->Update();
+    EXPECT_TRUE(window->WasKeyJustPressed(KeyCode::W));
+    EXPECT_EQ(window->GetMouseDeltaX(), 5);
+
+    // The gap plays as an empty frame; the release is not pulled forward
+    replay->ResetThisFrameInput();
+    window->Update();
+    EXPECT_TRUE(window->IsKeyDown(KeyCode::W));
+    EXPECT_FALSE(window->WasKeyJustReleased(KeyCode::W));
+    EXPECT_EQ(window->GetMouseDeltaX(), 0);
+    EXPECT_FALSE(replay->IsFinished());
+
+    replay->ResetThisFrameInput();
+    window->Update();
+    EXPECT_TRUE(window->WasKeyJustReleased(KeyCode::W));
+    EXPECT_TRUE(replay->IsFinished());
+    EXPECT_EQ(replay->GetPlayedFrameCount(), 2u);
+}
+
+TEST_F(InputRecordingTest, ReplayStream_StartsAtFirstRecordedFrame)
+{
+    InputRecorder recorder;
+    ASSERT_TRUE(recorder.Open(m_Path));
+
+    // Stream 1's window was created in frame 1
+    InputFrame moved;
+    moved.mouseX = 42;
+
+    recorder.BeginFrame();
+    recorder.Record(0, InputFrame{}, true);
+    recorder.EndFrame();
+
+    recorder.BeginFrame();
+    recorder.Record(0, InputFrame{}, true);
+    recorder.Record(1, moved, false);
+    recorder.EndFrame();
+    recorder.Close();
+
+    auto recording = std::make_shared<InputRecording>();
+    ASSERT_TRUE(recording->Load(m_Path));
+
+    InputReplayStream stream(recording, 1);
+    EXPECT_EQ(stream.GetFirstFrame(), 1u);
+
+    InputFrame out;
+    bool hasFocus = true;
+    EXPECT_FALSE(stream.Play(0, out, hasFocus));
+    EXPECT_TRUE(hasFocus);
+
+    EXPECT_TRUE(stream.Play(1, out, hasFocus));
+    EXPECT_EQ(out.mouseX, 42);
+    EXPECT_FALSE(hasFocus);
+    EXPECT_TRUE(stream.IsFinished());
+}
+
+TEST_F(InputRecordingTest, Parse_AcceptsVersion1)
+{
+    InputRecorder recorder;
+    ASSERT_TRUE(recorder.Open(m_Path));
+    recorder.BeginFrame();
+    recorder.Record(0, MakeFrame(InputClock::Now()), true);
+    recorder.EndFrame();
+    recorder.Close();
+
+    // A frame without text or modifiers is encoded identically in v1
+    std::vector<uint8_t> data = ReadFile();
+    data[sizeof(InputRecordingFormat::MAGIC)] = 1;
+
+    InputRecording recording;
+    ASSERT_TRUE(recording.Parse(data.data(), data.size()));
+    EXPECT_EQ(recording.GetStream(0).size(), 1u);
+
+    data[sizeof(InputRecordingFormat::MAGIC)] = InputRecordingFormat::VERSION + 1;
+    EXPECT_FALSE(recording.Parse(data.data(), data.size()));
+}
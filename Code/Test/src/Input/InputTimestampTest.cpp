@@ -0,0 +1,76 @@
+#include <gtest/gtest.h>
+#include "Input/InputTimestamp.h"
+#include "Input/InputFrame.h"
+#include "Utility/FixedRingBuffer.h"
+
+// ============================================================================
+// InputClock
+// ============================================================================
+
+TEST(InputTimestampTest, FromEventTimeMs_SubtractsEventAge)
+{
+    const InputTimestamp now = 5'000'000; // 5 s
+
+    EXPECT_EQ(InputClock::FromEventTimeMs(1000, 1000, now), now);
+    EXPECT_EQ(InputClock::FromEventTimeMs(990, 1000, now), now - 10'000);
+}
+
+TEST(InputTimestampTest, FromEventTimeMs_HandlesPlatformClockWrap)
+{
+    const InputTimestamp now = 5'000'000;
+
+    // Event 6 ms before the 32-bit platform clock wrapped, 'now' 4 ms after
+    EXPECT_EQ(InputClock::FromEventTimeMs(0xFFFFFFFAu, 4u, now), now - 10'000);
+}
+
+TEST(InputTimestampTest, FromEventTimeMs_RejectsImplausibleAge)
+{
+    const InputTimestamp now = 5'000'000;
+
+    // Event "from the future" or far in the past: fall back to now
+    EXPECT_EQ(InputClock::FromEventTimeMs(2000, 1000, now), now);
+    EXPECT_EQ(InputClock::FromEventTimeMs(0, InputClock::MAX_EVENT_AGE_MS + 1, now), now);
+}
+
+// ============================================================================
+// FixedRingBuffer
+// ============================================================================
+
+TEST(InputTimestampTest, FixedRingBuffer_OverwritesOldestWhenFull)
+{
+    FixedRingBuffer<int, 4> ring;
+    for (int i = 0; i < 6; ++i)
+        ring.Push(i);
+
+    ASSERT_EQ(ring.Size(), 4u);
+    EXPECT_TRUE(ring.Full());
+    EXPECT_EQ(ring.Dropped(), 2u);
+    EXPECT_EQ(ring.Front(), 2);
+    EXPECT_EQ(ring.Back(), 5);
+    EXPECT_EQ(ring[1], 3);
+
+    ring.Clear();
+    EXPECT_TRUE(ring.Empty());
+    EXPECT_EQ(ring.Dropped(), 0u);
+}
+
+// ============================================================================
+// InputFrame
+// ============================================================================
+
+TEST(InputTimestampTest, InputFrame_OldestTimestampSpansAllInput)
+{
+    InputFrame frame;
+    EXPECT_EQ(frame.GetOldestTimestamp(), 0u);
+
+    frame.keyTransitions.push_back({ 0x11, true, false, 300 });
+    frame.mouseButtonTransitions.push_back({ MouseButton::Left, true, 200 });
+    frame.mouseSamples.Push({ 250, 10, 10, 1, 1 });
+    frame.keyTransitions.push_back({ 0x1F, true, false, 0 }); // Untimed: ignored
+
+    EXPECT_EQ(frame.GetOldestTimestamp(), 200u);
+
+    frame.Reset();
+    EXPECT_TRUE(frame.mouseSamples.Empty());
+    EXPECT_EQ(frame.GetOldestTimestamp(), 0u);
+}
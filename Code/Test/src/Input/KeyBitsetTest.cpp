@@ -0,0 +1,192 @@
+#include <gtest/gtest.h>
+#include "Input/KeyBitset.h"
+#include "Input/InputState.h"
+#include <array>
+#include <chrono>
+#include <iostream>
+#include <vector>
+
+// ============================================================================
+// KeyBitset Unit Tests
+// ============================================================================
+
+TEST(KeyBitsetTest, DefaultConstructed_IsEmpty)
+{
+    KeyBitset bits;
+    EXPECT_FALSE(bits.Any());
+    EXPECT_TRUE(bits.None());
+    EXPECT_EQ(bits.Count(), 0u);
+}
+
+TEST(KeyBitsetTest, SetClearTest_AcrossWordBoundaries)
+{
+    KeyBitset bits;
+    const uint16_t scancodes[] = { 0, 1, 63, 64, 127, 128, 300, 511 };
+
+    for (uint16_t sc : scancodes)
+        bits.Set(sc);
+
+    for (uint16_t sc : scancodes)
+        EXPECT_TRUE(bits.Test(sc)) << "scancode " << sc;
+
+    EXPECT_FALSE(bits.Test(2));
+    EXPECT_FALSE(bits.Test(65));
+    EXPECT_EQ(bits.Count(), 8u);
+
+    bits.Clear(64);
+    EXPECT_FALSE(bits.Test(64));
+    EXPECT_TRUE(bits.Test(63));
+    EXPECT_EQ(bits.Count(), 7u);
+}
+
+TEST(KeyBitsetTest, OutOfRange_IsIgnored)
+{
+    KeyBitset bits;
+    bits.Set(512);
+    bits.Set(0xFFFF);
+    EXPECT_FALSE(bits.Any());
+    EXPECT_FALSE(bits.Test(512));
+}
+
+TEST(KeyBitsetTest, TransitionMasks_MatchPerKeyLogic)
+{
+    KeyBitset previous;
+    KeyBitset current;
+
+    previous.Set(10);  // held
+    current.Set(10);
+    previous.Set(70);  // released
+    current.Set(200);  // pressed
+    current.Set(511);  // pressed
+
+    KeyBitset pressed = KeyBitset::PressedMask(current, previous);
+    KeyBitset released = KeyBitset::ReleasedMask(current, previous);
+    KeyBitset changed = KeyBitset::ChangedMask(current, previous);
+
+    EXPECT_EQ(pressed.Count(), 2u);
+    EXPECT_TRUE(pressed.Test(200));
+    EXPECT_TRUE(pressed.Test(511));
+
+    EXPECT_EQ(released.Count(), 1u);
+    EXPECT_TRUE(released.Test(70));
+
+    EXPECT_EQ(changed.Count(), 3u);
+    EXPECT_FALSE(changed.Test(10));
+
+    EXPECT_TRUE(KeyBitset::AnyPressed(current, previous));
+    EXPECT_TRUE(KeyBitset::AnyReleased(current, previous));
+    EXPECT_FALSE(KeyBitset::AnyPressed(previous, previous));
+}
+
+TEST(KeyBitsetTest, ForEachSetBit_VisitsInAscendingOrder)
+{
+    KeyBitset bits;
+    bits.Set(400);
+    bits.Set(3);
+    bits.Set(64);
+
+    std::vector<uint16_t> visited;
+    bits.ForEachSetBit([&](uint16_t sc) { visited.push_back(sc); });
+
+    ASSERT_EQ(visited.size(), 3u);
+    EXPECT_EQ(visited[0], 3);
+    EXPECT_EQ(visited[1], 64);
+    EXPECT_EQ(visited[2], 400);
+}
+
+TEST(KeyBitsetTest, InputStateReset_ClearsKeys)
+{
+    InputState state;
+    state.keys.Set(0x11);
+    state.keyRepeatCount[0x11] = 3;
+    EXPECT_TRUE(state.IsKeyScanCodeDown(0x11));
+
+    state.Reset();
+    EXPECT_FALSE(state.IsKeyScanCodeDown(0x11));
+    EXPECT_EQ(state.keyRepeatCount[0x11], 0);
+}
+
+// ============================================================================
+// Performance Benchmark (Not a test, just for measurement)
+// ============================================================================
+
+namespace
+{
+    // Layout used before keys were packed: one bool per scancode, and a
+    // full-state copy every frame for transition detection.
+    struct LegacyKeyState
+    {
+        std::array<bool, 512> keys{};
+        std::array<uint16_t, 512> keyRepeatCount{};
+    };
+
+    // Keeps the optimizer from discarding benchmark work.
+    volatile uint32_t g_Sink = 0;
+}
+
+TEST(KeyBitsetBenchmark, MeasurePerFrameUpdateCost)
+{
+    constexpr int NUM_FRAMES = 200000;
+
+    // A few keys change each frame, several are held.
+    auto keyForFrame = [](int frame) -> uint16_t
+    {
+        return static_cast<uint16_t>((frame * 37) % 512);
+    };
+
+    // ------------------------------------------------------------------------
+    // Legacy: copy bool + repeat arrays, scan all keys for "just pressed"
+    // ------------------------------------------------------------------------
+    LegacyKeyState legacyCurrent;
+    LegacyKeyState legacyPrevious;
+    uint32_t legacyPressed = 0;
+
+    auto legacyStart = std::chrono::high_resolution_clock::now();
+    for (int frame = 0; frame < NUM_FRAMES; ++frame)
+    {
+        legacyPrevious = legacyCurrent;
+
+        uint16_t sc = keyForFrame(frame);
+        legacyCurrent.keys[sc] = !legacyCurrent.keys[sc];
+        legacyCurrent.keyRepeatCount[sc] = legacyCurrent.keys[sc] ? 1 : 0;
+
+        for (uint32_t i = 0; i < 512; ++i)
+        {
+            if (legacyCurrent.keys[i] && !legacyPrevious.keys[i])
+                ++legacyPressed;
+        }
+    }
+    auto legacyEnd = std::chrono::high_resolution_clock::now();
+    g_Sink = legacyPressed;
+
+    // ------------------------------------------------------------------------
+    // Packed: 64-byte key set snapshot, word-level pressed mask
+    // ------------------------------------------------------------------------
+    InputState packedCurrent;
+    KeyBitset packedPrevious;
+    uint32_t packedPressed = 0;
+
+    auto packedStart = std::chrono::high_resolution_clock::now();
+    for (int frame = 0; frame < NUM_FRAMES; ++frame)
+    {
+        packedPrevious = packedCurrent.keys;
+
+        uint16_t sc = keyForFrame(frame);
+        bool down = !packedCurrent.keys.Test(sc);
+        packedCurrent.keys.Assign(sc, down);
+        packedCurrent.keyRepeatCount[sc] = down ? 1 : 0;
+
+        packedPressed += KeyBitset::PressedMask(packedCurrent.keys, packedPrevious).Count();
+    }
+    auto packedEnd = std::chrono::high_resolution_clock::now();
+    g_Sink = packedPressed;
+
+    // Both layouts must agree on the observed transitions
+    ASSERT_EQ(legacyPressed, packedPressed);
+
+    auto legacyNs = std::chrono::duration_cast<std::chrono::nanoseconds>(legacyEnd - legacyStart).count();
+    auto packedNs = std::chrono::duration_cast<std::chrono::nanoseconds>(packedEnd - packedStart).count();
+
+    std::cout << "Legacy layout: " << (legacyNs / NUM_FRAMES) << " ns/frame" << std::endl;
+    std::cout << "Packed layout: " << (packedNs / NUM_FRAMES) << " ns/frame" << std::endl;
+}
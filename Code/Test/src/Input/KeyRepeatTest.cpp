@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include "Input/KeyRepeat.h"
+#include <vector>
+
+namespace
+{
+    constexpr InputTimestamp MS = 1000; // InputTimestamp is in microseconds
+
+    struct Repeat
+    {
+        uint16_t scancode;
+        InputTimestamp timestamp;
+    };
+
+    std::vector<Repeat> Collect(KeyRepeatGenerator& generator, InputTimestamp now)
+    {
+        std::vector<Repeat> out;
+        generator.Generate(now, [&out](uint16_t scancode, InputTimestamp ts) { out.push_back({ scancode, ts }); });
+        return out;
+    }
+}
+
+// ============================================================================
+// Schedule
+// ============================================================================
+
+TEST(KeyRepeatTest, FirstRepeatAfterDelayThenAtRate)
+{
+    KeyRepeatGenerator generator;
+    generator.SetRepeatInfo(25, 600); // 40 ms interval
+
+    generator.Press(30, 1000 * MS);
+    EXPECT_EQ(generator.GetNextRepeatTime(), 1600 * MS);
+
+    EXPECT_TRUE(Collect(generator, 1599 * MS).empty());
+
+    auto repeats = Collect(generator, 1600 * MS);
+    ASSERT_EQ(repeats.size(), 1u);
+    EXPECT_EQ(repeats[0].scancode, 30);
+    EXPECT_EQ(repeats[0].timestamp, 1600 * MS);
+    EXPECT_EQ(generator.GetNextRepeatTime(), 1640 * MS);
+}
+
+TEST(KeyRepeatTest, LongFrameGetsEveryRepeatWithOwnTimestamp)
+{
+    KeyRepeatGenerator generator;
+    generator.SetRepeatInfo(25, 600);
+    generator.Press(30, 0);
+
+    // One 200 ms frame after the delay: 600, 640, 680, 720, 760, 800
+    auto repeats = Collect(generator, 800 * MS);
+    ASSERT_EQ(repeats.size(), 6u);
+    for (size_t i = 0; i < repeats.size(); ++i)
+        EXPECT_EQ(repeats[i].timestamp, (600 + 40 * i) * MS);
+
+    EXPECT_TRUE(Collect(generator, 800 * MS).empty());
+}
+
+TEST(KeyRepeatTest, ReleaseStopsOnlyTheRepeatingKey)
+{
+    KeyRepeatGenerator generator;
+    generator.SetRepeatInfo(30, 200);
+
+    generator.Press(30, 0);
+    generator.Press(31, 10 * MS); // Latest press repeats
+    EXPECT_EQ(generator.GetRepeatingKey(), 31);
+
+    generator.Release(30);
+    EXPECT_TRUE(generator.IsRepeating());
+
+    generator.Release(31);
+    EXPECT_FALSE(generator.IsRepeating());
+    EXPECT_EQ(generator.GetNextRepeatTime(), 0u);
+    EXPECT_TRUE(Collect(generator, 10000 * MS).empty());
+}
+
+TEST(KeyRepeatTest, ZeroRateDisablesRepeat)
+{
+    KeyRepeatGenerator generator;
+    generator.SetRepeatInfo(25, 600);
+    generator.Press(30, 0);
+
+    generator.SetRepeatInfo(0, 600);
+    EXPECT_FALSE(generator.IsEnabled());
+    EXPECT_FALSE(generator.IsRepeating());
+
+    generator.Press(30, 0);
+    EXPECT_FALSE(generator.IsRepeating());
+}
+
+TEST(KeyRepeatTest, StallIsCappedAndKeepsPhase)
+{
+    KeyRepeatGenerator generator;
+    generator.SetRepeatInfo(100, 0); // 10 ms interval, no delay
+    generator.Press(30, 0);
+
+    // 10 s stall: far more than MAX_BATCH repeats due
+    auto repeats = Collect(generator, 10000 * MS + 5 * MS);
+    EXPECT_EQ(repeats.size(), KeyRepeatGenerator::MAX_BATCH);
+
+    InputTimestamp next = generator.GetNextRepeatTime();
+    EXPECT_GT(next, 10000 * MS);
+    EXPECT_EQ(next % (10 * MS), 0u);
+}
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include "Input/TextInput.h"
+#include "Event/InputEvent.h"
+
+// ============================================================================
+// UTF-8 Encoding
+// ============================================================================
+
+TEST(TextInputTest, EncodeUTF8_AllLengths)
+{
+    std::string text;
+    TextInput::AppendUTF8(text, 'a');      // 1 byte
+    TextInput::AppendUTF8(text, 0x00E9);   // é, 2 bytes
+    TextInput::AppendUTF8(text, 0x20AC);   // €, 3 bytes
+    TextInput::AppendUTF8(text, 0x1F600);  // 😀, 4 bytes
+
+    EXPECT_EQ(text, "a\xC3\xA9\xE2\x82\xAC\xF0\x9F\x98\x80");
+}
+
+TEST(TextInputTest, EncodeUTF8_RejectsInvalidCodePoints)
+{
+    char bytes[4];
+    EXPECT_EQ(TextInput::EncodeUTF8(0xD800, bytes), 0u);    // Surrogate
+    EXPECT_EQ(TextInput::EncodeUTF8(0x110000, bytes), 0u);  // Out of range
+
+    std::string text;
+    TextInput::AppendUTF8(text, 0xDFFF);
+    EXPECT_TRUE(text.empty());
+}
+
+TEST(TextInputTest, IsPrintable_FiltersControlCharacters)
+{
+    EXPECT_TRUE(TextInput::IsPrintable(' '));
+    EXPECT_TRUE(TextInput::IsPrintable('~'));
+    EXPECT_TRUE(TextInput::IsPrintable(0x00A0));
+    EXPECT_TRUE(TextInput::IsPrintable(0x1F600));
+
+    EXPECT_FALSE(TextInput::IsPrintable(0));
+    EXPECT_FALSE(TextInput::IsPrintable('\r'));
+    EXPECT_FALSE(TextInput::IsPrintable('\b'));
+    EXPECT_FALSE(TextInput::IsPrintable(0x1B));   // Escape
+    EXPECT_FALSE(TextInput::IsPrintable(0x01));   // Ctrl+A on Win32
+    EXPECT_FALSE(TextInput::IsPrintable(0x7F));   // Delete
+    EXPECT_FALSE(TextInput::IsPrintable(0x85));   // C1 control
+    EXPECT_FALSE(TextInput::IsPrintable(0xDC00));
+}
+
+TEST(TextInputTest, CombineSurrogates)
+{
+    // U+1F600 = D83D DE00
+    EXPECT_TRUE(TextInput::IsHighSurrogate(0xD83D));
+    EXPECT_TRUE(TextInput::IsLowSurrogate(0xDE00));
+    EXPECT_FALSE(TextInput::IsHighSurrogate(0xDE00));
+    EXPECT_EQ(TextInput::CombineSurrogates(0xD83D, 0xDE00), 0x1F600u);
+}
+
+// ============================================================================
+// TextInputEvent
+// ============================================================================
+
+TEST(TextInputTest, Event_CarriesCodepointAndUTF8)
+{
+    TextInputEvent e(0x20AC);
+
+    EXPECT_EQ(e.GetWindowInputEventType(), WindowInputEvent::TYPE::TEXT_INPUT);
+    EXPECT_EQ(e.GetCodepoint(), 0x20ACu);
+    EXPECT_EQ(e.GetUTF8(), "\xE2\x82\xAC");
+}
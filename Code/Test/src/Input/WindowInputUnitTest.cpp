@@ -107,4 +107,139 @@ TEST_F(InputSystemUnitTest, MouseButton_Events_Emitted)
 
     EXPECT_TRUE(listener.down);
     EXPECT_EQ(listener.btn, MouseButton::Left);
-}
\ No newline at end of file
+}
+TEST_F(InputSystemUnitTest, Keyboard_AnyKeyQueries_TrackTransitions)
+{
+    EXPECT_FALSE(m_Window->IsAnyKeyDown());
+    EXPECT_FALSE(m_Window->WasAnyKeyJustPressed());
+
+    // Press W and S in the same frame
+    m_Mock->MutableThisFrameInput().keyTransitions.push_back({ 0x11, true, false }); // W
+    m_Mock->MutableThisFrameInput().keyTransitions.push_back({ 0x1F, true, false }); // S
+    m_Window->Update();
+
+    EXPECT_TRUE(m_Window->IsAnyKeyDown());
+    EXPECT_TRUE(m_Window->WasAnyKeyJustPressed());
+    EXPECT_FALSE(m_Window->WasAnyKeyJustReleased());
+
+    std::vector<KeyCode> pressed;
+    m_Window->ForEachKeyJustPressed([&](KeyCode key) { pressed.push_back(key); });
+    ASSERT_EQ(pressed.size(), 2u);
+    EXPECT_EQ(pressed[0], KeyCode::W);
+    EXPECT_EQ(pressed[1], KeyCode::S);
+
+    // Release W only
+    m_Mock->ResetThisFrameInput();
+    m_Mock->MutableThisFrameInput().keyTransitions.push_back({ 0x11, false, false });
+    m_Window->Update();
+
+    EXPECT_TRUE(m_Window->IsAnyKeyDown());
+    EXPECT_FALSE(m_Window->WasAnyKeyJustPressed());
+    EXPECT_TRUE(m_Window->WasAnyKeyJustReleased());
+
+    KeyBitset released = m_Window->GetJustReleasedKeys();
+    EXPECT_EQ(released.Count(), 1u);
+    EXPECT_TRUE(released.Test(0x11));
+    EXPECT_TRUE(m_Window->GetJustPressedKeys().None());
+}
+
+TEST_F(InputSystemUnitTest, Mouse_Samples_FilteredBySinceTimestamp)
+{
+    auto& frame = m_Mock->MutableThisFrameInput();
+    frame.mouseSamples.Push({ 1000, 10, 10, 2, 0 });
+    frame.mouseSamples.Push({ 2000, 13, 10, 3, 0 });
+    frame.mouseSamples.Push({ 3000, 17, 11, 4, 1 });
+    frame.mouseDeltaX = 9;
+    frame.mouseDeltaY = 1;
+    m_Window->Update();
+
+    std::vector<InputFrame::MouseSample> samples;
+    EXPECT_EQ(m_Window->GetMouseSamplesSince(0, samples), 3u);
+
+    int32_t sumX = 0;
+    for (const auto& s : samples) sumX += s.deltaX;
+    EXPECT_EQ(sumX, m_Window->GetMouseDeltaX());
+
+    ASSERT_EQ(m_Window->GetMouseSamplesSince(2000, samples), 2u);
+    EXPECT_EQ(samples[0].timestamp, 2000u);
+    EXPECT_EQ(samples[1].x, 17);
+    EXPECT_EQ(m_Window->GetDroppedMouseSampleCount(), 0u);
+
+    // Samples do not carry over to the next frame
+    m_Mock->ResetThisFrameInput();
+    m_Window->Update();
+    EXPECT_EQ(m_Window->GetMouseSamplesSince(0, samples), 0u);
+}
+
+TEST_F(InputSystemUnitTest, OldestInputTimestamp_TracksConsumedInput)
+{
+    EXPECT_EQ(m_Window->GetOldestInputTimestamp(), 0u);
+
+    m_Mock->MutableThisFrameInput().keyTransitions.push_back({ 0x11, true, false, 5000 });
+    m_Mock->MutableThisFrameInput().mouseSamples.Push({ 4000, 0, 0, 0, 0 });
+    m_Window->Update();
+
+    EXPECT_EQ(m_Window->GetOldestInputTimestamp(), 4000u);
+
+    m_Mock->ResetThisFrameInput();
+    m_Window->Update();
+    EXPECT_EQ(m_Window->GetOldestInputTimestamp(), 0u);
+}
+
+TEST_F(InputSystemUnitTest, CursorMode_ForwardedToPlatform)
+{
+    EXPECT_EQ(m_Window->GetCursorMode(), CursorMode::Normal);
+
+    m_Window->SetCursorMode(CursorMode::Locked);
+    EXPECT_EQ(m_Mock->GetCursorMode(), CursorMode::Locked);
+    EXPECT_EQ(m_Window->GetCursorMode(), CursorMode::Locked);
+
+    m_Window->SetCursorMode(CursorMode::Confined);
+    EXPECT_EQ(m_Window->GetCursorMode(), CursorMode::Confined);
+
+    // Destroyed windows report Normal and ignore requests
+    m_Window->Destroy();
+    m_Window->SetCursorMode(CursorMode::Locked);
+    EXPECT_EQ(m_Window->GetCursorMode(), CursorMode::Normal);
+}
+
+TEST_F(InputSystemUnitTest, InputActions_EvaluatedOnUpdate)
+{
+    auto map = std::make_shared<InputActionMap>();
+    InputActionId jump = map->AddAction("Jump");
+    InputActionId fire = map->AddAction("Fire");
+    ASSERT_TRUE(map->AddBinding(jump, "Space"));
+    ASSERT_TRUE(map->AddBinding(fire, "MouseLeft"));
+    InputAxisId lookX = map->AddAxis("LookX", InputAxisSource::MouseX, 0.5f);
+
+    // Space already held when the map is attached
+    uint16_t space = KeyMapping::KeyCodeToScancode(KeyCode::Space);
+    m_Mock->MutableThisFrameInput().keyTransitions.push_back({ space, true, false });
+    m_Window->Update();
+    EXPECT_FALSE(m_Window->IsActionDown(jump));
+
+    m_Window->SetInputActionMap(map);
+    m_Mock->ResetThisFrameInput();
+    m_Mock->MutableThisFrameInput().mouseButtonTransitions.push_back({ MouseButton::Left, true });
+    m_Mock->MutableThisFrameInput().mouseDeltaX = 8;
+    m_Window->Update();
+
+    EXPECT_TRUE(m_Window->IsActionDown(jump));
+    EXPECT_TRUE(m_Window->WasActionJustPressed(fire));
+    EXPECT_FLOAT_EQ(m_Window->GetActionAxis(lookX), 4.0f);
+
+    // Release space: only jump changes
+    m_Mock->ResetThisFrameInput();
+    m_Mock->MutableThisFrameInput().keyTransitions.push_back({ space, false, false });
+    m_Window->Update();
+
+    const ActionState& actions = m_Window->GetActionState();
+    EXPECT_TRUE(actions.WasReleased(jump));
+    EXPECT_TRUE(actions.IsDown(fire));
+    EXPECT_FALSE(actions.WasPressed(fire));
+    EXPECT_FLOAT_EQ(actions.GetAxis(lookX), 0.0f);
+
+    // Detaching clears state
+    m_Window->SetInputActionMap(nullptr);
+    EXPECT_FALSE(m_Window->IsActionDown(fire));
+}
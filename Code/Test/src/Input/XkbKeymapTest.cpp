@@ -0,0 +1,104 @@
+#ifdef __linux__
+
+#include <gtest/gtest.h>
+#include "Input/Platform/Linux/XkbKeymap.h"
+#include <cstdio>
+#include <cstdlib>
+#include <string>
+#include <unistd.h>
+
+namespace
+{
+    // evdev key codes (linux/input-event-codes.h), as sent in wl_keyboard::key
+    constexpr uint32_t KEY_Q = 16;
+    constexpr uint32_t KEY_A = 30;
+    constexpr uint32_t KEY_LEFTSHIFT = 42;
+
+    /**
+     * Self-contained US-style keymap for the keys above (xkb keycode =
+     * evdev + 8), so the test needs no xkeyboard-config data.
+     */
+    constexpr const char* US_KEYMAP = R"(xkb_keymap {
+    xkb_keycodes {
+        minimum = 8;
+        maximum = 255;
+        <AD01> = 24;
+        <AC01> = 38;
+        <LFSH> = 50;
+    };
+    xkb_types {
+        type "ONE_LEVEL" {
+            modifiers = none;
+            map[none] = Level1;
+        };
+        type "ALPHABETIC" {
+            modifiers = Shift + Lock;
+            map[Shift] = Level2;
+            map[Lock] = Level2;
+        };
+    };
+    xkb_compatibility {
+    };
+    xkb_symbols {
+        key <AD01> { type = "ALPHABETIC", [ q, Q ] };
+        key <AC01> { type = "ALPHABETIC", [ a, A ] };
+        key <LFSH> { repeat = False, type = "ONE_LEVEL", [ Shift_L ] };
+        modifier_map Shift { <LFSH> };
+    };
+};
+)";
+
+    /**
+     * Keymap file descriptor as the compositor sends it (text plus its null
+     * terminator); XkbKeymap::Load() takes ownership.
+     */
+    int32_t MakeKeymapFd(const std::string& text, uint32_t& size)
+    {
+        char path[] = "/tmp/solarc_keymap_XXXXXX";
+        const int32_t fd = mkstemp(path);
+        if (fd < 0)
+            return -1;
+        unlink(path);
+
+        size = static_cast<uint32_t>(text.size() + 1);
+        if (write(fd, text.c_str(), size) != static_cast<ssize_t>(size))
+        {
+            close(fd);
+            return -1;
+        }
+        return fd;
+    }
+}
+
+// ============================================================================
+// Translation
+// ============================================================================
+
+TEST(XkbKeymapTest, EvdevKey_TranslatesToItsSymbol)
+{
+    XkbKeymap keymap;
+    uint32_t size = 0;
+    const int32_t fd = MakeKeymapFd(US_KEYMAP, size);
+    ASSERT_GE(fd, 0);
+    ASSERT_TRUE(keymap.Load(fd, size));
+
+    // wl_keyboard::key sends evdev codes: KEY_A must produce 'a', not the
+    // symbol of the key 8 codes away
+    EXPECT_EQ(keymap.Translate(KEY_A).codepoint, static_cast<uint32_t>('a'));
+    EXPECT_EQ(keymap.Translate(KEY_Q).codepoint, static_cast<uint32_t>('q'));
+    EXPECT_EQ(keymap.Translate(KEY_LEFTSHIFT).codepoint, 0u);
+}
+
+TEST(XkbKeymapTest, Repeats_IndexedByEvdevKey)
+{
+    XkbKeymap keymap;
+    uint32_t size = 0;
+    const int32_t fd = MakeKeymapFd(US_KEYMAP, size);
+    ASSERT_GE(fd, 0);
+    ASSERT_TRUE(keymap.Load(fd, size));
+
+    EXPECT_TRUE(keymap.KeyRepeats(KEY_A));
+    EXPECT_FALSE(keymap.KeyRepeats(KEY_LEFTSHIFT));
+}
+
+#endif // __linux__
@@ -2,6 +2,7 @@
 #include "MT/JobSystem.h"
 #include "MT/JobHandle.h"
 #include "MT/Job.h"
+#include <algorithm>
 #include <atomic>
 #include <barrier>
 #include <latch>
@@ -91,6 +92,32 @@ TEST(JobSystem, ReportsCorrectWorkerCount)
     ASSERT_EQ(jobSystem.GetWorkerCount(), 4);
 }
 
+TEST(JobSystem, WorkerIndexIsUniquePerWorkerThread)
+{
+    constexpr size_t workerCount = 4;
+    JobSystem jobSystem(workerCount);
+
+    EXPECT_EQ(JobSystem::GetCurrentWorkerIndex(), JobSystem::INVALID_WORKER_INDEX);
+
+    // Hold every worker in one job at the same time so each reports its own index
+    std::latch allRunning(workerCount);
+    std::vector<size_t> indices(workerCount, JobSystem::INVALID_WORKER_INDEX);
+
+    std::vector<JobHandle> handles;
+    for (size_t i = 0; i < workerCount; ++i) {
+        handles.push_back(jobSystem.Schedule([&, i]() {
+            indices[i] = JobSystem::GetCurrentWorkerIndex();
+            allRunning.arrive_and_wait();
+            }));
+    }
+    jobSystem.WaitAll(handles);
+
+    std::sort(indices.begin(), indices.end());
+    for (size_t i = 0; i < workerCount; ++i) {
+        EXPECT_EQ(indices[i], i);
+    }
+}
+
 TEST(JobSystem, ExecutesSingleTask)
 {
     JobSystem jobSystem(2);
@@ -0,0 +1,104 @@
+#include <gtest/gtest.h>
+#include "MT/SPSCQueue.h"
+#include "Input/InputEventQueue.h"
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// Single Thread
+// ============================================================================
+
+TEST(SPSCQueue, PushPop_PreservesOrder)
+{
+    SPSCQueue<int, 8> queue;
+    EXPECT_TRUE(queue.IsEmpty());
+
+    for (int i = 0; i < 5; ++i)
+        ASSERT_TRUE(queue.TryPush(i));
+    EXPECT_EQ(queue.SizeApprox(), 5u);
+
+    int value = -1;
+    for (int i = 0; i < 5; ++i)
+    {
+        ASSERT_TRUE(queue.TryPop(value));
+        EXPECT_EQ(value, i);
+    }
+    EXPECT_FALSE(queue.TryPop(value));
+}
+
+TEST(SPSCQueue, Full_RejectsPushUntilPopped)
+{
+    SPSCQueue<int, 4> queue;
+    for (int i = 0; i < 4; ++i)
+        ASSERT_TRUE(queue.TryPush(i));
+
+    EXPECT_FALSE(queue.TryPush(99));
+
+    int value = -1;
+    ASSERT_TRUE(queue.TryPop(value));
+    EXPECT_EQ(value, 0);
+    EXPECT_TRUE(queue.TryPush(4));
+
+    // Wraps around the ring
+    for (int expected = 1; expected <= 4; ++expected)
+    {
+        ASSERT_TRUE(queue.TryPop(value));
+        EXPECT_EQ(value, expected);
+    }
+}
+
+TEST(SPSCQueue, InputEvents_RoundTrip)
+{
+    auto queue = std::make_unique<InputEventQueue>();
+
+    ASSERT_TRUE(queue->TryPush({ .type = PlatformInputEvent::TYPE::KEY, .pressed = true, .code = 0x11, .timestamp = 42 }));
+    ASSERT_TRUE(queue->TryPush({ .type = PlatformInputEvent::TYPE::RELATIVE_MOTION, .dx = 0.5, .dy = -1.25 }));
+
+    PlatformInputEvent event;
+    ASSERT_TRUE(queue->TryPop(event));
+    EXPECT_EQ(event.type, PlatformInputEvent::TYPE::KEY);
+    EXPECT_TRUE(event.pressed);
+    EXPECT_EQ(event.code, 0x11);
+    EXPECT_EQ(event.timestamp, 42u);
+
+    ASSERT_TRUE(queue->TryPop(event));
+    EXPECT_EQ(event.type, PlatformInputEvent::TYPE::RELATIVE_MOTION);
+    EXPECT_DOUBLE_EQ(event.dy, -1.25);
+}
+
+// ============================================================================
+// Producer / Consumer Threads
+// ============================================================================
+
+TEST(SPSCQueue, TwoThreads_DeliverEveryItemInOrder)
+{
+    constexpr uint32_t ITEM_COUNT = 200000;
+    SPSCQueue<uint32_t, 256> queue;
+
+    std::thread producer([&]()
+    {
+        for (uint32_t i = 0; i < ITEM_COUNT; ++i)
+        {
+            while (!queue.TryPush(i))
+                std::this_thread::yield();
+        }
+    });
+
+    uint32_t expected = 0;
+    bool inOrder = true;
+    while (expected < ITEM_COUNT)
+    {
+        uint32_t value;
+        if (!queue.TryPop(value))
+        {
+            std::this_thread::yield();
+            continue;
+        }
+        inOrder &= (value == expected);
+        ++expected;
+    }
+
+    producer.join();
+    EXPECT_TRUE(inOrder);
+    EXPECT_TRUE(queue.IsEmpty());
+}
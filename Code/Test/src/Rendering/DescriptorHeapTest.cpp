@@ -0,0 +1,138 @@
+#include <gtest/gtest.h>
+#include "Rendering/RHI/DescriptorHeap.h"
+#include <algorithm>
+#include <mutex>
+#include <set>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// Allocation
+// ============================================================================
+
+TEST(DescriptorIndexAllocatorTest, Allocate_IsDenseUntilFull)
+{
+    DescriptorIndexAllocator allocator(4);
+
+    for (uint32_t expected = 0; expected < 4; ++expected) {
+        EXPECT_EQ(allocator.Allocate(), expected);
+    }
+    EXPECT_EQ(allocator.Allocate(), RHIDescriptorHandle::INVALID_INDEX);
+    EXPECT_EQ(allocator.GetAllocatedCount(), 4u);
+    EXPECT_EQ(allocator.GetPeakAllocatedCount(), 4u);
+}
+
+TEST(DescriptorIndexAllocatorTest, FreeWithoutFrame_IsReusedAtOnce)
+{
+    DescriptorIndexAllocator allocator(8);
+
+    const uint32_t a = allocator.Allocate();
+    const uint32_t b = allocator.Allocate();
+    allocator.Free(a, 0);
+    allocator.Free(b, 0);
+
+    // Last freed, first reused
+    EXPECT_EQ(allocator.Allocate(), b);
+    EXPECT_EQ(allocator.Allocate(), a);
+    EXPECT_EQ(allocator.Allocate(), 2u);
+}
+
+// ============================================================================
+// Deferred Frees
+// ============================================================================
+
+TEST(DescriptorIndexAllocatorTest, DeferredFree_WaitsForFrame)
+{
+    DescriptorIndexAllocator allocator(2);
+
+    const uint32_t a = allocator.Allocate();
+    const uint32_t b = allocator.Allocate();
+
+    // The GPU may still read 'a' until frame 5 completes
+    allocator.Free(a, 5);
+    EXPECT_EQ(allocator.GetAllocatedCount(), 1u);
+    EXPECT_EQ(allocator.GetPendingFreeCount(), 1u);
+    EXPECT_EQ(allocator.Allocate(), RHIDescriptorHandle::INVALID_INDEX);
+
+    EXPECT_EQ(allocator.Collect(4), 0u);
+    EXPECT_EQ(allocator.Allocate(), RHIDescriptorHandle::INVALID_INDEX);
+
+    EXPECT_EQ(allocator.Collect(5), 1u);
+    EXPECT_EQ(allocator.GetPendingFreeCount(), 0u);
+    EXPECT_EQ(allocator.Allocate(), a);
+    EXPECT_NE(a, b);
+}
+
+TEST(DescriptorIndexAllocatorTest, Collect_RecyclesOnlyCompletedFrames)
+{
+    DescriptorIndexAllocator allocator(16);
+
+    std::vector<uint32_t> indices;
+    for (int i = 0; i < 6; ++i) {
+        indices.push_back(allocator.Allocate());
+    }
+
+    // Two frees per frame 1, 2, 3
+    for (int i = 0; i < 6; ++i) {
+        allocator.Free(indices[i], 1 + i / 2);
+    }
+
+    EXPECT_EQ(allocator.Collect(2), 4u);
+    EXPECT_EQ(allocator.GetPendingFreeCount(), 2u);
+    EXPECT_EQ(allocator.Collect(10), 2u);
+    EXPECT_EQ(allocator.GetAllocatedCount(), 0u);
+    EXPECT_EQ(allocator.GetPeakAllocatedCount(), 6u);
+}
+
+TEST(DescriptorIndexAllocatorTest, OutOfOrderFree_WaitsForNewestFrame)
+{
+    DescriptorIndexAllocator allocator(4);
+
+    const uint32_t a = allocator.Allocate();
+    const uint32_t b = allocator.Allocate();
+
+    allocator.Free(a, 7);
+    allocator.Free(b, 3); // Raced in late: held until frame 7 too
+
+    EXPECT_EQ(allocator.Collect(6), 0u);
+    EXPECT_EQ(allocator.Collect(7), 2u);
+}
+
+// ============================================================================
+// Concurrency
+// ============================================================================
+
+TEST(DescriptorIndexAllocatorTest, ConcurrentAllocations_AreUnique)
+{
+    constexpr int threadCount = 8;
+    constexpr int perThread = 500;
+
+    DescriptorIndexAllocator allocator(threadCount * perThread);
+
+    std::mutex resultsMutex;
+    std::vector<uint32_t> results;
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([&]() {
+            std::vector<uint32_t> local;
+            for (int i = 0; i < perThread; ++i) {
+                local.push_back(allocator.Allocate());
+                // Churn: free half again right away
+                if (i % 2 == 1) {
+                    allocator.Free(local.back(), 0);
+                    local.pop_back();
+                }
+            }
+            std::lock_guard lock(resultsMutex);
+            results.insert(results.end(), local.begin(), local.end());
+            });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    const std::set<uint32_t> unique(results.begin(), results.end());
+    EXPECT_EQ(unique.size(), results.size());
+    EXPECT_EQ(unique.count(RHIDescriptorHandle::INVALID_INDEX), 0u);
+    EXPECT_EQ(allocator.GetAllocatedCount(), static_cast<uint32_t>(results.size()));
+}
@@ -0,0 +1,477 @@
+#include <gtest/gtest.h>
+#include "Rendering/RHI/GPUAllocator.h"
+#include <map>
+#include <memory>
+#include <vector>
+
+// ============================================================================
+// Mock Device
+// ============================================================================
+
+namespace
+{
+    constexpr uint64_t MiB = 1024 * 1024;
+
+    /**
+     * Counts memory objects; host-visible types get real host memory so
+     * mapped pointers can be written.
+     */
+    class MockMemoryBackend : public GPUMemoryBackend
+    {
+    public:
+        explicit MockMemoryBackend(const GPUMemoryProperties& properties) : m_Properties(properties) {}
+
+        bool AllocateMemory(uint32_t memoryType, uint64_t size, GPUDeviceMemory& memory, void*& mapped) override
+        {
+            if (failNextAllocations > 0) {
+                --failNextAllocations;
+                return false;
+            }
+
+            memory = m_NextHandle++;
+            mapped = nullptr;
+            if (m_Properties.types[memoryType].propertyFlags & GPU_MEMORY_HOST_VISIBLE) {
+                auto& storage = m_HostMemory[memory];
+                storage = std::make_unique<uint8_t[]>(size);
+                mapped = storage.get();
+            }
+
+            ++allocateCalls;
+            live[memory] = memoryType;
+            return true;
+        }
+
+        void FreeMemory(uint32_t memoryType, GPUDeviceMemory memory) override
+        {
+            EXPECT_EQ(live.count(memory), 1u);
+            EXPECT_EQ(live[memory], memoryType);
+            live.erase(memory);
+            m_HostMemory.erase(memory);
+        }
+
+        uint32_t allocateCalls = 0;
+        uint32_t failNextAllocations = 0;
+        std::map<GPUDeviceMemory, uint32_t> live; // Memory object -> type
+
+    private:
+        GPUMemoryProperties m_Properties;
+        GPUDeviceMemory m_NextHandle = 1;
+        std::map<GPUDeviceMemory, std::unique_ptr<uint8_t[]>> m_HostMemory;
+    };
+
+    /**
+     * Discrete-GPU-like table:
+     *   type 0: DEVICE_LOCAL                         (heap 0, 256 MiB VRAM)
+     *   type 1: HOST_VISIBLE | HOST_COHERENT         (heap 1, 64 MiB system)
+     *   type 2: HOST_VISIBLE | HOST_COHERENT | CACHED (heap 1)
+     *   type 3: DEVICE_LOCAL | HOST_VISIBLE          (heap 2, 16 MiB BAR)
+     */
+    GPUMemoryProperties MakeDiscreteProperties()
+    {
+        GPUMemoryProperties properties;
+        properties.types = {
+            { GPU_MEMORY_DEVICE_LOCAL, 0 },
+            { GPU_MEMORY_HOST_VISIBLE | GPU_MEMORY_HOST_COHERENT, 1 },
+            { GPU_MEMORY_HOST_VISIBLE | GPU_MEMORY_HOST_COHERENT | GPU_MEMORY_HOST_CACHED, 1 },
+            { GPU_MEMORY_DEVICE_LOCAL | GPU_MEMORY_HOST_VISIBLE, 2 },
+        };
+        properties.heaps = { { 256 * MiB }, { 64 * MiB }, { 16 * MiB } };
+        properties.maxAllocationCount = 64;
+        return properties;
+    }
+
+    GPUAllocationDesc DeviceLocal(uint64_t size, uint64_t alignment = 256)
+    {
+        GPUAllocationDesc desc;
+        desc.size = size;
+        desc.alignment = alignment;
+        desc.preferredFlags = GPU_MEMORY_DEVICE_LOCAL;
+        return desc;
+    }
+}
+
+class GPUAllocatorTest : public ::testing::Test
+{
+protected:
+    GPUAllocatorTest()
+        : m_Properties(MakeDiscreteProperties())
+        , m_Backend(m_Properties)
+        , m_Allocator(std::make_unique<GPUAllocator>(m_Properties, m_Backend, 8 * MiB))
+    {
+    }
+
+    GPUMemoryProperties m_Properties;
+    MockMemoryBackend m_Backend;
+    std::unique_ptr<GPUAllocator> m_Allocator;
+};
+
+// ============================================================================
+// Memory Type Selection
+// ============================================================================
+
+TEST_F(GPUAllocatorTest, FindMemoryType_PrefersPreferredFlags)
+{
+    EXPECT_EQ(m_Allocator->FindMemoryType(~0u, 0, GPU_MEMORY_DEVICE_LOCAL), 0u);
+    EXPECT_EQ(m_Allocator->FindMemoryType(~0u, GPU_MEMORY_HOST_VISIBLE, GPU_MEMORY_HOST_CACHED), 2u);
+    EXPECT_EQ(m_Allocator->FindMemoryType(~0u, GPU_MEMORY_HOST_VISIBLE | GPU_MEMORY_DEVICE_LOCAL), 3u);
+
+    // Preferred flags unavailable in the allowed types: fall back to required
+    EXPECT_EQ(m_Allocator->FindMemoryType(0b0010, GPU_MEMORY_HOST_VISIBLE, GPU_MEMORY_HOST_CACHED), 1u);
+
+    // Required flags unavailable
+    EXPECT_EQ(m_Allocator->FindMemoryType(0b0001, GPU_MEMORY_HOST_VISIBLE), UINT32_MAX);
+}
+
+TEST_F(GPUAllocatorTest, BlockSize_CappedByHeap)
+{
+    EXPECT_EQ(m_Allocator->GetBlockSize(0), 8 * MiB);  // 256 MiB / 8 > 8 MiB
+    EXPECT_EQ(m_Allocator->GetBlockSize(3), 2 * MiB);  // 16 MiB BAR heap / 8
+}
+
+TEST_F(GPUAllocatorTest, NoTypeWithRequiredFlags_ReturnsInvalid)
+{
+    GPUAllocationDesc desc = DeviceLocal(1024);
+    desc.memoryTypeBits = 0b0001;
+    desc.requiredFlags = GPU_MEMORY_HOST_VISIBLE;
+
+    EXPECT_FALSE(m_Allocator->Allocate(desc).IsValid());
+    EXPECT_EQ(m_Backend.allocateCalls, 0u);
+}
+
+// ============================================================================
+// Sub-allocation
+// ============================================================================
+
+TEST_F(GPUAllocatorTest, SmallAllocations_ShareOneBlock)
+{
+    std::vector<GPUAllocation> allocations;
+    for (int i = 0; i < 100; ++i) {
+        allocations.push_back(m_Allocator->Allocate(DeviceLocal(16 * 1024)));
+        ASSERT_TRUE(allocations.back().IsValid());
+        EXPECT_EQ(allocations.back().memoryType, 0u);
+        EXPECT_EQ(allocations.back().offset % 256, 0u);
+        EXPECT_FALSE(allocations.back().dedicated);
+    }
+
+    EXPECT_EQ(m_Backend.allocateCalls, 1u);
+
+    const GPUAllocatorStats stats = m_Allocator->GetStats();
+    EXPECT_EQ(stats.types[0].blockCount, 1u);
+    EXPECT_EQ(stats.types[0].allocationCount, 100u);
+    EXPECT_EQ(stats.types[0].usedBytes, 100u * 16u * 1024u);
+    EXPECT_EQ(stats.deviceAllocationCount, 1u);
+
+    for (const GPUAllocation& allocation : allocations) {
+        m_Allocator->Free(allocation);
+    }
+    EXPECT_EQ(m_Allocator->GetStats().total.allocationCount, 0u);
+}
+
+TEST_F(GPUAllocatorTest, FullBlock_OpensAnother)
+{
+    std::vector<GPUAllocation> allocations;
+    for (int i = 0; i < 4; ++i) {
+        allocations.push_back(m_Allocator->Allocate(DeviceLocal(3 * MiB)));
+        ASSERT_TRUE(allocations.back().IsValid());
+    }
+
+    // Two 3 MiB allocations per 8 MiB block
+    EXPECT_EQ(m_Backend.allocateCalls, 2u);
+    EXPECT_EQ(allocations[0].memory, allocations[1].memory);
+    EXPECT_NE(allocations[1].memory, allocations[2].memory);
+}
+
+TEST_F(GPUAllocatorTest, LinearAndOptimal_UseSeparateBlocks)
+{
+    GPUAllocationDesc buffer = DeviceLocal(4096);
+    GPUAllocationDesc image = DeviceLocal(4096);
+    image.tiling = GPUResourceTiling::Optimal;
+
+    const GPUAllocation a = m_Allocator->Allocate(buffer);
+    const GPUAllocation b = m_Allocator->Allocate(image);
+
+    EXPECT_NE(a.memory, b.memory);
+    EXPECT_EQ(m_Allocator->GetStats().types[0].blockCount, 2u);
+}
+
+TEST_F(GPUAllocatorTest, HostVisible_IsMappedAtOffset)
+{
+    GPUAllocationDesc desc;
+    desc.size = 4096;
+    desc.alignment = 64;
+    desc.requiredFlags = GPU_MEMORY_HOST_VISIBLE | GPU_MEMORY_HOST_COHERENT;
+
+    const GPUAllocation a = m_Allocator->Allocate(desc);
+    const GPUAllocation b = m_Allocator->Allocate(desc);
+    ASSERT_TRUE(a.IsValid() && b.IsValid());
+    ASSERT_NE(a.mapped, nullptr);
+    ASSERT_NE(b.mapped, nullptr);
+
+    ASSERT_EQ(a.memory, b.memory);
+    EXPECT_EQ(static_cast<uint8_t*>(b.mapped) - static_cast<uint8_t*>(a.mapped),
+        static_cast<std::ptrdiff_t>(b.offset - a.offset));
+
+    static_cast<uint8_t*>(a.mapped)[desc.size - 1] = 0xAB; // Writable
+
+    EXPECT_EQ(m_Allocator->Allocate(DeviceLocal(4096)).mapped, nullptr);
+}
+
+// ============================================================================
+// Dedicated Allocations
+// ============================================================================
+
+TEST_F(GPUAllocatorTest, LargeResource_GetsDedicatedMemory)
+{
+    const GPUAllocation large = m_Allocator->Allocate(DeviceLocal(5 * MiB)); // > half a block
+    ASSERT_TRUE(large.IsValid());
+    EXPECT_TRUE(large.dedicated);
+    EXPECT_EQ(large.offset, 0u);
+
+    GPUAllocationDesc requested = DeviceLocal(4096);
+    requested.dedicated = true;
+    const GPUAllocation small = m_Allocator->Allocate(requested);
+    EXPECT_TRUE(small.dedicated);
+
+    GPUAllocatorStats stats = m_Allocator->GetStats();
+    EXPECT_EQ(stats.types[0].dedicatedCount, 2u);
+    EXPECT_EQ(stats.types[0].dedicatedBytes, 5 * MiB + 4096);
+    EXPECT_EQ(stats.types[0].blockCount, 0u);
+
+    m_Allocator->Free(large);
+    m_Allocator->Free(small);
+    EXPECT_TRUE(m_Backend.live.empty());
+}
+
+// ============================================================================
+// Limits and Fallbacks
+// ============================================================================
+
+TEST_F(GPUAllocatorTest, HeapFull_FallsBackToNextType)
+{
+    // Types 1 and 2 share the 64 MiB heap; fill it with dedicated allocations
+    GPUAllocationDesc desc;
+    desc.size = 32 * MiB;
+    desc.requiredFlags = GPU_MEMORY_HOST_VISIBLE;
+    desc.preferredFlags = GPU_MEMORY_HOST_CACHED;
+
+    const GPUAllocation a = m_Allocator->Allocate(desc);
+    const GPUAllocation b = m_Allocator->Allocate(desc);
+    EXPECT_EQ(a.memoryType, 2u);
+    EXPECT_EQ(b.memoryType, 2u);
+
+    // Heap 1 is full: the next host-visible type is the 16 MiB BAR heap
+    desc.size = 8 * MiB;
+    const GPUAllocation c = m_Allocator->Allocate(desc);
+    ASSERT_TRUE(c.IsValid());
+    EXPECT_EQ(c.memoryType, 3u);
+
+    desc.size = 16 * MiB;
+    EXPECT_FALSE(m_Allocator->Allocate(desc).IsValid());
+}
+
+TEST_F(GPUAllocatorTest, DeviceRefusesBlock_RetriesSmaller)
+{
+    m_Backend.failNextAllocations = 1;
+
+    const GPUAllocation allocation = m_Allocator->Allocate(DeviceLocal(MiB));
+    ASSERT_TRUE(allocation.IsValid());
+    EXPECT_EQ(m_Allocator->GetStats().types[0].blockBytes, 4 * MiB);
+}
+
+TEST_F(GPUAllocatorTest, AllocationCountLimit_IsRespected)
+{
+    std::vector<GPUAllocation> allocations;
+    GPUAllocationDesc desc = DeviceLocal(4096);
+    desc.dedicated = true;
+
+    for (uint32_t i = 0; i < m_Properties.maxAllocationCount; ++i) {
+        allocations.push_back(m_Allocator->Allocate(desc));
+        ASSERT_TRUE(allocations.back().IsValid());
+    }
+    EXPECT_FALSE(m_Allocator->Allocate(desc).IsValid());
+
+    m_Allocator->Free(allocations.back());
+    EXPECT_TRUE(m_Allocator->Allocate(desc).IsValid());
+}
+
+// ============================================================================
+// Block Lifetime
+// ============================================================================
+
+TEST_F(GPUAllocatorTest, EmptyBlocks_OneKeptPerPool)
+{
+    std::vector<GPUAllocation> allocations;
+    for (int i = 0; i < 6; ++i) {
+        allocations.push_back(m_Allocator->Allocate(DeviceLocal(3 * MiB))); // 3 blocks
+    }
+    EXPECT_EQ(m_Allocator->GetStats().types[0].blockCount, 3u);
+
+    for (const GPUAllocation& allocation : allocations) {
+        m_Allocator->Free(allocation);
+    }
+
+    EXPECT_EQ(m_Allocator->GetStats().types[0].blockCount, 1u);
+    EXPECT_EQ(m_Backend.live.size(), 1u);
+
+    // The kept block is reused
+    const uint32_t calls = m_Backend.allocateCalls;
+    m_Allocator->Allocate(DeviceLocal(MiB));
+    EXPECT_EQ(m_Backend.allocateCalls, calls);
+}
+
+TEST_F(GPUAllocatorTest, Destructor_FreesAllMemory)
+{
+    m_Allocator->Allocate(DeviceLocal(4096));
+    m_Allocator->Allocate(DeviceLocal(6 * MiB));
+    EXPECT_EQ(m_Backend.live.size(), 2u);
+
+    m_Allocator.reset();
+    EXPECT_TRUE(m_Backend.live.empty());
+}
+
+// ============================================================================
+// Defragmentation
+// ============================================================================
+
+TEST_F(GPUAllocatorTest, Defragment_DrainsSparseBlocks)
+{
+    // Fill three blocks, then free most of the last two
+    std::vector<GPUAllocation> allocations;
+    for (int i = 0; i < 24; ++i) {
+        allocations.push_back(m_Allocator->Allocate(DeviceLocal(MiB)));
+    }
+    ASSERT_EQ(m_Allocator->GetStats().types[0].blockCount, 3u);
+
+    std::vector<GPUAllocation> kept;
+    for (size_t i = 0; i < allocations.size(); ++i) {
+        if (i < 6 || i % 8 == 0) {
+            kept.push_back(allocations[i]);
+        }
+        else {
+            m_Allocator->Free(allocations[i]);
+        }
+    }
+
+    // Resources track their allocation; the hook rebinds them
+    uint32_t moved = 0;
+    const GPUDefragmentStats stats = m_Allocator->Defragment(
+        [&](const GPUAllocation& from, const GPUAllocation& to) {
+            for (GPUAllocation& allocation : kept) {
+                if (allocation.memory == from.memory && allocation.offset == from.offset) {
+                    allocation = to;
+                    ++moved;
+                    return true;
+                }
+            }
+            ADD_FAILURE() << "Moved an allocation that does not exist";
+            return false;
+        });
+
+    EXPECT_EQ(stats.moves, moved);
+    EXPECT_EQ(stats.moves, 2u); // Allocations 8 and 16
+    EXPECT_EQ(stats.bytesMoved, 2 * MiB);
+    EXPECT_EQ(stats.blocksFreed, 2u);
+
+    const GPUAllocatorStats after = m_Allocator->GetStats();
+    EXPECT_EQ(after.types[0].blockCount, 1u);
+    EXPECT_EQ(after.types[0].allocationCount, kept.size());
+
+    // Moved allocations are real: freeing them empties the allocator
+    for (const GPUAllocation& allocation : kept) {
+        m_Allocator->Free(allocation);
+    }
+    EXPECT_EQ(m_Allocator->GetStats().total.allocationCount, 0u);
+}
+
+TEST_F(GPUAllocatorTest, Defragment_MovesEachAllocationAtMostOnce)
+{
+    // Four blocks left 6/8, 4/8, 3/8 and 2/8 full
+    constexpr size_t keptPerBlock[] = { 6, 4, 3, 2 };
+    std::vector<GPUAllocation> allocations;
+    for (int i = 0; i < 32; ++i) {
+        allocations.push_back(m_Allocator->Allocate(DeviceLocal(MiB)));
+    }
+    ASSERT_EQ(m_Allocator->GetStats().types[0].blockCount, 4u);
+
+    struct Resource
+    {
+        GPUAllocation allocation;
+        uint32_t moves = 0;
+    };
+    std::vector<Resource> kept;
+    for (size_t i = 0; i < allocations.size(); ++i) {
+        if (i % 8 < keptPerBlock[i / 8]) {
+            kept.push_back({ allocations[i] });
+        }
+        else {
+            m_Allocator->Free(allocations[i]);
+        }
+    }
+
+    const GPUDefragmentStats stats = m_Allocator->Defragment(
+        [&](const GPUAllocation& from, const GPUAllocation& to) {
+            for (Resource& resource : kept) {
+                if (resource.allocation.memory == from.memory && resource.allocation.offset == from.offset) {
+                    resource.allocation = to;
+                    ++resource.moves;
+                    return true;
+                }
+            }
+            ADD_FAILURE() << "Moved an allocation that does not exist";
+            return false;
+        });
+
+    uint32_t moved = 0;
+    for (const Resource& resource : kept) {
+        EXPECT_LE(resource.moves, 1u);
+        moved += resource.moves;
+    }
+    EXPECT_EQ(stats.moves, moved);
+    EXPECT_EQ(stats.bytesMoved, moved * MiB);
+    EXPECT_EQ(stats.blocksFreed, 2u); // 15 allocations fit in two blocks
+
+    const GPUAllocatorStats after = m_Allocator->GetStats();
+    EXPECT_EQ(after.types[0].blockCount, 2u);
+    EXPECT_EQ(after.types[0].allocationCount, kept.size());
+
+    for (const Resource& resource : kept) {
+        m_Allocator->Free(resource.allocation);
+    }
+    EXPECT_EQ(m_Allocator->GetStats().total.allocationCount, 0u);
+}
+
+TEST_F(GPUAllocatorTest, Defragment_DeclinedMoves_LeaveAllocations)
+{
+    std::vector<GPUAllocation> allocations;
+    for (int i = 0; i < 10; ++i) {
+        allocations.push_back(m_Allocator->Allocate(DeviceLocal(MiB)));
+    }
+    for (int i = 2; i < 8; ++i) {
+        m_Allocator->Free(allocations[i]);
+    }
+
+    const GPUDefragmentStats stats = m_Allocator->Defragment(
+        [](const GPUAllocation&, const GPUAllocation&) { return false; });
+
+    EXPECT_EQ(stats.moves, 0u);
+    EXPECT_EQ(stats.blocksFreed, 0u);
+    EXPECT_EQ(m_Allocator->GetStats().types[0].allocationCount, 4u);
+    EXPECT_EQ(m_Allocator->GetStats().types[0].blockCount, 2u);
+}
+
+TEST_F(GPUAllocatorTest, Defragment_RespectsByteBudget)
+{
+    std::vector<GPUAllocation> allocations;
+    for (int i = 0; i < 16; ++i) {
+        allocations.push_back(m_Allocator->Allocate(DeviceLocal(MiB)));
+    }
+    for (int i = 4; i < 12; ++i) {
+        m_Allocator->Free(allocations[i]); // Two half-full blocks
+    }
+
+    const GPUDefragmentStats stats = m_Allocator->Defragment(
+        [](const GPUAllocation&, const GPUAllocation&) { return true; }, 2 * MiB);
+
+    EXPECT_EQ(stats.moves, 2u);
+    EXPECT_EQ(stats.bytesMoved, 2 * MiB);
+}
@@ -0,0 +1,335 @@
+#include <gtest/gtest.h>
+#include "Rendering/RHI/PipelineCache.h"
+#include "Rendering/RHI/PipelineCompileQueue.h"
+#include "MT/JobSystem.h"
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <filesystem>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+namespace
+{
+    PipelineCacheDeviceInfo MakeDevice()
+    {
+        PipelineCacheDeviceInfo device;
+        device.vendorID = 0x10de;
+        device.deviceID = 0x2684;
+        device.driverVersion = 0x8a1c0000;
+        for (size_t i = 0; i < device.uuid.size(); ++i) {
+            device.uuid[i] = static_cast<uint8_t>(i * 7 + 1);
+        }
+        return device;
+    }
+
+    std::vector<uint8_t> MakeBlob(size_t size)
+    {
+        std::vector<uint8_t> blob(size);
+        for (size_t i = 0; i < size; ++i) {
+            blob[i] = static_cast<uint8_t>(i * 31);
+        }
+        return blob;
+    }
+
+    PipelineCompileFunction Returns(RHIPipelineHandle pipeline, bool cacheHit = false)
+    {
+        return [pipeline, cacheHit]() { return PipelineCompileResult{ pipeline, cacheHit }; };
+    }
+
+    // Wait (bounded) for a background compile to publish its result
+    bool WaitUntil(const std::function<bool()>& condition)
+    {
+        const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+        while (!condition()) {
+            if (std::chrono::steady_clock::now() > deadline)
+                return false;
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+        }
+        return true;
+    }
+}
+
+// ============================================================================
+// Cache File
+// ============================================================================
+
+TEST(PipelineCacheFileTest, RoundTrip_ReturnsDriverData)
+{
+    const PipelineCacheDeviceInfo device = MakeDevice();
+    const std::vector<uint8_t> blob = MakeBlob(1000);
+
+    const std::vector<uint8_t> file = PipelineCacheFile::Serialize(device, blob.data(), blob.size());
+
+    std::vector<uint8_t> data;
+    EXPECT_EQ(PipelineCacheFile::Deserialize(file, device, data), PipelineCacheLoadResult::Loaded);
+    EXPECT_EQ(data, blob);
+}
+
+TEST(PipelineCacheFileTest, OtherDevice_IsRejected)
+{
+    const std::vector<uint8_t> blob = MakeBlob(64);
+    const std::vector<uint8_t> file = PipelineCacheFile::Serialize(MakeDevice(), blob.data(), blob.size());
+
+    PipelineCacheDeviceInfo otherUUID = MakeDevice();
+    otherUUID.uuid[15] ^= 0xff;
+    PipelineCacheDeviceInfo otherGPU = MakeDevice();
+    otherGPU.deviceID += 1;
+    PipelineCacheDeviceInfo otherDriver = MakeDevice();
+    otherDriver.driverVersion += 1;
+
+    std::vector<uint8_t> data;
+    EXPECT_EQ(PipelineCacheFile::Deserialize(file, otherUUID, data), PipelineCacheLoadResult::DeviceMismatch);
+    EXPECT_EQ(PipelineCacheFile::Deserialize(file, otherGPU, data), PipelineCacheLoadResult::DeviceMismatch);
+    EXPECT_EQ(PipelineCacheFile::Deserialize(file, otherDriver, data), PipelineCacheLoadResult::DriverMismatch);
+    EXPECT_TRUE(data.empty());
+}
+
+TEST(PipelineCacheFileTest, DamagedFile_IsCorrupt)
+{
+    const PipelineCacheDeviceInfo device = MakeDevice();
+    const std::vector<uint8_t> blob = MakeBlob(256);
+    const std::vector<uint8_t> file = PipelineCacheFile::Serialize(device, blob.data(), blob.size());
+
+    std::vector<uint8_t> truncated(file.begin(), file.end() - 1);
+    std::vector<uint8_t> flipped = file;
+    flipped.back() ^= 0x01;
+    std::vector<uint8_t> header(file.begin(), file.begin() + 10);
+    std::vector<uint8_t> badMagic = file;
+    badMagic[0] ^= 0xff;
+
+    std::vector<uint8_t> data;
+    EXPECT_EQ(PipelineCacheFile::Deserialize(truncated, device, data), PipelineCacheLoadResult::Corrupt);
+    EXPECT_EQ(PipelineCacheFile::Deserialize(flipped, device, data), PipelineCacheLoadResult::Corrupt);
+    EXPECT_EQ(PipelineCacheFile::Deserialize(header, device, data), PipelineCacheLoadResult::Corrupt);
+    EXPECT_EQ(PipelineCacheFile::Deserialize(badMagic, device, data), PipelineCacheLoadResult::Corrupt);
+    EXPECT_TRUE(data.empty());
+}
+
+TEST(PipelineCacheFileTest, SaveLoad_ThroughDisk)
+{
+    namespace fs = std::filesystem;
+    const fs::path directory = fs::temp_directory_path() / "solarc_pipeline_cache_test";
+    fs::remove_all(directory);
+    const std::string path = (directory / "logs" / "pipeline_cache.bin").string();
+
+    const PipelineCacheDeviceInfo device = MakeDevice();
+    std::vector<uint8_t> data;
+    EXPECT_EQ(PipelineCacheFile::Load(path, device, data), PipelineCacheLoadResult::Missing);
+
+    // Creates the directory; a second save replaces the first
+    const std::vector<uint8_t> first = MakeBlob(100);
+    const std::vector<uint8_t> second = MakeBlob(5000);
+    ASSERT_TRUE(PipelineCacheFile::Save(path, device, first.data(), first.size()));
+    ASSERT_TRUE(PipelineCacheFile::Save(path, device, second.data(), second.size()));
+
+    EXPECT_EQ(PipelineCacheFile::Load(path, device, data), PipelineCacheLoadResult::Loaded);
+    EXPECT_EQ(data, second);
+    EXPECT_FALSE(fs::exists(path + ".tmp"));
+
+    fs::remove_all(directory);
+}
+
+// ============================================================================
+// Compile Queue
+// ============================================================================
+
+TEST(PipelineCompileQueueTest, Request_ReturnsFallbackUntilReady)
+{
+    JobSystem jobs(2);
+    PipelineCompileQueue queue(jobs);
+
+    std::atomic<bool> release{ false };
+    std::atomic<int> calls{ 0 };
+    auto compile = [&]() {
+        ++calls;
+        while (!release.load()) {
+            std::this_thread::yield();
+        }
+        return PipelineCompileResult{ 42, false };
+        };
+
+    EXPECT_EQ(queue.Request(1, compile, 7), 7u);
+    EXPECT_EQ(queue.Request(1, compile, 7), 7u); // Still compiling: not scheduled twice
+    EXPECT_FALSE(queue.IsReady(1));
+
+    release = true;
+    ASSERT_TRUE(WaitUntil([&]() { return queue.IsReady(1); }));
+    EXPECT_EQ(queue.Request(1, compile, 7), 42u);
+    EXPECT_EQ(calls.load(), 1);
+
+    const PipelineCompileStats stats = queue.GetStats();
+    EXPECT_EQ(stats.requests, 3u);
+    EXPECT_EQ(stats.fallbackRequests, 2u);
+    EXPECT_EQ(stats.compiles, 1u);
+    EXPECT_EQ(stats.pending, 0u);
+}
+
+TEST(PipelineCompileQueueTest, CompileNow_WaitsForBackgroundCompile)
+{
+    JobSystem jobs(2);
+    PipelineCompileQueue queue(jobs);
+
+    std::atomic<int> calls{ 0 };
+    auto slow = [&]() {
+        ++calls;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        return PipelineCompileResult{ 5, false };
+        };
+
+    queue.Request(3, slow);
+    EXPECT_EQ(queue.CompileNow(3, slow), 5u);
+    EXPECT_EQ(calls.load(), 1);
+
+    // Unknown key compiles on the calling thread
+    EXPECT_EQ(queue.CompileNow(4, Returns(9)), 9u);
+    EXPECT_TRUE(queue.IsReady(4));
+}
+
+TEST(PipelineCompileQueueTest, CompileNow_ConcurrentCallers_CompileOnce)
+{
+    JobSystem jobs(1);
+    PipelineCompileQueue queue(jobs);
+
+    std::atomic<int> calls{ 0 };
+    auto slow = [&]() {
+        ++calls;
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        return PipelineCompileResult{ 11, false };
+        };
+
+    std::vector<RHIPipelineHandle> results(4, 0);
+    std::vector<std::thread> threads;
+    for (size_t i = 0; i < results.size(); ++i) {
+        threads.emplace_back([&, i]() { results[i] = queue.CompileNow(6, slow); });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    EXPECT_EQ(calls.load(), 1);
+    EXPECT_EQ(results, (std::vector<RHIPipelineHandle>(4, 11)));
+
+    const PipelineCompileStats stats = queue.GetStats();
+    EXPECT_EQ(stats.compiles, 1u);
+    EXPECT_EQ(stats.pending, 0u);
+}
+
+TEST(PipelineCompileQueueTest, CompileNow_InsideJob_TakesOverQueuedCompile)
+{
+    JobSystem jobs(1);
+    PipelineCompileQueue queue(jobs);
+
+    std::atomic<int> calls{ 0 };
+    auto compile = [&]() {
+        ++calls;
+        return PipelineCompileResult{ 13, false };
+        };
+
+    // The only worker runs this job, so the background compile Request()
+    // schedules cannot start until the job returns
+    std::atomic<RHIPipelineHandle> result{ 0 };
+    JobHandle job = jobs.Schedule([&]() {
+        queue.Request(8, compile);
+        result = queue.CompileNow(8, compile);
+        });
+
+    ASSERT_TRUE(WaitUntil([&]() { return job.IsComplete(); }));
+    EXPECT_EQ(result.load(), 13u);
+
+    // The queued job finds the key taken over and skips it
+    queue.WaitIdle();
+    EXPECT_EQ(calls.load(), 1);
+
+    const PipelineCompileStats stats = queue.GetStats();
+    EXPECT_EQ(stats.compiles, 1u);
+    EXPECT_EQ(stats.pending, 0u);
+}
+
+TEST(PipelineCompileQueueTest, Failure_KeepsFallback_NoRetry)
+{
+    JobSystem jobs(1);
+    PipelineCompileQueue queue(jobs);
+
+    std::atomic<int> calls{ 0 };
+    auto throwing = [&]() -> PipelineCompileResult {
+        ++calls;
+        throw std::runtime_error("shader does not link");
+        };
+
+    queue.Request(8, throwing, 1);
+    queue.WaitIdle();
+
+    EXPECT_EQ(queue.Request(8, throwing, 1), 1u);
+    EXPECT_EQ(queue.CompileNow(8, throwing), 0u);
+    EXPECT_EQ(calls.load(), 1);
+    EXPECT_EQ(queue.GetStats().failures, 1u);
+    EXPECT_EQ(queue.GetStats().compiles, 0u);
+}
+
+TEST(PipelineCompileQueueTest, NonStandardThrow_CountsAsFailure)
+{
+    JobSystem jobs(1);
+    PipelineCompileQueue queue(jobs);
+
+    auto throwing = []() -> PipelineCompileResult { throw 42; };
+
+    EXPECT_EQ(queue.CompileNow(2, throwing), 0u);
+    EXPECT_EQ(queue.GetStats().failures, 1u);
+    EXPECT_EQ(queue.GetStats().pending, 0u);
+}
+
+TEST(PipelineCompileQueueTest, Request_AfterJobSystemShutdown_ReturnsFallback)
+{
+    JobSystem jobs(1);
+    PipelineCompileQueue queue(jobs);
+    jobs.Shutdown();
+
+    // The dropped job leaves nothing pending, so WaitIdle() returns
+    EXPECT_EQ(queue.Request(3, Returns(30), 4), 4u);
+    EXPECT_EQ(queue.GetStats().pending, 0u);
+    queue.WaitIdle();
+
+    // The key is not marked failed: CompileNow still builds it
+    EXPECT_EQ(queue.CompileNow(3, Returns(30)), 30u);
+}
+
+TEST(PipelineCompileQueueTest, Stats_CacheHitRate)
+{
+    JobSystem jobs(4);
+    PipelineCompileQueue queue(jobs);
+
+    for (PipelineKey key = 1; key <= 8; ++key) {
+        queue.Request(key, Returns(100 + key, key % 4 != 0));
+    }
+    queue.WaitIdle();
+
+    const PipelineCompileStats stats = queue.GetStats();
+    EXPECT_EQ(stats.compiles, 8u);
+    EXPECT_EQ(stats.cacheHits, 6u);
+    EXPECT_DOUBLE_EQ(stats.GetCacheHitRate(), 0.75);
+    EXPECT_GE(stats.maxCompileMs, stats.GetAverageCompileMs());
+}
+
+TEST(PipelineCompileQueueTest, Clear_DestroysEveryPipeline)
+{
+    JobSystem jobs(2);
+    PipelineCompileQueue queue(jobs);
+
+    for (PipelineKey key = 1; key <= 5; ++key) {
+        queue.Request(key, Returns(key * 10));
+    }
+
+    std::vector<RHIPipelineHandle> destroyed;
+    queue.Clear([&](RHIPipelineHandle pipeline) { destroyed.push_back(pipeline); });
+
+    std::sort(destroyed.begin(), destroyed.end());
+    EXPECT_EQ(destroyed, (std::vector<RHIPipelineHandle>{ 10, 20, 30, 40, 50 }));
+    EXPECT_FALSE(queue.IsReady(1));
+}
@@ -0,0 +1,55 @@
+#include <gtest/gtest.h>
+#include "Rendering/RHI/RHIDesc.h"
+
+// ============================================================================
+// Frames In Flight
+// ============================================================================
+
+TEST(RHIDescTest, Default_IsBalancedWithTwoFrames)
+{
+    RHIDesc desc;
+    EXPECT_EQ(desc.latencyMode, RHILatencyMode::Balanced);
+    EXPECT_EQ(desc.GetFramesInFlight(), 2u);
+    EXPECT_FALSE(desc.IsJustInTimeAcquire());
+}
+
+TEST(RHIDescTest, LatencyMode_SelectsFrameCount)
+{
+    RHIDesc desc;
+
+    desc.latencyMode = RHILatencyMode::LowLatency;
+    EXPECT_EQ(desc.GetFramesInFlight(), 1u);
+    EXPECT_TRUE(desc.IsJustInTimeAcquire());
+
+    desc.latencyMode = RHILatencyMode::Throughput;
+    EXPECT_EQ(desc.GetFramesInFlight(), 3u);
+    EXPECT_FALSE(desc.IsJustInTimeAcquire());
+}
+
+TEST(RHIDescTest, ExplicitFrameCount_OverridesModeAndClamps)
+{
+    RHIDesc desc;
+    desc.latencyMode = RHILatencyMode::LowLatency;
+
+    desc.framesInFlight = 3;
+    EXPECT_EQ(desc.GetFramesInFlight(), 3u);
+    EXPECT_TRUE(desc.IsJustInTimeAcquire()); // Acquire timing still follows the mode
+
+    desc.framesInFlight = 9;
+    EXPECT_EQ(desc.GetFramesInFlight(), RHIDesc::MAX_FRAMES_IN_FLIGHT);
+}
+
+// ============================================================================
+// Latency Mode Names
+// ============================================================================
+
+TEST(RHIDescTest, LatencyModeNames_RoundTrip)
+{
+    for (RHILatencyMode mode : { RHILatencyMode::LowLatency, RHILatencyMode::Balanced, RHILatencyMode::Throughput })
+        EXPECT_EQ(RHILatencyModeFromString(RHILatencyModeToString(mode)), mode);
+
+    EXPECT_EQ(RHILatencyModeFromString("Low_Latency"), RHILatencyMode::LowLatency);
+    EXPECT_EQ(RHILatencyModeFromString("THROUGHPUT"), RHILatencyMode::Throughput);
+    EXPECT_EQ(RHILatencyModeFromString("fast"), std::nullopt);
+    EXPECT_EQ(RHILatencyModeFromString(""), std::nullopt);
+}
@@ -1,5 +1,7 @@
 #include "RHIIntegrationTestFixture.h"
 #include <gtest/gtest.h>
+#include <atomic>
+#include <cstdint>
 #include <thread>
 #include <vector>
 
@@ -115,4 +117,127 @@ TEST_F(RHIGPUSyncIntegrationTest, WaitForGPU_CalledFromMultipleThreads)
 
     // All threads should succeed
     EXPECT_EQ(successCount, numThreads);
-}
\ No newline at end of file
+}
+
+// ============================================================================
+// Frame Completion Tests
+// ============================================================================
+
+// Offscreen so frames are submitted while the fixture window is hidden
+class RHIFrameCompletionIntegrationTest : public RHIPerTestIntegrationTestFixture
+{
+protected:
+    RHIDesc GetRHIDesc() const override
+    {
+        RHIDesc desc = GetTestRHIDesc();
+        desc.target = RHITarget::Offscreen;
+        return desc;
+    }
+
+    void SetUp() override
+    {
+#ifdef SOLARC_RENDERER_DX12
+        GTEST_SKIP() << "Offscreen rendering is Vulkan only";
+#endif
+        RHIPerTestIntegrationTestFixture::SetUp();
+    }
+};
+
+TEST_F(RHIFrameCompletionIntegrationTest, NothingSubmitted_FrameZeroIsComplete)
+{
+    auto& rhi = RHI::Get();
+
+    EXPECT_EQ(rhi.GetLastSubmittedFrame(), 0u);
+    EXPECT_TRUE(rhi.IsFrameComplete(0));
+    EXPECT_NO_THROW(rhi.WaitForGPU());
+}
+
+TEST_F(RHIFrameCompletionIntegrationTest, SubmittedFrames_IncreaseByOne)
+{
+    auto& rhi = RHI::Get();
+
+    uint64_t previous = rhi.GetLastSubmittedFrame();
+    for (int i = 0; i < 8; ++i) {
+        RunFrameCycle();
+        const uint64_t submitted = rhi.GetLastSubmittedFrame();
+        EXPECT_EQ(submitted, previous + 1);
+        previous = submitted;
+    }
+}
+
+TEST_F(RHIFrameCompletionIntegrationTest, WaitForGPU_CompletesLastSubmittedFrameOnly)
+{
+    auto& rhi = RHI::Get();
+
+    for (int i = 0; i < 5; ++i) {
+        RunFrameCycle();
+    }
+
+    const uint64_t last = rhi.GetLastSubmittedFrame();
+    rhi.WaitForGPU();
+
+    EXPECT_TRUE(rhi.IsFrameComplete(last));
+    EXPECT_TRUE(rhi.IsFrameComplete(1));
+    EXPECT_FALSE(rhi.IsFrameComplete(last + 1)); // Never submitted
+}
+
+TEST_F(RHIFrameCompletionIntegrationTest, FramesBeyondFramesInFlight_AreComplete)
+{
+    auto& rhi = RHI::Get();
+    const uint64_t framesInFlight = rhi.GetFramesInFlight();
+
+    for (uint64_t i = 0; i < framesInFlight + 3; ++i) {
+        RunFrameCycle();
+
+        // BeginFrame waited for the slot's previous submission
+        const uint64_t last = rhi.GetLastSubmittedFrame();
+        if (last > framesInFlight) {
+            EXPECT_TRUE(rhi.IsFrameComplete(last - framesInFlight));
+        }
+    }
+}
+
+TEST_F(RHIFrameCompletionIntegrationTest, IsFrameComplete_QueriedFromOtherThreads)
+{
+    auto& rhi = RHI::Get();
+
+    RunFrameCycle();
+    const uint64_t first = rhi.GetLastSubmittedFrame();
+
+    // Deferred-deletion style polling while the main thread keeps rendering
+    constexpr int numThreads = 4;
+    std::atomic<bool> stop{ false };
+    std::atomic<int> regressions{ 0 };
+    std::atomic<int> sawFirstComplete{ 0 };
+    std::vector<std::thread> threads;
+
+    for (int i = 0; i < numThreads; ++i) {
+        threads.emplace_back([&]() {
+            bool wasComplete = false;
+            while (!stop.load()) {
+                const bool complete = rhi.IsFrameComplete(first);
+                if (wasComplete && !complete) {
+                    regressions++;
+                }
+                wasComplete = complete;
+                std::this_thread::yield();
+            }
+            if (wasComplete || rhi.IsFrameComplete(first)) {
+                sawFirstComplete++;
+            }
+            });
+    }
+
+    for (int i = 0; i < 20; ++i) {
+        RunFrameCycle();
+    }
+    rhi.WaitForGPU();
+
+    stop = true;
+    for (auto& t : threads) {
+        t.join();
+    }
+
+    EXPECT_EQ(regressions, 0);
+    EXPECT_EQ(sawFirstComplete, numThreads);
+}
@@ -1,4 +1,5 @@
 #include "RHIIntegrationTestFixture.h"
+#include "MT/JobSystem.h"
 #include <gtest/gtest.h>
 
 using namespace Solarc;
@@ -64,7 +65,7 @@ TEST_F(RHILifecycleIntegrationTest, InitializeTwice_IsIdempotent)
 
     // Second initialization should be safe (logs warning but doesn't crash)
     EXPECT_NO_THROW({
-        RHI::Initialize(m_Window);
+        RHI::Initialize(m_Window, GetRHIDesc());
         });
 
     EXPECT_TRUE(RHI::IsInitialized());
@@ -125,24 +126,29 @@ TEST_F(RHILifecycleIntegrationTest, IsInitialized_ReflectsStateAccurately)
     EXPECT_FALSE(RHI::IsInitialized());
 
     // After re-initialization
-    RHI::Initialize(m_Window);
+    RHI::Initialize(m_Window, GetRHIDesc());
     EXPECT_TRUE(RHI::IsInitialized());
 }
 
 TEST(RHILifecycleDeathTest, GetAfterShutdown_Asserts)
 {
     // Create and immediately shutdown
+    if (GetTestRHIDesc().target == RHITarget::Offscreen) {
+        WindowContext::SetHeadless(true);
+    }
     auto& windowCtx = WindowContext::Get();
     auto window = windowCtx.CreateWindow("Temp", 800, 600);
     window->Hide();
+    if (!windowCtx.IsHeadless()) {
 #ifdef _WIN32
         WindowContext::Get().PollEvents(); // triggers WndProc / Wayland callbacks
 #elif defined(__linux__)
         wl_display_roundtrip(WindowContextPlatform::Get().GetDisplay()); 
-        window->Update();
 #endif
+    }
+    window->Update();
 
-    RHI::Initialize(window);
+    RHI::Initialize(window, GetTestRHIDesc());
     RHI::Shutdown();
 
     // Get() should assert after shutdown
@@ -152,4 +158,80 @@ TEST(RHILifecycleDeathTest, GetAfterShutdown_Asserts)
 
     // Cleanup
     window->Destroy();
-}
\ No newline at end of file
+}
+// ----------------------------------------------------------------------------
+// Descriptor Heap Tests
+// ----------------------------------------------------------------------------
+
+// Offscreen, so frames are submitted with the test window hidden
+class RHIDescriptorIntegrationTest : public RHIPerTestIntegrationTestFixture
+{
+protected:
+    RHIDesc GetRHIDesc() const override
+    {
+        RHIDesc desc = GetTestRHIDesc();
+        desc.target = RHITarget::Offscreen;
+        return desc;
+    }
+
+    void SetUp() override
+    {
+#ifdef SOLARC_RENDERER_DX12
+        GTEST_SKIP() << "No bindless descriptor heap on DX12";
+#endif
+        RHIPerTestIntegrationTestFixture::SetUp();
+
+        if (!RHI::Get().HasDescriptorHeap()) {
+            GTEST_SKIP() << "Device lacks descriptor indexing";
+        }
+    }
+};
+
+TEST_F(RHIDescriptorIntegrationTest, FreedDescriptor_RecycledAfterGPUFinished)
+{
+    auto& rhi = RHI::Get();
+    RunFrameCycle();
+
+    const RHIDescriptorHandle first = rhi.CreateSamplerDescriptor(RHISamplerFilter::Linear);
+    ASSERT_TRUE(first.IsValid());
+    EXPECT_EQ(first.type, RHIDescriptorType::Sampler);
+
+    // Freed between frames: the next frame may still use it
+    rhi.FreeDescriptor(first);
+    const RHIDescriptorHandle second = rhi.CreateSamplerDescriptor(RHISamplerFilter::Nearest);
+    ASSERT_TRUE(second.IsValid());
+    EXPECT_NE(second.index, first.index);
+
+    // Once that frame completed, the next BeginFrame() recycles the index
+    RunFrameCycle();
+    rhi.WaitForGPU();
+    RunFrameCycle();
+
+    const RHIDescriptorHandle third = rhi.CreateSamplerDescriptor(RHISamplerFilter::Linear);
+    EXPECT_EQ(third.index, first.index);
+
+    rhi.FreeDescriptor(second);
+    rhi.FreeDescriptor(third);
+    rhi.FreeDescriptor(RHIDescriptorHandle{}); // Invalid handles are ignored
+}
+
+TEST_F(RHIDescriptorIntegrationTest, PushConstants_RecordedFromTask)
+{
+    auto& rhi = RHI::Get();
+    JobSystem jobs(2);
+
+    const RHIDescriptorHandle sampler = rhi.CreateSamplerDescriptor(RHISamplerFilter::Nearest);
+    ASSERT_TRUE(sampler.IsValid());
+
+    rhi.BeginFrame();
+    EXPECT_NO_THROW(rhi.RecordParallel(jobs, { [&](RHICommandRecorder& recorder) {
+        const uint32_t indices[2] = { sampler.index, 0 };
+        recorder.PushConstants(indices, sizeof(indices));
+        recorder.Clear(0.0f, 0.0f, 0.0f, 1.0f);
+        } }));
+    rhi.EndFrame();
+    rhi.Present();
+
+    rhi.FreeDescriptor(sampler);
+    rhi.WaitForGPU();
+}
@@ -1,22 +1,58 @@
 #pragma once
 #include <gtest/gtest.h>
+#include <cstdlib>
 #include <memory>
+#include <string>
 #include "Window/Window.h"
 #include "Window/WindowContext.h"
 #include "Rendering/RHI/RHI.h"
 #include "Event/ObserverBus.h"
 
+/**
+ * RHI options for integration tests, from the environment
+ * (see RHIPerTestIntegrationTestFixture).
+ */
+inline RHIDesc GetTestRHIDesc()
+{
+    RHIDesc desc;
+
+    const char* offscreen = std::getenv("SOLARC_TEST_OFFSCREEN");
+    if (offscreen && std::string(offscreen) != "0") {
+        desc.target = RHITarget::Offscreen;
+    }
+
+    if (const char* device = std::getenv("SOLARC_TEST_DEVICE")) {
+        desc.preferredDevice = device;
+    }
+
+    return desc;
+}
+
 /**
  * Base fixture for RHI integration tests
  *
  * Creates real Window and initializes real RHI with actual GPU.
  * These are integration tests - they test the complete system.
+ *
+ * GPU-less machines (CI) set SOLARC_TEST_OFFSCREEN=1: windows are headless
+ * and the RHI renders offscreen, on SOLARC_TEST_DEVICE if set
+ * (e.g. "llvmpipe" for lavapipe).
  */
 class RHIPerTestIntegrationTestFixture : public ::testing::Test
 {
 protected:
+    /**
+     * RHI options used by SetUp(); override to force a target.
+     */
+    virtual RHIDesc GetRHIDesc() const { return GetTestRHIDesc(); }
+
     void SetUp() override
     {
+        // No display server needed when nothing is presented (must precede the first Get())
+        if (GetTestRHIDesc().target == RHITarget::Offscreen) {
+            WindowContext::SetHeadless(true);
+        }
+
         // Create a real window (hidden) for testing
         auto& windowCtx = WindowContext::Get();
 
@@ -32,7 +68,7 @@ protected:
         PumpWindowEvents(m_Window);
 
         // Initialize RHI with the real window
-        RHI::Initialize(m_Window);
+        RHI::Initialize(m_Window, GetRHIDesc());
 
         m_Bus.RegisterListener(&RHI::Get());
         m_Bus.RegisterProducer(m_Window.get());
@@ -63,6 +99,12 @@ protected:
     }
 
     void PumpWindowEvents(std::shared_ptr<Window> window) {
+        // Headless windows apply commands immediately
+        if (WindowContext::Get().IsHeadless()) {
+            window->Update();
+            return;
+        }
+
         #ifdef _WIN32
         WindowContext::Get().PollEvents();     // triggers WndProc / Wayland callbacks
         #elif defined(__linux__)
@@ -0,0 +1,140 @@
+#include "RHIIntegrationTestFixture.h"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdint>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using namespace Solarc;
+
+// ============================================================================
+// RHI Latency Mode Integration Tests (offscreen, once per mode)
+// ============================================================================
+
+class RHILatencyModeIntegrationTest
+    : public RHIPerTestIntegrationTestFixture
+    , public ::testing::WithParamInterface<RHILatencyMode>
+{
+protected:
+    RHIDesc GetRHIDesc() const override
+    {
+        RHIDesc desc = GetTestRHIDesc();
+        desc.target = RHITarget::Offscreen;
+        desc.latencyMode = GetParam();
+        return desc;
+    }
+
+    void SetUp() override
+    {
+#ifdef SOLARC_RENDERER_DX12
+        GTEST_SKIP() << "Offscreen rendering is Vulkan only";
+#endif
+        RHIPerTestIntegrationTestFixture::SetUp();
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Configuration Tests
+// ----------------------------------------------------------------------------
+
+TEST_P(RHILatencyModeIntegrationTest, FramesInFlightMatchesMode)
+{
+    RHIDesc expected;
+    expected.latencyMode = GetParam();
+
+    EXPECT_EQ(RHI::Get().GetLatencyMode(), GetParam());
+    EXPECT_EQ(RHI::Get().GetFramesInFlight(), expected.GetFramesInFlight());
+}
+
+TEST_P(RHILatencyModeIntegrationTest, ManyFrames_LatestFrameReadsBack)
+{
+    // Cycles every frame-in-flight slot and offscreen image several times
+    for (int i = 0; i < 16; ++i) {
+        RunFrameCycle(1.0f, 0.0f, 0.0f, 1.0f);
+    }
+    RunFrameCycle(0.0f, 0.0f, 1.0f, 1.0f);
+
+    std::vector<uint8_t> pixels;
+    uint32_t width = 0, height = 0;
+    ASSERT_TRUE(RHI::Get().ReadbackFrame(pixels, width, height));
+    ASSERT_FALSE(pixels.empty());
+
+    EXPECT_EQ(pixels[0], 255); // Blue
+    EXPECT_EQ(pixels[2], 0);
+}
+
+// ============================================================================
+// Performance Benchmark (Not a test, just for measurement)
+// ============================================================================
+//
+// Each frame spins the CPU for CPU_WORK and gives the GPU GPU_CLEARS full
+// screen clears. Reported per mode:
+// - Frame:    mean BeginFrame-to-BeginFrame time (throughput)
+// - Blocked:  mean time BeginFrame waited for a frame-in-flight slot or an
+//             image; Overlap = share of the frame the CPU was not blocked
+// - Latency:  mean time from BeginFrame of frame k until frame k's GPU work
+//             is known complete (the fence wait of frame k + frames in flight)
+
+TEST_P(RHILatencyModeIntegrationTest, Benchmark_CpuGpuOverlapAndLatency)
+{
+    using Clock = std::chrono::steady_clock;
+    constexpr int FRAMES = 120;
+    constexpr int GPU_CLEARS = 32;
+    constexpr auto CPU_WORK = std::chrono::milliseconds(2);
+
+    RHI& rhi = RHI::Get();
+    const uint32_t framesInFlight = rhi.GetFramesInFlight();
+
+    std::vector<Clock::time_point> frameBegin(FRAMES);
+    std::vector<Clock::time_point> slotFree(FRAMES); // Previous use of this frame's slot completed
+    uint64_t blockedUs = 0;
+
+    for (int frame = 0; frame < FRAMES; ++frame) {
+        frameBegin[frame] = Clock::now();
+        rhi.BeginFrame();
+        const RHIFrameTimings& timings = rhi.GetLastFrameTimings();
+        slotFree[frame] = frameBegin[frame] + std::chrono::microseconds(timings.waitForFrameUs);
+
+        const auto workEnd = Clock::now() + CPU_WORK;
+        while (Clock::now() < workEnd) {
+        }
+
+        for (int i = 0; i < GPU_CLEARS; ++i) {
+            rhi.Clear(i / float(GPU_CLEARS), 0.0f, 0.0f, 1.0f);
+        }
+        rhi.EndFrame();
+        rhi.Present();
+
+        // Acquire may happen in Clear() (low latency), so read timings after the frame
+        blockedUs += rhi.GetLastFrameTimings().waitForFrameUs + rhi.GetLastFrameTimings().acquireUs;
+    }
+    rhi.WaitForGPU();
+    const auto end = Clock::now();
+
+    double latencyUs = 0.0;
+    int latencySamples = 0;
+    for (int frame = 0; frame + static_cast<int>(framesInFlight) < FRAMES; ++frame) {
+        latencyUs += std::chrono::duration<double, std::micro>(slotFree[frame + framesInFlight] - frameBegin[frame]).count();
+        ++latencySamples;
+    }
+
+    const double frameUs = std::chrono::duration<double, std::micro>(end - frameBegin[0]).count() / FRAMES;
+    const double meanBlockedUs = static_cast<double>(blockedUs) / FRAMES;
+
+    std::cout << "Latency mode " << RHILatencyModeToString(GetParam())
+              << " (" << framesInFlight << " in flight): frame " << frameUs << " us"
+              << ", blocked " << meanBlockedUs << " us"
+              << ", overlap " << 100.0 * (1.0 - meanBlockedUs / frameUs) << "%"
+              << ", latency " << (latencySamples ? latencyUs / latencySamples : 0.0) << " us" << std::endl;
+
+    EXPECT_GT(frameUs, 0.0);
+}
+
+INSTANTIATE_TEST_SUITE_P(
+    LatencyModes,
+    RHILatencyModeIntegrationTest,
+    ::testing::Values(RHILatencyMode::LowLatency, RHILatencyMode::Balanced, RHILatencyMode::Throughput),
+    [](const ::testing::TestParamInfo<RHILatencyMode>& info) {
+        return std::string(RHILatencyModeToString(info.param));
+    });
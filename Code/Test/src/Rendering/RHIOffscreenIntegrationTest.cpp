@@ -0,0 +1,123 @@
+#include "RHIIntegrationTestFixture.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <vector>
+
+using namespace Solarc;
+
+// ============================================================================
+// RHI Offscreen Integration Tests
+// ============================================================================
+
+class RHIOffscreenIntegrationTest : public RHIPerTestIntegrationTestFixture
+{
+protected:
+    RHIDesc GetRHIDesc() const override
+    {
+        RHIDesc desc = GetTestRHIDesc();
+        desc.target = RHITarget::Offscreen;
+        return desc;
+    }
+
+    void SetUp() override
+    {
+#ifdef SOLARC_RENDERER_DX12
+        GTEST_SKIP() << "Offscreen rendering is Vulkan only";
+#endif
+        RHIPerTestIntegrationTestFixture::SetUp();
+    }
+};
+
+// ----------------------------------------------------------------------------
+// Readback Tests
+// ----------------------------------------------------------------------------
+
+TEST_F(RHIOffscreenIntegrationTest, IsOffscreen)
+{
+    EXPECT_TRUE(RHI::Get().IsOffscreen());
+    EXPECT_EQ(RHI::Get().GetPresentTiming(), nullptr);
+}
+
+TEST_F(RHIOffscreenIntegrationTest, NothingPresented_ReadbackFails)
+{
+    std::vector<uint8_t> pixels;
+    uint32_t width = 0, height = 0;
+
+    EXPECT_FALSE(RHI::Get().ReadbackFrame(pixels, width, height));
+}
+
+TEST_F(RHIOffscreenIntegrationTest, HiddenWindow_ClearColorReadsBack)
+{
+    // Fixture window is hidden: offscreen frames render anyway
+    RunFrameCycle(1.0f, 0.0f, 0.0f, 1.0f);
+    EXPECT_TRUE(RHI::Get().GetLastFrameTimings().presented);
+
+    std::vector<uint8_t> pixels;
+    uint32_t width = 0, height = 0;
+    ASSERT_TRUE(RHI::Get().ReadbackFrame(pixels, width, height));
+
+    const SurfaceExtent extent = m_Window->GetBufferExtent();
+    EXPECT_EQ(width, static_cast<uint32_t>(extent.width));
+    EXPECT_EQ(height, static_cast<uint32_t>(extent.height));
+    ASSERT_EQ(pixels.size(), static_cast<size_t>(width) * height * 4);
+
+    // BGRA8: opaque red, first and last pixel
+    EXPECT_EQ(pixels[0], 0);
+    EXPECT_EQ(pixels[1], 0);
+    EXPECT_EQ(pixels[2], 255);
+    EXPECT_EQ(pixels[3], 255);
+    EXPECT_EQ(pixels[pixels.size() - 2], 255);
+}
+
+TEST_F(RHIOffscreenIntegrationTest, ReadbackReturnsLatestFrame)
+{
+    RunFrameCycle(1.0f, 0.0f, 0.0f, 1.0f);
+    RunFrameCycle(0.0f, 1.0f, 0.0f, 1.0f);
+    RunFrameCycle(0.0f, 0.0f, 1.0f, 1.0f);
+
+    std::vector<uint8_t> pixels;
+    uint32_t width = 0, height = 0;
+    ASSERT_TRUE(RHI::Get().ReadbackFrame(pixels, width, height));
+    ASSERT_FALSE(pixels.empty());
+
+    EXPECT_EQ(pixels[0], 255); // Blue
+    EXPECT_EQ(pixels[1], 0);
+    EXPECT_EQ(pixels[2], 0);
+}
+
+TEST_F(RHIOffscreenIntegrationTest, MultipleClears_LastClearWins)
+{
+    RHI& rhi = RHI::Get();
+    rhi.BeginFrame();
+    rhi.Clear(1.0f, 0.0f, 0.0f, 1.0f);
+    rhi.Clear(0.0f, 1.0f, 0.0f, 1.0f);
+    rhi.EndFrame();
+    rhi.Present();
+
+    std::vector<uint8_t> pixels;
+    uint32_t width = 0, height = 0;
+    ASSERT_TRUE(rhi.ReadbackFrame(pixels, width, height));
+    ASSERT_FALSE(pixels.empty());
+
+    EXPECT_EQ(pixels[0], 0);
+    EXPECT_EQ(pixels[1], 255); // Green
+    EXPECT_EQ(pixels[2], 0);
+}
+
+TEST_F(RHIOffscreenIntegrationTest, FrameWithoutClear_IsBlack)
+{
+    RHI& rhi = RHI::Get();
+    rhi.BeginFrame();
+    rhi.EndFrame();
+    rhi.Present();
+
+    std::vector<uint8_t> pixels;
+    uint32_t width = 0, height = 0;
+    ASSERT_TRUE(rhi.ReadbackFrame(pixels, width, height));
+    ASSERT_FALSE(pixels.empty());
+
+    EXPECT_EQ(pixels[0], 0);
+    EXPECT_EQ(pixels[1], 0);
+    EXPECT_EQ(pixels[2], 0);
+    EXPECT_EQ(pixels[3], 255);
+}
@@ -0,0 +1,209 @@
+#include "RHIIntegrationTestFixture.h"
+#include "MT/JobSystem.h"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+using namespace Solarc;
+
+// ============================================================================
+// RHI Parallel Recording Integration Tests (offscreen, read back)
+// ============================================================================
+
+class RHIParallelRecordingIntegrationTest : public RHIPerTestIntegrationTestFixture
+{
+protected:
+    RHIDesc GetRHIDesc() const override
+    {
+        RHIDesc desc = GetTestRHIDesc();
+        desc.target = RHITarget::Offscreen;
+        return desc;
+    }
+
+    void SetUp() override
+    {
+#ifdef SOLARC_RENDERER_DX12
+        GTEST_SKIP() << "Offscreen rendering is Vulkan only";
+#endif
+        RHIPerTestIntegrationTestFixture::SetUp();
+        m_Jobs = std::make_unique<JobSystem>(4);
+    }
+
+    void TearDown() override
+    {
+        m_Jobs.reset();
+        RHIPerTestIntegrationTestFixture::TearDown();
+    }
+
+    // BGRA8 pixel of the last presented frame
+    struct Pixel { uint8_t b, g, r, a; };
+
+    Pixel ReadPixel(uint32_t x, uint32_t y)
+    {
+        if (m_Pixels.empty()) {
+            EXPECT_TRUE(RHI::Get().ReadbackFrame(m_Pixels, m_Width, m_Height));
+        }
+        const size_t offset = (static_cast<size_t>(y) * m_Width + x) * 4;
+        return { m_Pixels[offset], m_Pixels[offset + 1], m_Pixels[offset + 2], m_Pixels[offset + 3] };
+    }
+
+    std::unique_ptr<JobSystem> m_Jobs;
+    std::vector<uint8_t> m_Pixels;
+    uint32_t m_Width = 0;
+    uint32_t m_Height = 0;
+};
+
+// ----------------------------------------------------------------------------
+// Merge Tests
+// ----------------------------------------------------------------------------
+
+TEST_F(RHIParallelRecordingIntegrationTest, Quadrants_RecordedOnWorkers)
+{
+    RHI& rhi = RHI::Get();
+    rhi.BeginFrame();
+
+    std::vector<RHIRecordTask> tasks;
+    for (int quadrant = 0; quadrant < 4; ++quadrant) {
+        tasks.push_back([quadrant](RHICommandRecorder& recorder) {
+            const uint32_t halfW = recorder.GetWidth() / 2;
+            const uint32_t halfH = recorder.GetHeight() / 2;
+            const int32_t x = (quadrant % 2) ? static_cast<int32_t>(halfW) : 0;
+            const int32_t y = (quadrant / 2) ? static_cast<int32_t>(halfH) : 0;
+            recorder.ClearRect(x, y, recorder.GetWidth() - halfW, recorder.GetHeight() - halfH,
+                quadrant == 1 ? 1.0f : 0.0f, quadrant == 2 ? 1.0f : 0.0f, quadrant == 3 ? 1.0f : 0.0f, 1.0f);
+            });
+    }
+    rhi.RecordParallel(*m_Jobs, std::move(tasks));
+
+    rhi.EndFrame();
+    rhi.Present();
+
+    const Pixel topLeft = ReadPixel(0, 0);
+    const Pixel topRight = ReadPixel(m_Width - 1, 0);
+    const Pixel bottomLeft = ReadPixel(0, m_Height - 1);
+    const Pixel bottomRight = ReadPixel(m_Width - 1, m_Height - 1);
+
+    EXPECT_EQ(topLeft.r + topLeft.g + topLeft.b, 0); // Black
+    EXPECT_EQ(topRight.r, 255);
+    EXPECT_EQ(bottomLeft.g, 255);
+    EXPECT_EQ(bottomRight.b, 255);
+    EXPECT_EQ(bottomRight.r, 0);
+}
+
+TEST_F(RHIParallelRecordingIntegrationTest, TaskOrderWins_NotCompletionOrder)
+{
+    RHI& rhi = RHI::Get();
+    rhi.BeginFrame();
+
+    std::vector<RHIRecordTask> tasks;
+    tasks.push_back([](RHICommandRecorder& recorder) {
+        recorder.Clear(1.0f, 0.0f, 0.0f, 1.0f);
+        });
+    tasks.push_back([](RHICommandRecorder& recorder) {
+        // Finishes last but is merged last because it is listed last
+        std::this_thread::sleep_for(std::chrono::milliseconds(20));
+        recorder.Clear(0.0f, 1.0f, 0.0f, 1.0f);
+        });
+    rhi.RecordParallel(*m_Jobs, std::move(tasks));
+
+    rhi.EndFrame();
+    rhi.Present();
+
+    EXPECT_EQ(ReadPixel(0, 0).g, 255);
+    EXPECT_EQ(ReadPixel(0, 0).r, 0);
+}
+
+TEST_F(RHIParallelRecordingIntegrationTest, ClearBefore_IsKept_ClearAfter_Wins)
+{
+    RHI& rhi = RHI::Get();
+    rhi.BeginFrame();
+    rhi.Clear(1.0f, 0.0f, 0.0f, 1.0f);
+
+    std::vector<RHIRecordTask> tasks;
+    tasks.push_back([](RHICommandRecorder& recorder) {
+        recorder.ClearRect(0, 0, recorder.GetWidth() / 2, recorder.GetHeight(), 0.0f, 0.0f, 1.0f, 1.0f);
+        });
+    rhi.RecordParallel(*m_Jobs, std::move(tasks));
+
+    rhi.EndFrame();
+    rhi.Present();
+
+    EXPECT_EQ(ReadPixel(0, 0).b, 255);           // Task's half
+    EXPECT_EQ(ReadPixel(m_Width - 1, 0).r, 255); // Loaded from the Clear before
+
+    m_Pixels.clear();
+    rhi.BeginFrame();
+    rhi.RecordParallel(*m_Jobs, { [](RHICommandRecorder& recorder) { recorder.Clear(1.0f, 0.0f, 0.0f, 1.0f); } });
+    rhi.Clear(0.0f, 1.0f, 0.0f, 1.0f);
+    rhi.EndFrame();
+    rhi.Present();
+
+    EXPECT_EQ(ReadPixel(0, 0).g, 255);
+    EXPECT_EQ(ReadPixel(0, 0).r, 0);
+}
+
+TEST_F(RHIParallelRecordingIntegrationTest, ManyFrames_ReusesWorkerPools)
+{
+    RHI& rhi = RHI::Get();
+
+    // More tasks than workers, over more frames than frames in flight
+    for (int frame = 0; frame < 12; ++frame) {
+        rhi.BeginFrame();
+
+        std::vector<RHIRecordTask> tasks;
+        for (int i = 0; i < 16; ++i) {
+            tasks.push_back([i](RHICommandRecorder& recorder) {
+                const uint32_t stripe = recorder.GetWidth() / 16 + 1;
+                recorder.ClearRect(static_cast<int32_t>(i * stripe), 0, stripe, recorder.GetHeight(),
+                    0.0f, 0.0f, 1.0f, 1.0f);
+                });
+        }
+        rhi.RecordParallel(*m_Jobs, std::move(tasks));
+
+        rhi.EndFrame();
+        rhi.Present();
+    }
+
+    EXPECT_EQ(ReadPixel(0, 0).b, 255);
+    EXPECT_EQ(ReadPixel(m_Width - 1, m_Height - 1).b, 255);
+}
+
+TEST_F(RHIParallelRecordingIntegrationTest, ThrowingTask_IsRethrown_FrameStillCompletes)
+{
+    RHI& rhi = RHI::Get();
+    rhi.BeginFrame();
+    rhi.Clear(1.0f, 0.0f, 0.0f, 1.0f);
+
+    std::vector<RHIRecordTask> tasks;
+    tasks.push_back([](RHICommandRecorder& recorder) {
+        recorder.Clear(0.0f, 0.0f, 1.0f, 1.0f);
+        throw std::runtime_error("task failed");
+        });
+    EXPECT_THROW(rhi.RecordParallel(*m_Jobs, std::move(tasks)), std::runtime_error);
+
+    rhi.EndFrame();
+    rhi.Present();
+
+    // The failed task's commands were dropped
+    EXPECT_EQ(ReadPixel(0, 0).r, 255);
+    EXPECT_EQ(ReadPixel(0, 0).b, 0);
+}
+
+TEST_F(RHIParallelRecordingIntegrationTest, DummyFrame_SkipsTasks)
+{
+    RHI& rhi = RHI::Get();
+    m_Window->Minimize();
+    PumpWindowEvents(m_Window);
+
+    bool ran = false;
+    rhi.BeginFrame();
+    rhi.RecordParallel(*m_Jobs, { [&ran](RHICommandRecorder&) { ran = true; } });
+    rhi.EndFrame();
+    rhi.Present();
+
+    EXPECT_FALSE(ran);
+}
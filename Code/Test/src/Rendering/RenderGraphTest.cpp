@@ -0,0 +1,397 @@
+#include <gtest/gtest.h>
+#include "Rendering/RenderGraph/RenderGraph.h"
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+namespace
+{
+    const RGTextureDesc BACK_BUFFER_DESC = { 1280, 720, RGFormat::BGRA8_UNORM };
+
+    // Back buffer as the RHI hands it over: undefined contents, presented at the end
+    RGResourceHandle ImportBackBuffer(RenderGraph& graph)
+    {
+        return graph.ImportTexture("BackBuffer", BACK_BUFFER_DESC, RGAccess::None, RGAccess::Present);
+    }
+
+    RGBarrier Barrier(RGResourceHandle resource, RGAccess before, RGAccess after)
+    {
+        return RGBarrier{ resource, before, after };
+    }
+}
+
+// ============================================================================
+// Swapchain Clear / Present
+// ============================================================================
+
+TEST(RenderGraphTest, ClearPresent_BarrierPlacement)
+{
+    RenderGraph graph;
+    RGResourceHandle backBuffer = ImportBackBuffer(graph);
+
+    RGPassHandle clear = graph.AddPass("Clear", [&](RGPassBuilder& builder) {
+        builder.Write(backBuffer);
+        });
+    RGPassHandle present = graph.AddPass("Present", [&](RGPassBuilder& builder) {
+        builder.Read(backBuffer, RGAccess::Present);
+        });
+
+    graph.Compile();
+    ASSERT_TRUE(graph.IsCompiled());
+
+    EXPECT_FALSE(graph.IsPassCulled(clear));
+    EXPECT_FALSE(graph.IsPassCulled(present));
+
+    EXPECT_EQ(graph.GetPassBarriers(clear),
+        std::vector<RGBarrier>{ Barrier(backBuffer, RGAccess::None, RGAccess::ColorAttachmentWrite) });
+    EXPECT_EQ(graph.GetPassBarriers(present),
+        std::vector<RGBarrier>{ Barrier(backBuffer, RGAccess::ColorAttachmentWrite, RGAccess::Present) });
+    EXPECT_TRUE(graph.GetFinalBarriers().empty()); // Already in its final access
+
+    ASSERT_EQ(graph.GetBatches().size(), 2u);
+    EXPECT_EQ(graph.GetTransientHeapSize(), 0u);
+}
+
+TEST(RenderGraphTest, NoPresentPass_FinalBarrierTransitions)
+{
+    RenderGraph graph;
+    RGResourceHandle backBuffer = ImportBackBuffer(graph);
+
+    graph.AddPass("Clear", [&](RGPassBuilder& builder) { builder.Write(backBuffer); });
+    graph.Compile();
+
+    EXPECT_EQ(graph.GetFinalBarriers(),
+        std::vector<RGBarrier>{ Barrier(backBuffer, RGAccess::ColorAttachmentWrite, RGAccess::Present) });
+}
+
+// ============================================================================
+// Barriers and Batches
+// ============================================================================
+
+TEST(RenderGraphTest, ConsecutiveAttachmentWrites_ShareBatch)
+{
+    RenderGraph graph;
+    RGResourceHandle backBuffer = ImportBackBuffer(graph);
+
+    RGPassHandle a = graph.AddPass("A", [&](RGPassBuilder& builder) { builder.Write(backBuffer); });
+    RGPassHandle b = graph.AddPass("B", [&](RGPassBuilder& builder) { builder.Write(backBuffer); });
+    RGPassHandle c = graph.AddPass("C", [&](RGPassBuilder& builder) { builder.Write(backBuffer); });
+    graph.Compile();
+
+    EXPECT_EQ(graph.GetPassBarriers(a).size(), 1u);
+    EXPECT_TRUE(graph.GetPassBarriers(b).empty());
+    EXPECT_TRUE(graph.GetPassBarriers(c).empty());
+
+    ASSERT_EQ(graph.GetBatches().size(), 1u);
+    EXPECT_EQ(graph.GetBatches()[0], (std::vector<RGPassHandle>{ a, b, c }));
+}
+
+TEST(RenderGraphTest, ReadAfterWrite_SplitsBatch)
+{
+    RenderGraph graph;
+    RGResourceHandle backBuffer = ImportBackBuffer(graph);
+    RGResourceHandle scene;
+
+    RGPassHandle draw = graph.AddPass("Scene", [&](RGPassBuilder& builder) {
+        scene = builder.CreateTexture("Scene", { 1280, 720, RGFormat::RGBA16_FLOAT });
+        builder.Write(scene);
+        });
+    RGPassHandle tonemap = graph.AddPass("Tonemap", [&](RGPassBuilder& builder) {
+        builder.Read(scene);
+        builder.Write(backBuffer);
+        });
+    graph.Compile();
+
+    EXPECT_EQ(graph.GetPassBarriers(draw),
+        std::vector<RGBarrier>{ Barrier(scene, RGAccess::None, RGAccess::ColorAttachmentWrite) });
+    EXPECT_EQ(graph.GetPassBarriers(tonemap), (std::vector<RGBarrier>{
+        Barrier(scene, RGAccess::ColorAttachmentWrite, RGAccess::ShaderRead),
+        Barrier(backBuffer, RGAccess::None, RGAccess::ColorAttachmentWrite) }));
+
+    ASSERT_EQ(graph.GetBatches().size(), 2u);
+    EXPECT_EQ(graph.GetBatches()[0], std::vector<RGPassHandle>{ draw });
+    EXPECT_EQ(graph.GetBatches()[1], std::vector<RGPassHandle>{ tonemap });
+}
+
+TEST(RenderGraphTest, RepeatedReads_NeedNoBarrier)
+{
+    RenderGraph graph;
+    RGResourceHandle backBuffer = ImportBackBuffer(graph);
+    RGResourceHandle shadow;
+
+    graph.AddPass("Shadow", [&](RGPassBuilder& builder) {
+        shadow = builder.CreateTexture("Shadow", { 1024, 1024, RGFormat::D32_FLOAT });
+        builder.Write(shadow, RGAccess::DepthAttachmentWrite);
+        });
+    RGPassHandle first = graph.AddPass("Lighting", [&](RGPassBuilder& builder) {
+        builder.Read(shadow);
+        builder.Write(backBuffer);
+        });
+    RGPassHandle second = graph.AddPass("Fog", [&](RGPassBuilder& builder) {
+        builder.Read(shadow);
+        builder.Write(backBuffer);
+        });
+    graph.Compile();
+
+    EXPECT_EQ(graph.GetPassBarriers(first).size(), 2u);
+    EXPECT_TRUE(graph.GetPassBarriers(second).empty());
+    EXPECT_EQ(graph.GetBatches().size(), 2u);
+}
+
+TEST(RenderGraphTest, TransferWriteAfterTransferWrite_NeedsBarrier)
+{
+    RenderGraph graph;
+    RGResourceHandle target = graph.ImportTexture("Target", BACK_BUFFER_DESC,
+        RGAccess::TransferWrite, RGAccess::ShaderRead);
+
+    RGPassHandle a = graph.AddPass("CopyA", [&](RGPassBuilder& builder) {
+        builder.Write(target, RGAccess::TransferWrite);
+        });
+    RGPassHandle b = graph.AddPass("CopyB", [&](RGPassBuilder& builder) {
+        builder.Write(target, RGAccess::TransferWrite);
+        });
+    graph.Compile();
+
+    EXPECT_EQ(graph.GetPassBarriers(a),
+        std::vector<RGBarrier>{ Barrier(target, RGAccess::TransferWrite, RGAccess::TransferWrite) });
+    EXPECT_EQ(graph.GetPassBarriers(b),
+        std::vector<RGBarrier>{ Barrier(target, RGAccess::TransferWrite, RGAccess::TransferWrite) });
+    EXPECT_EQ(graph.GetFinalBarriers(),
+        std::vector<RGBarrier>{ Barrier(target, RGAccess::TransferWrite, RGAccess::ShaderRead) });
+}
+
+TEST(RenderGraphTest, ImportedInitialAccess_SkipsRedundantBarrier)
+{
+    RenderGraph graph;
+    RGResourceHandle history = graph.ImportTexture("History", BACK_BUFFER_DESC,
+        RGAccess::ShaderRead, RGAccess::ShaderRead);
+    RGResourceHandle backBuffer = ImportBackBuffer(graph);
+
+    RGPassHandle pass = graph.AddPass("Resolve", [&](RGPassBuilder& builder) {
+        builder.Read(history);
+        builder.Write(backBuffer);
+        });
+    graph.Compile();
+
+    EXPECT_EQ(graph.GetPassBarriers(pass),
+        std::vector<RGBarrier>{ Barrier(backBuffer, RGAccess::None, RGAccess::ColorAttachmentWrite) });
+}
+
+// ============================================================================
+// Culling
+// ============================================================================
+
+TEST(RenderGraphTest, UnreadTransient_IsCulled)
+{
+    RenderGraph graph;
+    RGResourceHandle backBuffer = ImportBackBuffer(graph);
+    RGResourceHandle debug;
+
+    RGPassHandle unused = graph.AddPass("Debug", [&](RGPassBuilder& builder) {
+        debug = builder.CreateTexture("Debug", { 256, 256 });
+        builder.Write(debug);
+        });
+    RGPassHandle clear = graph.AddPass("Clear", [&](RGPassBuilder& builder) { builder.Write(backBuffer); });
+    graph.Compile();
+
+    EXPECT_TRUE(graph.IsPassCulled(unused));
+    EXPECT_TRUE(graph.GetPassBarriers(unused).empty());
+    EXPECT_FALSE(graph.IsPassCulled(clear));
+    EXPECT_EQ(graph.GetExecutionOrder(), std::vector<RGPassHandle>{ clear });
+    EXPECT_EQ(graph.GetTransientAllocation(debug).size, 0u);
+    EXPECT_EQ(graph.GetTransientHeapSize(), 0u);
+}
+
+TEST(RenderGraphTest, CullingPropagates_ThroughChains)
+{
+    RenderGraph graph;
+    RGResourceHandle backBuffer = ImportBackBuffer(graph);
+    RGResourceHandle a, b;
+
+    RGPassHandle producer = graph.AddPass("Producer", [&](RGPassBuilder& builder) {
+        a = builder.CreateTexture("A", { 64, 64 });
+        builder.Write(a);
+        });
+    RGPassHandle consumer = graph.AddPass("Consumer", [&](RGPassBuilder& builder) {
+        builder.Read(a);
+        b = builder.CreateTexture("B", { 64, 64 });
+        builder.Write(b);
+        });
+    RGPassHandle clear = graph.AddPass("Clear", [&](RGPassBuilder& builder) { builder.Write(backBuffer); });
+    graph.Compile();
+
+    // B is never read, so its producer goes, and with it A's producer
+    EXPECT_TRUE(graph.IsPassCulled(consumer));
+    EXPECT_TRUE(graph.IsPassCulled(producer));
+    EXPECT_FALSE(graph.IsPassCulled(clear));
+}
+
+TEST(RenderGraphTest, SideEffects_KeepPass)
+{
+    RenderGraph graph;
+    RGResourceHandle scratch;
+
+    RGPassHandle capture = graph.AddPass("Capture", [&](RGPassBuilder& builder) {
+        scratch = builder.CreateTexture("Scratch", { 64, 64 });
+        builder.Write(scratch);
+        builder.SetSideEffects();
+        });
+    graph.Compile();
+
+    EXPECT_FALSE(graph.IsPassCulled(capture));
+}
+
+TEST(RenderGraphTest, PartialWrites_KeepEarlierWriters)
+{
+    RenderGraph graph;
+    RGResourceHandle backBuffer = ImportBackBuffer(graph);
+
+    RGPassHandle clear = graph.AddPass("Clear", [&](RGPassBuilder& builder) { builder.Write(backBuffer); });
+    RGPassHandle overlay = graph.AddPass("Overlay", [&](RGPassBuilder& builder) { builder.Write(backBuffer); });
+    graph.Compile();
+
+    EXPECT_FALSE(graph.IsPassCulled(clear));
+    EXPECT_FALSE(graph.IsPassCulled(overlay));
+}
+
+// ============================================================================
+// Transient Aliasing
+// ============================================================================
+
+TEST(RenderGraphTest, DisjointLifetimes_Alias)
+{
+    RenderGraph graph;
+    RGResourceHandle backBuffer = ImportBackBuffer(graph);
+    RGResourceHandle a, b;
+
+    graph.AddPass("WriteA", [&](RGPassBuilder& builder) {
+        a = builder.CreateTexture("A", { 512, 512 });
+        builder.Write(a);
+        });
+    graph.AddPass("ReadA", [&](RGPassBuilder& builder) {
+        builder.Read(a);
+        builder.Write(backBuffer);
+        });
+    graph.AddPass("WriteB", [&](RGPassBuilder& builder) {
+        b = builder.CreateTexture("B", { 512, 512 });
+        builder.Write(b);
+        });
+    graph.AddPass("ReadB", [&](RGPassBuilder& builder) {
+        builder.Read(b);
+        builder.Write(backBuffer);
+        });
+    graph.Compile();
+
+    const RGTransientAllocation allocA = graph.GetTransientAllocation(a);
+    const RGTransientAllocation allocB = graph.GetTransientAllocation(b);
+
+    EXPECT_EQ(allocA.size, 512u * 512u * 4u);
+    EXPECT_EQ(allocA.offset, allocB.offset);
+    EXPECT_EQ(graph.GetTransientHeapSize(), allocA.size);
+    EXPECT_EQ(graph.GetTransientBytesWithoutAliasing(), allocA.size + allocB.size);
+
+    // The aliased texture starts from discarded contents
+    const RGBarrier first = graph.GetPassBarriers(RGPassHandle{ 2 }).front();
+    EXPECT_EQ(first, Barrier(b, RGAccess::None, RGAccess::ColorAttachmentWrite));
+}
+
+TEST(RenderGraphTest, OverlappingLifetimes_DoNotAlias)
+{
+    RenderGraph graph;
+    RGResourceHandle backBuffer = ImportBackBuffer(graph);
+    RGResourceHandle a, b;
+
+    graph.AddPass("WriteA", [&](RGPassBuilder& builder) {
+        a = builder.CreateTexture("A", { 100, 100 });
+        builder.Write(a);
+        });
+    graph.AddPass("WriteB", [&](RGPassBuilder& builder) {
+        b = builder.CreateTexture("B", { 300, 300 });
+        builder.Write(b);
+        });
+    graph.AddPass("Combine", [&](RGPassBuilder& builder) {
+        builder.Read(a);
+        builder.Read(b);
+        builder.Write(backBuffer);
+        });
+    graph.Compile();
+
+    const RGTransientAllocation allocA = graph.GetTransientAllocation(a);
+    const RGTransientAllocation allocB = graph.GetTransientAllocation(b);
+
+    EXPECT_EQ(allocA.size % RenderGraph::TRANSIENT_ALIGNMENT, 0u);
+    EXPECT_EQ(allocA.offset % RenderGraph::TRANSIENT_ALIGNMENT, 0u);
+    EXPECT_TRUE(allocA.offset + allocA.size <= allocB.offset || allocB.offset + allocB.size <= allocA.offset);
+    EXPECT_EQ(graph.GetTransientHeapSize(), allocA.size + allocB.size);
+}
+
+TEST(RenderGraphTest, SmallTransient_FillsGapBetweenLargerOnes)
+{
+    RenderGraph graph;
+    RGResourceHandle backBuffer = ImportBackBuffer(graph);
+    RGResourceHandle big1, big2, small;
+
+    // big1 lives [0,1], big2 [1,3], small [2,3]: small reuses big1's bytes
+    graph.AddPass("P0", [&](RGPassBuilder& builder) {
+        big1 = builder.CreateTexture("Big1", { 1024, 1024 });
+        builder.Write(big1);
+        });
+    graph.AddPass("P1", [&](RGPassBuilder& builder) {
+        builder.Read(big1);
+        big2 = builder.CreateTexture("Big2", { 1024, 1024 });
+        builder.Write(big2);
+        });
+    graph.AddPass("P2", [&](RGPassBuilder& builder) {
+        small = builder.CreateTexture("Small", { 256, 256 });
+        builder.Write(small);
+        });
+    graph.AddPass("P3", [&](RGPassBuilder& builder) {
+        builder.Read(big2);
+        builder.Read(small);
+        builder.Write(backBuffer);
+        });
+    graph.Compile();
+
+    const uint64_t bigSize = 1024u * 1024u * 4u;
+    EXPECT_EQ(graph.GetTransientHeapSize(), 2 * bigSize);
+    EXPECT_EQ(graph.GetTransientAllocation(small).offset, graph.GetTransientAllocation(big1).offset);
+}
+
+// ============================================================================
+// Rebuilding
+// ============================================================================
+
+TEST(RenderGraphTest, AddPassAfterCompile_RequiresRecompile)
+{
+    RenderGraph graph;
+    RGResourceHandle backBuffer = ImportBackBuffer(graph);
+
+    graph.AddPass("Clear", [&](RGPassBuilder& builder) { builder.Write(backBuffer); });
+    graph.Compile();
+    EXPECT_TRUE(graph.IsCompiled());
+
+    RGPassHandle present = graph.AddPass("Present", [&](RGPassBuilder& builder) {
+        builder.Read(backBuffer, RGAccess::Present);
+        });
+    EXPECT_FALSE(graph.IsCompiled());
+
+    graph.Compile();
+    EXPECT_EQ(graph.GetPassBarriers(present).size(), 1u);
+    EXPECT_TRUE(graph.GetFinalBarriers().empty());
+}
+
+TEST(RenderGraphTest, Reset_ClearsEverything)
+{
+    RenderGraph graph;
+    RGResourceHandle backBuffer = ImportBackBuffer(graph);
+    graph.AddPass("Clear", [&](RGPassBuilder& builder) { builder.Write(backBuffer); });
+    graph.Compile();
+
+    graph.Reset();
+
+    EXPECT_FALSE(graph.IsCompiled());
+    EXPECT_EQ(graph.GetPassCount(), 0u);
+    EXPECT_EQ(graph.GetResourceCount(), 0u);
+    EXPECT_TRUE(graph.GetExecutionOrder().empty());
+}
@@ -0,0 +1,175 @@
+#include <gtest/gtest.h>
+#include "Rendering/RHI/UploadRing.h"
+#include <algorithm>
+#include <cstring>
+#include <thread>
+#include <vector>
+
+// ============================================================================
+// Helpers
+// ============================================================================
+
+namespace
+{
+    constexpr uint64_t FRAME_SIZE = 64 * 1024;
+    constexpr uint32_t FRAME_COUNT = 3;
+
+    // Host memory standing in for the mapped GPU buffer
+    class UploadRingTest : public ::testing::Test
+    {
+    protected:
+        UploadRingTest()
+            : m_Memory(FRAME_SIZE * FRAME_COUNT)
+            , m_Ring(m_Memory.data(), FRAME_SIZE, FRAME_COUNT)
+        {
+        }
+
+        std::vector<uint8_t> m_Memory;
+        UploadRing m_Ring;
+    };
+}
+
+// ============================================================================
+// Allocation
+// ============================================================================
+
+TEST_F(UploadRingTest, Allocate_IsLinearAndAligned)
+{
+    m_Ring.BeginFrame(0);
+
+    const UploadAllocation a = m_Ring.Allocate(10, 16);
+    const UploadAllocation b = m_Ring.Allocate(100, 256);
+    const UploadAllocation c = m_Ring.Allocate(4, 4);
+
+    ASSERT_TRUE(a.IsValid() && b.IsValid() && c.IsValid());
+    EXPECT_EQ(a.offset, 0u);
+    EXPECT_EQ(b.offset, 256u);
+    EXPECT_EQ(c.offset, 356u);
+    EXPECT_EQ(static_cast<uint8_t*>(b.mapped) - m_Memory.data(), 256);
+    EXPECT_EQ(m_Ring.GetUsedBytes(), 360u);
+}
+
+TEST_F(UploadRingTest, Partitions_AreDisjointPerFrame)
+{
+    for (uint32_t frame = 0; frame < FRAME_COUNT; ++frame) {
+        m_Ring.BeginFrame(frame);
+        const UploadAllocation allocation = m_Ring.Allocate(1024, 256);
+
+        ASSERT_TRUE(allocation.IsValid());
+        EXPECT_EQ(allocation.offset, frame * FRAME_SIZE);
+        EXPECT_EQ(m_Ring.GetCurrentFrame(), frame);
+    }
+}
+
+TEST_F(UploadRingTest, Alignment_AppliesToBufferOffset)
+{
+    // Partition 1 starts at 64 KiB; a 64 KiB alignment lands exactly on it
+    m_Ring.BeginFrame(1);
+    const UploadAllocation allocation = m_Ring.Allocate(16, 64 * 1024);
+
+    ASSERT_TRUE(allocation.IsValid());
+    EXPECT_EQ(allocation.offset % (64 * 1024), 0u);
+    EXPECT_EQ(allocation.offset, FRAME_SIZE);
+}
+
+TEST_F(UploadRingTest, Upload_CopiesData)
+{
+    m_Ring.BeginFrame(2);
+
+    const float data[4] = { 1.0f, 2.0f, 3.0f, 4.0f };
+    const UploadAllocation allocation = m_Ring.Upload(data, sizeof(data));
+
+    ASSERT_TRUE(allocation.IsValid());
+    EXPECT_EQ(std::memcmp(m_Memory.data() + allocation.offset, data, sizeof(data)), 0);
+}
+
+// ============================================================================
+// Overflow and Reclamation
+// ============================================================================
+
+TEST_F(UploadRingTest, FullPartition_FailsWithoutSpilling)
+{
+    m_Ring.BeginFrame(0);
+
+    ASSERT_TRUE(m_Ring.Allocate(FRAME_SIZE - 8, 16).IsValid());
+    EXPECT_FALSE(m_Ring.Allocate(16, 16).IsValid()); // Would spill into frame 1
+    EXPECT_TRUE(m_Ring.Allocate(8, 8).IsValid());    // Exactly fills the partition
+    EXPECT_FALSE(m_Ring.Allocate(1, 1).IsValid());
+
+    EXPECT_EQ(m_Ring.GetFailedAllocations(), 2u);
+    EXPECT_EQ(m_Ring.GetUsedBytes(), FRAME_SIZE);
+}
+
+TEST_F(UploadRingTest, BeginFrame_ReclaimsPartition_TracksPeak)
+{
+    m_Ring.BeginFrame(0);
+    m_Ring.Allocate(40 * 1024);
+
+    m_Ring.BeginFrame(1);
+    m_Ring.Allocate(1024);
+
+    // Frame slot 0 again: its previous frame's data is reclaimed
+    m_Ring.BeginFrame(0);
+    EXPECT_EQ(m_Ring.GetUsedBytes(), 0u);
+    EXPECT_EQ(m_Ring.GetFailedAllocations(), 0u);
+    EXPECT_EQ(m_Ring.GetPeakUsedBytes(), 40u * 1024u);
+
+    const UploadAllocation allocation = m_Ring.Allocate(60 * 1024);
+    ASSERT_TRUE(allocation.IsValid());
+    EXPECT_EQ(allocation.offset, 0u);
+    EXPECT_EQ(m_Ring.GetPeakUsedBytes(), 60u * 1024u);
+}
+
+// ============================================================================
+// Concurrency
+// ============================================================================
+
+TEST_F(UploadRingTest, ConcurrentAllocations_NeverOverlap)
+{
+    constexpr int threadCount = 8;
+    constexpr int perThread = 200;
+    constexpr uint64_t size = 24;
+
+    m_Ring.BeginFrame(1);
+
+    std::vector<std::vector<UploadAllocation>> results(threadCount);
+    std::vector<std::thread> threads;
+    for (int t = 0; t < threadCount; ++t) {
+        threads.emplace_back([this, t, &results]() {
+            for (int i = 0; i < perThread; ++i) {
+                UploadAllocation allocation = m_Ring.Allocate(size, 32);
+                if (allocation.IsValid()) {
+                    std::memset(allocation.mapped, t + 1, size);
+                    results[t].push_back(allocation);
+                }
+            }
+            });
+    }
+    for (std::thread& thread : threads) {
+        thread.join();
+    }
+
+    // 8 * 200 * 32 bytes = 50 KiB: everything fits in a 64 KiB partition
+    std::vector<UploadAllocation> all;
+    for (int t = 0; t < threadCount; ++t) {
+        EXPECT_EQ(results[t].size(), static_cast<size_t>(perThread));
+        for (const UploadAllocation& allocation : results[t]) {
+            // Nobody else wrote into this thread's ranges
+            const uint8_t* bytes = static_cast<const uint8_t*>(allocation.mapped);
+            EXPECT_TRUE(std::all_of(bytes, bytes + size, [t](uint8_t b) { return b == t + 1; }));
+            all.push_back(allocation);
+        }
+    }
+
+    std::sort(all.begin(), all.end(), [](const UploadAllocation& a, const UploadAllocation& b) {
+        return a.offset < b.offset;
+        });
+    for (size_t i = 0; i < all.size(); ++i) {
+        EXPECT_EQ(all[i].offset % 32, 0u);
+        EXPECT_GE(all[i].offset, FRAME_SIZE);
+        EXPECT_LE(all[i].offset + size, 2 * FRAME_SIZE);
+        if (i > 0) {
+            EXPECT_LE(all[i - 1].offset + size, all[i].offset);
+        }
+    }
+}
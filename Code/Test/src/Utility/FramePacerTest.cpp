@@ -0,0 +1,133 @@
+#include <gtest/gtest.h>
+#include "Utility/FramePacer.h"
+#include "Utility/PresentTimingModel.h"
+
+using namespace std::chrono_literals;
+
+// ============================================================================
+// Frame Deadlines
+// ============================================================================
+
+TEST(FramePacerTest, Unlimited_ReturnsNow)
+{
+    FramePacer pacer;
+    EXPECT_TRUE(pacer.IsUnlimited());
+    EXPECT_EQ(pacer.GetFramePeriod(), FramePacer::Clock::duration::zero());
+
+    auto now = FramePacer::Clock::now();
+    EXPECT_EQ(pacer.NextFrameDeadline(now), now);
+}
+
+TEST(FramePacerTest, FixedGrid_DoesNotAccumulateJitter)
+{
+    FramePacer pacer(100); // 10 ms period
+    ASSERT_EQ(pacer.GetFramePeriod(), 10ms);
+
+    auto start = FramePacer::Clock::now();
+    auto deadline = pacer.NextFrameDeadline(start);
+    EXPECT_EQ(deadline, start + 10ms);
+
+    // Frames finish at uneven times inside their slot; deadlines stay on the grid
+    deadline = pacer.NextFrameDeadline(start + 13ms);
+    EXPECT_EQ(deadline, start + 20ms);
+    deadline = pacer.NextFrameDeadline(start + 21ms);
+    EXPECT_EQ(deadline, start + 30ms);
+}
+
+TEST(FramePacerTest, FarBehind_ReanchorsInsteadOfCatchingUp)
+{
+    FramePacer pacer(100);
+
+    auto start = FramePacer::Clock::now();
+    pacer.NextFrameDeadline(start);
+
+    // 100 ms hitch: start the next frame now, not ten back-to-back frames
+    auto late = start + 110ms;
+    EXPECT_EQ(pacer.NextFrameDeadline(late), late);
+    EXPECT_EQ(pacer.NextFrameDeadline(late + 2ms), late + 10ms);
+}
+
+TEST(FramePacerTest, ResetAndRateChange_ReanchorGrid)
+{
+    FramePacer pacer(100);
+    auto start = FramePacer::Clock::now();
+    pacer.NextFrameDeadline(start);
+
+    pacer.Reset();
+    EXPECT_EQ(pacer.NextFrameDeadline(start + 500ms), start + 510ms);
+
+    pacer.SetTargetFrameRate(50);
+    EXPECT_EQ(pacer.GetFramePeriod(), 20ms);
+    EXPECT_EQ(pacer.NextFrameDeadline(start + 600ms), start + 620ms);
+}
+
+// ============================================================================
+// Display Sync
+// ============================================================================
+
+TEST(FramePacerTest, DisplaySynced_StartsJustBeforeVBlank)
+{
+    auto t0 = FramePacer::Clock::now();
+
+    PresentFeedback feedback;
+    feedback.frameStart = t0 - 10ms;
+    feedback.presentTime = t0 - 6ms;
+    feedback.displayTime = t0;
+    feedback.refreshInterval = 16ms;
+
+    PresentTimingModel model;
+    model.OnPresented(feedback);
+    const auto lead = model.GetLeadTime();
+
+    FramePacer pacer;
+    EXPECT_FALSE(pacer.IsDisplaySynced());
+
+    // Unlimited rate: wait for the last moment that still makes the next refresh
+    pacer.SetPresentTiming(&model);
+    ASSERT_TRUE(pacer.IsDisplaySynced());
+    EXPECT_EQ(pacer.NextFrameDeadline(t0 + 1ms), t0 + 16ms - lead);
+
+    // Rate cap below the refresh rate: grid deadline, snapped to a refresh
+    pacer.SetTargetFrameRate(30);
+    auto deadline = pacer.NextFrameDeadline(t0 + 1ms);
+    EXPECT_GE(deadline, t0 + 1ms + pacer.GetFramePeriod());
+    EXPECT_EQ(model.PredictVBlank(deadline + lead), deadline + lead);
+
+    pacer.SetPresentTiming(nullptr);
+    pacer.SetTargetFrameRate(0);
+    EXPECT_EQ(pacer.NextFrameDeadline(t0 + 1ms), t0 + 1ms);
+}
+
+TEST(FramePacerTest, DisplaySynced_CapBetweenHalfAndFullRefresh_KeepsCapRate)
+{
+    auto t0 = FramePacer::Clock::now();
+
+    PresentFeedback feedback;
+    feedback.frameStart = t0 - 6ms;
+    feedback.presentTime = t0 - 4ms;
+    feedback.displayTime = t0;
+    feedback.refreshInterval = 10ms;
+
+    PresentTimingModel model;
+    model.OnPresented(feedback);
+    const auto lead = model.GetLeadTime();
+
+    // 80 fps cap on a 100 Hz display: 12.5 ms, between one and two refreshes
+    FramePacer pacer(80);
+    pacer.SetPresentTiming(&model);
+
+    auto first = pacer.NextFrameDeadline(t0);
+    auto deadline = first;
+    for (int i = 0; i < 8; ++i)
+    {
+        auto next = pacer.NextFrameDeadline(deadline);
+        EXPECT_EQ(model.PredictVBlank(next + lead), next + lead);
+        EXPECT_GT(next, deadline);
+        deadline = next;
+    }
+
+    // 8 periods are 100 ms; snapping each deadline to whole refreshes
+    // (20 ms each) would take 160 ms
+    EXPECT_GE(deadline - first, 90ms);
+    EXPECT_LE(deadline - first, 110ms);
+}
@@ -0,0 +1,100 @@
+#include <gtest/gtest.h>
+#include "Utility/FrameTimer.h"
+#include <chrono>
+#include <iostream>
+
+using namespace std::chrono_literals;
+
+// ============================================================================
+// Delta Time / FPS
+// ============================================================================
+
+TEST(FrameTimerTest, DeltaTimeAndFps_FromFrameStarts)
+{
+    FrameTimer timer;
+    auto t = FrameTimer::Clock::now();
+
+    timer.BeginFrame(t);
+    EXPECT_FLOAT_EQ(timer.GetDeltaTime(), 0.0f);
+    timer.EndFrame(t + 4ms);
+
+    for (int i = 1; i <= 10; ++i)
+    {
+        timer.BeginFrame(t + i * 20ms);
+        timer.EndFrame(t + i * 20ms + 5ms);
+    }
+
+    EXPECT_NEAR(timer.GetDeltaTime(), 0.020f, 1e-5f);
+    EXPECT_NEAR(timer.GetFps(), 50.0f, 0.01f);
+    EXPECT_EQ(timer.GetFrameCount(), 11u);
+
+    FrameTimeStats cpu = timer.GetStats(FrameMetric::CpuFrame);
+    EXPECT_EQ(cpu.sampleCount, 11u);
+    EXPECT_NEAR(cpu.p50, 5.0f, 1e-3f);
+    EXPECT_NEAR(cpu.max, 5.0f, 1e-3f);
+}
+
+// ============================================================================
+// Percentiles
+// ============================================================================
+
+TEST(FrameTimerTest, Percentiles_CatchTailSpikes)
+{
+    FrameTimer timer;
+
+    // 100 samples: 1..100 ms
+    for (int i = 1; i <= 100; ++i)
+        timer.RecordSample(FrameMetric::PresentInterval, std::chrono::milliseconds(i));
+
+    FrameTimeStats stats = timer.GetStats(FrameMetric::PresentInterval);
+    EXPECT_EQ(stats.sampleCount, 100u);
+    // Nearest rank: the p-th percentile of 1..100 is p
+    EXPECT_FLOAT_EQ(stats.p50, 50.0f);
+    EXPECT_FLOAT_EQ(stats.p95, 95.0f);
+    EXPECT_FLOAT_EQ(stats.p99, 99.0f);
+    EXPECT_FLOAT_EQ(stats.max, 100.0f);
+    EXPECT_NEAR(stats.mean, 50.5f, 1e-3f);
+
+    // Untouched metric is empty
+    EXPECT_EQ(timer.GetStats(FrameMetric::Acquire).sampleCount, 0u);
+}
+
+TEST(FrameTimerTest, Window_KeepsOnlyRecentSamples)
+{
+    FrameTimer timer;
+
+    for (size_t i = 0; i < FrameTimer::WINDOW_SIZE; ++i)
+        timer.RecordSample(FrameMetric::GpuWait, 50ms);
+    for (size_t i = 0; i < FrameTimer::WINDOW_SIZE; ++i)
+        timer.RecordSample(FrameMetric::GpuWait, 2ms);
+
+    FrameTimeStats stats = timer.GetStats(FrameMetric::GpuWait);
+    EXPECT_EQ(stats.sampleCount, FrameTimer::WINDOW_SIZE);
+    EXPECT_NEAR(stats.p99, 2.0f, 1e-3f);
+
+    timer.Reset();
+    EXPECT_EQ(timer.GetStats(FrameMetric::GpuWait).sampleCount, 0u);
+}
+
+// ============================================================================
+// Performance Benchmark (Not a test, just for measurement)
+// ============================================================================
+
+TEST(FrameTimerTest, Benchmark_StatsQuery)
+{
+    FrameTimer timer;
+    for (size_t i = 0; i < FrameTimer::WINDOW_SIZE; ++i)
+        timer.RecordSample(FrameMetric::CpuFrame, std::chrono::microseconds(1000 + (i * 7919) % 5000));
+
+    constexpr int ITERATIONS = 2000;
+    float sink = 0.0f;
+    auto start = std::chrono::high_resolution_clock::now();
+    for (int i = 0; i < ITERATIONS; ++i)
+        sink += timer.GetStats(FrameMetric::CpuFrame).p99;
+    auto elapsed = std::chrono::high_resolution_clock::now() - start;
+
+    std::cout << "FrameTimer::GetStats (" << FrameTimer::WINDOW_SIZE << " samples): "
+              << std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count() / ITERATIONS
+              << " ns/query" << std::endl;
+    EXPECT_GT(sink, 0.0f);
+}
@@ -0,0 +1,178 @@
+#include <gtest/gtest.h>
+#include "Utility/PresentTimingModel.h"
+
+using namespace std::chrono_literals;
+
+namespace
+{
+    using Clock = PresentTimingModel::Clock;
+
+    constexpr Clock::duration REFRESH = 16ms;
+
+    PresentFeedback MakeFeedback(Clock::time_point frameStart, Clock::duration work, Clock::time_point displayTime,
+        Clock::duration refresh = REFRESH)
+    {
+        PresentFeedback feedback;
+        feedback.frameStart = frameStart;
+        feedback.presentTime = frameStart + work;
+        feedback.displayTime = displayTime;
+        feedback.refreshInterval = refresh;
+        return feedback;
+    }
+}
+
+// ============================================================================
+// Prediction
+// ============================================================================
+
+TEST(PresentTimingModelTest, NoFeedback_NoPrediction)
+{
+    PresentTimingModel model;
+    EXPECT_FALSE(model.HasPrediction());
+
+    auto now = Clock::now();
+    EXPECT_EQ(model.ScheduleFrame(now), now);
+}
+
+TEST(PresentTimingModelTest, VariableRefresh_NoPrediction)
+{
+    PresentTimingModel model;
+    auto t0 = Clock::now();
+    model.OnPresented(MakeFeedback(t0 - 10ms, 2ms, t0, Clock::duration::zero()));
+
+    EXPECT_FALSE(model.HasPrediction());
+    EXPECT_EQ(model.ScheduleFrame(t0 + 1ms), t0 + 1ms);
+}
+
+TEST(PresentTimingModelTest, PredictVBlank_StaysOnRefreshGrid)
+{
+    PresentTimingModel model;
+    auto t0 = Clock::now();
+    model.OnPresented(MakeFeedback(t0 - 10ms, 2ms, t0));
+    ASSERT_TRUE(model.HasPrediction());
+    EXPECT_EQ(model.GetRefreshInterval(), REFRESH);
+
+    EXPECT_EQ(model.PredictVBlank(t0), t0);
+    EXPECT_EQ(model.PredictVBlank(t0 + 1ms), t0 + 16ms);
+    EXPECT_EQ(model.PredictVBlank(t0 + 16ms), t0 + 16ms);
+    EXPECT_EQ(model.PredictVBlank(t0 + 40ms), t0 + 48ms);
+    EXPECT_EQ(model.PredictVBlank(t0 - 20ms), t0 - 16ms);
+}
+
+// ============================================================================
+// Scheduling
+// ============================================================================
+
+TEST(PresentTimingModelTest, ScheduleFrame_StartsLeadTimeBeforeReachableVBlank)
+{
+    PresentTimingModel model;
+    auto t0 = Clock::now();
+    model.OnPresented(MakeFeedback(t0 - 10ms, 4ms, t0));
+
+    // 4 ms of work + default margin
+    ASSERT_EQ(model.GetLeadTime(), 4ms + PresentTimingModel::DEFAULT_SAFETY_MARGIN);
+    const Clock::duration lead = model.GetLeadTime();
+
+    EXPECT_EQ(model.ScheduleFrame(t0 + 2ms), t0 + 16ms - lead);
+
+    // Too late for the t0 + 16 ms refresh: aim for the one after
+    EXPECT_EQ(model.ScheduleFrame(t0 + 12ms), t0 + 32ms - lead);
+}
+
+TEST(PresentTimingModelTest, WorkEstimate_TracksWorstRecentFrame)
+{
+    PresentTimingModel model;
+    auto t0 = Clock::now();
+    model.OnPresented(MakeFeedback(t0, 2ms, t0 + 16ms));
+    model.OnPresented(MakeFeedback(t0 + 16ms, 6ms, t0 + 32ms));
+    model.OnPresented(MakeFeedback(t0 + 32ms, 3ms, t0 + 48ms));
+
+    EXPECT_EQ(model.GetLeadTime(), 6ms + model.GetSafetyMargin());
+
+    // The slow frame ages out of the window
+    for (size_t i = 0; i < PresentTimingModel::WORK_WINDOW; ++i)
+        model.OnPresented(MakeFeedback(t0 + 64ms, 3ms, t0 + 80ms));
+    EXPECT_EQ(model.GetLeadTime(), 3ms + model.GetSafetyMargin());
+}
+
+// ============================================================================
+// Safety Margin Adaptation
+// ============================================================================
+
+TEST(PresentTimingModelTest, MissedScheduledFrame_WidensMargin)
+{
+    PresentTimingModel model;
+    auto t0 = Clock::now();
+    model.OnPresented(MakeFeedback(t0 - 10ms, 4ms, t0));
+
+    Clock::time_point start = model.ScheduleFrame(t0 + 1ms);
+    Clock::time_point target = start + model.GetLeadTime();
+
+    // Shown one refresh after the vblank it was scheduled for
+    model.OnPresented(MakeFeedback(start, 4ms, target + REFRESH));
+
+    EXPECT_EQ(model.GetMissedCount(), 1u);
+    EXPECT_EQ(model.GetSafetyMargin(), PresentTimingModel::DEFAULT_SAFETY_MARGIN + PresentTimingModel::MARGIN_STEP);
+}
+
+TEST(PresentTimingModelTest, UnscheduledLateFrames_DoNotWidenMargin)
+{
+    PresentTimingModel model;
+    auto t0 = Clock::now();
+    model.OnPresented(MakeFeedback(t0 - 10ms, 4ms, t0));
+
+    // Queued behind a full FIFO: shown several refreshes after present, never scheduled
+    model.OnPresented(MakeFeedback(t0, 2ms, t0 + 48ms));
+    model.OnPresented(MakeFeedback(t0 + 1ms, 2ms, t0 + 64ms));
+
+    EXPECT_EQ(model.GetMissedCount(), 0u);
+    EXPECT_EQ(model.GetSafetyMargin(), PresentTimingModel::DEFAULT_SAFETY_MARGIN);
+}
+
+TEST(PresentTimingModelTest, HitStreak_NarrowsMarginBackDown)
+{
+    PresentTimingModel model;
+    auto t0 = Clock::now();
+    model.OnPresented(MakeFeedback(t0 - 10ms, 4ms, t0));
+
+    Clock::time_point start = model.ScheduleFrame(t0 + 1ms);
+    model.OnPresented(MakeFeedback(start, 4ms, start + model.GetLeadTime() + REFRESH));
+    ASSERT_EQ(model.GetSafetyMargin(), PresentTimingModel::DEFAULT_SAFETY_MARGIN + PresentTimingModel::MARGIN_STEP);
+
+    Clock::time_point notBefore = start + 1ms;
+    for (uint32_t i = 0; i < PresentTimingModel::HIT_STREAK; ++i)
+    {
+        start = model.ScheduleFrame(notBefore);
+        Clock::time_point target = start + model.GetLeadTime();
+        model.OnPresented(MakeFeedback(start, 4ms, target));
+        notBefore = target + 1ms;
+    }
+
+    EXPECT_EQ(model.GetMissedCount(), 1u);
+    EXPECT_EQ(model.GetSafetyMargin(), PresentTimingModel::DEFAULT_SAFETY_MARGIN);
+}
+
+// ============================================================================
+// Statistics
+// ============================================================================
+
+TEST(PresentTimingModelTest, Statistics_CountFeedbackKinds)
+{
+    PresentTimingModel model;
+    auto t0 = Clock::now();
+
+    PresentFeedback feedback = MakeFeedback(t0, 3ms, t0 + 12ms);
+    feedback.zeroCopy = true;
+    model.OnPresented(feedback);
+    model.OnPresented(MakeFeedback(t0 + 16ms, 3ms, t0 + 32ms));
+    model.OnDiscarded();
+
+    EXPECT_EQ(model.GetPresentedCount(), 2u);
+    EXPECT_EQ(model.GetZeroCopyCount(), 1u);
+    EXPECT_EQ(model.GetDiscardedCount(), 1u);
+    EXPECT_EQ(model.GetLastDisplayLatency(), 13ms);
+
+    model.Reset();
+    EXPECT_FALSE(model.HasPrediction());
+    EXPECT_EQ(model.GetPresentedCount(), 0u);
+}
@@ -0,0 +1,108 @@
+#include <gtest/gtest.h>
+#include "Utility/SlotMap.h"
+#include <memory>
+#include <string>
+
+// ============================================================================
+// Handles
+// ============================================================================
+
+TEST(SlotMapTest, InsertAndGet)
+{
+    SlotMap<std::string> map;
+    SlotHandle a = map.Insert("a");
+    SlotHandle b = map.Insert("b");
+
+    ASSERT_EQ(map.Size(), 2u);
+    ASSERT_NE(map.Get(a), nullptr);
+    ASSERT_NE(map.Get(b), nullptr);
+    EXPECT_EQ(*map.Get(a), "a");
+    EXPECT_EQ(*map.Get(b), "b");
+    EXPECT_FALSE(map.Contains(SlotHandle{}));
+}
+
+TEST(SlotMapTest, Erase_KeepsOtherHandlesValid)
+{
+    SlotMap<int> map;
+    SlotHandle a = map.Insert(1);
+    SlotHandle b = map.Insert(2);
+    SlotHandle c = map.Insert(3);
+
+    // Erasing the first element moves the last one into its dense position
+    EXPECT_TRUE(map.Erase(a));
+    EXPECT_EQ(map.Size(), 2u);
+    EXPECT_EQ(map.Get(a), nullptr);
+    ASSERT_NE(map.Get(b), nullptr);
+    ASSERT_NE(map.Get(c), nullptr);
+    EXPECT_EQ(*map.Get(b), 2);
+    EXPECT_EQ(*map.Get(c), 3);
+
+    EXPECT_FALSE(map.Erase(a));
+}
+
+TEST(SlotMapTest, ReusedSlot_StaleHandleRejected)
+{
+    SlotMap<int> map;
+    SlotHandle a = map.Insert(1);
+    map.Erase(a);
+
+    SlotHandle b = map.Insert(2);
+    EXPECT_EQ(b.index, a.index); // Slot reused...
+    EXPECT_NE(b.generation, a.generation); // ...under a new generation
+
+    EXPECT_EQ(map.Get(a), nullptr);
+    ASSERT_NE(map.Get(b), nullptr);
+    EXPECT_EQ(*map.Get(b), 2);
+}
+
+TEST(SlotMapTest, Clear_InvalidatesAllHandles)
+{
+    SlotMap<int> map;
+    SlotHandle a = map.Insert(1);
+    SlotHandle b = map.Insert(2);
+    map.Clear();
+
+    EXPECT_TRUE(map.Empty());
+    EXPECT_FALSE(map.Contains(a));
+    EXPECT_FALSE(map.Contains(b));
+
+    SlotHandle c = map.Insert(3);
+    EXPECT_TRUE(map.Contains(c));
+    EXPECT_EQ(map.Size(), 1u);
+}
+
+// ============================================================================
+// Dense Storage
+// ============================================================================
+
+TEST(SlotMapTest, DenseIteration_VisitsLiveElementsOnly)
+{
+    SlotMap<int> map;
+    SlotHandle handles[5];
+    for (int i = 0; i < 5; ++i)
+        handles[i] = map.Insert(i);
+
+    map.Erase(handles[1]);
+    map.Erase(handles[3]);
+
+    int sum = 0;
+    for (int value : map)
+        sum += value;
+    EXPECT_EQ(sum, 0 + 2 + 4);
+
+    // HandleAt maps each dense position back to its element
+    for (size_t i = 0; i < map.Size(); ++i)
+        EXPECT_EQ(*map.Get(map.HandleAt(i)), map[i]);
+}
+
+TEST(SlotMapTest, Erase_ReleasesValue)
+{
+    SlotMap<std::shared_ptr<int>> map;
+    auto value = std::make_shared<int>(7);
+    SlotHandle a = map.Insert(value);
+    map.Insert(std::make_shared<int>(8));
+
+    EXPECT_EQ(value.use_count(), 2);
+    map.Erase(a);
+    EXPECT_EQ(value.use_count(), 1);
+}
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include "Utility/TLSFAllocator.h"
+#include <algorithm>
+#include <random>
+#include <vector>
+
+// ============================================================================
+// Allocation
+// ============================================================================
+
+TEST(TLSFAllocatorTest, Allocate_ReturnsDisjointRanges)
+{
+    TLSFAllocator allocator(1024 * 1024);
+
+    uint64_t a = 0, b = 0, c = 0;
+    ASSERT_TRUE(allocator.Allocate(1000, 1, a));
+    ASSERT_TRUE(allocator.Allocate(5000, 1, b));
+    ASSERT_TRUE(allocator.Allocate(100, 1, c));
+
+    std::vector<std::pair<uint64_t, uint64_t>> ranges = { { a, 1000 }, { b, 5000 }, { c, 100 } };
+    std::sort(ranges.begin(), ranges.end());
+    for (size_t i = 1; i < ranges.size(); ++i) {
+        EXPECT_LE(ranges[i - 1].first + ranges[i - 1].second, ranges[i].first);
+    }
+
+    EXPECT_EQ(allocator.GetUsedBytes(), 6100u);
+    EXPECT_EQ(allocator.GetAllocationCount(), 3u);
+}
+
+TEST(TLSFAllocatorTest, Alignment_IsHonoured)
+{
+    TLSFAllocator allocator(1024 * 1024);
+
+    uint64_t offset = 0;
+    ASSERT_TRUE(allocator.Allocate(3, 1, offset)); // Misalign the next free range
+
+    for (uint64_t alignment : { 16ull, 256ull, 4096ull, 65536ull }) {
+        ASSERT_TRUE(allocator.Allocate(100, alignment, offset));
+        EXPECT_EQ(offset % alignment, 0u) << "alignment " << alignment;
+    }
+}
+
+TEST(TLSFAllocatorTest, WholeRange_FitsExactly)
+{
+    TLSFAllocator allocator(1024 * 1024);
+
+    uint64_t offset = 0;
+    ASSERT_TRUE(allocator.Allocate(1024 * 1024, 256, offset));
+    EXPECT_EQ(offset, 0u);
+    EXPECT_EQ(allocator.GetFreeBytes(), 0u);
+    EXPECT_FALSE(allocator.Allocate(1, 1, offset));
+}
+
+TEST(TLSFAllocatorTest, TooLarge_Fails)
+{
+    TLSFAllocator allocator(4096);
+
+    uint64_t offset = 0;
+    EXPECT_FALSE(allocator.Allocate(4097, 1, offset));
+    EXPECT_TRUE(allocator.IsEmpty());
+}
+
+// ============================================================================
+// Free and Merge
+// ============================================================================
+
+TEST(TLSFAllocatorTest, Free_MergesNeighbours)
+{
+    TLSFAllocator allocator(64 * 1024);
+
+    uint64_t a = 0, b = 0, c = 0;
+    ASSERT_TRUE(allocator.Allocate(16 * 1024, 1, a));
+    ASSERT_TRUE(allocator.Allocate(16 * 1024, 1, b));
+    ASSERT_TRUE(allocator.Allocate(16 * 1024, 1, c));
+
+    // Free the middle, then both sides: one range again
+    allocator.Free(b);
+    allocator.Free(a);
+    allocator.Free(c);
+
+    EXPECT_TRUE(allocator.IsEmpty());
+    EXPECT_EQ(allocator.GetLargestFreeRange(), 64u * 1024u);
+
+    uint64_t whole = 0;
+    EXPECT_TRUE(allocator.Allocate(64 * 1024, 1, whole));
+}
+
+TEST(TLSFAllocatorTest, Fragmentation_ShowsInLargestFreeRange)
+{
+    TLSFAllocator allocator(64 * 1024);
+
+    std::vector<uint64_t> offsets(16);
+    for (uint64_t& offset : offsets) {
+        ASSERT_TRUE(allocator.Allocate(4 * 1024, 1, offset));
+    }
+
+    // Free every other range: half the space is free, in 4 KiB holes
+    for (size_t i = 0; i < offsets.size(); i += 2) {
+        allocator.Free(offsets[i]);
+    }
+
+    EXPECT_EQ(allocator.GetFreeBytes(), 32u * 1024u);
+    EXPECT_EQ(allocator.GetLargestFreeRange(), 4u * 1024u);
+
+    uint64_t offset = 0;
+    EXPECT_FALSE(allocator.Allocate(8 * 1024, 1, offset));
+    EXPECT_TRUE(allocator.Allocate(4 * 1024, 1, offset));
+}
+
+TEST(TLSFAllocatorTest, RandomAllocFree_NeverOverlaps)
+{
+    constexpr uint64_t size = 4 * 1024 * 1024;
+    TLSFAllocator allocator(size);
+
+    std::mt19937 rng(1234);
+    std::vector<std::pair<uint64_t, uint64_t>> live; // offset, size
+
+    for (int i = 0; i < 5000; ++i) {
+        if (!live.empty() && (rng() % 3 == 0 || live.size() > 200)) {
+            const size_t victim = rng() % live.size();
+            allocator.Free(live[victim].first);
+            live.erase(live.begin() + victim);
+            continue;
+        }
+
+        const uint64_t bytes = 1 + rng() % 40000;
+        const uint64_t alignment = uint64_t{ 1 } << (rng() % 13);
+        uint64_t offset = 0;
+        if (allocator.Allocate(bytes, alignment, offset)) {
+            ASSERT_EQ(offset % alignment, 0u);
+            ASSERT_LE(offset + bytes, size);
+            live.emplace_back(offset, bytes);
+        }
+    }
+
+    std::sort(live.begin(), live.end());
+    uint64_t used = 0;
+    for (size_t i = 0; i < live.size(); ++i) {
+        used += live[i].second;
+        if (i > 0) {
+            ASSERT_LE(live[i - 1].first + live[i - 1].second, live[i].first);
+        }
+    }
+    EXPECT_EQ(allocator.GetUsedBytes(), used);
+
+    for (const auto& [offset, bytes] : live) {
+        allocator.Free(offset);
+    }
+    EXPECT_TRUE(allocator.IsEmpty());
+    EXPECT_EQ(allocator.GetLargestFreeRange(), size);
+}
@@ -93,11 +93,26 @@ public:
         m_HasFocus = false;
     }
 
+    void SetCursorMode(CursorMode mode) { m_CursorMode = mode; }
+    CursorMode GetCursorMode() const { return m_CursorMode; }
+
+    // === Surface Scale ===
+    SurfaceScale GetSurfaceScale() const { return m_SurfaceScale; }
+
+    void SetRenderScale(float scale)
+    {
+        m_SurfaceScale.renderScale = SurfaceScale::ClampRenderScale(scale);
+        // Simulate the platform: buffer size changed, same logical size
+        DispatchEvent(std::make_shared<WindowResizeEvent>(m_Width, m_Height));
+    }
+
     // Expose mutable access for tests
     InputFrame& MutableThisFrameInput() { return m_InputFrame; }
 
     bool m_HasFocus = true;
     InputFrame m_InputFrame;
+    CursorMode m_CursorMode = CursorMode::Normal;
+    SurfaceScale m_SurfaceScale;
 };
 
 // Define the Window type using our Mock Platform
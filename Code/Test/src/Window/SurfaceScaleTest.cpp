@@ -0,0 +1,88 @@
+#include <gtest/gtest.h>
+#include <cmath>
+#include <memory>
+
+#include "Window/Window.h"
+#include "Window/SurfaceScale.h"
+#include "Window/MockWindowPlatform.h"
+
+// ============================================================================
+// Buffer Extent
+// ============================================================================
+
+TEST(SurfaceScaleTest, Default_BufferMatchesLogicalSize)
+{
+    SurfaceScale scale;
+    EXPECT_FLOAT_EQ(scale.GetDisplayScale(), 1.0f);
+    EXPECT_EQ(scale.ToBuffer(1280, 720), (SurfaceExtent{ 1280, 720 }));
+}
+
+TEST(SurfaceScaleTest, FractionalDisplayScale_RoundsHalfAwayFromZero)
+{
+    SurfaceScale scale;
+    scale.displayScale = 150; // 1.25
+
+    EXPECT_FLOAT_EQ(scale.GetDisplayScale(), 1.25f);
+    EXPECT_EQ(scale.ToBuffer(1280, 720), (SurfaceExtent{ 1600, 900 }));
+    EXPECT_EQ(scale.ToBuffer(1001, 3), (SurfaceExtent{ 1251, 4 })); // 1251.25, 3.75
+
+    scale.displayScale = 180; // 1.5
+    EXPECT_EQ(scale.ToBuffer(5, 7), (SurfaceExtent{ 8, 11 }));      // 7.5, 10.5
+}
+
+TEST(SurfaceScaleTest, RenderScale_CombinesWithDisplayScale)
+{
+    SurfaceScale scale;
+    scale.displayScale = 240; // 2.0
+    scale.renderScale = 0.5f;
+
+    EXPECT_EQ(scale.ToBuffer(1920, 1080), (SurfaceExtent{ 1920, 1080 }));
+
+    scale.displayScale = SurfaceScale::SCALE_DENOMINATOR;
+    scale.renderScale = 0.75f;
+    EXPECT_EQ(scale.ToBuffer(1920, 1080), (SurfaceExtent{ 1440, 810 }));
+}
+
+TEST(SurfaceScaleTest, EmptyLogicalSize_EmptyBuffer_TinyStaysNonEmpty)
+{
+    SurfaceScale scale;
+    scale.renderScale = SurfaceScale::MIN_RENDER_SCALE;
+
+    EXPECT_EQ(scale.ToBuffer(0, 600), SurfaceExtent{});
+    EXPECT_EQ(scale.ToBuffer(800, -1), SurfaceExtent{});
+    EXPECT_EQ(scale.ToBuffer(1, 1), (SurfaceExtent{ 1, 1 }));
+}
+
+TEST(SurfaceScaleTest, ClampRenderScale_RejectsOutOfRange)
+{
+    EXPECT_FLOAT_EQ(SurfaceScale::ClampRenderScale(0.6f), 0.6f);
+    EXPECT_FLOAT_EQ(SurfaceScale::ClampRenderScale(0.01f), SurfaceScale::MIN_RENDER_SCALE);
+    EXPECT_FLOAT_EQ(SurfaceScale::ClampRenderScale(8.0f), SurfaceScale::MAX_RENDER_SCALE);
+    EXPECT_FLOAT_EQ(SurfaceScale::ClampRenderScale(0.0f), 1.0f);
+    EXPECT_FLOAT_EQ(SurfaceScale::ClampRenderScale(-2.0f), 1.0f);
+    EXPECT_FLOAT_EQ(SurfaceScale::ClampRenderScale(std::nanf("")), 1.0f);
+}
+
+// ============================================================================
+// Window Integration
+// ============================================================================
+
+TEST(SurfaceScaleTest, Window_SetRenderScaleResizesBuffer)
+{
+    auto platform = std::make_unique<MockWindowPlatform>("ScaledWindow", 1000, 500);
+    auto* mock = platform.get();
+    auto window = std::make_shared<TestWindow>(std::move(platform));
+
+    mock->m_SurfaceScale.displayScale = 180; // 1.5
+    EXPECT_EQ(window->GetBufferExtent(), (SurfaceExtent{ 1500, 750 }));
+
+    window->SetRenderScale(0.5f);
+    window->Update();
+
+    EXPECT_EQ(window->GetBufferExtent(), (SurfaceExtent{ 750, 375 }));
+    EXPECT_EQ(window->GetWidth(), 1000);
+    EXPECT_FLOAT_EQ(window->GetSurfaceScale().renderScale, 0.5f);
+
+    window->Destroy();
+    EXPECT_EQ(window->GetBufferExtent(), SurfaceExtent{});
+}
@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+#include <atomic>
+#include <memory>
+#include <thread>
+
+#include "Window/Window.h"
+#include "Window/WindowState.h"
+#include "Window/MockWindowPlatform.h"
+
+// ============================================================================
+// Publishing Mock
+// ============================================================================
+
+/**
+ * MockWindowPlatform that publishes its state like the real platforms,
+ * so WindowT takes the wait-free path.
+ */
+class PublishingMockWindowPlatform : public MockWindowPlatform
+{
+public:
+    using MockWindowPlatform::MockWindowPlatform;
+
+    void BindStateSnapshot(WindowStateSnapshot* snapshot)
+    {
+        m_Snapshot = snapshot;
+        Publish();
+    }
+
+    void Show() { MockWindowPlatform::Show(); Publish(); }
+    void Hide() { MockWindowPlatform::Hide(); Publish(); }
+    void Resize(int32_t width, int32_t height) { MockWindowPlatform::Resize(width, height); Publish(); }
+    void Minimize() { MockWindowPlatform::Minimize(); Publish(); }
+    void Restore() { MockWindowPlatform::Restore(); Publish(); }
+
+    WindowStateSnapshot* m_Snapshot = nullptr;
+
+private:
+    void Publish()
+    {
+        if (!m_Snapshot) return;
+
+        uint8_t flags = 0;
+        if (m_IsVisible) flags |= WINDOW_STATE_VISIBLE;
+        if (m_IsMinimized) flags |= WINDOW_STATE_MINIMIZED;
+        m_Snapshot->Publish(m_Width, m_Height, flags);
+    }
+};
+
+using PublishingTestWindow = WindowT<PublishingMockWindowPlatform>;
+
+// ============================================================================
+// Snapshot
+// ============================================================================
+
+TEST(WindowStateTest, PackUnpack_RoundTrips)
+{
+    uint64_t packed = WindowStateSnapshot::Pack(1920, 1080, WINDOW_STATE_VISIBLE | WINDOW_STATE_MAXIMIZED, 42);
+    WindowState state = WindowStateSnapshot::Unpack(packed);
+
+    EXPECT_EQ(state.width, 1920);
+    EXPECT_EQ(state.height, 1080);
+    EXPECT_EQ(state.generation, 42u);
+    EXPECT_TRUE(state.IsVisible());
+    EXPECT_TRUE(state.IsMaximized());
+    EXPECT_FALSE(state.IsMinimized());
+    EXPECT_FALSE(state.IsClosed());
+}
+
+TEST(WindowStateTest, Pack_ClampsExtents)
+{
+    WindowState state = WindowStateSnapshot::Unpack(WindowStateSnapshot::Pack(-5, 100000, 0, 0));
+    EXPECT_EQ(state.width, 0);
+    EXPECT_EQ(state.height, WindowStateSnapshot::MAX_EXTENT);
+}
+
+TEST(WindowStateTest, Publish_BumpsGeneration)
+{
+    WindowStateSnapshot snapshot;
+    EXPECT_EQ(snapshot.Load().generation, 0u);
+
+    snapshot.Publish(800, 600, WINDOW_STATE_VISIBLE);
+    snapshot.Publish(800, 600, WINDOW_STATE_VISIBLE);
+
+    WindowState state = snapshot.Load();
+    EXPECT_EQ(state.generation, 2u);
+    EXPECT_TRUE(state.IsRenderable());
+}
+
+TEST(WindowStateTest, IsRenderable_RequiresVisibleNonEmptyWindow)
+{
+    WindowState state;
+    state.width = 800;
+    state.height = 600;
+    EXPECT_FALSE(state.IsRenderable());
+
+    state.flags = WINDOW_STATE_VISIBLE;
+    EXPECT_TRUE(state.IsRenderable());
+
+    state.flags = WINDOW_STATE_VISIBLE | WINDOW_STATE_MINIMIZED;
+    EXPECT_FALSE(state.IsRenderable());
+
+    state.flags = WINDOW_STATE_VISIBLE;
+    state.height = 0;
+    EXPECT_FALSE(state.IsRenderable());
+}
+
+TEST(WindowStateTest, ConcurrentReader_NeverSeesTornState)
+{
+    WindowStateSnapshot snapshot;
+    std::atomic<bool> done{ false };
+    std::atomic<int> torn{ 0 };
+
+    // Writer always publishes width == height; visible iff the size is even
+    std::thread reader([&]() {
+        while (!done.load(std::memory_order_acquire))
+        {
+            WindowState state = snapshot.Load();
+            bool evenSize = (state.width % 2) == 0;
+            if (state.width != state.height || (state.generation != 0 && state.IsVisible() != evenSize))
+                torn.fetch_add(1, std::memory_order_relaxed);
+        }
+        });
+
+    for (int32_t i = 1; i <= 100000; ++i)
+        snapshot.Publish(i % 4096, i % 4096, ((i % 4096) % 2) == 0 ? WINDOW_STATE_VISIBLE : 0);
+
+    done.store(true, std::memory_order_release);
+    reader.join();
+
+    EXPECT_EQ(torn.load(), 0);
+}
+
+// ============================================================================
+// WindowT Integration
+// ============================================================================
+
+TEST(WindowStateTest, Window_ReadsPublishedState)
+{
+    auto platform = std::make_unique<PublishingMockWindowPlatform>("StateWindow", 800, 600);
+    auto* mock = platform.get();
+    auto window = std::make_shared<PublishingTestWindow>(std::move(platform));
+
+    ASSERT_NE(mock->m_Snapshot, nullptr);
+
+    EXPECT_EQ(window->GetWidth(), 800);
+    EXPECT_EQ(window->GetHeight(), 600);
+    EXPECT_FALSE(window->IsVisible());
+
+    const uint32_t generation = window->GetState().generation;
+    window->Show();
+    window->Resize(1024, 768);
+
+    WindowState state = window->GetState();
+    EXPECT_TRUE(state.IsVisible());
+    EXPECT_EQ(state.width, 1024);
+    EXPECT_EQ(state.height, 768);
+    EXPECT_NE(state.generation, generation);
+}
+
+TEST(WindowStateTest, Window_DestroyPublishesClosedAndUnbinds)
+{
+    auto platform = std::make_unique<PublishingMockWindowPlatform>("StateWindow", 800, 600);
+    auto window = std::make_shared<PublishingTestWindow>(std::move(platform));
+    window->Show();
+
+    window->Destroy();
+
+    WindowState state = window->GetState();
+    EXPECT_TRUE(state.IsClosed());
+    EXPECT_TRUE(window->IsClosed());
+    EXPECT_FALSE(window->IsVisible());
+    EXPECT_EQ(window->GetWidth(), 0);
+    EXPECT_FALSE(state.IsRenderable());
+}
+
+TEST(WindowStateTest, Window_NonPublishingPlatformFallsBack)
+{
+    auto platform = std::make_unique<MockWindowPlatform>("LockedWindow", 640, 480);
+    auto* mock = platform.get();
+    auto window = std::make_shared<TestWindow>(std::move(platform));
+
+    mock->m_IsVisible = true;
+    mock->m_Width = 320;
+
+    WindowState state = window->GetState();
+    EXPECT_TRUE(state.IsVisible());
+    EXPECT_EQ(state.width, 320);
+    EXPECT_EQ(state.height, 480);
+
+    window->Destroy();
+    EXPECT_TRUE(window->GetState().IsClosed());
+    EXPECT_FALSE(window->IsVisible());
+}